@@ -307,6 +307,9 @@ Constellation::Config BuildConstellationConfig(Settings const &settings)
   cfg.kademlia_routing      = settings.kademlia_routing.value();
   cfg.persistent_tx_status  = settings.persistent_status.value();
   cfg.proof_of_stake        = settings.proof_of_stake.value();
+  cfg.erasure_coded_rbc     = settings.erasure_coded_rbc.value();
+  cfg.weighted_cabinet_from = settings.weighted_cabinet_from.value();
+  cfg.corrected_uint_from   = settings.corrected_uint_from.value();
   cfg.network_mode          = GetNetworkMode(settings);
   cfg.features              = settings.experimental_features.value();
   cfg.enable_agents         = settings.enable_agents.value();
@@ -24,6 +24,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <ostream>
 #include <thread>
 
@@ -43,6 +44,12 @@ const uint32_t DEFAULT_MAX_PEERS          = 3;
 const uint32_t DEFAULT_TRANSIENT_PEERS    = 1;
 const uint32_t NUM_SYSTEM_THREADS = static_cast<uint32_t>(std::thread::hardware_concurrency());
 
+// weighted cabinet selection is not activated unless a network chooses a block to start from
+const uint64_t DEFAULT_WEIGHTED_CABINET = std::numeric_limits<uint64_t>::max();
+
+// neither is the corrected UInt256 arithmetic of smart contracts
+const uint64_t DEFAULT_CORRECTED_UINT = std::numeric_limits<uint64_t>::max();
+
 }  // namespace
 
 // clang-format off
@@ -81,6 +88,9 @@ Settings::Settings()
   , max_cabinet_size      {*this, "max-cabinet-size",        DEFAULT_CABINET_SIZE,         "Maximum cabinet size"}
   , stake_delay_period    {*this, "stake-delay-period",      DEFAULT_STAKE_DELAY_PERIOD,   "<deprecated>"}
   , aeon_period           {*this, "aeon-period",             DEFAULT_AEON_PERIOD,          "Number of blocks each cabinet is governing"}
+  , erasure_coded_rbc     {*this, "erasure-coded-rbc",       false,                        "Disperse erasure coded fragments of the DKG messages instead of full copies"}
+  , weighted_cabinet_from {*this, "weighted-cabinet-from",   DEFAULT_WEIGHTED_CABINET,     "First block whose cabinet is selected by weighted sampling (default: never)"}
+  , corrected_uint_from   {*this, "corrected-uint-from",     DEFAULT_CORRECTED_UINT,       "First block whose contracts use the corrected UInt256 arithmetic (default: never)"}
   , graceful_failure      {*this, "graceful-failure",        false,                        "Whether to shutdown on critical system failures"}
   , fault_tolerant        {*this, "fault-tolerant",          false,                        "Whether to crash on critical system failures"}
   , enable_agents         {*this, "enable-agents",           false,                        "Run the node with agent support"}
@@ -113,6 +113,13 @@ public:
   settings::Setting<uint64_t> max_cabinet_size;
   settings::Setting<uint64_t> stake_delay_period;
   settings::Setting<uint64_t> aeon_period;
+  settings::Setting<bool>     erasure_coded_rbc;
+  settings::Setting<uint64_t> weighted_cabinet_from;
+  /// @}
+
+  /// @name Smart Contracts
+  /// @{
+  settings::Setting<uint64_t> corrected_uint_from;
   /// @}
 
   /// @name Error handling
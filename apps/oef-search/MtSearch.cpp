@@ -125,8 +125,10 @@ int MtSearch::run()
   FETCH_LOG_INFO(LOGGING_NAME, "tasks_thread_count: ", config_.tasks_thread_count());
   FETCH_LOG_INFO(LOGGING_NAME, "Search config: ", config_.DebugString());
 
+  auto const tasks_thread_count = std::max(config_.tasks_thread_count(), minimum_thread_count);
+
   core    = std::make_shared<Core>();
-  auto ts = std::make_shared<fetch::oef::base::Taskpool>();
+  auto ts = std::make_shared<fetch::oef::base::Taskpool>(tasks_thread_count);
   ts->SetDefault();
   outbounds = std::make_shared<OutboundConversations>();
   listeners =
@@ -157,7 +159,7 @@ int MtSearch::run()
       std::bind(&fetch::oef::base::Taskpool::run, tasks.get(), _1);
 
   comms_runners.start(std::max(config_.comms_thread_count(), minimum_thread_count), run_comms);
-  tasks_runners.start(std::max(config_.tasks_thread_count(), minimum_thread_count), run_tasks);
+  tasks_runners.start(tasks_thread_count, run_tasks);
 
   startListeners();
 
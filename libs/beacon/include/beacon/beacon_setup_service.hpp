@@ -25,6 +25,7 @@
 #include "dkg/dkg_messages.hpp"
 #include "moment/clocks.hpp"
 #include "moment/deadline_timer.hpp"
+#include "muddle/erasure_coded_rbc.hpp"
 #include "muddle/muddle_endpoint.hpp"
 #include "muddle/punishment_broadcast_channel.hpp"
 #include "muddle/rbc.hpp"
@@ -78,6 +79,13 @@ public:
     BEACON_READY
   };
 
+  /// The reliable broadcast channel used to distribute the DKG messages
+  enum class BroadcastProtocol : uint8_t
+  {
+    RBC,               ///< Every member receives the full message from the broadcaster
+    ERASURE_CODED_RBC  ///< Members receive coded fragments and relay them to each other
+  };
+
   using ConstByteArray  = byte_array::ConstByteArray;
   using StateMachine    = core::StateMachine<State>;
   using StateMachinePtr = std::shared_ptr<StateMachine>;
@@ -121,7 +129,8 @@ public:
   using NotarisationCallbackFunction = std::function<void(SharedNotarisationManager)>;
 
   BeaconSetupService(MuddleInterface &muddle, ManifestCacheInterface &manifest_cache,
-                     CertificatePtr certificate);
+                     CertificatePtr    certificate,
+                     BroadcastProtocol broadcast_protocol = BroadcastProtocol::RBC);
   BeaconSetupService(BeaconSetupService const &) = delete;
   BeaconSetupService(BeaconSetupService &&)      = delete;
   virtual ~BeaconSetupService()                  = default;
@@ -254,7 +263,7 @@ private:
   std::string NodeString();
 
   // Convenience functions
-  ReliableChannelPtr ReliableBroadcastFactory();
+  ReliableChannelPtr ReliableBroadcastFactory(BroadcastProtocol broadcast_protocol);
 
   /// @name Handlers for messages
   /// @{
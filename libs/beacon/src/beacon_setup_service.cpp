@@ -40,9 +40,9 @@ using shards::ServiceIdentifier;
 char const *ToString(BeaconSetupService::State state);
 
 // Convenience factory to set up the RBC/PBC
-BeaconSetupService::ReliableChannelPtr BeaconSetupService::ReliableBroadcastFactory()
+BeaconSetupService::ReliableChannelPtr BeaconSetupService::ReliableBroadcastFactory(
+    BroadcastProtocol broadcast_protocol)
 {
-  using ChannelType = muddle::RBC;
   // using ChannelType = PunishmentBroadcastChannel; // The other option
 
   auto call_on_msg = [this](MuddleAddress const &from, ConstByteArray const &payload) -> void {
@@ -52,8 +52,15 @@ BeaconSetupService::ReliableChannelPtr BeaconSetupService::ReliableBroadcastFact
     OnDkgMessage(from, env.Message());
   };
 
-  return std::make_unique<ChannelType>(endpoint_, identity_.identifier(), call_on_msg, certificate_,
-                                       CHANNEL_RBC_BROADCAST, false);
+  if (broadcast_protocol == BroadcastProtocol::ERASURE_CODED_RBC)
+  {
+    return std::make_unique<muddle::ErasureCodedRBC>(endpoint_, identity_.identifier(),
+                                                     call_on_msg, certificate_,
+                                                     CHANNEL_RBC_ERASURE_CODED, false);
+  }
+
+  return std::make_unique<muddle::RBC>(endpoint_, identity_.identifier(), call_on_msg,
+                                       certificate_, CHANNEL_RBC_BROADCAST, false);
 }
 
 /**
@@ -75,14 +82,15 @@ std::string BeaconSetupService::NodeString()
 
 BeaconSetupService::BeaconSetupService(MuddleInterface &       muddle,
                                        ManifestCacheInterface &manifest_cache,
-                                       CertificatePtr          certificate)
+                                       CertificatePtr          certificate,
+                                       BroadcastProtocol       broadcast_protocol)
   : identity_{certificate->identity()}
   , manifest_cache_{manifest_cache}
   , muddle_{muddle}
   , endpoint_{muddle_.GetEndpoint()}
   , shares_subscription_(endpoint_.Subscribe(SERVICE_DKG, CHANNEL_SECRET_KEY))
   , certificate_{std::move(certificate)}
-  , rbc_{ReliableBroadcastFactory()}
+  , rbc_{ReliableBroadcastFactory(broadcast_protocol)}
   , state_machine_{std::make_shared<StateMachine>("BeaconSetupService", State::IDLE, ToString)}
   , beacon_dkg_state_gauge_{telemetry::Registry::Instance().CreateGauge<uint64_t>(
         "beacon_dkg_state_gauge", "State the DKG is in as integer in [0, 10]")}
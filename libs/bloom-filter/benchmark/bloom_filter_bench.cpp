@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "bloom_filter/blocked_bloom_filter.hpp"
+#include "bloom_filter/bloom_filter.hpp"
+#include "core/byte_array/byte_array.hpp"
+#include "core/byte_array/const_byte_array.hpp"
+#include "core/random/lcg.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using fetch::BasicBloomFilter;
+using fetch::BlockedBloomFilter;
+using fetch::byte_array::ByteArray;
+using fetch::byte_array::ConstByteArray;
+using RNG = fetch::random::LinearCongruentialGenerator;
+
+namespace {
+
+// roughly the number of transactions held in the filter and in a single block
+constexpr std::size_t NUM_ADDED_DIGESTS = 100000;
+constexpr std::size_t NUM_BLOCK_DIGESTS = 2000;
+
+RNG rng;
+
+std::vector<ConstByteArray> GenerateDigests(std::size_t count)
+{
+  std::vector<ConstByteArray> digests;
+  digests.reserve(count);
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    ByteArray digest;
+    digest.Resize(BlockedBloomFilter::DIGEST_SIZE);
+
+    for (std::size_t j = 0; j < digest.size(); ++j)
+    {
+      digest[j] = static_cast<uint8_t>(rng() >> 19u);
+    }
+
+    digests.emplace_back(digest);
+  }
+
+  return digests;
+}
+
+template <typename Filter>
+void FillFilter(Filter &filter)
+{
+  for (auto const &digest : GenerateDigests(NUM_ADDED_DIGESTS))
+  {
+    filter.Add(digest);
+  }
+}
+
+template <typename Filter>
+void BloomFilter_MatchBlock(benchmark::State &state)
+{
+  Filter filter;
+  FillFilter(filter);
+
+  // half of the block has been seen before
+  auto       block = GenerateDigests(NUM_BLOCK_DIGESTS / 2);
+  auto const seen  = GenerateDigests(NUM_BLOCK_DIGESTS / 2);
+  for (auto const &digest : seen)
+  {
+    filter.Add(digest);
+    block.push_back(digest);
+  }
+
+  for (auto _ : state)
+  {
+    std::size_t positives{0};
+    for (auto const &digest : block)
+    {
+      positives += static_cast<std::size_t>(filter.Match(digest).first);
+    }
+    benchmark::DoNotOptimize(positives);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * block.size()));
+}
+
+void BloomFilter_MatchBlockBatch(benchmark::State &state)
+{
+  BlockedBloomFilter filter;
+  FillFilter(filter);
+
+  auto       block = GenerateDigests(NUM_BLOCK_DIGESTS / 2);
+  auto const seen  = GenerateDigests(NUM_BLOCK_DIGESTS / 2);
+  for (auto const &digest : seen)
+  {
+    filter.Add(digest);
+    block.push_back(digest);
+  }
+
+  BlockedBloomFilter::MatchResults results{};
+  for (auto _ : state)
+  {
+    filter.MatchBatch(block, results);
+    benchmark::DoNotOptimize(results.data());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * block.size()));
+}
+
+template <typename Filter>
+void BloomFilter_FalsePositiveRate(benchmark::State &state)
+{
+  Filter filter;
+  FillFilter(filter);
+
+  auto const unseen = GenerateDigests(NUM_ADDED_DIGESTS);
+
+  std::size_t false_positives{0};
+  for (auto _ : state)
+  {
+    false_positives = 0;
+    for (auto const &digest : unseen)
+    {
+      false_positives += static_cast<std::size_t>(filter.Match(digest).first);
+    }
+    benchmark::DoNotOptimize(false_positives);
+  }
+
+  state.counters["false_positive_rate"] =
+      static_cast<double>(false_positives) / static_cast<double>(unseen.size());
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BloomFilter_MatchBlock, BasicBloomFilter);
+BENCHMARK_TEMPLATE(BloomFilter_MatchBlock, BlockedBloomFilter);
+BENCHMARK(BloomFilter_MatchBlockBatch);
+BENCHMARK_TEMPLATE(BloomFilter_FalsePositiveRate, BasicBloomFilter);
+BENCHMARK_TEMPLATE(BloomFilter_FalsePositiveRate, BlockedBloomFilter);
@@ -0,0 +1,136 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/bitvector.hpp"
+#include "core/byte_array/const_byte_array.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace fetch {
+
+/*
+ * A Bloom filter which places all of the bits of an element inside a single 64 byte block (one
+ * cache line), setting one bit in each of the block's eight 64 bit words.
+ *
+ * Elements which are the size of a digest are assumed to be uniformly distributed already and
+ * their bytes are used directly to select the block and the bits. Elements of any other size are
+ * hashed first. Neither path allocates, so queries cost a single cache line access.
+ */
+class BlockedBloomFilter
+{
+public:
+  using ConstByteArray = byte_array::ConstByteArray;
+  using Elements       = std::vector<ConstByteArray>;
+  using MatchResults   = std::vector<uint8_t>;
+
+  static constexpr std::size_t WORDS_PER_BLOCK  = 8;
+  static constexpr std::size_t BITS_PER_ELEMENT = WORDS_PER_BLOCK;
+  static constexpr std::size_t NUM_BLOCKS       = 1u << 14u;
+  static constexpr std::size_t SIZE_IN_BITS     = NUM_BLOCKS * WORDS_PER_BLOCK * 64u;
+  static constexpr std::size_t DIGEST_SIZE      = 32;
+
+  /*
+   * Construct a filter of the same size as the BasicBloomFilter (1 MiB)
+   */
+  BlockedBloomFilter();
+  BlockedBloomFilter(BlockedBloomFilter const &) = delete;
+  BlockedBloomFilter(BlockedBloomFilter &&)      = delete;
+  ~BlockedBloomFilter()                          = default;
+
+  BlockedBloomFilter &operator=(BlockedBloomFilter const &) = delete;
+  BlockedBloomFilter &operator=(BlockedBloomFilter &&) = delete;
+
+  /*
+   * Check if the argument matches the Bloom filter. Returns a pair of a Boolean (false if the
+   * element had never been added; true if the argument had been added or is a false positive) and
+   * the number of bits which were checked, which is always BITS_PER_ELEMENT.
+   */
+  std::pair<bool, std::size_t> Match(ConstByteArray const &element) const;
+
+  /*
+   * Check a number of elements at once. Each entry of results is set to 1 if the corresponding
+   * element matches the filter and 0 otherwise. The blocks of a group of elements are fetched
+   * together so that their memory accesses overlap.
+   */
+  void MatchBatch(Elements const &elements, MatchResults &results) const;
+
+  /*
+   * Set the bits of the Bloom filter corresponding to the argument
+   */
+  void Add(ConstByteArray const &element);
+
+  /*
+   * Empty the Bloom filter (set all bits to zero). Preserves filter size.
+   */
+  void Reset();
+
+private:
+  struct Position
+  {
+    std::size_t block{0};  ///< Index of the block holding the element's bits
+    uint64_t    bits{0};   ///< Six bits for each word of the block, lowest word first
+  };
+
+  static Position Locate(ConstByteArray const &element);
+
+  bool IsSet(Position const &position) const;
+
+  BitVector bits_;
+
+  template <typename, typename>
+  friend struct fetch::serializers::MapSerializer;
+};
+
+namespace serializers {
+
+template <typename D>
+struct MapSerializer<BlockedBloomFilter, D>
+{
+public:
+  using Type       = BlockedBloomFilter;
+  using DriverType = D;
+
+  // deliberately different to the BasicBloomFilter key, the bit layouts are not compatible
+  static const uint8_t BLOCKS = 2;
+
+  template <typename T>
+  static void Serialize(T &map_constructor, Type const &filter)
+  {
+    auto map = map_constructor(1);
+    map.Append(BLOCKS, filter.bits_);
+  }
+
+  template <typename T>
+  static void Deserialize(T &map, Type &filter)
+  {
+    map.ExpectKeyGetValue(BLOCKS, filter.bits_);
+
+    if (filter.bits_.size() != Type::SIZE_IN_BITS)
+    {
+      throw std::runtime_error("Unexpected size of blocked Bloom filter");
+    }
+  }
+};
+
+}  // namespace serializers
+}  // namespace fetch
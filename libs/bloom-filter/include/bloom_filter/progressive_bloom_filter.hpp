@@ -17,13 +17,14 @@
 //
 //------------------------------------------------------------------------------
 
-#include "bloom_filter/bloom_filter.hpp"
+#include "bloom_filter/blocked_bloom_filter.hpp"
 
 #include <cstddef>
 #include <istream>
 #include <memory>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 namespace fetch {
 
@@ -34,6 +35,10 @@ class ConstByteArray;
 class ProgressiveBloomFilter
 {
 public:
+  using Elements       = BlockedBloomFilter::Elements;
+  using ElementIndices = std::vector<std::size_t>;
+  using MatchResults   = BlockedBloomFilter::MatchResults;
+
   explicit ProgressiveBloomFilter(uint64_t overlap);
   ProgressiveBloomFilter(ProgressiveBloomFilter const &) = delete;
   ProgressiveBloomFilter(ProgressiveBloomFilter &&)      = delete;
@@ -44,6 +49,8 @@ public:
 
   std::pair<bool, std::size_t> Match(fetch::byte_array::ConstByteArray const &element,
                                      std::size_t                              element_index) const;
+  void MatchBatch(Elements const &elements, ElementIndices const &element_indices,
+                  MatchResults &results) const;
   void Add(fetch::byte_array::ConstByteArray const &element, std::size_t element_index,
            std::size_t current_head_index);
 
@@ -52,10 +59,10 @@ public:
 private:
   bool IsInCurrentRange(std::size_t index) const;
 
-  uint64_t                          current_min_index_{};
-  uint64_t                          overlap_;
-  std::unique_ptr<BasicBloomFilter> filter1_{std::make_unique<BasicBloomFilter>()};
-  std::unique_ptr<BasicBloomFilter> filter2_{std::make_unique<BasicBloomFilter>()};
+  uint64_t                            current_min_index_{};
+  uint64_t                            overlap_;
+  std::unique_ptr<BlockedBloomFilter> filter1_{std::make_unique<BlockedBloomFilter>()};
+  std::unique_ptr<BlockedBloomFilter> filter2_{std::make_unique<BlockedBloomFilter>()};
 
   template <typename, typename>
   friend struct fetch::serializers::MapSerializer;
@@ -0,0 +1,179 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "bloom_filter/blocked_bloom_filter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace fetch {
+namespace {
+
+constexpr std::size_t BLOCK_MASK       = BlockedBloomFilter::NUM_BLOCKS - 1u;
+constexpr std::size_t BITS_PER_WORD    = 64u;
+constexpr std::size_t BATCH_GROUP_SIZE = 16u;
+constexpr uint64_t    BIT_INDEX_MASK   = BITS_PER_WORD - 1u;
+constexpr uint64_t    BIT_INDEX_WIDTH  = 6u;
+
+static_assert((BlockedBloomFilter::NUM_BLOCKS & BLOCK_MASK) == 0,
+              "Number of blocks must be a power of two");
+
+// FNV-1a, only used for elements which are not digests
+uint64_t Fnv1a(byte_array::ConstByteArray const &element)
+{
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (std::size_t i = 0; i < element.size(); ++i)
+  {
+    hash ^= element[i];
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+// SplitMix64 finaliser, spreads the FNV output over all of the bits of the word
+uint64_t Mix(uint64_t value)
+{
+  value += 0x9e3779b97f4a7c15ull;
+  value = (value ^ (value >> 30u)) * 0xbf58476d1ce4e5b9ull;
+  value = (value ^ (value >> 27u)) * 0x94d049bb133111ebull;
+  return value ^ (value >> 31u);
+}
+
+uint64_t BitMask(uint64_t bits, std::size_t word)
+{
+  return 1ull << ((bits >> (word * BIT_INDEX_WIDTH)) & BIT_INDEX_MASK);
+}
+
+}  // namespace
+
+constexpr std::size_t BlockedBloomFilter::WORDS_PER_BLOCK;
+constexpr std::size_t BlockedBloomFilter::BITS_PER_ELEMENT;
+constexpr std::size_t BlockedBloomFilter::NUM_BLOCKS;
+constexpr std::size_t BlockedBloomFilter::SIZE_IN_BITS;
+constexpr std::size_t BlockedBloomFilter::DIGEST_SIZE;
+
+BlockedBloomFilter::BlockedBloomFilter()
+  : bits_(SIZE_IN_BITS)
+{}
+
+std::pair<bool, std::size_t> BlockedBloomFilter::Match(ConstByteArray const &element) const
+{
+  return {IsSet(Locate(element)), BITS_PER_ELEMENT};
+}
+
+void BlockedBloomFilter::MatchBatch(Elements const &elements, MatchResults &results) const
+{
+  results.resize(elements.size());
+
+  std::array<Position, BATCH_GROUP_SIZE> positions{};
+  for (std::size_t start = 0; start < elements.size(); start += BATCH_GROUP_SIZE)
+  {
+    std::size_t const count = std::min(BATCH_GROUP_SIZE, elements.size() - start);
+
+    // issue the loads of all of the blocks in the group before any of them are tested
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      positions[i] = Locate(elements[start + i]);
+      __builtin_prefetch(&bits_(positions[i].block * WORDS_PER_BLOCK));
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      results[start + i] = static_cast<uint8_t>(IsSet(positions[i]));
+    }
+  }
+}
+
+void BlockedBloomFilter::Add(ConstByteArray const &element)
+{
+  auto const position = Locate(element);
+  auto *     words    = &bits_(position.block * WORDS_PER_BLOCK);
+
+  for (std::size_t word = 0; word < WORDS_PER_BLOCK; ++word)
+  {
+    words[word] |= BitMask(position.bits, word);
+  }
+}
+
+void BlockedBloomFilter::Reset()
+{
+  bits_.SetAllZero();
+}
+
+BlockedBloomFilter::Position BlockedBloomFilter::Locate(ConstByteArray const &element)
+{
+  uint64_t selector{0};
+  uint64_t bits{0};
+
+  if (element.size() == DIGEST_SIZE)
+  {
+    std::memcpy(&selector, element.pointer(), sizeof(selector));
+    std::memcpy(&bits, element.pointer() + sizeof(selector), sizeof(bits));
+  }
+  else
+  {
+    selector = Mix(Fnv1a(element));
+    bits     = Mix(selector);
+  }
+
+  return {static_cast<std::size_t>(selector & BLOCK_MASK), bits};
+}
+
+bool BlockedBloomFilter::IsSet(Position const &position) const
+{
+  auto const *words = &bits_(position.block * WORDS_PER_BLOCK);
+
+#if defined(__AVX2__)
+
+  // build the masks for the two halves of the block and check that every bit of them is set
+  __m256i const bits    = _mm256_set1_epi64x(static_cast<int64_t>(position.bits));
+  __m256i const one     = _mm256_set1_epi64x(1);
+  __m256i const low_6   = _mm256_set1_epi64x(static_cast<int64_t>(BIT_INDEX_MASK));
+  __m256i const shift_l = _mm256_set_epi64x(18, 12, 6, 0);
+  __m256i const shift_h = _mm256_set_epi64x(42, 36, 30, 24);
+
+  __m256i const mask_l =
+      _mm256_sllv_epi64(one, _mm256_and_si256(_mm256_srlv_epi64(bits, shift_l), low_6));
+  __m256i const mask_h =
+      _mm256_sllv_epi64(one, _mm256_and_si256(_mm256_srlv_epi64(bits, shift_h), low_6));
+
+  __m256i const block_l = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(words));
+  __m256i const block_h = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(words + 4));
+
+  return (_mm256_testc_si256(block_l, mask_l) != 0) && (_mm256_testc_si256(block_h, mask_h) != 0);
+
+#else
+
+  uint64_t missing{0};
+  for (std::size_t word = 0; word < WORDS_PER_BLOCK; ++word)
+  {
+    auto const mask = BitMask(position.bits, word);
+    missing |= (words[word] & mask) ^ mask;
+  }
+
+  return missing == 0;
+
+#endif
+}
+
+}  // namespace fetch
@@ -19,6 +19,7 @@
 #include "bloom_filter/progressive_bloom_filter.hpp"
 #include "core/byte_array/const_byte_array.hpp"
 
+#include <cassert>
 #include <cstddef>
 
 namespace fetch {
@@ -45,6 +46,32 @@ std::pair<bool, std::size_t> ProgressiveBloomFilter::Match(
   return filter1_->Match(element);
 }
 
+/**
+ * Check a number of elements at once, elements outside of the current range never match
+ *
+ * @param elements The elements to check
+ * @param element_indices The index of each element
+ * @param results Set to 1 for each element which matches the filter, otherwise 0
+ */
+void ProgressiveBloomFilter::MatchBatch(Elements const &      elements,
+                                        ElementIndices const &element_indices,
+                                        MatchResults &        results) const
+{
+  assert(elements.size() == element_indices.size());
+
+  filter1_->MatchBatch(elements, results);
+
+  for (std::size_t i = 0; i < elements.size(); ++i)
+  {
+    if (!IsInCurrentRange(element_indices[i]))
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Match out of range: ", element_indices[i],
+                     " min: ", current_min_index_, " max: ", current_min_index_ + (overlap_ * 2u));
+      results[i] = 0;
+    }
+  }
+}
+
 void ProgressiveBloomFilter::Add(fetch::byte_array::ConstByteArray const &element,
                                  std::size_t element_index, std::size_t current_head_index)
 {
@@ -0,0 +1,168 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "bloom_filter/blocked_bloom_filter.hpp"
+#include "core/byte_array/byte_array.hpp"
+#include "core/byte_array/const_byte_array.hpp"
+#include "core/random/lcg.hpp"
+#include "core/serializers/main_serializer.hpp"
+
+#include "gmock/gmock.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using namespace fetch;
+
+using byte_array::ByteArray;
+using byte_array::ConstByteArray;
+
+class BlockedBloomFilterTests : public ::testing::Test
+{
+public:
+  std::vector<ConstByteArray> GenerateDigests(std::size_t count)
+  {
+    std::vector<ConstByteArray> digests;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      ByteArray digest;
+      digest.Resize(BlockedBloomFilter::DIGEST_SIZE);
+      for (std::size_t j = 0; j < digest.size(); ++j)
+      {
+        digest[j] = static_cast<uint8_t>(rng_() >> 19u);
+      }
+      digests.emplace_back(digest);
+    }
+    return digests;
+  }
+
+  std::unique_ptr<BlockedBloomFilter> filter{std::make_unique<BlockedBloomFilter>()};
+
+private:
+  random::LinearCongruentialGenerator rng_;
+};
+
+TEST_F(BlockedBloomFilterTests, empty_filter_matches_nothing)
+{
+  EXPECT_FALSE(filter->Match("abc").first);
+  EXPECT_FALSE(filter->Match(GenerateDigests(1).front()).first);
+}
+
+TEST_F(BlockedBloomFilterTests, added_elements_always_match)
+{
+  auto const digests = GenerateDigests(5000);
+  for (auto const &digest : digests)
+  {
+    filter->Add(digest);
+  }
+  filter->Add("short");
+  filter->Add("an element which is longer than a digest is");
+
+  for (auto const &digest : digests)
+  {
+    auto const result = filter->Match(digest);
+    EXPECT_TRUE(result.first);
+    EXPECT_EQ(result.second, BlockedBloomFilter::BITS_PER_ELEMENT);
+  }
+  EXPECT_TRUE(filter->Match("short").first);
+  EXPECT_TRUE(filter->Match("an element which is longer than a digest is").first);
+}
+
+TEST_F(BlockedBloomFilterTests, false_positive_rate_is_low)
+{
+  for (auto const &digest : GenerateDigests(100000))
+  {
+    filter->Add(digest);
+  }
+
+  std::size_t false_positives{0};
+  for (auto const &digest : GenerateDigests(100000))
+  {
+    false_positives += static_cast<std::size_t>(filter->Match(digest).first);
+  }
+
+  // with around six elements per block hardly any false positives are expected
+  EXPECT_LT(false_positives, 100);
+}
+
+TEST_F(BlockedBloomFilterTests, batch_match_agrees_with_single_match)
+{
+  auto const added = GenerateDigests(1000);
+  for (auto const &digest : added)
+  {
+    filter->Add(digest);
+  }
+
+  // interleave added and unseen elements, with a length which is not a multiple of the group size
+  BlockedBloomFilter::Elements elements{};
+  auto const                   unseen = GenerateDigests(37);
+  for (std::size_t i = 0; i < unseen.size(); ++i)
+  {
+    elements.push_back(added[i]);
+    elements.push_back(unseen[i]);
+  }
+  elements.push_back("short");
+
+  BlockedBloomFilter::MatchResults results{};
+  filter->MatchBatch(elements, results);
+
+  ASSERT_EQ(results.size(), elements.size());
+  for (std::size_t i = 0; i < elements.size(); ++i)
+  {
+    EXPECT_EQ(results[i] != 0, filter->Match(elements[i]).first);
+  }
+
+  for (std::size_t i = 0; i < unseen.size(); ++i)
+  {
+    EXPECT_EQ(results[2 * i], 1);
+  }
+}
+
+TEST_F(BlockedBloomFilterTests, reset_clears_the_filter)
+{
+  filter->Add("abc");
+  filter->Reset();
+
+  EXPECT_FALSE(filter->Match("abc").first);
+}
+
+TEST_F(BlockedBloomFilterTests, filter_survives_serialisation)
+{
+  auto const digests = GenerateDigests(100);
+  for (auto const &digest : digests)
+  {
+    filter->Add(digest);
+  }
+
+  serializers::LargeObjectSerializeHelper buffer{};
+  buffer << *filter;
+
+  BlockedBloomFilter restored{};
+  serializers::LargeObjectSerializeHelper input{buffer.data()};
+  input >> restored;
+
+  for (auto const &digest : digests)
+  {
+    EXPECT_TRUE(restored.Match(digest).first);
+  }
+}
+
+}  // namespace
@@ -36,6 +36,14 @@ void   InitialiseTestConstants();
 extern uint64_t STAKE_WARM_UP_PERIOD;
 extern uint64_t STAKE_COOL_DOWN_PERIOD;
 
+// the first block whose cabinet is selected by weighted sampling, earlier blocks use the original
+// selection (see StakeSnapshot::CabinetSelection). Set from the node's configuration at start up.
+extern uint64_t WEIGHTED_CABINET_SELECTION_BLOCK;
+
+// the first block whose contracts use the corrected UInt256 arithmetic, earlier blocks use the
+// original kernels (see vectorise/uint/legacy.hpp). Set from the node's configuration at start up.
+extern uint64_t CORRECTED_UINT256_ARITHMETIC_BLOCK;
+
 extern Digest const GENESIS_DIGEST_DEFAULT;
 extern Digest const GENESIS_MERKLE_ROOT_DEFAULT;
 
@@ -21,6 +21,8 @@
 #include "core/digest.hpp"
 #include "core/synchronisation/protected.hpp"
 
+#include <limits>
+
 namespace fetch {
 namespace chain {
 namespace {
@@ -104,8 +106,10 @@ void InitialiseTestConstants()
   });
 }
 
-uint64_t STAKE_WARM_UP_PERIOD   = 100;
-uint64_t STAKE_COOL_DOWN_PERIOD = 100;
+uint64_t STAKE_WARM_UP_PERIOD               = 100;
+uint64_t STAKE_COOL_DOWN_PERIOD             = 100;
+uint64_t WEIGHTED_CABINET_SELECTION_BLOCK   = std::numeric_limits<uint64_t>::max();
+uint64_t CORRECTED_UINT256_ARITHMETIC_BLOCK = std::numeric_limits<uint64_t>::max();
 
 Digest const GENESIS_DIGEST_DEFAULT = FromBase64("0+++++++++++++++++Genesis+++++++++++++++++0=");
 Digest const GENESIS_MERKLE_ROOT_DEFAULT =
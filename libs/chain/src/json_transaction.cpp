@@ -20,6 +20,7 @@
 #include "chain/transaction.hpp"
 #include "chain/transaction_serializer.hpp"
 #include "core/byte_array/decoders.hpp"
+#include "json/reader.hpp"
 #include "logging/logging.hpp"
 #include "variant/variant.hpp"
 #include "variant/variant_utils.hpp"
@@ -35,6 +36,34 @@ using variant::Variant;
 static constexpr char const *LOGGING_NAME        = "JsonTx";
 static const ConstByteArray  JSON_FORMAT_VERSION = "1.2";
 
+/**
+ * Decode the contents of the version and data fields of a JSON transaction
+ *
+ * @param version The contents of the version field
+ * @param data The (base64 encoded) contents of the data field
+ * @param dst The transaction to be populated
+ */
+static bool DecodeJsonFields(ConstByteArray const &version, ConstByteArray const &data,
+                             Transaction &dst)
+{
+  // ensure that the version matches expectation
+  if (JSON_FORMAT_VERSION != version)
+  {
+    FETCH_LOG_INFO(LOGGING_NAME, "Unexpected version: ", version);
+    return false;
+  }
+
+  // create the serializer and try and deserialize the transaction
+  TransactionSerializer serializer{FromBase64(data)};
+  if (!serializer.Deserialize(dst))
+  {
+    FETCH_LOG_INFO(LOGGING_NAME, "No data field present in payload");
+    return false;
+  }
+
+  return true;
+}
+
 /**
  * Convert an input JSON object into a transaction
  *
@@ -51,13 +80,6 @@ bool FromJsonTransaction(Variant const &src, Transaction &dst)
     return false;
   }
 
-  // ensure that the version matches expectation
-  if (JSON_FORMAT_VERSION != version)
-  {
-    FETCH_LOG_INFO(LOGGING_NAME, "Unexpected version: ", version);
-    return false;
-  }
-
   // extract the data field
   ConstByteArray data{};
   if (!Extract(src, "data", data))
@@ -66,18 +88,67 @@ bool FromJsonTransaction(Variant const &src, Transaction &dst)
     return false;
   }
 
-  // convert the data field to binary
-  data = FromBase64(data);
+  return DecodeJsonFields(version, data, dst);
+}
 
-  // create the serializer and try and deserialize the transaction
-  TransactionSerializer serializer{data};
-  if (!serializer.Deserialize(dst))
+/**
+ * Decode the JSON object at the current position of the reader directly into a transaction
+ *
+ * The object is always consumed in its entirety, even when it does not describe a valid
+ * transaction, so that the caller can carry on with the rest of the document.
+ *
+ * @param src The reader positioned on the object to decode
+ * @param dst The transaction to be populated
+ */
+bool FromJsonTransaction(json::JSONReader &src, Transaction &dst)
+{
+  using ValueType = json::JSONReader::ValueType;
+
+  if (src.PeekType() != ValueType::OBJECT)
+  {
+    FETCH_LOG_INFO(LOGGING_NAME, "Payload is not an object");
+    src.SkipValue();
+    return false;
+  }
+
+  bool           has_version{false};
+  bool           has_data{false};
+  ConstByteArray version{};
+  ConstByteArray data{};
+  ConstByteArray key{};
+
+  src.EnterObject();
+  while (src.NextField(key))
+  {
+    if ((key == "ver") && (src.PeekType() == ValueType::STRING))
+    {
+      version     = src.ReadString();
+      has_version = true;
+    }
+    else if ((key == "data") && (src.PeekType() == ValueType::STRING))
+    {
+      data     = src.ReadString();
+      has_data = true;
+    }
+    else
+    {
+      src.SkipValue();
+    }
+  }
+
+  if (!has_version)
+  {
+    FETCH_LOG_INFO(LOGGING_NAME, "No version field present in payload");
+    return false;
+  }
+
+  if (!has_data)
   {
     FETCH_LOG_INFO(LOGGING_NAME, "No data field present in payload");
     return false;
   }
 
-  return true;
+  return DecodeJsonFields(version, data, dst);
 }
 
 /**
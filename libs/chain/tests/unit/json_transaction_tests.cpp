@@ -21,11 +21,13 @@
 #include "chain/transaction.hpp"
 #include "chain/transaction_builder.hpp"
 #include "crypto/ecdsa.hpp"
+#include "json/reader.hpp"
 #include "variant/variant.hpp"
 
 #include "gtest/gtest.h"
 
 #include <memory>
+#include <string>
 
 using fetch::chain::Address;
 using fetch::chain::FromJsonTransaction;
@@ -33,6 +35,7 @@ using fetch::chain::ToJsonTransaction;
 using fetch::chain::Transaction;
 using fetch::chain::TransactionBuilder;
 using fetch::crypto::ECDSASigner;
+using fetch::json::JSONReader;
 using fetch::variant::Variant;
 
 TEST(JsonTransactionTests, BasicTest)
@@ -77,3 +80,72 @@ TEST(JsonTransactionTests, BasicTest)
   EXPECT_EQ(transfers_expected[0].to, transfers_actual[0].to);
   EXPECT_EQ(transfers_expected[0].amount, transfers_actual[0].amount);
 }
+
+TEST(JsonTransactionTests, DecodeFromReader)
+{
+  ECDSASigner identity1{};
+  ECDSASigner identity2{};
+
+  Address const address1{identity1.identity()};
+  Address const address2{identity2.identity()};
+
+  auto tx = TransactionBuilder()
+                .From(address1)
+                .Transfer(address2, 500)
+                .Signer(identity1.identity())
+                .Seal()
+                .Sign(identity1)
+                .Build();
+
+  Variant json{};
+  ASSERT_TRUE(ToJsonTransaction(*tx, json, true));
+
+  // a bulk submission with extra fields, a wrong version and a value that is not an object
+  std::string const data = std::string{json["data"].As<fetch::byte_array::ConstByteArray>()};
+  std::string const text =
+      R"([{"metadata": {"digest": ["ignored"]}, "data": ")" + data + R"(", "ver": "1.2"},)" +
+      R"({"ver": "1.1", "data": ")" + data + R"("}, 42])";
+
+  JSONReader reader{text};
+  reader.EnterArray();
+
+  Transaction output;
+  ASSERT_TRUE(reader.NextElement());
+  ASSERT_TRUE(FromJsonTransaction(reader, output));
+  EXPECT_EQ(tx->digest(), output.digest());
+  EXPECT_EQ(tx->from(), output.from());
+
+  Transaction rejected;
+  ASSERT_TRUE(reader.NextElement());
+  EXPECT_FALSE(FromJsonTransaction(reader, rejected));
+  ASSERT_TRUE(reader.NextElement());
+  EXPECT_FALSE(FromJsonTransaction(reader, rejected));
+
+  EXPECT_FALSE(reader.NextElement());
+  EXPECT_TRUE(reader.AtEnd());
+}
+
+TEST(JsonTransactionTests, MalformedDocumentsAreRejectedByTheReader)
+{
+  auto const decode = [](std::string const &text) {
+    JSONReader  reader{text};
+    Transaction output;
+    FromJsonTransaction(reader, output);
+    return reader.AtEnd();
+  };
+
+  // fields which are not needed are skipped, but must still be well formed
+  EXPECT_THROW(decode(R"({"ver": "1.1", "metadata": [1, 2,], "data": ""})"), std::exception);
+  EXPECT_THROW(decode(R"({"ver": "1.1", "metadata": {"a" 1}, "data": ""})"), std::exception);
+  EXPECT_THROW(decode(R"({"ver": "1.1", "fee": 12abc, "data": ""})"), std::exception);
+  EXPECT_THROW(decode(R"({"ver": "1.1", "flag": tru, "data": ""})"), std::exception);
+  EXPECT_THROW(decode(R"({"ver": "1.1", "note": "\q", "data": ""})"), std::exception);
+  EXPECT_THROW(decode(R"({"ver": "1.1" "data": ""})"), std::exception);
+
+  // trailing content is left for the caller to reject
+  EXPECT_FALSE(decode(R"({"ver": "1.1", "data": ""},)"));
+
+  // values which are not objects are skipped (and validated) as a whole
+  EXPECT_THROW(decode("[1, 2,]"), std::exception);
+  EXPECT_TRUE(decode("[1, 2]"));
+}
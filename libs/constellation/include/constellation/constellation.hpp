@@ -52,6 +52,7 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -109,6 +110,9 @@ public:
     bool           persistent_tx_status{false};
     ConstByteArray genesis_file_contents{};
     bool           proof_of_stake{false};
+    bool           erasure_coded_rbc{false};
+    uint64_t       weighted_cabinet_from{std::numeric_limits<uint64_t>::max()};
+    uint64_t       corrected_uint_from{std::numeric_limits<uint64_t>::max()};
     NetworkMode    network_mode{NetworkMode::PUBLIC_NETWORK};
     FeatureFlags   features{};
 
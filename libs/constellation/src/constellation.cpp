@@ -20,6 +20,7 @@
 #include "beacon/beacon_setup_service.hpp"
 #include "beacon/event_manager.hpp"
 #include "bloom_filter/bloom_filter.hpp"
+#include "chain/constants.hpp"
 #include "constellation/constellation.hpp"
 #include "constellation/health_check_http_module.hpp"
 #include "constellation/logging_http_module.hpp"
@@ -30,6 +31,7 @@
 #include "http/middleware/telemetry.hpp"
 #include "ledger/chaincode/contract_context.hpp"
 #include "ledger/chaincode/contract_http_interface.hpp"
+#include "ledger/chaincode/executable_store.hpp"
 #include "ledger/consensus/consensus.hpp"
 #include "ledger/consensus/simulated_pow_consensus.hpp"
 #include "ledger/consensus/stake_snapshot.hpp"
@@ -243,6 +245,9 @@ StakeManagerPtr CreateStakeManager(constellation::Constellation::Config const &c
 
   if (cfg.proof_of_stake)
   {
+    // the cabinet selection scheme is part of consensus, every node of a network must agree on it
+    chain::WEIGHTED_CABINET_SELECTION_BLOCK = cfg.weighted_cabinet_from;
+
     mgr = std::make_shared<ledger::StakeManager>();
   }
 
@@ -293,8 +298,14 @@ BeaconSetupServicePtr CreateBeaconSetupService(constellation::Constellation::Con
   BeaconSetupServicePtr beacon_setup{};
   if (cfg.proof_of_stake)
   {
-    beacon_setup =
-        std::make_unique<fetch::beacon::BeaconSetupService>(muddle, manifest_cache, certificate);
+    using BroadcastProtocol = fetch::beacon::BeaconSetupService::BroadcastProtocol;
+
+    auto const broadcast_protocol = cfg.erasure_coded_rbc
+                                        ? BroadcastProtocol::ERASURE_CODED_RBC
+                                        : BroadcastProtocol::RBC;
+
+    beacon_setup = std::make_unique<fetch::beacon::BeaconSetupService>(
+        muddle, manifest_cache, certificate, broadcast_protocol);
   }
   return beacon_setup;
 }
@@ -444,6 +455,14 @@ void Constellation::OnBlock(ledger::Block const &block)
 bool Constellation::OnStartup()
 {
   FETCH_LOG_INFO(LOGGING_NAME, "OnStartup()");
+
+  // contract arithmetic is part of consensus, every node of a network must agree on it
+  chain::CORRECTED_UINT256_ARITHMETIC_BLOCK = cfg_.corrected_uint_from;
+
+  // compiled contracts are shared between the executors and kept across restarts
+  ledger::ExecutableStore::Instance().Load(cfg_.db_prefix + "_executables.db",
+                                           cfg_.db_prefix + "_executables_index.db");
+
   return true;
 }
 
@@ -1087,6 +1106,9 @@ std::ostream &operator<<(std::ostream &stream, Constellation::Config const &conf
   stream << "Aeon Period..........: " << config.aeon_period << '\n';
   stream << "Kad Routing..........: " << config.kademlia_routing << '\n';
   stream << "Proof of Stake.......: " << config.proof_of_stake << '\n';
+  stream << "Erasure Coded RBC....: " << config.erasure_coded_rbc << '\n';
+  stream << "Weighted Cabinet From: " << config.weighted_cabinet_from << '\n';
+  stream << "Corrected UInt From..: " << config.corrected_uint_from << '\n';
   stream << "Agents...............: " << config.enable_agents << '\n';
   stream << "Messenger Port.......: " << config.messenger_port << '\n';
   stream << "Mailbox Port.........: " << config.mailbox_port << '\n';
@@ -36,7 +36,7 @@ OpenAPIHttpModule::OpenAPIHttpModule()
         }
 
         Variant paths{Variant::Object()};
-        for (auto const &view : server_->views_unsafe())
+        for (auto const &view : server_->views())
         {
 
           std::string method = ToString(view.method);
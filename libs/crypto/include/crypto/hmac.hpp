@@ -0,0 +1,90 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "core/byte_array/const_byte_array.hpp"
+#include "crypto/hash.hpp"
+#include "crypto/hasher_interface.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace fetch {
+namespace crypto {
+
+/**
+ * Compute the keyed-hash message authentication code (RFC 2104) of a message
+ *
+ * @tparam T The hash function, must provide BLOCK_SIZE_IN_BYTES
+ * @param key The secret key
+ * @param message The message to be authenticated
+ * @return The authentication code, the size of which is the digest size of T
+ */
+template <typename T>
+byte_array::ByteArray Hmac(byte_array::ConstByteArray const &key,
+                           byte_array::ConstByteArray const &message)
+{
+  static_assert(std::is_base_of<HasherInterface, T>::value,
+                "Use a type derived from fetch::crypto::Hasher:Interface");
+
+  static constexpr std::size_t BLOCK_SIZE = T::BLOCK_SIZE_IN_BYTES;
+  static constexpr uint8_t     INNER_PAD  = 0x36u;
+  static constexpr uint8_t     OUTER_PAD  = 0x5cu;
+
+  // keys longer than a block are replaced by their digest, shorter ones are zero padded
+  std::array<uint8_t, BLOCK_SIZE> block{};
+  if (key.size() > BLOCK_SIZE)
+  {
+    auto const digest = Hash<T>(key);
+    std::memcpy(block.data(), digest.pointer(), digest.size());
+  }
+  else if (!key.empty())
+  {
+    std::memcpy(block.data(), key.pointer(), key.size());
+  }
+
+  T hasher;
+
+  for (auto &b : block)
+  {
+    b ^= INNER_PAD;
+  }
+
+  hasher.Reset();
+  hasher.Update(block.data(), block.size());
+  hasher.Update(message);
+  auto const inner = hasher.Final();
+
+  for (auto &b : block)
+  {
+    b ^= static_cast<uint8_t>(INNER_PAD ^ OUTER_PAD);
+  }
+
+  hasher.Reset();
+  hasher.Update(block.data(), block.size());
+  hasher.Update(inner);
+
+  return hasher.Final();
+}
+
+}  // namespace crypto
+}  // namespace fetch
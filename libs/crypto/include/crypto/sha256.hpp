@@ -29,7 +29,8 @@ public:
   using HasherInterface::Final;
   using HasherInterface::Update;
 
-  static constexpr std::size_t SIZE_IN_BYTES = 32u;
+  static constexpr std::size_t SIZE_IN_BYTES       = 32u;
+  static constexpr std::size_t BLOCK_SIZE_IN_BYTES = 64u;
 
   SHA256()               = default;
   ~SHA256() override     = default;
@@ -29,7 +29,8 @@ public:
   using HasherInterface::Final;
   using HasherInterface::Update;
 
-  static constexpr std::size_t SIZE_IN_BYTES = 64u;
+  static constexpr std::size_t SIZE_IN_BYTES       = 64u;
+  static constexpr std::size_t BLOCK_SIZE_IN_BYTES = 128u;
 
   SHA512()               = default;
   ~SHA512() override     = default;
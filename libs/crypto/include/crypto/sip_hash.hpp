@@ -0,0 +1,48 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace fetch {
+namespace crypto {
+
+/**
+ * SipHash-2-4, a keyed hash of short messages. Inputs which collide can not be chosen without
+ * knowing the key, so it is suitable for hash tables whose keys are not trusted.
+ */
+class SipHash
+{
+public:
+  using Key = std::array<uint64_t, 2>;
+
+  explicit SipHash(Key const &key);
+
+  uint64_t operator()(void const *data, std::size_t size) const;
+  uint64_t operator()(uint64_t value) const;
+
+  static Key RandomKey();
+
+private:
+  Key key_;
+};
+
+}  // namespace crypto
+}  // namespace fetch
@@ -0,0 +1,84 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "core/mutex.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <unordered_set>
+
+namespace fetch {
+namespace crypto {
+
+/**
+ * Bounded, thread safe record of (message, public key, signature) triples which have already been
+ * verified, so that signatures which are checked repeatedly (for example the notarisations of
+ * blocks which are received more than once) only pay for the pairing computation once.
+ *
+ * Triples are stored as the SHA256 digest of their length-prefixed concatenation. When the cache
+ * is full the oldest entry is evicted.
+ */
+class VerifiedSignatureCache
+{
+public:
+  using ConstByteArray = byte_array::ConstByteArray;
+
+  static constexpr std::size_t DEFAULT_CAPACITY = 4096;
+
+  // Construction / Destruction
+  explicit VerifiedSignatureCache(std::size_t capacity = DEFAULT_CAPACITY);
+  VerifiedSignatureCache(VerifiedSignatureCache const &) = delete;
+  VerifiedSignatureCache(VerifiedSignatureCache &&)      = delete;
+  ~VerifiedSignatureCache()                              = default;
+
+  bool Contains(ConstByteArray const &message, ConstByteArray const &public_key,
+                ConstByteArray const &signature) const;
+  void Add(ConstByteArray const &message, ConstByteArray const &public_key,
+           ConstByteArray const &signature);
+  void Clear();
+
+  std::size_t size() const;
+  std::size_t capacity() const;
+
+  // Operators
+  VerifiedSignatureCache &operator=(VerifiedSignatureCache const &) = delete;
+  VerifiedSignatureCache &operator=(VerifiedSignatureCache &&) = delete;
+
+private:
+  struct DigestHash
+  {
+    std::size_t operator()(ConstByteArray const &digest) const;
+  };
+
+  using Entries       = std::unordered_set<ConstByteArray, DigestHash>;
+  using EvictionQueue = std::deque<ConstByteArray>;
+
+  static ConstByteArray Digest(ConstByteArray const &message, ConstByteArray const &public_key,
+                               ConstByteArray const &signature);
+
+  std::size_t const capacity_;
+
+  mutable Mutex mutex_;
+  Entries       entries_;
+  EvictionQueue eviction_queue_;
+};
+
+}  // namespace crypto
+}  // namespace fetch
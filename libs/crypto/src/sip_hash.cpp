@@ -0,0 +1,154 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "crypto/sip_hash.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+namespace fetch {
+namespace crypto {
+namespace {
+
+constexpr uint64_t Rotate(uint64_t value, unsigned bits)
+{
+  return (value << bits) | (value >> (64u - bits));
+}
+
+uint64_t LoadLittleEndian(uint8_t const *bytes, std::size_t size)
+{
+  uint64_t value{0};
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    value |= uint64_t{bytes[i]} << (8u * i);
+  }
+
+  return value;
+}
+
+class State
+{
+public:
+  explicit State(SipHash::Key const &key)
+    : v0_{key[0] ^ 0x736f6d6570736575ull}
+    , v1_{key[1] ^ 0x646f72616e646f6dull}
+    , v2_{key[0] ^ 0x6c7967656e657261ull}
+    , v3_{key[1] ^ 0x7465646279746573ull}
+  {}
+
+  void Compress(uint64_t word)
+  {
+    v3_ ^= word;
+    Round();
+    Round();
+    v0_ ^= word;
+  }
+
+  uint64_t Finalise()
+  {
+    v2_ ^= 0xffu;
+    Round();
+    Round();
+    Round();
+    Round();
+
+    return v0_ ^ v1_ ^ v2_ ^ v3_;
+  }
+
+private:
+  void Round()
+  {
+    v0_ += v1_;
+    v1_ = Rotate(v1_, 13) ^ v0_;
+    v0_ = Rotate(v0_, 32);
+    v2_ += v3_;
+    v3_ = Rotate(v3_, 16) ^ v2_;
+    v0_ += v3_;
+    v3_ = Rotate(v3_, 21) ^ v0_;
+    v2_ += v1_;
+    v1_ = Rotate(v1_, 17) ^ v2_;
+    v2_ = Rotate(v2_, 32);
+  }
+
+  uint64_t v0_;
+  uint64_t v1_;
+  uint64_t v2_;
+  uint64_t v3_;
+};
+
+}  // namespace
+
+SipHash::SipHash(Key const &key)
+  : key_{key}
+{}
+
+/**
+ * Hash a message
+ *
+ * @param data The message
+ * @param size The size of the message in bytes
+ * @return The hash
+ */
+uint64_t SipHash::operator()(void const *data, std::size_t size) const
+{
+  auto const *bytes = static_cast<uint8_t const *>(data);
+
+  State             state{key_};
+  std::size_t const tail = size - (size % 8u);
+  for (std::size_t offset = 0; offset < tail; offset += 8u)
+  {
+    state.Compress(LoadLittleEndian(bytes + offset, 8u));
+  }
+
+  // the last word holds the remaining bytes, and the low byte of the message size at the top
+  state.Compress(LoadLittleEndian(bytes + tail, size - tail) | (uint64_t{size} << 56u));
+
+  return state.Finalise();
+}
+
+/**
+ * Hash an integer, as the message of its eight little endian bytes
+ *
+ * @param value The integer
+ * @return The hash
+ */
+uint64_t SipHash::operator()(uint64_t value) const
+{
+  State state{key_};
+  state.Compress(value);
+  state.Compress(uint64_t{8} << 56u);
+
+  return state.Finalise();
+}
+
+/**
+ * Draw a key from the system's source of random numbers
+ *
+ * @return The key
+ */
+SipHash::Key SipHash::RandomKey()
+{
+  std::random_device                      device;
+  std::uniform_int_distribution<uint64_t> distribution;
+
+  return {{distribution(device), distribution(device)}};
+}
+
+}  // namespace crypto
+}  // namespace fetch
@@ -0,0 +1,132 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "crypto/sha256.hpp"
+#include "crypto/verified_signature_cache.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace fetch {
+namespace crypto {
+namespace {
+
+void UpdateWithLength(SHA256 &hasher, byte_array::ConstByteArray const &value)
+{
+  auto const length = static_cast<uint64_t>(value.size());
+  hasher.Update(reinterpret_cast<uint8_t const *>(&length), sizeof(length));
+  hasher.Update(value);
+}
+
+}  // namespace
+
+constexpr std::size_t VerifiedSignatureCache::DEFAULT_CAPACITY;
+
+/**
+ * Construct the cache
+ *
+ * @param capacity The maximum number of verified triples that are remembered
+ */
+VerifiedSignatureCache::VerifiedSignatureCache(std::size_t capacity)
+  : capacity_{std::max<std::size_t>(capacity, 1)}
+{}
+
+/**
+ * Determine whether a triple has previously been recorded as verified
+ *
+ * @param message The signed message
+ * @param public_key The serialised public key
+ * @param signature The serialised signature
+ * @return true if the triple is in the cache, otherwise false
+ */
+bool VerifiedSignatureCache::Contains(ConstByteArray const &message,
+                                      ConstByteArray const &public_key,
+                                      ConstByteArray const &signature) const
+{
+  auto const digest = Digest(message, public_key, signature);
+
+  FETCH_LOCK(mutex_);
+  return entries_.find(digest) != entries_.end();
+}
+
+/**
+ * Record a triple as verified, evicting the oldest entry if the cache is full
+ *
+ * @param message The signed message
+ * @param public_key The serialised public key
+ * @param signature The serialised signature
+ */
+void VerifiedSignatureCache::Add(ConstByteArray const &message, ConstByteArray const &public_key,
+                                 ConstByteArray const &signature)
+{
+  auto digest = Digest(message, public_key, signature);
+
+  FETCH_LOCK(mutex_);
+  if (!entries_.insert(digest).second)
+  {
+    return;
+  }
+
+  eviction_queue_.push_back(std::move(digest));
+  while (eviction_queue_.size() > capacity_)
+  {
+    entries_.erase(eviction_queue_.front());
+    eviction_queue_.pop_front();
+  }
+}
+
+void VerifiedSignatureCache::Clear()
+{
+  FETCH_LOCK(mutex_);
+  entries_.clear();
+  eviction_queue_.clear();
+}
+
+std::size_t VerifiedSignatureCache::size() const
+{
+  FETCH_LOCK(mutex_);
+  return entries_.size();
+}
+
+std::size_t VerifiedSignatureCache::capacity() const
+{
+  return capacity_;
+}
+
+std::size_t VerifiedSignatureCache::DigestHash::operator()(ConstByteArray const &digest) const
+{
+  // the entries are already uniformly distributed digests
+  std::size_t value{0};
+  std::memcpy(&value, digest.pointer(), std::min(sizeof(value), digest.size()));
+  return value;
+}
+
+VerifiedSignatureCache::ConstByteArray VerifiedSignatureCache::Digest(
+    ConstByteArray const &message, ConstByteArray const &public_key,
+    ConstByteArray const &signature)
+{
+  SHA256 hasher;
+  UpdateWithLength(hasher, message);
+  UpdateWithLength(hasher, public_key);
+  UpdateWithLength(hasher, signature);
+  return hasher.Final();
+}
+
+}  // namespace crypto
+}  // namespace fetch
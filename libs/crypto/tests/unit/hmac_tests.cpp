@@ -0,0 +1,64 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/encoders.hpp"
+#include "crypto/hmac.hpp"
+#include "crypto/sha256.hpp"
+#include "crypto/sha512.hpp"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using fetch::byte_array::ByteArray;
+using fetch::byte_array::ConstByteArray;
+using fetch::byte_array::ToHex;
+using fetch::crypto::Hmac;
+using fetch::crypto::SHA256;
+using fetch::crypto::SHA512;
+
+// RFC 4231 test case 2
+TEST(HmacTests, ShortKey)
+{
+  ConstByteArray const key{"Jefe"};
+  ConstByteArray const message{"what do ya want for nothing?"};
+
+  EXPECT_EQ(ToHex(Hmac<SHA256>(key, message)),
+            "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843");
+  EXPECT_EQ(ToHex(Hmac<SHA512>(key, message)),
+            "164b7a7bfcf819e2e395fbe73b56e0a387bd64222e831fd610270cd7ea250554"
+            "9758bf75c05a994a6d034f65f8f0e6fdcaeab1a34d4a6b4b636e070a38bce737");
+}
+
+// RFC 4231 test case 6
+TEST(HmacTests, KeyLongerThanBlock)
+{
+  ByteArray key{};
+  key.Resize(131);
+  for (std::size_t i = 0; i < key.size(); ++i)
+  {
+    key[i] = 0xaa;
+  }
+
+  ConstByteArray const message{"Test Using Larger Than Block-Size Key - Hash Key First"};
+
+  EXPECT_EQ(ToHex(Hmac<SHA256>(key, message)),
+            "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54");
+}
+
+}  // namespace
@@ -0,0 +1,87 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "crypto/sip_hash.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using fetch::crypto::SipHash;
+
+// the key and messages of the test vectors of the reference implementation
+SipHash::Key const REFERENCE_KEY{{0x0706050403020100ull, 0x0f0e0d0c0b0a0908ull}};
+
+std::vector<uint8_t> ReferenceMessage(std::size_t size)
+{
+  std::vector<uint8_t> message(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    message[i] = static_cast<uint8_t>(i);
+  }
+
+  return message;
+}
+
+TEST(SipHashTests, MessagesHashToTheReferenceVectors)
+{
+  SipHash const hash{REFERENCE_KEY};
+
+  auto const expect = [&hash](std::size_t size, uint64_t expected) {
+    auto const message = ReferenceMessage(size);
+    EXPECT_EQ(expected, hash(message.data(), message.size())) << "size: " << size;
+  };
+
+  expect(0, 0x726fdb47dd0e0e31ull);
+  expect(1, 0x74f839c593dc67fdull);
+  expect(7, 0xab0200f58b01d137ull);
+  expect(8, 0x93f5f5799a932462ull);
+  expect(15, 0xa129ca6149be45e5ull);
+}
+
+TEST(SipHashTests, IntegersHashAsTheirLittleEndianBytes)
+{
+  SipHash const hash{REFERENCE_KEY};
+
+  EXPECT_EQ(0x93f5f5799a932462ull, hash(uint64_t{0x0706050403020100ull}));
+
+  for (uint64_t value : {uint64_t{0}, uint64_t{1}, uint64_t{0xdeadbeefcafef00dull}})
+  {
+    uint8_t bytes[8];
+    for (std::size_t i = 0; i < sizeof(bytes); ++i)
+    {
+      bytes[i] = static_cast<uint8_t>(value >> (8u * i));
+    }
+
+    EXPECT_EQ(hash(bytes, sizeof(bytes)), hash(value));
+  }
+}
+
+TEST(SipHashTests, HashesDependOnTheKey)
+{
+  SipHash const first{REFERENCE_KEY};
+  SipHash const second{{{REFERENCE_KEY[0], REFERENCE_KEY[1] ^ 1u}}};
+
+  EXPECT_NE(first(uint64_t{42}), second(uint64_t{42}));
+}
+
+}  // namespace
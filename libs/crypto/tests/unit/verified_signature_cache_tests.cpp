@@ -0,0 +1,109 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "crypto/verified_signature_cache.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using fetch::byte_array::ConstByteArray;
+using fetch::crypto::VerifiedSignatureCache;
+
+ConstByteArray Entry(std::string const &prefix, std::size_t index)
+{
+  return ConstByteArray{prefix + std::to_string(index)};
+}
+
+TEST(VerifiedSignatureCacheTests, AddedTriplesAreFound)
+{
+  VerifiedSignatureCache cache;
+
+  EXPECT_FALSE(cache.Contains("message", "key", "signature"));
+  cache.Add("message", "key", "signature");
+  EXPECT_TRUE(cache.Contains("message", "key", "signature"));
+
+  // every element of the triple is significant
+  EXPECT_FALSE(cache.Contains("message2", "key", "signature"));
+  EXPECT_FALSE(cache.Contains("message", "key2", "signature"));
+  EXPECT_FALSE(cache.Contains("message", "key", "signature2"));
+
+  // the boundaries between the elements are significant
+  EXPECT_FALSE(cache.Contains("messagek", "ey", "signature"));
+  EXPECT_FALSE(cache.Contains("message", "keys", "ignature"));
+
+  // adding a triple again does not duplicate it
+  cache.Add("message", "key", "signature");
+  EXPECT_EQ(cache.size(), 1);
+
+  cache.Clear();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_FALSE(cache.Contains("message", "key", "signature"));
+}
+
+TEST(VerifiedSignatureCacheTests, OldestTriplesAreEvicted)
+{
+  VerifiedSignatureCache cache{10};
+
+  for (std::size_t i = 0; i < 25; ++i)
+  {
+    cache.Add(Entry("message", i), "key", "signature");
+    EXPECT_LE(cache.size(), cache.capacity());
+  }
+
+  EXPECT_EQ(cache.size(), 10);
+  for (std::size_t i = 0; i < 25; ++i)
+  {
+    EXPECT_EQ(cache.Contains(Entry("message", i), "key", "signature"), i >= 15);
+  }
+}
+
+TEST(VerifiedSignatureCacheTests, ConcurrentAccess)
+{
+  static constexpr std::size_t NUM_THREADS = 4;
+  static constexpr std::size_t NUM_ENTRIES = 1000;
+
+  VerifiedSignatureCache cache{NUM_THREADS * NUM_ENTRIES};
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < NUM_THREADS; ++t)
+  {
+    threads.emplace_back([&cache, t]() {
+      auto const key = Entry("key", t);
+      for (std::size_t i = 0; i < NUM_ENTRIES; ++i)
+      {
+        cache.Add(Entry("message", i), key, "signature");
+        EXPECT_TRUE(cache.Contains(Entry("message", i), key, "signature"));
+      }
+    });
+  }
+
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  EXPECT_EQ(cache.size(), NUM_THREADS * NUM_ENTRIES);
+}
+
+}  // namespace
@@ -21,6 +21,7 @@
 #include "core/byte_array/byte_array.hpp"
 #include "core/macros.hpp"
 #include "core/mutex.hpp"
+#include "core/string/to_lower.hpp"
 #include "http/abstract_connection.hpp"
 #include "http/http_connection_manager.hpp"
 #include "http/request.hpp"
@@ -28,8 +29,11 @@
 #include "logging/logging.hpp"
 #include "network/fetch_asio.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <deque>
 #include <memory>
+#include <string>
 
 namespace fetch {
 namespace http {
@@ -69,6 +73,11 @@ public:
       FETCH_LOCK(write_mutex_);
       write_in_progress = !write_queue_.empty();
       write_queue_.push_back(response);
+
+      if (pending_responses_ > 0)
+      {
+        --pending_responses_;
+      }
     }
 
     if (!write_in_progress)
@@ -92,12 +101,43 @@ public:
   {
     FETCH_LOG_DEBUG(LOGGING_NAME, "Ready to ready HTTP header");
 
-    SharedRequestType request = std::make_shared<HTTPRequest>();
     if (!buffer_ptr)
     {
       buffer_ptr = std::make_shared<asio::streambuf>(std::numeric_limits<std::size_t>::max());
     }
 
+    // pipelined requests which have already been received are parsed straight out of the buffer
+    // rather than going back through the reactor for each one
+    for (;;)
+    {
+      std::size_t const header_length = BufferedHeaderLength(*buffer_ptr);
+      if (header_length == 0)
+      {
+        break;
+      }
+
+      SharedRequestType request = std::make_shared<HTTPRequest>();
+      if (!request->ParseHeader(*buffer_ptr, header_length))
+      {
+        return;
+      }
+
+      if (request->content_length() > buffer_ptr->size())
+      {
+        ReadBody(buffer_ptr, request);
+        return;
+      }
+
+      Dispatch(buffer_ptr, request);
+
+      if (!is_open_ || close_requested_)
+      {
+        return;
+      }
+    }
+
+    SharedRequestType request = std::make_shared<HTTPRequest>();
+
     auto self = shared_from_this();
 
     auto cb = [this, buffer_ptr, request, self](std::error_code const &ec, std::size_t len) {
@@ -132,17 +172,9 @@ public:
     // Check if we got all the body
     if (request->content_length() <= buffer_ptr->size())
     {
-      request->ParseBody(*buffer_ptr);
+      Dispatch(buffer_ptr, request);
 
-      // at this point if the read has been successful populate the remote address information
-      // inside the request
-      auto const &remote_endpoint = socket_.remote_endpoint();
-      request->SetOriginatingAddress(remote_endpoint.address().to_string(), remote_endpoint.port());
-
-      // push the request to the main server
-      manager_.PushRequest(handle_, *request);
-
-      if (is_open_)
+      if (is_open_ && !close_requested_)
       {
         ReadHeader(buffer_ptr);
       }
@@ -196,15 +228,22 @@ public:
       if (!ec)
       {
         bool write_more = false;
+        bool finished   = false;
         {
           FETCH_LOCK(write_mutex_);
           write_more = !write_queue_.empty();
+          finished   = close_requested_ && !write_more && (pending_responses_ == 0);
         }
 
         if (is_open_ && write_more)
         {
           Write();
         }
+        else if (finished)
+        {
+          // the client asked for the connection to be closed after its last response
+          Close();
+        }
       }
       else
       {
@@ -235,13 +274,71 @@ public:
   }
 
 private:
+  /**
+   * Determine the length of a complete request header held in the buffer
+   *
+   * @param buffer The receive buffer
+   * @return The length of the header (including the terminating blank line), or zero if the
+   * buffer does not contain a complete header
+   */
+  static std::size_t BufferedHeaderLength(asio::streambuf const &buffer)
+  {
+    static char const TERMINATOR[] = "\r\n\r\n";
+
+    auto const begin = asio::buffers_begin(buffer.data());
+    auto const end   = asio::buffers_end(buffer.data());
+    auto const it    = std::search(begin, end, TERMINATOR, TERMINATOR + 4);
+
+    if (it == end)
+    {
+      return 0;
+    }
+
+    return static_cast<std::size_t>(it - begin) + 4u;
+  }
+
+  /**
+   * Hand a fully received request to the server
+   *
+   * @param buffer_ptr The receive buffer holding the request body
+   * @param request The request whose header has been parsed
+   */
+  void Dispatch(BufferPointerType const &buffer_ptr, SharedRequestType const &request)
+  {
+    request->ParseBody(*buffer_ptr);
+
+    // at this point if the read has been successful populate the remote address information
+    // inside the request
+    std::error_code ec;
+    auto const      remote_endpoint = socket_.remote_endpoint(ec);
+    request->SetOriginatingAddress(remote_endpoint.address().to_string(), remote_endpoint.port());
+
+    // connections are kept alive unless the client asks otherwise (or predates HTTP/1.1)
+    std::string connection{request->header()["connection"]};
+    string::ToLower(connection);
+
+    bool const keep_alive = (request->protocol() == "http/1.0") ? (connection == "keep-alive")
+                                                                 : (connection != "close");
+
+    {
+      FETCH_LOCK(write_mutex_);
+      ++pending_responses_;
+      close_requested_ = close_requested_ || !keep_alive;
+    }
+
+    // push the request to the main server
+    manager_.PushRequest(handle_, *request);
+  }
+
   asio::ip::tcp::tcp::socket socket_;
   HTTPConnectionManager &    manager_;
   ResponseQueueType          write_queue_;
   Mutex                      write_mutex_;
 
-  HandleType handle_{};
-  bool       is_open_ = false;
+  HandleType  handle_{};
+  bool        is_open_ = false;
+  bool        close_requested_{false};  ///< Close once all outstanding responses have been sent
+  std::size_t pending_responses_{0};    ///< Requests dispatched but not yet responded to
 };
 }  // namespace http
 }  // namespace fetch
@@ -23,9 +23,12 @@
 #include "http/view_parameters.hpp"
 #include "logging/logging.hpp"
 
+#include <bitset>
 #include <cstddef>
-#include <functional>
+#include <limits>
+#include <memory>
 #include <regex>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -34,26 +37,97 @@ namespace http {
 
 using ViewParameters = KeyValueSet;
 
+/**
+ * Matcher for a single path parameter.
+ *
+ * Patterns consisting of one character class followed by an optional quantifier (for example
+ * `[a-fA-F0-9]{64}`, `\d+` or `.+`) are compiled into a typed capture which is evaluated with a
+ * lookup table. All other patterns fall back to an anchored regular expression.
+ */
+class ParameterMatcher
+{
+public:
+  static constexpr std::size_t NO_MATCH = std::numeric_limits<std::size_t>::max();
+
+  explicit ParameterMatcher(std::string pattern);
+
+  std::size_t Match(byte_array::ConstByteArray const &path, std::size_t offset) const;
+
+  std::string const &pattern() const
+  {
+    return pattern_;
+  }
+
+  bool is_typed() const
+  {
+    return typed_;
+  }
+
+private:
+  using CharacterSet = std::bitset<256>;
+
+  bool CompileTyped();
+
+  std::string  pattern_;
+  bool         typed_{false};
+  CharacterSet allowed_{};
+  std::size_t  min_length_{1};
+  std::size_t  max_length_{1};
+  std::regex   regex_{};
+};
+
+using ParameterMatcherPtr = std::shared_ptr<ParameterMatcher const>;
+
 class Route
 {
 public:
   static constexpr char const *LOGGING_NAME = "HttpRoute";
-  using MatchFunction =
-      std::function<bool(std::size_t &, byte_array::ByteArray const &, ViewParameters &)>;
-  using MatchingVector = std::vector<MatchFunction>;
-  using ParameterList  = std::vector<byte_array::ConstByteArray>;
-  using ValidatorMap   = std::unordered_map<byte_array::ConstByteArray, validators::Validator>;
 
-  bool Match(byte_array::ConstByteArray const &path, ViewParameters &params)
+  /**
+   * A route is a sequence of literal segments and parameter captures
+   */
+  struct Segment
+  {
+    byte_array::ConstByteArray literal;
+    byte_array::ConstByteArray parameter;
+    ParameterMatcherPtr        matcher;
+
+    bool is_parameter() const
+    {
+      return static_cast<bool>(matcher);
+    }
+  };
+
+  using Segments      = std::vector<Segment>;
+  using ParameterList = std::vector<byte_array::ConstByteArray>;
+  using ValidatorMap  = std::unordered_map<byte_array::ConstByteArray, validators::Validator>;
+
+  bool Match(byte_array::ConstByteArray const &path, ViewParameters &params) const
   {
     std::size_t i = 0;
     params.Clear();
 
-    for (auto &m : match_)
+    for (auto const &segment : segments_)
     {
-      if (!m(i, path, params))
+      if (segment.is_parameter())
+      {
+        std::size_t const length = segment.matcher->Match(path, i);
+        if (length == ParameterMatcher::NO_MATCH)
+        {
+          return false;
+        }
+
+        params[segment.parameter] = path.SubArray(i, length);
+        i += length;
+      }
+      else
       {
-        return false;
+        if (!path.Match(segment.literal, i))
+        {
+          return false;
+        }
+
+        i += segment.literal.size();
       }
       // TODO(issue 1371): Add validators
     }
@@ -133,6 +207,11 @@ public:
     return path_parameters_;
   }
 
+  Segments const &segments() const
+  {
+    return segments_;
+  }
+
   bool HasParameterDetails(byte_array::ConstByteArray const &name) const
   {
     auto it = validators_.find(name);
@@ -154,14 +233,21 @@ public:
 private:
   void AddMatch(byte_array::ByteArray const &value)
   {
-    match_.push_back([value](std::size_t &i, byte_array::ByteArray const &path, ViewParameters &) {
-      bool ret = path.Match(value, i);
-      if (ret)
-      {
-        i += value.size();
-      }
-      return ret;
-    });
+    if (value.empty())
+    {
+      return;
+    }
+
+    // merge adjacent literals so that they map onto a single edge of the routing trie
+    if (!segments_.empty() && !segments_.back().is_parameter())
+    {
+      byte_array::ByteArray merged;
+      merged.Append(segments_.back().literal, value);
+      segments_.back().literal = merged;
+      return;
+    }
+
+    segments_.push_back({value, {}, {}});
   }
 
   byte_array::ByteArray AddParameter(byte_array::ByteArray const &value)
@@ -179,38 +265,16 @@ private:
     byte_array::ByteArray var = value.SubArray(0, i);
     ++i;
 
-    std::string reg = "^" + std::string(value.SubArray(i, value.size() - i));
-
-    std::regex rgx(reg);
-    match_.push_back(
-        [rgx, var](std::size_t &i, byte_array::ByteArray const &path, ViewParameters &params) {
-          std::string s = std::string(path.SubArray(i));
-          std::smatch matches;
-          bool        ret = std::regex_search(s, matches, rgx);
-
-          if (ret)
-          {
-            if (matches.size() != 1)
-            {
-              // Ambiguous matches are treated as non-matches.
-              return false;
-            }
-
-            std::string m = matches[0];
-
-            params[var] = path.SubArray(i, m.size());
-
-            i += m.size();
-          }
+    auto matcher =
+        std::make_shared<ParameterMatcher const>(std::string(value.SubArray(i, value.size() - i)));
+    segments_.push_back({{}, var, std::move(matcher)});
 
-          return ret;
-        });
     return var;
   }
 
   byte_array::ByteArray original_;
   byte_array::ByteArray path_;
-  MatchingVector        match_;
+  Segments              segments_;
   ParameterList         path_parameters_;
   ValidatorMap          validators_;
 };
@@ -0,0 +1,103 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "http/method.hpp"
+#include "http/route.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace fetch {
+namespace http {
+
+/**
+ * Radix trie of compiled routes.
+ *
+ * Literal segments of all of the routes share compressed edges of the trie and parameter segments
+ * become typed capture edges. A lookup therefore only inspects the routes that share a prefix with
+ * the requested path rather than every registered route. When several routes match a path the one
+ * registered first (lowest index) is selected, exactly as with a linear scan.
+ */
+class RouteTrie
+{
+public:
+  using ConstByteArray = byte_array::ConstByteArray;
+  using Index          = std::size_t;
+
+  static constexpr Index NOT_FOUND = std::numeric_limits<Index>::max();
+
+  void  Insert(Route const &route, Method method, Index index);
+  Index Lookup(Method method, ConstByteArray const &path, ViewParameters &params) const;
+
+private:
+  struct Node;
+  using NodePtr = std::unique_ptr<Node>;
+
+  struct LiteralEdge
+  {
+    ConstByteArray label;
+    NodePtr        child;
+  };
+
+  struct ParameterEdge
+  {
+    ConstByteArray      name;
+    ParameterMatcherPtr matcher;
+    NodePtr             child;
+  };
+
+  struct Endpoint
+  {
+    Method method;
+    Index  index;
+  };
+
+  struct Node
+  {
+    std::vector<LiteralEdge>   literals;    ///< Keyed by the first character of the label
+    std::vector<ParameterEdge> parameters;  ///< Tried in insertion order
+    std::vector<Endpoint>      endpoints;   ///< Routes which terminate at this node
+    Index                      min_index{NOT_FOUND};  ///< Smallest route index in the sub-tree
+  };
+
+  using Capture  = std::pair<ConstByteArray, ConstByteArray>;
+  using Captures = std::vector<Capture>;
+
+  struct Search
+  {
+    Method                method;
+    ConstByteArray const &path;
+    Captures              captures;
+    Index                 best{NOT_FOUND};
+    Captures              best_captures;
+  };
+
+  static Node *InsertLiteral(Node &node, ConstByteArray const &literal, Index index);
+  static Node *InsertParameter(Node &node, Route::Segment const &segment, Index index);
+  static void  Find(Node const &node, std::size_t offset, Search &search);
+
+  Node root_;
+};
+
+}  // namespace http
+}  // namespace fetch
@@ -28,10 +28,12 @@
 #include "http/request.hpp"
 #include "http/response.hpp"
 #include "http/route.hpp"
+#include "http/route_trie.hpp"
 #include "http/status.hpp"
 #include "http/tagged_tree.hpp"
 #include "logging/logging.hpp"
 #include "network/fetch_asio.hpp"
+#include "network/details/thread_pool.hpp"
 #include "network/management/network_manager.hpp"
 
 #include <algorithm>
@@ -43,6 +45,8 @@
 #include <mutex>
 #include <new>
 #include <system_error>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -66,15 +70,23 @@ public:
 
   static constexpr char const *LOGGING_NAME = "HTTPServer";
 
-  explicit HTTPServer(NetworkManager const &network_manager)
+  explicit HTTPServer(NetworkManager const &network_manager,
+                      std::size_t           num_workers = DefaultNumWorkers())
     : networkManager_(network_manager)
-  {}
+    , workers_(network::MakeThreadPool(std::max<std::size_t>(num_workers, 1), "HTTP"))
+    , routing_(std::make_shared<RoutingTable const>())
+  {
+    workers_->Start();
+  }
 
   HTTPServer(HTTPServer &&)      = delete;
   HTTPServer(HTTPServer const &) = delete;
 
   virtual ~HTTPServer()
   {
+    // no further views are executed once the server starts to shut down
+    workers_->Stop();
+
     auto socketWeak = socket_;
     auto accepWeak  = acceptor_;
 
@@ -150,7 +162,41 @@ public:
   void Stop()
   {}
 
+  /**
+   * Queue a request for processing on the worker pool.
+   *
+   * Requests from the same client form a strand: they are processed one at a time and the next one
+   * is only started once the response to the previous one has been handed to the connection, so
+   * that pipelined requests are answered in order.
+   *
+   * @param client The handle of the client connection
+   * @param req The request to be processed
+   */
   void PushRequest(HandleType client, HTTPRequest req) override
+  {
+    {
+      FETCH_LOCK(strands_mutex_);
+      auto &strand = strands_[client];
+      strand.pending.push_back(std::move(req));
+
+      if (strand.active)
+      {
+        return;
+      }
+
+      strand.active = true;
+    }
+
+    ScheduleNext(client);
+  }
+
+  /**
+   * Evaluate a request against the registered middleware and views
+   *
+   * @param req The request to be processed
+   * @return The response to the request
+   */
+  HTTPResponse ProcessRequest(HTTPRequest &req)
   {
     // TODO(issue 35): Need to actually add better support for the options here
     if (req.method() == Method::OPTIONS)
@@ -163,12 +209,12 @@ public:
       res.AddHeader("Access-Control-Allow-Headers",
                     "Content-Type, Authorization, Content-Length, X-Requested-With");
 
-      SendToManager(client, res);
-      return;
+      return res;
     }
 
-    // TODO(issue 28): improve such that it works for multiple threads.
-    FETCH_LOCK(eval_mutex_);
+    // TODO(issue 28): Not all of the registered modules are thread safe yet, so views are evaluated
+    // one at a time. Requests are still parsed, routed and answered off the network threads.
+    FETCH_LOCK(view_mutex_);
     HTTPResponse res("page not found", mime_types::GetMimeTypeFromExtension(".html"),
                      Status::CLIENT_ERROR_NOT_FOUND);
 
@@ -183,31 +229,24 @@ public:
       }
 
       // finding the view that matches the URL
+      auto const routing = routing_table();
+
       ViewParameters params;
-      for (auto &v : views_)
+      auto const     index = routing->trie.Lookup(req.method(), req.uri(), params);
+      if (index != RouteTrie::NOT_FOUND)
       {
-        // skip all views that don't match the required method
-        if (v.method != req.method())
-        {
-          continue;
-        }
+        auto const &v = routing->views[index];
 
-        if (v.route.Match(req.uri(), params))
+        // checking that the correct level of authentication is present
+        if (!v.authenticator(req))
         {
-          // checking that the correct level of authentication is present
-          if (!v.authenticator(req))
-          {
-            res = HTTPResponse("authentication required",
-                               fetch::http::mime_types::GetMimeTypeFromExtension(".html"),
-                               Status::SERVER_ERROR_NETWORK_AUTHENTICATION_REQUIRED);
-            SendToManager(client, res);
-            return;
-          }
-
-          // generating result
-          res = v.view(params, req);
-          break;
+          return HTTPResponse("authentication required",
+                              fetch::http::mime_types::GetMimeTypeFromExtension(".html"),
+                              Status::SERVER_ERROR_NETWORK_AUTHENTICATION_REQUIRED);
         }
+
+        // generating result
+        res = v.view(params, req);
       }
 
       // signal that the request has been processed
@@ -220,22 +259,18 @@ public:
     }
     catch (std::exception const &e)
     {
-      HTTPResponse response("internal error: " + std::string(e.what()),
-                            fetch::http::mime_types::GetMimeTypeFromExtension(".html"),
-                            Status::SERVER_ERROR_INTERNAL_SERVER_ERROR);
-      SendToManager(client, response);
-      return;
+      return HTTPResponse("internal error: " + std::string(e.what()),
+                          fetch::http::mime_types::GetMimeTypeFromExtension(".html"),
+                          Status::SERVER_ERROR_INTERNAL_SERVER_ERROR);
     }
     catch (...)
     {
-      HTTPResponse response("unknown internal error",
-                            fetch::http::mime_types::GetMimeTypeFromExtension(".html"),
-                            Status::SERVER_ERROR_INTERNAL_SERVER_ERROR);
-      SendToManager(client, response);
-      return;
+      return HTTPResponse("unknown internal error",
+                          fetch::http::mime_types::GetMimeTypeFromExtension(".html"),
+                          Status::SERVER_ERROR_INTERNAL_SERVER_ERROR);
     }
 
-    SendToManager(client, res);
+    return res;
   }
 
   // Accept static void to avoid having to create shared ptr to this class
@@ -291,8 +326,20 @@ public:
       route.AddValidator(param.name, std::move(v));
     }
 
+    FETCH_LOCK(eval_mutex_);
     views_.push_back(
         {std::move(description), method, std::move(route), view, std::move(authenticator)});
+
+    // publish a new routing table, requests in flight continue to use the previous one
+    auto routing   = std::make_shared<RoutingTable>();
+    routing->views = views_;
+    for (std::size_t index = 0; index < routing->views.size(); ++index)
+    {
+      auto const &mounted = routing->views[index];
+      routing->trie.Insert(mounted.route, mounted.method, index);
+    }
+
+    routing_ = std::move(routing);
   }
 
   void AddModule(HTTPModule const &module)
@@ -331,18 +378,88 @@ public:
 
   void AddDefaultRootModule()
   {
-    AddModule(DefaultRootModule(views_));
+    AddModule(DefaultRootModule(views()));
+  }
+
+  static std::size_t DefaultNumWorkers()
+  {
+    return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
   }
 
 private:
+  struct RoutingTable
+  {
+    MountedViews views;
+    RouteTrie    trie;
+  };
+
+  struct Strand
+  {
+    std::deque<HTTPRequest> pending;
+    bool                    active{false};
+  };
+
+  using RoutingTablePtr = std::shared_ptr<RoutingTable const>;
+  using Strands         = std::unordered_map<HandleType, Strand>;
+
+  RoutingTablePtr routing_table()
+  {
+    FETCH_LOCK(eval_mutex_);
+    return routing_;
+  }
+
+  void ScheduleNext(HandleType client)
+  {
+    HTTPRequest req;
+    {
+      FETCH_LOCK(strands_mutex_);
+
+      auto it = strands_.find(client);
+      if (it == strands_.end())
+      {
+        return;
+      }
+
+      if (it->second.pending.empty())
+      {
+        strands_.erase(it);
+        return;
+      }
+
+      req = std::move(it->second.pending.front());
+      it->second.pending.pop_front();
+    }
+
+    workers_->Post([this, client, req]() mutable {
+      HTTPResponse res = ProcessRequest(req);
+
+      std::weak_ptr<ConnectionManager> manager = manager_;
+      networkManager_.Post([this, manager, client, res] {
+        auto manager_lock = manager.lock();
+
+        // the server outlives its connection manager, so while the manager is held the strand can
+        // safely be continued
+        if (manager_lock)
+        {
+          manager_lock->Send(client, res);
+          ScheduleNext(client);
+        }
+      });
+    });
+  }
+
   Mutex eval_mutex_;
+  Mutex view_mutex_;
+  Mutex strands_mutex_;
 
   std::vector<RequestMiddleware>  pre_view_middleware_;
   MountedViews                    views_;
   std::vector<ResponseMiddleware> post_view_middleware_;
 
   NetworkManager                   networkManager_;
-  std::deque<HTTPRequest>          requests_;
+  network::ThreadPool              workers_;
+  RoutingTablePtr                  routing_;
+  Strands                          strands_;
   std::weak_ptr<Acceptor>          acceptor_;
   std::weak_ptr<Socket>            socket_;
   std::weak_ptr<ConnectionManager> manager_;
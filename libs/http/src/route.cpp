@@ -0,0 +1,272 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "http/route.hpp"
+
+#include <cctype>
+#include <string>
+#include <utility>
+
+namespace fetch {
+namespace http {
+namespace {
+
+constexpr std::size_t UNBOUNDED = std::numeric_limits<std::size_t>::max();
+
+bool ParseCount(std::string const &pattern, std::size_t &pos, std::size_t &value)
+{
+  std::size_t const start = pos;
+
+  value = 0;
+  while ((pos < pattern.size()) && (std::isdigit(static_cast<unsigned char>(pattern[pos])) != 0))
+  {
+    value = (value * 10u) + static_cast<std::size_t>(pattern[pos] - '0');
+    ++pos;
+  }
+
+  return pos != start;
+}
+
+}  // namespace
+
+constexpr std::size_t ParameterMatcher::NO_MATCH;
+
+/**
+ * Construct the matcher for a parameter pattern
+ *
+ * @param pattern The regular expression describing the parameter
+ */
+ParameterMatcher::ParameterMatcher(std::string pattern)
+  : pattern_{std::move(pattern)}
+{
+  typed_ = CompileTyped();
+
+  if (!typed_)
+  {
+    regex_ = std::regex("^" + pattern_);
+  }
+}
+
+/**
+ * Match the parameter against the path starting at the specified offset
+ *
+ * @param path The request path
+ * @param offset The offset into the path where the parameter starts
+ * @return The length of the captured value, or NO_MATCH if the parameter does not match
+ */
+std::size_t ParameterMatcher::Match(byte_array::ConstByteArray const &path,
+                                    std::size_t                       offset) const
+{
+  if (typed_)
+  {
+    std::size_t length = 0;
+    while ((length < max_length_) && (offset + length < path.size()) &&
+           allowed_.test(path[offset + length]))
+    {
+      ++length;
+    }
+
+    return (length < min_length_) ? NO_MATCH : length;
+  }
+
+  std::string const s = std::string(path.SubArray(offset));
+  std::smatch       matches;
+  if (!std::regex_search(s, matches, regex_))
+  {
+    return NO_MATCH;
+  }
+
+  // Ambiguous matches are treated as non-matches.
+  if (matches.size() != 1)
+  {
+    return NO_MATCH;
+  }
+
+  return static_cast<std::size_t>(matches[0].length());
+}
+
+/**
+ * Attempt to compile the pattern into a character class with a repetition count
+ *
+ * Only patterns for which a greedy scan is guaranteed to give the same result as the anchored
+ * regular expression are accepted.
+ *
+ * @return true if successful, otherwise false
+ */
+bool ParameterMatcher::CompileTyped()
+{
+  std::string const &p   = pattern_;
+  std::size_t        pos = 0;
+
+  if (p.empty())
+  {
+    return false;
+  }
+
+  // parse the character class
+  if (p[pos] == '[')
+  {
+    ++pos;
+
+    bool const negated = (pos < p.size()) && (p[pos] == '^');
+    if (negated)
+    {
+      ++pos;
+    }
+
+    std::size_t const class_start = pos;
+    while ((pos < p.size()) && (p[pos] != ']'))
+    {
+      auto const first = static_cast<unsigned char>(p[pos]);
+
+      // escapes and nested classes are left to the regex engine
+      if ((first == '\\') || (first == '['))
+      {
+        return false;
+      }
+
+      if ((pos + 2 < p.size()) && (p[pos + 1] == '-') && (p[pos + 2] != ']'))
+      {
+        auto const last = static_cast<unsigned char>(p[pos + 2]);
+        if ((last == '\\') || (last == '[') || (last < first))
+        {
+          return false;
+        }
+
+        for (std::size_t c = first; c <= last; ++c)
+        {
+          allowed_.set(c);
+        }
+
+        pos += 3;
+      }
+      else
+      {
+        allowed_.set(first);
+        ++pos;
+      }
+    }
+
+    if ((pos == p.size()) || (pos == class_start))
+    {
+      return false;
+    }
+    ++pos;
+
+    if (negated)
+    {
+      allowed_.flip();
+    }
+  }
+  else if ((p[pos] == '\\') && (pos + 1 < p.size()))
+  {
+    char const escaped = p[pos + 1];
+    pos += 2;
+
+    for (std::size_t c = 0; c < allowed_.size(); ++c)
+    {
+      bool const digit = (c >= '0') && (c <= '9');
+      bool const word  = digit || ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) ||
+                        (c == '_');
+
+      if (((escaped == 'd') && digit) || ((escaped == 'w') && word))
+      {
+        allowed_.set(c);
+      }
+    }
+
+    if (allowed_.none())
+    {
+      return false;
+    }
+  }
+  else if (p[pos] == '.')
+  {
+    ++pos;
+
+    allowed_.set();
+    allowed_.reset(static_cast<unsigned char>('\n'));
+    allowed_.reset(static_cast<unsigned char>('\r'));
+  }
+  else if (std::isalnum(static_cast<unsigned char>(p[pos])) != 0)
+  {
+    allowed_.set(static_cast<unsigned char>(p[pos]));
+    ++pos;
+  }
+  else
+  {
+    return false;
+  }
+
+  // parse the (greedy) quantifier
+  if (pos == p.size())
+  {
+    min_length_ = max_length_ = 1;
+    return true;
+  }
+
+  switch (p[pos])
+  {
+  case '+':
+    min_length_ = 1;
+    max_length_ = UNBOUNDED;
+    ++pos;
+    break;
+  case '*':
+    min_length_ = 0;
+    max_length_ = UNBOUNDED;
+    ++pos;
+    break;
+  case '?':
+    min_length_ = 0;
+    max_length_ = 1;
+    ++pos;
+    break;
+  case '{':
+    ++pos;
+    if (!ParseCount(p, pos, min_length_) || (pos == p.size()))
+    {
+      return false;
+    }
+
+    max_length_ = min_length_;
+    if (p[pos] == ',')
+    {
+      ++pos;
+      if (!ParseCount(p, pos, max_length_))
+      {
+        max_length_ = UNBOUNDED;
+      }
+    }
+
+    if ((pos == p.size()) || (p[pos] != '}') || (max_length_ < min_length_))
+    {
+      return false;
+    }
+    ++pos;
+    break;
+  default:
+    return false;
+  }
+
+  // anything after the quantifier (including a lazy modifier) is left to the regex engine
+  return pos == p.size();
+}
+
+}  // namespace http
+}  // namespace fetch
@@ -0,0 +1,201 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "http/route_trie.hpp"
+
+#include <algorithm>
+
+namespace fetch {
+namespace http {
+
+constexpr RouteTrie::Index RouteTrie::NOT_FOUND;
+
+/**
+ * Add a route to the trie
+ *
+ * @param route The route to be added
+ * @param method The method that the route serves
+ * @param index The index of the route (used to resolve ambiguous matches)
+ */
+void RouteTrie::Insert(Route const &route, Method method, Index index)
+{
+  Node *node      = &root_;
+  node->min_index = std::min(node->min_index, index);
+
+  for (auto const &segment : route.segments())
+  {
+    if (segment.is_parameter())
+    {
+      node = InsertParameter(*node, segment, index);
+    }
+    else
+    {
+      node = InsertLiteral(*node, segment.literal, index);
+    }
+  }
+
+  node->endpoints.push_back({method, index});
+}
+
+/**
+ * Find the first route that matches the method and path
+ *
+ * @param method The request method
+ * @param path The request path
+ * @param params The captured path parameters of the matching route
+ * @return The index of the matching route if successful, otherwise NOT_FOUND
+ */
+RouteTrie::Index RouteTrie::Lookup(Method method, ConstByteArray const &path,
+                                   ViewParameters &params) const
+{
+  params.Clear();
+
+  Search search{method, path, {}, NOT_FOUND, {}};
+  Find(root_, 0, search);
+
+  for (auto const &capture : search.best_captures)
+  {
+    params[capture.first] = capture.second;
+  }
+
+  return search.best;
+}
+
+RouteTrie::Node *RouteTrie::InsertLiteral(Node &node, ConstByteArray const &literal, Index index)
+{
+  Node *      current = &node;
+  std::size_t offset  = 0;
+
+  while (offset < literal.size())
+  {
+    auto it = std::find_if(
+        current->literals.begin(), current->literals.end(),
+        [&literal, offset](LiteralEdge const &edge) { return edge.label[0] == literal[offset]; });
+
+    if (it == current->literals.end())
+    {
+      auto child       = std::make_unique<Node>();
+      child->min_index = index;
+
+      Node *next = child.get();
+      current->literals.push_back({literal.SubArray(offset), std::move(child)});
+
+      return next;
+    }
+
+    // determine how much of the edge is shared with the literal
+    auto const &label  = it->label;
+    std::size_t common = 1;
+    while ((common < label.size()) && (offset + common < literal.size()) &&
+           (label[common] == literal[offset + common]))
+    {
+      ++common;
+    }
+
+    // split the edge when the literal diverges part way along it
+    if (common < label.size())
+    {
+      auto middle       = std::make_unique<Node>();
+      middle->min_index = it->child->min_index;
+      middle->literals.push_back({label.SubArray(common), std::move(it->child)});
+
+      it->label = label.SubArray(0, common);
+      it->child = std::move(middle);
+    }
+
+    current            = it->child.get();
+    current->min_index = std::min(current->min_index, index);
+    offset += common;
+  }
+
+  return current;
+}
+
+RouteTrie::Node *RouteTrie::InsertParameter(Node &node, Route::Segment const &segment, Index index)
+{
+  auto it = std::find_if(node.parameters.begin(), node.parameters.end(),
+                         [&segment](ParameterEdge const &edge) {
+                           return (edge.name == segment.parameter) &&
+                                  (edge.matcher->pattern() == segment.matcher->pattern());
+                         });
+
+  if (it == node.parameters.end())
+  {
+    node.parameters.push_back({segment.parameter, segment.matcher, std::make_unique<Node>()});
+    it = std::prev(node.parameters.end());
+  }
+
+  Node *next      = it->child.get();
+  next->min_index = std::min(next->min_index, index);
+
+  return next;
+}
+
+void RouteTrie::Find(Node const &node, std::size_t offset, Search &search)
+{
+  // nothing in this sub-tree can improve on the route that has already been found
+  if (node.min_index >= search.best)
+  {
+    return;
+  }
+
+  auto const &path = search.path;
+
+  if (offset == path.size())
+  {
+    for (auto const &endpoint : node.endpoints)
+    {
+      if ((endpoint.method == search.method) && (endpoint.index < search.best))
+      {
+        search.best          = endpoint.index;
+        search.best_captures = search.captures;
+      }
+    }
+  }
+
+  if (offset < path.size())
+  {
+    for (auto const &edge : node.literals)
+    {
+      if (edge.label[0] == path[offset])
+      {
+        if (path.Match(edge.label, offset))
+        {
+          Find(*edge.child, offset + edge.label.size(), search);
+        }
+        break;
+      }
+    }
+  }
+
+  for (auto const &edge : node.parameters)
+  {
+    std::size_t const length = edge.matcher->Match(path, offset);
+    if (length == ParameterMatcher::NO_MATCH)
+    {
+      continue;
+    }
+
+    search.captures.emplace_back(edge.name, path.SubArray(offset, length));
+    Find(*edge.child, offset + length, search);
+    search.captures.pop_back();
+  }
+}
+
+}  // namespace http
+}  // namespace fetch
@@ -0,0 +1,229 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "http/module.hpp"
+#include "http/response.hpp"
+#include "http/server.hpp"
+#include "network/fetch_asio.hpp"
+#include "network/management/network_manager.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using fetch::http::HTTPModule;
+using fetch::http::HTTPRequest;
+using fetch::http::HTTPResponse;
+using fetch::http::HTTPServer;
+using fetch::http::ViewParameters;
+using fetch::network::NetworkManager;
+
+constexpr uint16_t    PORT         = 8642;
+constexpr std::size_t NUM_REQUESTS = 20;
+
+struct EchoModule : HTTPModule
+{
+  EchoModule()
+  {
+    Get("/echo/(index=\\d+)", "Echoes the index of the request",
+        [](ViewParameters const &params, HTTPRequest const & /*request*/) {
+          auto const index = std::stoul(static_cast<std::string>(params["index"]));
+
+          // earlier requests take longer, they would be overtaken if views on the same
+          // connection were allowed to run concurrently
+          std::this_thread::sleep_for(std::chrono::milliseconds(2 * (NUM_REQUESTS - index)));
+
+          return HTTPResponse(std::to_string(index));
+        });
+  }
+};
+
+// Split the raw responses read from a connection into their bodies
+std::vector<std::string> ParseBodies(std::string const &data)
+{
+  std::vector<std::string> bodies;
+
+  std::size_t position = 0;
+  while (position < data.size())
+  {
+    auto const header_end = data.find("\r\n\r\n", position);
+    if (header_end == std::string::npos)
+    {
+      break;
+    }
+
+    std::string header = data.substr(position, header_end - position);
+    std::transform(header.begin(), header.end(), header.begin(),
+                   [](char c) { return static_cast<char>(std::tolower(c)); });
+
+    static std::string const CONTENT_LENGTH{"content-length:"};
+    auto const               field = header.find(CONTENT_LENGTH);
+    if (field == std::string::npos)
+    {
+      break;
+    }
+
+    auto const length     = std::stoul(header.substr(field + CONTENT_LENGTH.size()));
+    auto const body_start = header_end + 4;
+
+    bodies.emplace_back(data.substr(body_start, length));
+    position = body_start + length;
+  }
+
+  return bodies;
+}
+
+// Views which record how many of them are being evaluated at the same time
+struct CountingModule : HTTPModule
+{
+  CountingModule()
+  {
+    Get("/count", "Counts the views in flight",
+        [this](ViewParameters const & /*params*/, HTTPRequest const & /*request*/) {
+          auto const in_flight = ++active;
+
+          auto previous = max_active.load();
+          while ((in_flight > previous) && !max_active.compare_exchange_weak(previous, in_flight))
+          {
+          }
+
+          std::this_thread::sleep_for(std::chrono::milliseconds(5));
+          --active;
+
+          return HTTPResponse("counted");
+        });
+  }
+
+  std::atomic<std::size_t> active{0};
+  std::atomic<std::size_t> max_active{0};
+};
+
+// Send the requests on a new connection and read until the server closes it
+std::string Exchange(std::string const &requests)
+{
+  asio::io_context      context;
+  asio::ip::tcp::socket socket{context};
+  socket.connect({asio::ip::address::from_string("127.0.0.1"), PORT});
+  asio::write(socket, asio::buffer(requests));
+
+  std::string     responses;
+  std::error_code ec;
+  asio::read(socket, asio::dynamic_buffer(responses), ec);
+  EXPECT_EQ(ec, asio::error::eof);
+
+  return responses;
+}
+
+TEST(HTTPPipeliningTests, PipelinedResponsesAreReturnedInOrder)
+{
+  NetworkManager network_manager{"Pipelining", 2};
+  network_manager.Start();
+
+  {
+    HTTPServer server{network_manager, 4};
+    EchoModule module;
+    server.AddModule(module);
+    server.Start(PORT);
+
+    // all of the requests are sent in one go on a single connection, the last one closing it
+    std::string requests;
+    for (std::size_t i = 0; i < NUM_REQUESTS; ++i)
+    {
+      requests += "GET /echo/" + std::to_string(i) + " HTTP/1.1\r\nHost: 127.0.0.1\r\n";
+      requests += (i + 1 == NUM_REQUESTS) ? "Connection: close\r\n\r\n" : "\r\n";
+    }
+
+    auto const bodies = ParseBodies(Exchange(requests));
+    ASSERT_EQ(bodies.size(), NUM_REQUESTS);
+
+    for (std::size_t i = 0; i < NUM_REQUESTS; ++i)
+    {
+      EXPECT_EQ(bodies[i], std::to_string(i));
+    }
+  }
+
+  network_manager.Stop();
+}
+
+TEST(HTTPPipeliningTests, ConnectionsWithoutKeepAliveAreClosedAfterOneResponse)
+{
+  NetworkManager network_manager{"Pipelining", 2};
+  network_manager.Start();
+
+  {
+    HTTPServer server{network_manager, 4};
+    EchoModule module;
+    server.AddModule(module);
+    server.Start(PORT);
+
+    // HTTP/1.0 closes by default, so the second request is never answered
+    auto const bodies =
+        ParseBodies(Exchange("GET /echo/1 HTTP/1.0\r\n\r\nGET /echo/2 HTTP/1.0\r\n\r\n"));
+    ASSERT_EQ(bodies.size(), 1);
+    EXPECT_EQ(bodies[0], "1");
+  }
+
+  network_manager.Stop();
+}
+
+TEST(HTTPPipeliningTests, ViewsAreEvaluatedOneAtATime)
+{
+  static constexpr std::size_t NUM_CLIENTS = 8;
+
+  NetworkManager network_manager{"Pipelining", 2};
+  network_manager.Start();
+
+  {
+    HTTPServer     server{network_manager, 4};
+    CountingModule module;
+    server.AddModule(module);
+    server.Start(PORT);
+
+    std::vector<std::thread> clients;
+    for (std::size_t i = 0; i < NUM_CLIENTS; ++i)
+    {
+      clients.emplace_back([] {
+        auto const bodies = ParseBodies(
+            Exchange("GET /count HTTP/1.1\r\nHost: 127.0.0.1\r\nConnection: close\r\n\r\n"));
+        ASSERT_EQ(bodies.size(), 1);
+        EXPECT_EQ(bodies[0], "counted");
+      });
+    }
+
+    for (auto &client : clients)
+    {
+      client.join();
+    }
+
+    EXPECT_EQ(module.max_active, 1);
+  }
+
+  network_manager.Stop();
+}
+
+}  // namespace
@@ -0,0 +1,142 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "http/method.hpp"
+#include "http/route.hpp"
+#include "http/route_trie.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+using fetch::byte_array::ConstByteArray;
+using fetch::http::Method;
+using fetch::http::ParameterMatcher;
+using fetch::http::Route;
+using fetch::http::RouteTrie;
+using fetch::http::ViewParameters;
+
+std::string const DIGEST(64, 'a');
+std::string const IDENTIFIER(48, 'b');
+
+TEST(RouteTrieTests, CommonPatternsAreTyped)
+{
+  EXPECT_TRUE(ParameterMatcher{"[a-fA-F0-9]{64}"}.is_typed());
+  EXPECT_TRUE(ParameterMatcher{"[1-9A-HJ-NP-Za-km-z]{48,50}"}.is_typed());
+  EXPECT_TRUE(ParameterMatcher{"\\d+"}.is_typed());
+  EXPECT_TRUE(ParameterMatcher{".+"}.is_typed());
+  EXPECT_FALSE(ParameterMatcher{"a|b"}.is_typed());
+  EXPECT_FALSE(ParameterMatcher{"\\d+?"}.is_typed());
+}
+
+TEST(RouteTrieTests, TypedMatchersAgreeWithRegex)
+{
+  std::vector<std::string> const patterns{"[a-fA-F0-9]{64}", "[0-9]{2,4}", "\\d+", "\\w*",
+                                          ".+",              "[^/]+",      "x"};
+  std::vector<std::string> const paths{DIGEST + "/tail", "12345", "12/abc", "",
+                                       "abc_9/def",      "x",     "/"};
+
+  for (auto const &pattern : patterns)
+  {
+    ParameterMatcher const typed{pattern};
+    ParameterMatcher const regex{"(?:" + pattern + ")"};
+    ASSERT_TRUE(typed.is_typed()) << pattern;
+    ASSERT_FALSE(regex.is_typed()) << pattern;
+
+    for (auto const &path : paths)
+    {
+      EXPECT_EQ(typed.Match(path, 0), regex.Match(path, 0)) << pattern << " vs " << path;
+    }
+  }
+}
+
+TEST(RouteTrieTests, LookupMatchesLinearScan)
+{
+  std::vector<std::pair<Method, std::string>> const definitions{
+      {Method::GET, "/api/status/tx/(digest=[a-fA-F0-9]{64})"},
+      {Method::GET, "/api/status"},
+      {Method::POST, "/api/contract/submit"},
+      {Method::GET, "/api/status/chain"},
+      {Method::GET, "/api/wallet/(identifier=[1-9A-HJ-NP-Za-km-z]{48,50})/balance"},
+      {Method::GET, "/api/(query=.+)"},
+      {Method::GET, "/"},
+  };
+
+  std::vector<Route> routes;
+  RouteTrie          trie;
+  for (std::size_t index = 0; index < definitions.size(); ++index)
+  {
+    routes.push_back(Route::FromString(definitions[index].second));
+    trie.Insert(routes.back(), definitions[index].first, index);
+  }
+
+  std::vector<std::pair<Method, std::string>> const requests{
+      {Method::GET, "/api/status/tx/" + DIGEST},
+      {Method::GET, "/api/status"},
+      {Method::GET, "/api/status/chain"},
+      {Method::POST, "/api/contract/submit"},
+      {Method::GET, "/api/contract/submit"},
+      {Method::GET, "/api/wallet/" + IDENTIFIER + "/balance"},
+      {Method::GET, "/api/wallet/short/balance"},
+      {Method::GET, "/"},
+      {Method::GET, "/missing"},
+      {Method::POST, "/api/status"},
+  };
+
+  for (auto const &request : requests)
+  {
+    ConstByteArray const path{request.second};
+
+    // the first registered route that matches must win, as with a linear scan
+    std::size_t    expected = RouteTrie::NOT_FOUND;
+    ViewParameters expected_params;
+    for (std::size_t index = 0; index < routes.size(); ++index)
+    {
+      if ((definitions[index].first == request.first) &&
+          routes[index].Match(path, expected_params))
+      {
+        expected = index;
+        break;
+      }
+    }
+
+    ViewParameters params;
+    auto const     found = trie.Lookup(request.first, path, params);
+    ASSERT_EQ(found, expected) << request.second;
+
+    if (found != RouteTrie::NOT_FOUND)
+    {
+      for (auto const &param : routes[found].path_parameters())
+      {
+        EXPECT_EQ(params[param], expected_params[param]) << request.second;
+      }
+    }
+  }
+
+  ViewParameters params;
+  EXPECT_EQ(trie.Lookup(Method::GET, "/api/status/tx/" + DIGEST, params), 0u);
+  EXPECT_EQ(params["digest"], DIGEST);
+  EXPECT_EQ(trie.Lookup(Method::GET, "/api/status/chain", params), 3u);
+  EXPECT_EQ(trie.Lookup(Method::GET, "/api/status/other", params), 5u);
+  EXPECT_EQ(params["query"], "status/other");
+}
+
+}  // namespace
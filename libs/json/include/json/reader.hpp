@@ -0,0 +1,92 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "json/structural_index.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fetch {
+namespace json {
+
+/**
+ * On demand JSON reader.
+ *
+ * Unlike JSONDocument, no tree is built: the caller walks the document (guided by the structural
+ * index) and only decodes the values that it is interested in. Everything else is skipped without
+ * being materialised. Strings without escape sequences are returned as views into the document.
+ *
+ * Malformed input is reported by throwing JSONParseException.
+ */
+class JSONReader
+{
+public:
+  using ConstByteArray = byte_array::ConstByteArray;
+
+  enum class ValueType
+  {
+    OBJECT,
+    ARRAY,
+    STRING,
+    NUMBER,
+    BOOLEAN,
+    NULL_VALUE
+  };
+
+  explicit JSONReader(ConstByteArray document);
+  JSONReader(JSONReader const &) = delete;
+  JSONReader(JSONReader &&)      = default;
+  ~JSONReader()                  = default;
+
+  ValueType PeekType() const;
+  bool      AtEnd() const;
+
+  /// @name Containers
+  /// @{
+  void EnterObject();
+  bool NextField(ConstByteArray &key);
+  void EnterArray();
+  bool NextElement();
+  /// @}
+
+  /// @name Values
+  /// @{
+  ConstByteArray ReadString();
+  ConstByteArray ReadScalar();
+  void           SkipValue();
+  /// @}
+
+  // Operators
+  JSONReader &operator=(JSONReader const &) = delete;
+  JSONReader &operator=(JSONReader &&) = default;
+
+private:
+  char           Current() const;
+  char           Previous() const;
+  void           Expect(char c);
+  ConstByteArray Unescape(std::size_t start, std::size_t end) const;
+
+  ConstByteArray  document_;
+  StructuralIndex index_;
+  std::size_t     cursor_{0};  ///< The index of the next structural to be consumed
+};
+
+}  // namespace json
+}  // namespace fetch
@@ -0,0 +1,69 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fetch {
+namespace json {
+
+/**
+ * First stage of the on demand JSON parser.
+ *
+ * The document is scanned in blocks of 64 bytes. For each block vectorised comparisons produce
+ * bit masks of the quotes, backslashes, operators and whitespace, from which the escaped quotes and
+ * the extent of every string are derived with a handful of integer operations. What remains is the
+ * position of every structural character outside of strings ({, }, [, ], : and ,), of every
+ * opening quote and of the first character of every other scalar. The second stage (JSONReader)
+ * navigates the document using these positions only.
+ */
+class StructuralIndex
+{
+public:
+  using ConstByteArray = byte_array::ConstByteArray;
+  using Positions      = std::vector<uint32_t>;
+
+  static constexpr std::size_t BLOCK_SIZE = 64;
+
+  bool Build(ConstByteArray const &document);
+
+  Positions const &positions() const
+  {
+    return positions_;
+  }
+
+  std::size_t size() const
+  {
+    return positions_.size();
+  }
+
+  uint32_t operator[](std::size_t index) const
+  {
+    return positions_[index];
+  }
+
+private:
+  Positions positions_;
+};
+
+}  // namespace json
+}  // namespace fetch
@@ -0,0 +1,573 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "json/exceptions.hpp"
+#include "json/reader.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace fetch {
+namespace json {
+namespace {
+
+bool IsDelimiter(char c)
+{
+  switch (c)
+  {
+  case '{':
+  case '}':
+  case '[':
+  case ']':
+  case ':':
+  case ',':
+  case '"':
+  case ' ':
+  case '\t':
+  case '\n':
+  case '\r':
+    return true;
+  default:
+    return false;
+  }
+}
+
+bool IsDigit(char c)
+{
+  return (c >= '0') && (c <= '9');
+}
+
+/**
+ * Check that the text of a scalar is a literal or a number as defined by RFC 8259
+ *
+ * @param text The text of the scalar
+ * @return true if the scalar is valid, otherwise false
+ */
+bool IsValidScalar(byte_array::ConstByteArray const &text)
+{
+  if ((text == "true") || (text == "false") || (text == "null"))
+  {
+    return true;
+  }
+
+  std::size_t const size = text.size();
+  std::size_t       i    = 0;
+
+  auto const at = [&text, size](std::size_t position) {
+    return (position < size) ? static_cast<char>(text[position]) : '\0';
+  };
+
+  auto const skip_digits = [&at, &i]() {
+    std::size_t const start = i;
+    while (IsDigit(at(i)))
+    {
+      ++i;
+    }
+    return i != start;
+  };
+
+  if (at(i) == '-')
+  {
+    ++i;
+  }
+
+  // integer part, without leading zeros
+  if (at(i) == '0')
+  {
+    ++i;
+  }
+  else if (!skip_digits())
+  {
+    return false;
+  }
+
+  if (at(i) == '.')
+  {
+    ++i;
+    if (!skip_digits())
+    {
+      return false;
+    }
+  }
+
+  if ((at(i) == 'e') || (at(i) == 'E'))
+  {
+    ++i;
+    if ((at(i) == '+') || (at(i) == '-'))
+    {
+      ++i;
+    }
+    if (!skip_digits())
+    {
+      return false;
+    }
+  }
+
+  return i == size;
+}
+
+uint32_t HexValue(char c)
+{
+  if ((c >= '0') && (c <= '9'))
+  {
+    return static_cast<uint32_t>(c - '0');
+  }
+  if ((c >= 'a') && (c <= 'f'))
+  {
+    return static_cast<uint32_t>(c - 'a' + 10);
+  }
+  if ((c >= 'A') && (c <= 'F'))
+  {
+    return static_cast<uint32_t>(c - 'A' + 10);
+  }
+
+  throw JSONParseException("Invalid unicode escape sequence");
+}
+
+void AppendUtf8(byte_array::ByteArray &output, std::size_t &length, uint32_t code_point)
+{
+  auto const append = [&output, &length](uint32_t value) {
+    output[length++] = static_cast<uint8_t>(value);
+  };
+
+  if (code_point < 0x80u)
+  {
+    append(code_point);
+  }
+  else if (code_point < 0x800u)
+  {
+    append(0xC0u | (code_point >> 6u));
+    append(0x80u | (code_point & 0x3Fu));
+  }
+  else if (code_point < 0x10000u)
+  {
+    append(0xE0u | (code_point >> 12u));
+    append(0x80u | ((code_point >> 6u) & 0x3Fu));
+    append(0x80u | (code_point & 0x3Fu));
+  }
+  else
+  {
+    append(0xF0u | (code_point >> 18u));
+    append(0x80u | ((code_point >> 12u) & 0x3Fu));
+    append(0x80u | ((code_point >> 6u) & 0x3Fu));
+    append(0x80u | (code_point & 0x3Fu));
+  }
+}
+
+}  // namespace
+
+/**
+ * Construct the reader, indexing the structure of the document
+ *
+ * @param document The JSON document to be read
+ */
+JSONReader::JSONReader(ConstByteArray document)
+  : document_{std::move(document)}
+{
+  if (!index_.Build(document_))
+  {
+    throw JSONParseException("Unterminated string in JSON document");
+  }
+}
+
+/**
+ * Determine the type of the next value in the document
+ *
+ * @return The type of the value
+ */
+JSONReader::ValueType JSONReader::PeekType() const
+{
+  char const c = Current();
+
+  switch (c)
+  {
+  case '{':
+    return ValueType::OBJECT;
+  case '[':
+    return ValueType::ARRAY;
+  case '"':
+    return ValueType::STRING;
+  case 't':
+  case 'f':
+    return ValueType::BOOLEAN;
+  case 'n':
+    return ValueType::NULL_VALUE;
+  default:
+    break;
+  }
+
+  if ((c == '-') || ((c >= '0') && (c <= '9')))
+  {
+    return ValueType::NUMBER;
+  }
+
+  throw JSONParseException(std::string("Unexpected character '") + c + "' in JSON document");
+}
+
+/**
+ * Determine if the whole of the document has been consumed
+ */
+bool JSONReader::AtEnd() const
+{
+  return cursor_ >= index_.size();
+}
+
+/**
+ * Consume the opening brace of an object
+ */
+void JSONReader::EnterObject()
+{
+  Expect('{');
+}
+
+/**
+ * Advance to the next field of the current object
+ *
+ * @param key The key of the field, the reader is positioned on its value
+ * @return true if there is another field, false if the end of the object has been consumed
+ */
+bool JSONReader::NextField(ConstByteArray &key)
+{
+  bool const first = (Previous() == '{');
+
+  if (Current() == '}')
+  {
+    if (!first && (Previous() == ','))
+    {
+      throw JSONParseException("Trailing comma in JSON object");
+    }
+
+    ++cursor_;
+    return false;
+  }
+
+  if (!first)
+  {
+    Expect(',');
+  }
+
+  key = ReadString();
+  Expect(':');
+
+  return true;
+}
+
+/**
+ * Consume the opening bracket of an array
+ */
+void JSONReader::EnterArray()
+{
+  Expect('[');
+}
+
+/**
+ * Advance to the next element of the current array
+ *
+ * @return true if the reader is positioned on another element, false if the end of the array has
+ * been consumed
+ */
+bool JSONReader::NextElement()
+{
+  bool const first = (Previous() == '[');
+
+  if (Current() == ']')
+  {
+    if (!first && (Previous() == ','))
+    {
+      throw JSONParseException("Trailing comma in JSON array");
+    }
+
+    ++cursor_;
+    return false;
+  }
+
+  if (!first)
+  {
+    Expect(',');
+  }
+
+  return true;
+}
+
+/**
+ * Read a string value, decoding any escape sequences
+ *
+ * @return The string
+ */
+JSONReader::ConstByteArray JSONReader::ReadString()
+{
+  if (Current() != '"')
+  {
+    throw JSONParseException("Expected string in JSON document");
+  }
+
+  ConstByteArray const &document = document_;
+  std::size_t const     start    = index_[cursor_] + 1u;
+  ++cursor_;
+
+  // the structural index guarantees that the string is terminated
+  bool        escaped = false;
+  std::size_t end     = start;
+  while ((end < document.size()) && (document[end] != '"'))
+  {
+    if (document[end] == '\\')
+    {
+      escaped = true;
+      ++end;
+    }
+    ++end;
+  }
+
+  if (end >= document.size())
+  {
+    throw JSONParseException("Unterminated string in JSON document");
+  }
+
+  return escaped ? Unescape(start, end) : document.SubArray(start, end - start);
+}
+
+/**
+ * Read the raw text of a number, boolean or null value
+ *
+ * @return The text of the value
+ */
+JSONReader::ConstByteArray JSONReader::ReadScalar()
+{
+  if (IsDelimiter(Current()))
+  {
+    throw JSONParseException("Expected scalar in JSON document");
+  }
+
+  ConstByteArray const &document = document_;
+  std::size_t const     start    = index_[cursor_];
+  ++cursor_;
+
+  std::size_t end = start + 1;
+  while ((end < document.size()) && !IsDelimiter(static_cast<char>(document[end])))
+  {
+    ++end;
+  }
+
+  auto scalar = document.SubArray(start, end - start);
+  if (!IsValidScalar(scalar))
+  {
+    throw JSONParseException("Invalid scalar '" + static_cast<std::string>(scalar) +
+                             "' in JSON document");
+  }
+
+  return scalar;
+}
+
+/**
+ * Skip over the next value (and all of its children) without keeping it
+ *
+ * The value is still validated as it is skipped: separators, keys, strings and scalars must all be
+ * well formed.
+ */
+void JSONReader::SkipValue()
+{
+  // the containers entered so far, tracked explicitly so that deeply nested input can not exhaust
+  // the stack
+  std::vector<char> open_containers{};
+
+  for (;;)
+  {
+    // consume a single value, entering it if it is a non-empty container
+    switch (PeekType())
+    {
+    case ValueType::OBJECT:
+      ++cursor_;
+      if (Current() == '}')
+      {
+        ++cursor_;
+        break;
+      }
+
+      open_containers.push_back('{');
+      ReadString();
+      Expect(':');
+      continue;
+
+    case ValueType::ARRAY:
+      ++cursor_;
+      if (Current() == ']')
+      {
+        ++cursor_;
+        break;
+      }
+
+      open_containers.push_back('[');
+      continue;
+
+    case ValueType::STRING:
+      ReadString();
+      break;
+
+    default:
+      ReadScalar();
+      break;
+    }
+
+    // close every container which has been completed, then move on to the next value
+    while (!open_containers.empty())
+    {
+      bool const in_object = (open_containers.back() == '{');
+      char const next      = Current();
+      char const closing   = in_object ? '}' : ']';
+
+      if (next == closing)
+      {
+        ++cursor_;
+        open_containers.pop_back();
+        continue;
+      }
+
+      Expect(',');
+
+      if (in_object)
+      {
+        ReadString();
+        Expect(':');
+      }
+
+      break;
+    }
+
+    if (open_containers.empty())
+    {
+      return;
+    }
+  }
+}
+
+char JSONReader::Current() const
+{
+  if (cursor_ >= index_.size())
+  {
+    throw JSONParseException("Unexpected end of JSON document");
+  }
+
+  return static_cast<char>(document_[index_[cursor_]]);
+}
+
+char JSONReader::Previous() const
+{
+  return (cursor_ == 0) ? '\0' : static_cast<char>(document_[index_[cursor_ - 1]]);
+}
+
+void JSONReader::Expect(char c)
+{
+  if (Current() != c)
+  {
+    throw JSONParseException(std::string("Expected '") + c + "' but found '" + Current() + "'");
+  }
+
+  ++cursor_;
+}
+
+JSONReader::ConstByteArray JSONReader::Unescape(std::size_t start, std::size_t end) const
+{
+  // the decoded string is never longer than the encoded one
+  byte_array::ByteArray output;
+  output.Resize(end - start);
+
+  std::size_t length = 0;
+  for (std::size_t i = start; i < end; ++i)
+  {
+    auto const c = static_cast<char>(document_[i]);
+    if (c != '\\')
+    {
+      output[length++] = static_cast<uint8_t>(c);
+      continue;
+    }
+
+    ++i;
+    switch (static_cast<char>(document_[i]))
+    {
+    case '"':
+      output[length++] = '"';
+      break;
+    case '\\':
+      output[length++] = '\\';
+      break;
+    case '/':
+      output[length++] = '/';
+      break;
+    case 'b':
+      output[length++] = '\b';
+      break;
+    case 'f':
+      output[length++] = '\f';
+      break;
+    case 'n':
+      output[length++] = '\n';
+      break;
+    case 'r':
+      output[length++] = '\r';
+      break;
+    case 't':
+      output[length++] = '\t';
+      break;
+    case 'u':
+    {
+      auto const read_code_unit = [this, end](std::size_t position) {
+        if (position + 4 > end)
+        {
+          throw JSONParseException("Truncated unicode escape sequence");
+        }
+
+        uint32_t value = 0;
+        for (std::size_t j = position; j < position + 4; ++j)
+        {
+          value = (value << 4u) | HexValue(static_cast<char>(document_[j]));
+        }
+
+        return value;
+      };
+
+      uint32_t code_point = read_code_unit(i + 1);
+      i += 4;
+
+      // combine surrogate pairs
+      if ((code_point >= 0xD800u) && (code_point < 0xDC00u) && (i + 2 < end) &&
+          (document_[i + 1] == '\\') && (document_[i + 2] == 'u'))
+      {
+        uint32_t const low = read_code_unit(i + 3);
+        if ((low >= 0xDC00u) && (low < 0xE000u))
+        {
+          code_point = 0x10000u + ((code_point - 0xD800u) << 10u) + (low - 0xDC00u);
+          i += 6;
+        }
+      }
+
+      AppendUtf8(output, length, code_point);
+      break;
+    }
+    default:
+      throw JSONParseException("Invalid escape sequence in JSON string");
+    }
+  }
+
+  output.Resize(length);
+  return {output};
+}
+
+}  // namespace json
+}  // namespace fetch
@@ -0,0 +1,268 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "json/structural_index.hpp"
+
+#include <cstring>
+#include <limits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace fetch {
+namespace json {
+namespace {
+
+constexpr uint64_t EVEN_BITS = 0x5555555555555555ull;
+constexpr uint64_t ODD_BITS  = ~EVEN_BITS;
+
+/**
+ * Character class masks of a single block, one bit per byte
+ */
+struct BlockMasks
+{
+  uint64_t quote{0};
+  uint64_t backslash{0};
+  uint64_t op{0};
+  uint64_t whitespace{0};
+};
+
+#if defined(__AVX2__)
+
+uint64_t Equal(__m256i const &lo, __m256i const &hi, char c)
+{
+  __m256i const needle = _mm256_set1_epi8(c);
+
+  auto const lo_bits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, needle)));
+  auto const hi_bits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, needle)));
+
+  return uint64_t{lo_bits} | (uint64_t{hi_bits} << 32u);
+}
+
+BlockMasks Classify(uint8_t const *block)
+{
+  __m256i const lo = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(block));
+  __m256i const hi = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(block + 32));
+
+  BlockMasks masks;
+  masks.quote     = Equal(lo, hi, '"');
+  masks.backslash = Equal(lo, hi, '\\');
+  masks.op = Equal(lo, hi, '{') | Equal(lo, hi, '}') | Equal(lo, hi, '[') | Equal(lo, hi, ']') |
+             Equal(lo, hi, ':') | Equal(lo, hi, ',');
+  masks.whitespace =
+      Equal(lo, hi, ' ') | Equal(lo, hi, '\t') | Equal(lo, hi, '\n') | Equal(lo, hi, '\r');
+
+  return masks;
+}
+
+#elif defined(__SSE2__)
+
+uint64_t Equal(__m128i const *chunks, char c)
+{
+  __m128i const needle = _mm_set1_epi8(c);
+
+  uint64_t bits = 0;
+  for (uint32_t i = 0; i < 4u; ++i)
+  {
+    auto const chunk_bits =
+        static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunks[i], needle)));
+    bits |= uint64_t{chunk_bits} << (16u * i);
+  }
+
+  return bits;
+}
+
+BlockMasks Classify(uint8_t const *block)
+{
+  __m128i chunks[4];
+  for (uint32_t i = 0; i < 4u; ++i)
+  {
+    chunks[i] = _mm_loadu_si128(reinterpret_cast<__m128i const *>(block + (16u * i)));
+  }
+
+  BlockMasks masks;
+  masks.quote     = Equal(chunks, '"');
+  masks.backslash = Equal(chunks, '\\');
+  masks.op = Equal(chunks, '{') | Equal(chunks, '}') | Equal(chunks, '[') | Equal(chunks, ']') |
+             Equal(chunks, ':') | Equal(chunks, ',');
+  masks.whitespace =
+      Equal(chunks, ' ') | Equal(chunks, '\t') | Equal(chunks, '\n') | Equal(chunks, '\r');
+
+  return masks;
+}
+
+#else
+
+BlockMasks Classify(uint8_t const *block)
+{
+  BlockMasks masks;
+  for (uint32_t i = 0; i < StructuralIndex::BLOCK_SIZE; ++i)
+  {
+    uint64_t const bit = uint64_t{1} << i;
+
+    switch (block[i])
+    {
+    case '"':
+      masks.quote |= bit;
+      break;
+    case '\\':
+      masks.backslash |= bit;
+      break;
+    case '{':
+    case '}':
+    case '[':
+    case ']':
+    case ':':
+    case ',':
+      masks.op |= bit;
+      break;
+    case ' ':
+    case '\t':
+    case '\n':
+    case '\r':
+      masks.whitespace |= bit;
+      break;
+    default:
+      break;
+    }
+  }
+
+  return masks;
+}
+
+#endif
+
+/**
+ * Compute the positions of the characters which are escaped by an odd length run of backslashes
+ *
+ * @param backslash The backslash mask of the block
+ * @param prev_ends_odd Carry between blocks: set if the previous block ended in an odd run
+ * @return The mask of escaped characters
+ */
+uint64_t FindEscaped(uint64_t backslash, uint64_t &prev_ends_odd)
+{
+  uint64_t const start_edges     = backslash & ~(backslash << 1u);
+  uint64_t const even_start_mask = EVEN_BITS ^ prev_ends_odd;
+  uint64_t const even_starts     = start_edges & even_start_mask;
+  uint64_t const odd_starts      = start_edges & ~even_start_mask;
+  uint64_t const even_carries    = backslash + even_starts;
+
+  uint64_t   odd_carries = backslash + odd_starts;
+  bool const ends_odd    = odd_carries < backslash;  // overflow of the addition
+  odd_carries |= prev_ends_odd;
+  prev_ends_odd = ends_odd ? 1u : 0u;
+
+  uint64_t const even_carry_ends = even_carries & ~backslash;
+  uint64_t const odd_carry_ends  = odd_carries & ~backslash;
+
+  return (even_carry_ends & ODD_BITS) | (odd_carry_ends & EVEN_BITS);
+}
+
+/**
+ * Turn the mask of (unescaped) quotes into a mask covering the inside of strings, including the
+ * opening quote but not the closing one
+ */
+uint64_t PrefixXor(uint64_t bits)
+{
+  bits ^= bits << 1u;
+  bits ^= bits << 2u;
+  bits ^= bits << 4u;
+  bits ^= bits << 8u;
+  bits ^= bits << 16u;
+  bits ^= bits << 32u;
+
+  return bits;
+}
+
+void AppendPositions(StructuralIndex::Positions &positions, uint64_t bits, uint32_t offset)
+{
+  while (bits != 0)
+  {
+    positions.push_back(offset + static_cast<uint32_t>(__builtin_ctzll(bits)));
+    bits &= bits - 1u;
+  }
+}
+
+}  // namespace
+
+constexpr std::size_t StructuralIndex::BLOCK_SIZE;
+
+/**
+ * Build the structural index of a document
+ *
+ * @param document The document to be indexed
+ * @return true if successful, false if the document ends inside a string or is too large
+ */
+bool StructuralIndex::Build(ConstByteArray const &document)
+{
+  positions_.clear();
+
+  if (document.size() >= std::numeric_limits<uint32_t>::max())
+  {
+    return false;
+  }
+
+  // structural characters typically make up a sizeable fraction of transaction payloads
+  positions_.reserve(document.size() / 8u);
+
+  auto const *data = document.pointer();
+  auto const  size = document.size();
+
+  uint64_t prev_ends_odd  = 0;
+  uint64_t prev_in_string = 0;
+  uint64_t prev_scalar    = 0;
+
+  for (std::size_t offset = 0; offset < size; offset += BLOCK_SIZE)
+  {
+    uint8_t const *block = data + offset;
+
+    // the final partial block is padded with whitespace
+    uint8_t padded[BLOCK_SIZE];
+    if (offset + BLOCK_SIZE > size)
+    {
+      std::memset(padded, ' ', BLOCK_SIZE);
+      std::memcpy(padded, block, size - offset);
+      block = padded;
+    }
+
+    BlockMasks const masks = Classify(block);
+
+    uint64_t const escaped   = FindEscaped(masks.backslash, prev_ends_odd);
+    uint64_t const quote     = masks.quote & ~escaped;
+    uint64_t const in_string = PrefixXor(quote) ^ prev_in_string;
+    prev_in_string           = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+    // the first character of each number or keyword, i.e. scalars not preceded by another scalar
+    uint64_t const scalar        = ~(masks.op | masks.whitespace | quote) & ~in_string;
+    uint64_t const scalar_starts = scalar & ~((scalar << 1u) | prev_scalar);
+    prev_scalar                  = scalar >> 63u;
+
+    uint64_t const structurals = (masks.op & ~in_string) | (quote & in_string) | scalar_starts;
+
+    AppendPositions(positions_, structurals, static_cast<uint32_t>(offset));
+  }
+
+  // an unterminated string leaves the final block inside a string
+  return prev_in_string == 0;
+}
+
+}  // namespace json
+}  // namespace fetch
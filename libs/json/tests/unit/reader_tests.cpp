@@ -0,0 +1,182 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "json/exceptions.hpp"
+#include "json/reader.hpp"
+#include "json/structural_index.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <string>
+
+using fetch::byte_array::ConstByteArray;
+using fetch::json::JSONParseException;
+using fetch::json::JSONReader;
+using fetch::json::StructuralIndex;
+
+TEST(JsonReaderTests, StructuralIndexSkipsStringContents)
+{
+  // place escaped quotes and backslashes either side of the 64 byte block boundaries
+  std::string const padding(60, 'x');
+  std::string const text = R"({"a":")" + padding + R"(\"{[,:\\",)" +
+                           R"("b" : [ 12, true ,null ],)" + R"("c":")" + padding + padding +
+                           R"(\\\"\\"})";
+
+  StructuralIndex index;
+  ASSERT_TRUE(index.Build(text));
+
+  std::string structure;
+  for (auto const position : index.positions())
+  {
+    structure.push_back(text[position]);
+  }
+
+  EXPECT_EQ(structure, R"({":",":[1,t,n],":"})");
+}
+
+TEST(JsonReaderTests, UnterminatedStringIsRejected)
+{
+  EXPECT_THROW(JSONReader{R"({"a": "abc\"})"}, JSONParseException);
+}
+
+TEST(JsonReaderTests, ReadsValuesOnDemand)
+{
+  JSONReader reader{R"( [ {"skip": {"nested": [1, {"x": "]"}]}, "name": "a\/bé\n", "n": -1.5e3},
+                         "plain", 42, [] ] )"};
+
+  ConstByteArray key;
+
+  ASSERT_EQ(reader.PeekType(), JSONReader::ValueType::ARRAY);
+  reader.EnterArray();
+
+  ASSERT_TRUE(reader.NextElement());
+  ASSERT_EQ(reader.PeekType(), JSONReader::ValueType::OBJECT);
+  reader.EnterObject();
+
+  ASSERT_TRUE(reader.NextField(key));
+  EXPECT_EQ(key, "skip");
+  reader.SkipValue();
+
+  ASSERT_TRUE(reader.NextField(key));
+  EXPECT_EQ(key, "name");
+  EXPECT_EQ(reader.ReadString(), std::string("a/b\xc3\xa9\n"));
+
+  ASSERT_TRUE(reader.NextField(key));
+  EXPECT_EQ(key, "n");
+  ASSERT_EQ(reader.PeekType(), JSONReader::ValueType::NUMBER);
+  EXPECT_EQ(reader.ReadScalar(), "-1.5e3");
+
+  EXPECT_FALSE(reader.NextField(key));
+
+  ASSERT_TRUE(reader.NextElement());
+  EXPECT_EQ(reader.ReadString(), "plain");
+
+  ASSERT_TRUE(reader.NextElement());
+  EXPECT_EQ(reader.ReadScalar(), "42");
+
+  ASSERT_TRUE(reader.NextElement());
+  reader.EnterArray();
+  EXPECT_FALSE(reader.NextElement());
+
+  EXPECT_FALSE(reader.NextElement());
+  EXPECT_TRUE(reader.AtEnd());
+}
+
+TEST(JsonReaderTests, MalformedDocumentsThrow)
+{
+  auto const walk = [](char const *text) {
+    JSONReader reader{text};
+    reader.SkipValue();
+  };
+
+  EXPECT_THROW(walk("[1, 2}"), JSONParseException);
+  EXPECT_THROW(walk("{\"a\": [1, 2"), JSONParseException);
+  EXPECT_THROW(walk(""), JSONParseException);
+
+  JSONReader     reader{R"({"a" 1})"};
+  ConstByteArray key;
+  reader.EnterObject();
+  EXPECT_THROW(reader.NextField(key), JSONParseException);
+
+  JSONReader missing_comma{"[1 2]"};
+  missing_comma.EnterArray();
+  ASSERT_TRUE(missing_comma.NextElement());
+  missing_comma.ReadScalar();
+  EXPECT_THROW(missing_comma.NextElement(), JSONParseException);
+}
+
+TEST(JsonReaderTests, SkippedValuesAreValidated)
+{
+  auto const skip = [](char const *text) {
+    JSONReader reader{text};
+    reader.SkipValue();
+    return reader.AtEnd();
+  };
+
+  EXPECT_TRUE(skip(R"({"a": [1, -0.5e+3, "xé", {}, [], true, false, null], "b": {"c": 0}})"));
+  EXPECT_TRUE(skip("[[[[]]]]"));
+
+  // separators
+  EXPECT_THROW(skip("[1, 2,]"), JSONParseException);
+  EXPECT_THROW(skip(R"({"a": 1,})"), JSONParseException);
+  EXPECT_THROW(skip("[1 2]"), JSONParseException);
+  EXPECT_THROW(skip(R"({"a": 1 "b": 2})"), JSONParseException);
+  EXPECT_THROW(skip("[,1]"), JSONParseException);
+  EXPECT_THROW(skip(R"({"a" 1})"), JSONParseException);
+  EXPECT_THROW(skip(R"({"a": })"), JSONParseException);
+  EXPECT_THROW(skip(R"({"a": 1: 2})"), JSONParseException);
+  EXPECT_THROW(skip("[1: 2]"), JSONParseException);
+
+  // keys
+  EXPECT_THROW(skip("{a: 1}"), JSONParseException);
+  EXPECT_THROW(skip("{1: 1}"), JSONParseException);
+
+  // scalars
+  EXPECT_THROW(skip("[tru]"), JSONParseException);
+  EXPECT_THROW(skip("[nul]"), JSONParseException);
+  EXPECT_THROW(skip("[01]"), JSONParseException);
+  EXPECT_THROW(skip("[1.]"), JSONParseException);
+  EXPECT_THROW(skip("[.5]"), JSONParseException);
+  EXPECT_THROW(skip("[1e]"), JSONParseException);
+  EXPECT_THROW(skip("[--1]"), JSONParseException);
+  EXPECT_THROW(skip("[0x10]"), JSONParseException);
+  EXPECT_THROW(skip("[NaN]"), JSONParseException);
+
+  // strings
+  EXPECT_THROW(skip(R"(["\q"])"), JSONParseException);
+  EXPECT_THROW(skip(R"(["\u12g4"])"), JSONParseException);
+  EXPECT_THROW(skip(R"({"\x": 1})"), JSONParseException);
+
+  // nesting
+  EXPECT_THROW(skip("[{]}"), JSONParseException);
+  EXPECT_THROW(skip("[[]"), JSONParseException);
+}
+
+TEST(JsonReaderTests, InvalidScalarsAreRejected)
+{
+  JSONReader reader{"[12, 1.5.2, trueish]"};
+  reader.EnterArray();
+
+  ASSERT_TRUE(reader.NextElement());
+  EXPECT_EQ(reader.ReadScalar(), "12");
+
+  ASSERT_TRUE(reader.NextElement());
+  EXPECT_THROW(reader.ReadScalar(), JSONParseException);
+}
@@ -0,0 +1,86 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "core/random/lcg.hpp"
+#include "crypto/identity.hpp"
+#include "ledger/consensus/stake_snapshot.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+using fetch::byte_array::ByteArray;
+using fetch::crypto::Identity;
+using fetch::ledger::StakeSnapshot;
+
+using RNG              = fetch::random::LinearCongruentialGenerator;
+using CabinetSelection = StakeSnapshot::CabinetSelection;
+
+constexpr std::size_t IDENTITY_SIZE     = 64;
+constexpr uint64_t    MAXIMUM_STAKE     = 10000;
+constexpr std::size_t CABINET_SIZE      = 200;
+constexpr uint64_t    BENCHMARK_ENTROPY = 42;
+constexpr uint64_t    STAKE_POOL_SEED   = 7;
+
+void FillStakePool(StakeSnapshot &snapshot, std::size_t count)
+{
+  RNG rng;
+  rng.Seed(STAKE_POOL_SEED);
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    ByteArray identifier;
+    identifier.Resize(IDENTITY_SIZE);
+    for (std::size_t j = 0; j < IDENTITY_SIZE; ++j)
+    {
+      identifier[j] = static_cast<uint8_t>(rng() >> 32u);
+    }
+
+    snapshot.UpdateStake(Identity{identifier}, 1 + (rng() % MAXIMUM_STAKE));
+  }
+}
+
+template <CabinetSelection SELECTION>
+void StakeSnapshot_BuildCabinet(benchmark::State &state)
+{
+  StakeSnapshot snapshot;
+  FillStakePool(snapshot, static_cast<std::size_t>(state.range(0)));
+  state.counters["Stakers"] = static_cast<double>(snapshot.size());
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(snapshot.BuildCabinet(BENCHMARK_ENTROPY, CABINET_SIZE, {}, SELECTION));
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(StakeSnapshot_BuildCabinet, CabinetSelection::SHUFFLED_SCAN)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(50000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(StakeSnapshot_BuildCabinet, CabinetSelection::WEIGHTED_SAMPLING)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(50000)
+    ->Unit(benchmark::kMillisecond);
@@ -28,6 +28,7 @@
 #include "moment/clocks.hpp"
 
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -81,8 +82,16 @@ public:
   bool     is_loose     = false;
   uint64_t chain_label{0};  ///< The label of a heaviest chain this block once belonged to
                             ///< A more detailed explanation in MainChain::HeaviestTip.
+  Digest   skip_hash;       ///< An earlier block of the same chain, used to skip down it
+                            ///< (see MainChain::LookupAncestor). Kept in chain storage.
+  /// The number of the block which began the aeon of this block, used to find it without walking
+  /// the chain (see MainChain::GetAeonBeginning). Kept in chain storage.
+  uint64_t aeon_beginning{UNKNOWN_AEON_BEGINNING};
   /// @}
 
+  /// Marks a block whose aeon beginning was not recorded when it was stored
+  static constexpr Index UNKNOWN_AEON_BEGINNING = std::numeric_limits<Index>::max();
+
   // Helper functions
   std::size_t GetTransactionCount() const;
   void        UpdateDigest();
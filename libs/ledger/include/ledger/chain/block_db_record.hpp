@@ -54,13 +54,17 @@ public:
 
   static uint8_t const BLOCK     = 1;
   static uint8_t const NEXT_HASH = 2;
+  static uint8_t const SKIP_HASH = 3;
+  static uint8_t const AEON      = 4;
 
   template <typename Constructor>
   static void Serialize(Constructor &map_constructor, Type const &dbRecord)
   {
-    auto map = map_constructor(2);
+    auto map = map_constructor(4);
     map.Append(BLOCK, dbRecord.block);
     map.Append(NEXT_HASH, dbRecord.next_hash);
+    map.Append(SKIP_HASH, dbRecord.block.skip_hash);
+    map.Append(AEON, dbRecord.block.aeon_beginning);
   }
 
   template <typename MapDeserializer>
@@ -68,6 +72,18 @@ public:
   {
     map.ExpectKeyGetValue(BLOCK, dbRecord.block);
     map.ExpectKeyGetValue(NEXT_HASH, dbRecord.next_hash);
+
+    // records written before skip hashes were introduced do not have one
+    if (map.size() > 2)
+    {
+      map.ExpectKeyGetValue(SKIP_HASH, dbRecord.block.skip_hash);
+    }
+
+    // nor do records written before aeon beginnings were, which leaves them unknown
+    if (map.size() > 3)
+    {
+      map.ExpectKeyGetValue(AEON, dbRecord.block.aeon_beginning);
+    }
   }
 };
 
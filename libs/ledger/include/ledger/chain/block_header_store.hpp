@@ -0,0 +1,124 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "chain/constants.hpp"
+#include "ledger/chain/block.hpp"
+#include "storage/random_access_stack.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace fetch {
+namespace ledger {
+
+/**
+ * The part of a block needed to navigate the chain, without any of its transactions
+ */
+struct BlockHeader
+{
+  using Weight = Block::Weight;
+
+  BlockHash hash;
+  BlockHash previous_hash;
+  BlockHash merkle_hash;
+  BlockHash skip_hash;  ///< See Block::skip_hash
+  BlockHash next_hash;  ///< The stored child of the block, empty when unknown
+  uint64_t  block_number{0};
+  Weight    weight{0};
+  Weight    total_weight{0};
+  uint64_t  timestamp{0};
+  uint64_t  aeon_beginning{Block::UNKNOWN_AEON_BEGINNING};  ///< See Block::aeon_beginning
+  uint32_t  log2_num_lanes{0};
+
+  BlockHeader() = default;
+  explicit BlockHeader(Block const &block);
+
+  bool IsGenesis() const;
+};
+
+/**
+ * Stores block headers as fixed size records in a single file, next to the block bodies kept by
+ * the chain's object store.
+ *
+ * Each record is a plain array of bytes so the file can be read without deserialising anything,
+ * and updating the forward reference of a stored block rewrites a single record in place. The
+ * slot of every record is kept in memory, keyed by the leading bytes of the block hash, and is
+ * rebuilt when the file is loaded. A file with records of an older layout is discarded on loading,
+ * since the headers can be recovered from the block bodies.
+ */
+class BlockHeaderStore
+{
+public:
+  void New(std::string const &filename);
+  void Load(std::string const &filename);
+  void Flush();
+
+  bool Get(BlockHash const &hash, BlockHeader &header) const;
+  bool Has(BlockHash const &hash) const;
+  bool Set(BlockHeader const &header);
+  bool SetNextHash(BlockHash const &hash, BlockHash const &next_hash);
+
+  std::size_t size() const;
+
+private:
+  using RawHash = std::array<uint8_t, chain::HASH_SIZE>;
+
+  enum : uint32_t
+  {
+    MERKLE_HASH_PRESENT = 1u << 0u,
+    SKIP_HASH_PRESENT   = 1u << 1u,
+    NEXT_HASH_PRESENT   = 1u << 2u
+  };
+
+  struct Record
+  {
+    RawHash  hash{};
+    RawHash  previous_hash{};
+    RawHash  merkle_hash{};
+    RawHash  skip_hash{};
+    RawHash  next_hash{};
+    uint64_t block_number{0};
+    uint64_t weight{0};
+    uint64_t total_weight{0};
+    uint64_t timestamp{0};
+    uint64_t aeon_beginning{0};
+    uint32_t log2_num_lanes{0};
+    uint32_t present{0};  ///< Which of the optional hashes are set
+  };
+
+  static_assert(sizeof(Record) == (5 * chain::HASH_SIZE) + (5 * sizeof(uint64_t)) + 8,
+                "Header records must not contain padding");
+
+  using Stack = storage::RandomAccessStack<Record>;
+  using Slots = std::unordered_multimap<uint64_t, uint64_t>;
+
+  static uint64_t Key(RawHash const &hash);
+  static uint64_t Key(BlockHash const &hash);
+
+  bool Find(BlockHash const &hash, uint64_t &slot, Record &record) const;
+
+  Stack stack_;
+  Slots slots_;  ///< Slot of each record, keyed by the leading bytes of its hash
+};
+
+}  // namespace ledger
+}  // namespace fetch
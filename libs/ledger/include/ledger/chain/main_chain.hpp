@@ -26,6 +26,7 @@
 #include "core/mutex.hpp"
 #include "crypto/fnv.hpp"
 #include "ledger/chain/block.hpp"
+#include "ledger/chain/block_header_store.hpp"
 #include "meta/type_util.hpp"
 #include "network/generics/milli_timer.hpp"
 #include "storage/object_store.hpp"
@@ -176,6 +177,8 @@ public:
   Blocks     GetHeaviestChain(uint64_t limit = UPPER_BOUND) const;
   Blocks     GetChainPreceding(BlockHash start, uint64_t limit = UPPER_BOUND) const;
   Travelogue TimeTravel(BlockHash current_hash, std::size_t limit = UPPER_BOUND) const;
+  BlockPtr   GetAncestor(BlockHash const &hash, uint64_t block_number) const;
+  BlockPtr   GetAeonBeginning(BlockHash const &hash) const;
   bool       GetPathToCommonAncestor(
             Blocks &blocks, BlockHash tip_hash, BlockHash node_hash, uint64_t limit = UPPER_BOUND,
             BehaviourWhenLimit behaviour = BehaviourWhenLimit::RETURN_MOST_RECENT) const;
@@ -215,6 +218,7 @@ private:
   using LooseBlockMap = std::unordered_map<BlockHash, BlockHashList>;
   using BlockStore    = fetch::storage::ObjectStore<DbRecord>;
   using BlockStorePtr = std::unique_ptr<BlockStore>;
+  using HeaderStorePtr = std::unique_ptr<BlockHeaderStore>;
   using RMutex        = std::recursive_mutex;
   using RLock         = std::unique_lock<RMutex>;
 
@@ -272,6 +276,7 @@ private:
   bool     LookupBlockFromCache(BlockHash const &hash, BlockPtr &block) const;
   bool     LookupBlockFromStorage(BlockHash const &hash, BlockPtr &block,
                                   BlockHash *next_hash = nullptr) const;
+  bool     LookupHeader(BlockHash const &hash, BlockHeader &header) const;
   bool     IsBlockInCache(BlockHash const &hash) const;
   void     AddBlockToCache(BlockPtr const &block) const;
   void     AddBlockToBloomFilter(Block const &block) const;
@@ -280,12 +285,23 @@ private:
   bool LookupReference(BlockHash const &hash, BlockHash &next_hash) const;
   /// @}t
 
+  /// @name Ancestry
+  /// @{
+  bool LookupAncestor(BlockHeader &header, uint64_t block_number) const;
+  bool LookupCommonAncestor(BlockHeader left, BlockHeader right, BlockHeader &ancestor) const;
+  void SetHeightIndex(uint64_t block_number, BlockHash const &hash);
+  bool LookupHeightIndex(uint64_t block_number, BlockHash &hash) const;
+  /// @}
+
   /// @name Low-level storage interface
   /// @{
   void                CacheBlock(BlockPtr const &block) const;
   BlockMap::size_type UncacheBlock(BlockHash const &hash) const;
   void                KeepBlock(BlockPtr const &block) const;
   bool LoadBlock(BlockHash const &hash, Block &block, BlockHash *next_hash = nullptr) const;
+  bool LoadHeader(BlockHash const &hash, BlockHeader &header) const;
+  void BackfillHeader(DbRecord const &record, BlockHeader &header) const;
+  void CacheStoredReferences(BlockHeader const &header) const;
   /// @}
 
   /// @name Tip Management
@@ -294,7 +310,7 @@ private:
   bool     UpdateTips(BlockPtr const &block);
   bool     DetermineHeaviestTip();
   bool     UpdateHeaviestTip(BlockPtr const &block);
-  BlockPtr HeaviestChainBlockAbove(uint64_t limit) const;
+  bool     HeaviestChainHeaderAbove(uint64_t limit, BlockHeader &header) const;
   BlockPtr GetLabeledSubchainStart() const;
   /// @}
 
@@ -305,11 +321,16 @@ private:
 
   void FlushToDisk(bool flush_bloom = false);
 
-  Mode          mode_{Mode::IN_MEMORY_DB};
-  bool const    dirty_block_functionality_;
-  DirtyMap      dirty_map_;
-  BlockStorePtr block_store_;  ///< Long term storage and backup
-  std::fstream  head_store_;
+  Mode           mode_{Mode::IN_MEMORY_DB};
+  bool const     dirty_block_functionality_;
+  DirtyMap       dirty_map_;
+  BlockStorePtr  block_store_;   ///< Long term storage and backup
+  HeaderStorePtr header_store_;  ///< Headers of the blocks in the block store
+  std::fstream   head_store_;
+
+  ///< Hashes of the stored part of the heaviest chain, indexed by block number
+  mutable std::fstream height_store_;
+  uint64_t             height_index_size_{0};  ///< Number of valid entries in the height index
 
   mutable RMutex   lock_;         ///< Mutex protecting block_chain_, tips_ & heaviest_
   mutable BlockMap block_chain_;  ///< All recent blocks are kept in memory
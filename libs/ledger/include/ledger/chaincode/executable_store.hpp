@@ -0,0 +1,151 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "core/mutex.hpp"
+#include "crypto/fnv.hpp"  // needed for std::hash<ConstByteArray>
+#include "storage/object_store.hpp"
+#include "telemetry/telemetry.hpp"
+#include "vm/executable_serializers.hpp"
+#include "vm/generator.hpp"
+#include "vm/module.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fetch {
+namespace ledger {
+
+/**
+ * Compiled executables stored alongside the fingerprint of the module they were compiled against
+ */
+struct CompiledExecutable
+{
+  byte_array::ConstByteArray module_fingerprint;
+  vm::Executable             executable;
+};
+
+/**
+ * Process wide, content addressed store of compiled smart contract executables.
+ *
+ * Executables are keyed by the digest of the contract source. They are shared between all of the
+ * executors in memory and, once a database has been attached, persisted so that contracts do not
+ * need to be recompiled after a restart.
+ */
+class ExecutableStore
+{
+public:
+  using ConstByteArray = byte_array::ConstByteArray;
+  using ExecutablePtr  = std::shared_ptr<vm::Executable const>;
+  using ModulePtr      = std::shared_ptr<vm::Module>;
+  using Errors         = std::vector<std::string>;
+
+  static constexpr char const *LOGGING_NAME = "ExecutableStore";
+
+  /// The maximum number of executables kept in memory
+  static constexpr std::size_t MAX_CACHED_EXECUTABLES = 1024;
+
+  static ExecutableStore &Instance();
+
+  // Construction / Destruction
+  ExecutableStore();
+  ExecutableStore(ExecutableStore const &) = delete;
+  ExecutableStore(ExecutableStore &&)      = delete;
+  ~ExecutableStore()                       = default;
+
+  void Load(std::string const &doc_file, std::string const &index_file);
+
+  ExecutablePtr GetOrCompile(ConstByteArray const &digest, ModulePtr const &module,
+                             vm::SourceFiles const &files, Errors &errors);
+
+  std::size_t size() const;
+  void        Clear();
+
+  // Operators
+  ExecutableStore &operator=(ExecutableStore const &) = delete;
+  ExecutableStore &operator=(ExecutableStore &&) = delete;
+
+  static ConstByteArray Fingerprint(vm::Module const &module);
+
+private:
+  struct Entry
+  {
+    ConstByteArray module_fingerprint;
+    ExecutablePtr  executable;
+  };
+
+  using Cache      = std::unordered_map<ConstByteArray, Entry>;
+  using StorePtr   = std::unique_ptr<storage::ObjectStore<CompiledExecutable>>;
+  using CounterPtr = telemetry::CounterPtr;
+
+  ExecutablePtr LookupInMemory(ConstByteArray const &digest, ConstByteArray const &fingerprint);
+  ExecutablePtr LookupOnDisk(ConstByteArray const &digest, ConstByteArray const &fingerprint);
+  void          Persist(ConstByteArray const &digest, ConstByteArray const &fingerprint,
+                        vm::Executable const &executable);
+  void          Insert(ConstByteArray const &digest, ConstByteArray const &fingerprint,
+                       ExecutablePtr const &executable);
+
+  mutable Mutex lock_;  ///< Protects the in memory cache
+  Cache         cache_;
+
+  // disk access is serialised separately, so that memory hits are not held up by it
+  mutable Mutex store_lock_;
+  StorePtr      store_;
+
+  CounterPtr memory_hits_;
+  CounterPtr disk_hits_;
+  CounterPtr compilations_;
+};
+
+}  // namespace ledger
+
+namespace serializers {
+
+template <typename D>
+struct MapSerializer<ledger::CompiledExecutable, D>
+{
+public:
+  using Type       = ledger::CompiledExecutable;
+  using DriverType = D;
+
+  static uint8_t const MODULE_FINGERPRINT = 1;
+  static uint8_t const EXECUTABLE         = 2;
+
+  template <typename Constructor>
+  static void Serialize(Constructor &map_constructor, Type const &compiled)
+  {
+    auto map = map_constructor(2);
+    map.Append(MODULE_FINGERPRINT, compiled.module_fingerprint);
+    map.Append(EXECUTABLE, compiled.executable);
+  }
+
+  template <typename MapDeserializer>
+  static void Deserialize(MapDeserializer &map, Type &compiled)
+  {
+    map.ExpectKeyGetValue(MODULE_FINGERPRINT, compiled.module_fingerprint);
+    map.ExpectKeyGetValue(EXECUTABLE, compiled.executable);
+  }
+};
+
+}  // namespace serializers
+}  // namespace fetch
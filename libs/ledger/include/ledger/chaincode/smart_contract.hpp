@@ -47,7 +47,7 @@ class SmartContract : public Contract
 public:
   using ConstByteArray = byte_array::ConstByteArray;
   using Executable     = fetch::vm::Executable;
-  using ExecutablePtr  = std::shared_ptr<Executable>;
+  using ExecutablePtr  = std::shared_ptr<Executable const>;
 
   // Construction / Destruction
   explicit SmartContract(std::string const &source);
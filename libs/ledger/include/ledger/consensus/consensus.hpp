@@ -22,6 +22,7 @@
 #include "beacon/event_manager.hpp"
 #include "chain/address.hpp"
 #include "crypto/identity.hpp"
+#include "crypto/verified_signature_cache.hpp"
 #include "ledger/chain/main_chain.hpp"
 #include "ledger/consensus/consensus_interface.hpp"
 #include "ledger/consensus/stake_manager.hpp"
@@ -29,6 +30,7 @@
 #include "telemetry/telemetry.hpp"
 
 #include <cmath>
+#include <functional>
 #include <unordered_map>
 
 namespace fetch {
@@ -49,6 +51,7 @@ public:
   using BlockEntropy          = ledger::Block::BlockEntropy;
   using NotarisationPtr       = std::shared_ptr<ledger::NotarisationService>;
   using NotarisationResult    = NotarisationService::NotarisationResult;
+  using ConsensusInterface::Blocks;
   using ConsensusInterface::NextBlockPtr;
 
   // Construction / Destruction
@@ -64,6 +67,7 @@ public:
   NextBlockPtr GenerateNextBlock() override;
   Status       ValidBlock(Block const &current) const override;
   bool         VerifyNotarisation(Block const &block) const;
+  void         VerifyNotarisations(Blocks const &blocks) const override;
 
   void SetMaxCabinetSize(uint16_t size) override;
   void SetBlockInterval(uint64_t block_interval_ms) override;
@@ -113,12 +117,21 @@ private:
   CabinetHistory cabinet_history_{};  ///< Cache of historical cabinets
   uint64_t       block_interval_ms_{std::numeric_limits<uint64_t>::max()};
 
-  Block                      GetBeginningOfAeon(Block const &current, MainChain const &chain) const;
+  using PriorBlockLookup = std::function<BlockPtr(Block const &)>;
+
+  Block GetBeginningOfAeon(Block const &current, MainChain const &chain) const;
+  Block GetBeginningOfAeon(Block const &current, MainChain const &chain,
+                           PriorBlockLookup const &prior_to, bool update_cache) const;
   mutable AeonBeginningCache aeon_beginning_cache_;
 
   NotarisationPtr notarisation_;
   mutable Mutex   mutex_;
 
+  // Signatures which have already been verified, so that blocks seen more than once (or verified
+  // ahead of validation during sync) are not re-verified
+  mutable crypto::VerifiedSignatureCache verified_notarisations_;
+  mutable crypto::VerifiedSignatureCache verified_entropy_;
+
   CabinetPtr GetCabinet(Block const &previous) const;
 
   bool     ValidBlockTiming(Block const &previous, Block const &proposed) const;
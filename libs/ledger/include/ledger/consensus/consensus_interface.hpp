@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace fetch {
 namespace ledger {
@@ -33,6 +34,7 @@ class ConsensusInterface
 {
 public:
   using NextBlockPtr   = std::unique_ptr<Block>;
+  using Blocks         = std::vector<std::shared_ptr<Block>>;
   using StakeSnapshot  = ledger::StakeSnapshot;
   using Minerwhitelist = beacon::BlockEntropy::Cabinet;
 
@@ -57,6 +59,12 @@ public:
   // Verify a block according to consensus requirements. It must not be loose.
   virtual Status ValidBlock(Block const &current) const = 0;
 
+  // Optionally check the signatures of a sequence of blocks, ordered earliest to latest, ahead of
+  // them being validated one at a time with ValidBlock. This does not accept or reject any block,
+  // it only makes the subsequent validation cheaper.
+  virtual void VerifyNotarisations(Blocks const & /*blocks*/) const
+  {}
+
   // Set system parameters
   virtual void SetMaxCabinetSize(uint16_t max_cabinet_size)                    = 0;
   virtual void SetBlockInterval(uint64_t block_interval_s)                     = 0;
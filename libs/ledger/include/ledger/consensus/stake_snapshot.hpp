@@ -47,6 +47,16 @@ public:
     uint64_t stake;
   };
 
+  /**
+   * The schemes by which a cabinet can be selected. The cabinet of a block must always be selected
+   * with the same scheme, so new schemes are added alongside the existing ones.
+   */
+  enum class CabinetSelection : uint8_t
+  {
+    SHUFFLED_SCAN = 0,  ///< Shuffle and scan all of the stakes for each cabinet member
+    WEIGHTED_SAMPLING   ///< Sample without replacement from a Fenwick tree of the stakes
+  };
+
   static constexpr char const *LOGGING_NAME = "StakeSnapshot";
 
   // Construction / Destruction
@@ -56,7 +66,8 @@ public:
   ~StakeSnapshot()                     = default;
 
   CabinetPtr BuildCabinet(uint64_t entropy, std::size_t count,
-                          std::set<byte_array::ConstByteArray> const &whitelist = {}) const;
+                          std::set<byte_array::ConstByteArray> const &whitelist = {},
+                          CabinetSelection selection = CabinetSelection::SHUFFLED_SCAN) const;
 
   /// @name Stake Updates
   /// @{
@@ -82,6 +93,11 @@ private:
   using IdentityIndex = std::unordered_map<Identity, RecordPtr>;
   using StakeIndex    = std::vector<RecordPtr>;
 
+  void SelectByShuffledScan(uint64_t entropy, std::size_t count, StakeIndex &stake_index,
+                            Cabinet &cabinet) const;
+  static void SelectByWeightedSampling(uint64_t entropy, std::size_t count,
+                                       StakeIndex &stake_index, Cabinet &cabinet);
+
   IdentityIndex identity_index_{};  ///< Map of Identity to Record
   StakeIndex    stake_index_;       ///< Array of Records
   uint64_t      total_stake_{0};    ///< Total stake cache
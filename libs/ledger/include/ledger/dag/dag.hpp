@@ -34,6 +34,7 @@
 
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <limits>
 #include <list>
 #include <queue>
@@ -87,6 +88,8 @@ private:
   using Mutex           = std::recursive_mutex;
   using CertificatePtr  = std::shared_ptr<crypto::Prover>;
   using DAGTypes        = DAGInterface::DAGTypes;
+  using NodeID          = uint32_t;
+  using NodeIDs         = std::vector<NodeID>;
 
 public:
   using MissingNodeHashes = std::set<NodeHash>;
@@ -159,7 +162,11 @@ private:
   // volatile state
   std::unordered_map<DAGTipID, DAGTipPtr>               all_tips_;  // All tips are here
   std::unordered_map<NodeHash, DAGTipPtr>               tips_;  // look up tips of the dag pointing at a certain node hash
-  std::unordered_map<NodeHash, DAGNodePtr>              node_pool_;  // dag nodes that are not finalised but are still valid
+  std::unordered_map<NodeHash, NodeID>                  node_ids_;  // dag nodes that are not finalised but are still valid (the node pool)
+  std::vector<DAGNodePtr>                               nodes_;  // pool nodes by id, empty once removed from the pool
+  std::vector<std::size_t>                              previous_offsets_{0};  // references of node id are previous_ids_[offsets[id], offsets[id + 1])
+  NodeIDs                                               previous_ids_;  // referenced node ids, INVALID_NODE_ID when outside of the pool
+  std::unordered_map<DAGHash, uint64_t>                 recent_hashes_;  // epochs still in the validity period and their nodes, to the epoch block number
   std::unordered_map<NodeHash, DAGNodePtr>              loose_nodes_;  // nodes that are missing one or more references (waiting on NodeHash)
   std::unordered_map<NodeHash, std::vector<DAGNodePtr>> loose_nodes_lookup_;  // nodes that are missing one or more references (waiting on NodeHash)
   // clang-format on
@@ -171,6 +178,8 @@ private:
   std::vector<DAGNode> recently_added_;  // nodes that have been recently added
   std::set<NodeHash>   missing_;         // node hashes that we know are missing
 
+  static constexpr NodeID INVALID_NODE_ID = std::numeric_limits<NodeID>::max();
+
   // Internal functions don't need locking and can recursively call themselves etc.
   bool       PushInternal(DAGNodePtr const &node);
   bool       AlreadySeenInternal(DAGNodePtr const &node) const;
@@ -185,13 +194,24 @@ private:
   bool       NodeInvalidInternal(DAGNodePtr const &node);
   DAGNodePtr GetDAGNodeInternal(DAGHash const &hash, bool including_loose,
                                 bool &was_loose);  // const
-  void       TraverseFromTips(std::set<DAGHash> const &            tip_hashes,
-                              std::function<void(NodeHash)> const &on_node,
-                              std::function<bool(NodeHash)> const &terminating_condition);
+  void       TraverseFromTips(std::set<DAGHash> const &          tip_hashes,
+                              std::function<bool(NodeID)> const &on_node);
   bool       GetEpochFromStorage(std::string const &identifier, DAGEpoch &epoch);
   bool       SetEpochInStorage(std::string const & /*unused*/, DAGEpoch const &epoch, bool is_head);
   void       Flush();
 
+  // Node pool, with the nodes interned to dense ids in the order they were added
+  DAGNodePtr LookupPoolNodeInternal(NodeHash const &hash) const;
+  void       AddPoolNodeInternal(DAGNodePtr const &node);
+  void       RemovePoolNodeInternal(NodeHash const &hash);
+  void       CompactPoolInternal();
+  void       ClearPoolInternal();
+
+  // Index of the epochs still in the validity period
+  void IndexEpochInternal(DAGEpoch const &epoch);
+  void UnindexEpochInternal(DAGEpoch const &epoch);
+  void RebuildEpochIndexInternal();
+
   void DeleteTip(DAGTipID tip_id);
   void DeleteTip(NodeHash const &hash);
 
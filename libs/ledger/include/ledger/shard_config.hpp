@@ -58,7 +58,7 @@ struct ShardConfig
 
   /// @name Tx Sync Configuration
   /// @{
-  std::size_t verification_threads{1};  ///< Num threads for tx verification
+  std::size_t verification_threads{0};  ///< Num threads for tx verification, zero for all cores
   Timeperiod  sync_service_timeout{5000};
   Timeperiod  sync_service_promise_timeout{30000};
   Timeperiod  sync_service_fetch_period{5000};
@@ -0,0 +1,69 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstddef>
+
+namespace fetch {
+namespace ledger {
+
+/**
+ * Throughput driven flow control for the number of requests kept in flight to a single peer.
+ *
+ * The window is evaluated in rounds: once as many responses as the current window have arrived,
+ * the rate at which objects were delivered during the round is compared with that of the previous
+ * round. The window keeps growing (doubling at first, then linearly) while doing so improves the
+ * delivery rate, shrinks when the rate drops off and is halved whenever a request fails.
+ */
+class AdaptiveSyncWindow
+{
+public:
+  using Clock     = std::chrono::steady_clock;
+  using Timepoint = Clock::time_point;
+
+  static constexpr std::size_t DEFAULT_INITIAL_WINDOW = 2;
+  static constexpr std::size_t DEFAULT_MAXIMUM_WINDOW = 32;
+
+  // Construction / Destruction
+  explicit AdaptiveSyncWindow(std::size_t initial_window = DEFAULT_INITIAL_WINDOW,
+                              std::size_t maximum_window = DEFAULT_MAXIMUM_WINDOW,
+                              Timepoint   now            = Clock::now());
+  ~AdaptiveSyncWindow() = default;
+
+  void OnSuccess(std::size_t num_objects, Timepoint now = Clock::now());
+  void OnFailure(Timepoint now = Clock::now());
+
+  std::size_t window() const;
+  double      rate() const;
+
+private:
+  void StartRound(Timepoint now);
+
+  std::size_t const maximum_window_;
+  std::size_t       window_;
+  bool              slow_start_{true};
+  double            rate_{0.0};  ///< Objects per second delivered in the last complete round
+
+  std::size_t round_responses_{0};
+  std::size_t round_objects_{0};
+  Timepoint   round_start_;
+};
+
+}  // namespace ledger
+}  // namespace fetch
@@ -73,6 +73,7 @@ public:
   Document GetOrCreate(ResourceAddress const &key) override;
   Document Get(ResourceAddress const &key) const override;
   void     Set(ResourceAddress const &key, StateValue const &value) override;
+  void     SetBatch(WriteBatch const &batch) override;
 
   void Reset() override;
 
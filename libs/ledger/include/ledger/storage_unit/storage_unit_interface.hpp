@@ -23,6 +23,7 @@
 #include "storage/document.hpp"
 #include "storage/resource_mapper.hpp"
 
+#include <utility>
 #include <vector>
 
 namespace fetch {
@@ -43,6 +44,7 @@ public:
   using StateValue      = byte_array::ConstByteArray;
   using ShardIndex      = uint32_t;
   using Keys            = std::vector<storage::ResourceID>;
+  using WriteBatch      = std::vector<std::pair<ResourceAddress, StateValue>>;
 
   // Construction / Destruction
   StorageInterface()          = default;
@@ -56,6 +58,19 @@ public:
   virtual bool     Lock(ShardIndex shard)                                   = 0;
   virtual bool     Unlock(ShardIndex shard)                                 = 0;
   virtual void     Reset()                                                  = 0;
+
+  /**
+   * Set a group of values, storage engines that can apply the updates together override this
+   *
+   * @param batch The key value pairs to be written, in order
+   */
+  virtual void SetBatch(WriteBatch const &batch)
+  {
+    for (auto const &entry : batch)
+    {
+      Set(entry.first, entry.second);
+    }
+  }
   /// @}
 };
 
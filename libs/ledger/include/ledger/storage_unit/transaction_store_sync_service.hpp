@@ -24,6 +24,7 @@
 #include "core/future_timepoint.hpp"
 #include "core/service_ids.hpp"
 #include "core/state_machine.hpp"
+#include "ledger/storage_unit/adaptive_sync_window.hpp"
 #include "ledger/storage_unit/lane_controller.hpp"
 #include "ledger/storage_unit/transaction_sinks.hpp"
 #include "ledger/transaction_verifier.hpp"
@@ -98,7 +99,7 @@ public:
   struct Config
   {
     uint32_t                  lane_id{0};
-    std::size_t               verification_threads{1};
+    std::size_t               verification_threads{0};  ///< Zero for one per hardware thread
     std::chrono::milliseconds main_timeout{5000};
     std::chrono::milliseconds promise_wait_timeout{2000};
     std::chrono::milliseconds fetch_object_wait_duration{5000};
@@ -147,6 +148,18 @@ private:
   State OnResolvingObjects();
   State OnTrimCache();
 
+  void UpdateSubtreeProgress();
+
+  /// Flow control of the subtree requests made to a single peer
+  struct SubtreePeer
+  {
+    AdaptiveSyncWindow window;
+    std::size_t        in_flight{0};
+  };
+
+  using SubtreePeers    = std::unordered_map<Address, SubtreePeer>;
+  using SubtreeRequests = std::unordered_map<uint64_t, Address>;  ///< Root to peer queried
+
   TrimCacheCallback                  trim_cache_callback_;
   std::shared_ptr<StateMachine>      state_machine_;
   TxFinderProtocol *                 tx_finder_protocol_;
@@ -165,9 +178,11 @@ private:
   RequestingSubTreeList pending_subtree_;
   RequestingTxList      pending_objects_;
 
-  std::queue<uint64_t>                                          roots_to_sync_;
-  uint64_t                                                      root_size_ = 0;
-  std::unordered_map<PromiseOfTxList::PromiseCounter, uint64_t> promise_id_to_roots_;
+  std::queue<uint64_t> roots_to_sync_;
+  uint64_t             root_size_ = 0;
+  SubtreePeers         subtree_peers_;
+  SubtreeRequests      subtree_requests_;
+  uint64_t             subtree_roots_completed_{0};
 
   std::atomic_bool is_ready_{false};
 
@@ -177,6 +192,12 @@ private:
   telemetry::CounterPtr         subtree_requests_total_;
   telemetry::CounterPtr         subtree_response_total_;
   telemetry::CounterPtr         subtree_failure_total_;
+  telemetry::CounterPtr         subtree_transactions_total_;
+  telemetry::GaugePtr<uint64_t> subtree_roots_total_;
+  telemetry::GaugePtr<uint64_t> subtree_roots_completed_total_;
+  telemetry::GaugePtr<uint64_t> subtree_requests_in_flight_;
+  telemetry::GaugePtr<uint64_t> subtree_request_window_;
+  telemetry::GaugePtr<uint64_t> subtree_sync_rate_;
   telemetry::GaugePtr<uint64_t> current_tss_state_;
   telemetry::GaugePtr<uint64_t> current_tss_peers_;
 };
@@ -20,6 +20,10 @@
 #include "core/digest.hpp"
 #include "ledger/execution_result.hpp"
 
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace fetch {
 namespace ledger {
 
@@ -68,6 +72,10 @@ public:
     ContractExecutionResult contract_exec_result{};
   };
 
+  using Digests          = std::vector<Digest>;
+  using TxStatuses       = std::vector<TxStatus>;
+  using ExecutionResults = std::vector<std::pair<Digest, ContractExecutionResult>>;
+
   // Factory Methods
   static TransactionStatusPtr CreateTimeBasedCache();
   static TransactionStatusPtr CreatePersistentCache();
@@ -102,6 +110,21 @@ public:
    * @param exec_result The contract execution result
    */
   virtual void Update(Digest digest, ContractExecutionResult exec_result) = 0;
+
+  /**
+   * Query the status of a number of transactions at once
+   *
+   * @param digests The digests of the transactions
+   * @return The status objects, in the same order as the digests
+   */
+  virtual TxStatuses QueryBatch(Digests const &digests) const = 0;
+
+  /**
+   * Update the contract execution results for a number of transactions at once
+   *
+   * @param results The transaction digests and their contract execution results
+   */
+  virtual void UpdateBatch(ExecutionResults const &results) = 0;
   /// @}
 };
 
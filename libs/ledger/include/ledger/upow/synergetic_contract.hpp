@@ -109,6 +109,7 @@ public:
 
   uint64_t CalculateFee() const override;
   void     SetChargeLimit(uint64_t charge_limit);
+  void     SetBlockIndex(uint64_t block_index);
 
 private:
   using ModulePtr     = std::shared_ptr<vm::Module>;
@@ -136,6 +137,7 @@ private:
 
   uint64_t charge_{0};
   uint64_t charge_limit_{0};
+  uint64_t block_index_{0};
 };
 
 char const *ToString(SynergeticContract::Status status);
@@ -41,9 +41,11 @@ public:
 
   /// @name Transaction Status Interface
   /// @{
-  TxStatus Query(Digest digest) const override;
-  void     Update(Digest digest, TransactionStatus status) override;
-  void     Update(Digest digest, ContractExecutionResult exec_result) override;
+  TxStatus   Query(Digest digest) const override;
+  void       Update(Digest digest, TransactionStatus status) override;
+  void       Update(Digest digest, ContractExecutionResult exec_result) override;
+  TxStatuses QueryBatch(Digests const &digests) const override;
+  void       UpdateBatch(ExecutionResults const &results) override;
   /// @}
 
   // Operators
@@ -22,17 +22,34 @@
 #include "ledger/transaction_status_cache.hpp"
 #include "moment/clocks.hpp"
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <unordered_map>
+#include <vector>
 
 namespace fetch {
 namespace ledger {
 
+/**
+ * In memory transaction status cache which forgets about transactions a day after they were first
+ * seen.
+ *
+ * Entries are spread over a number of independently locked shards so that status updates from
+ * block execution and queries from the HTTP interface rarely contend with each other. Each shard
+ * also records the digests inserted during each epoch (a fixed interval of time), which means that
+ * pruning only visits the entries which have expired instead of checking the age of every entry.
+ */
 class TimeBasedTransactionStatusCache : public TransactionStatusInterface
 {
 public:
   using Timestamp = moment::ClockInterface::Timestamp;
 
+  static constexpr std::size_t NUM_SHARDS = 16;
+
   // Construction / Destruction
   TimeBasedTransactionStatusCache()                                        = default;
   TimeBasedTransactionStatusCache(TimeBasedTransactionStatusCache const &) = delete;
@@ -40,9 +57,11 @@ public:
 
   /// @name Transaction Status Interface
   /// @{
-  TxStatus Query(Digest digest) const override;
-  void     Update(Digest digest, TransactionStatus status) override;
-  void     Update(Digest digest, ContractExecutionResult exec_result) override;
+  TxStatus   Query(Digest digest) const override;
+  void       Update(Digest digest, TransactionStatus status) override;
+  void       Update(Digest digest, ContractExecutionResult exec_result) override;
+  TxStatuses QueryBatch(Digests const &digests) const override;
+  void       UpdateBatch(ExecutionResults const &results) override;
   /// @}
 
   // Operators
@@ -50,22 +69,46 @@ public:
   TimeBasedTransactionStatusCache &operator=(TimeBasedTransactionStatusCache &&) = delete;
 
 private:
+  using Epoch = uint64_t;
+
   struct CacheEntry
   {
-    TxStatus  status{};
-    Timestamp timestamp{};
+    TxStatus status{};
+    Epoch    epoch{0};  ///< The epoch in which the entry was created
+  };
+
+  struct EpochDigests
+  {
+    Epoch   epoch{0};
+    Digests digests{};
   };
 
   using Cache    = DigestMap<CacheEntry>;
   using ClockPtr = moment::ClockPtr;
 
-  void PruneCache(Timestamp const &until);
-  void PruneCacheIfNecessary(Timestamp const &until);
+  struct Shard
+  {
+    mutable Mutex            lock;
+    Cache                    cache{};
+    std::deque<EpochDigests> epochs{};  ///< Digests created in each epoch, oldest first
+  };
+
+  using Shards = std::array<Shard, NUM_SHARDS>;
+
+  Epoch        CurrentEpoch() const;
+  Shard &      LookupShard(Digest const &digest);
+  Shard const &LookupShard(Digest const &digest) const;
+
+  static CacheEntry &LookupOrCreate(Shard &shard, Digest const &digest, Epoch epoch);
+  static void        PruneShard(Shard &shard, Epoch until);
+
+  void PruneCache(Epoch current);
+  void PruneCacheIfNecessary(Epoch current);
 
-  mutable Mutex mtx_;
-  ClockPtr      clock_{moment::GetClock("tx-status")};
-  Cache         cache_{};
-  Timestamp     last_clean_{clock_->Now()};
+  ClockPtr           clock_{moment::GetClock("tx-status")};
+  Timestamp const    origin_{clock_->Now()};
+  Shards             shards_{};
+  std::atomic<Epoch> last_clean_{0};
 };
 
 }  // namespace ledger
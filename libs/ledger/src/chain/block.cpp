@@ -30,6 +30,8 @@
 namespace fetch {
 namespace ledger {
 
+constexpr Block::Index Block::UNKNOWN_AEON_BEGINNING;
+
 bool Block::operator==(Block const &rhs) const
 {
   // Invalid to compare blocks with no block hash
@@ -0,0 +1,298 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "ledger/chain/block_header_store.hpp"
+#include "storage/storage_exception.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace fetch {
+namespace ledger {
+namespace {
+
+using RawHash = std::array<uint8_t, chain::HASH_SIZE>;
+
+constexpr std::size_t LOAD_BATCH_SIZE = 1024;
+constexpr uint64_t    RECORD_LAYOUT   = 1;  ///< Kept in the file header, bumped when Record changes
+
+bool ToRaw(BlockHash const &hash, RawHash &raw)
+{
+  if (hash.size() != chain::HASH_SIZE)
+  {
+    return false;
+  }
+
+  std::memcpy(raw.data(), hash.pointer(), raw.size());
+  return true;
+}
+
+bool ToOptionalRaw(BlockHash const &hash, RawHash &raw, uint32_t flag, uint32_t &present)
+{
+  if (hash.empty())
+  {
+    return true;
+  }
+
+  present |= flag;
+  return ToRaw(hash, raw);
+}
+
+BlockHash FromRaw(RawHash const &raw)
+{
+  byte_array::ByteArray buffer;
+  buffer.Resize(raw.size());
+  std::memcpy(buffer.pointer(), raw.data(), raw.size());
+
+  return {buffer};
+}
+
+BlockHash FromOptionalRaw(RawHash const &raw, uint32_t flag, uint32_t present)
+{
+  return ((present & flag) != 0u) ? FromRaw(raw) : BlockHash{};
+}
+
+}  // namespace
+
+BlockHeader::BlockHeader(Block const &block)
+  : hash(block.hash)
+  , previous_hash(block.previous_hash)
+  , merkle_hash(block.merkle_hash)
+  , skip_hash(block.skip_hash)
+  , block_number(block.block_number)
+  , weight(block.weight)
+  , total_weight(block.total_weight)
+  , timestamp(block.timestamp)
+  , aeon_beginning(block.aeon_beginning)
+  , log2_num_lanes(block.log2_num_lanes)
+{}
+
+bool BlockHeader::IsGenesis() const
+{
+  return previous_hash == chain::ZERO_HASH;
+}
+
+/**
+ * Create a new, empty, header file
+ *
+ * @param filename The path to the file
+ */
+void BlockHeaderStore::New(std::string const &filename)
+{
+  stack_.New(filename);
+  stack_.SetExtraHeader(RECORD_LAYOUT);
+  slots_.clear();
+}
+
+/**
+ * Load an existing header file and index its records. The file is created if it does not exist,
+ * and replaced by an empty one if its records have another layout.
+ *
+ * @param filename The path to the file
+ */
+void BlockHeaderStore::Load(std::string const &filename)
+{
+  // a file of another layout can not be read, but the chain recovers its headers when looked up
+  bool loaded{false};
+  try
+  {
+    stack_.Load(filename, true);
+    loaded = stack_.header_extra() == RECORD_LAYOUT;
+  }
+  catch (storage::StorageException const &)
+  {
+    loaded = false;
+  }
+
+  if (!loaded)
+  {
+    New(filename);
+    return;
+  }
+
+  slots_.clear();
+  slots_.reserve(stack_.size());
+
+  std::vector<Record> records(LOAD_BATCH_SIZE);
+  for (uint64_t start = 0; start < stack_.size(); start += LOAD_BATCH_SIZE)
+  {
+    auto const count = std::min<uint64_t>(LOAD_BATCH_SIZE, stack_.size() - start);
+
+    stack_.GetBulk(start, count, records.data());
+    for (uint64_t i = 0; i < count; ++i)
+    {
+      slots_.emplace(Key(records[i].hash), start + i);
+    }
+  }
+}
+
+void BlockHeaderStore::Flush()
+{
+  stack_.Flush(false);
+}
+
+/**
+ * Look up the header of a block
+ *
+ * @param hash The hash of the block
+ * @param[out] header The header of the block
+ * @return true if the header is stored, otherwise false
+ */
+bool BlockHeaderStore::Get(BlockHash const &hash, BlockHeader &header) const
+{
+  uint64_t slot{0};
+  Record   record;
+  if (!Find(hash, slot, record))
+  {
+    return false;
+  }
+
+  header.hash           = hash;
+  header.previous_hash  = FromRaw(record.previous_hash);
+  header.merkle_hash    = FromOptionalRaw(record.merkle_hash, MERKLE_HASH_PRESENT, record.present);
+  header.skip_hash      = FromOptionalRaw(record.skip_hash, SKIP_HASH_PRESENT, record.present);
+  header.next_hash      = FromOptionalRaw(record.next_hash, NEXT_HASH_PRESENT, record.present);
+  header.block_number   = record.block_number;
+  header.weight         = record.weight;
+  header.total_weight   = record.total_weight;
+  header.timestamp      = record.timestamp;
+  header.aeon_beginning = record.aeon_beginning;
+  header.log2_num_lanes = record.log2_num_lanes;
+
+  return true;
+}
+
+bool BlockHeaderStore::Has(BlockHash const &hash) const
+{
+  uint64_t slot{0};
+  Record   record;
+  return Find(hash, slot, record);
+}
+
+/**
+ * Store the header of a block, replacing the previous header of the block if there is one
+ *
+ * @param header The header to be stored
+ * @return true if successful, false if any of the hashes of the header are malformed
+ */
+bool BlockHeaderStore::Set(BlockHeader const &header)
+{
+  Record record;
+  record.block_number   = header.block_number;
+  record.weight         = header.weight;
+  record.total_weight   = header.total_weight;
+  record.timestamp      = header.timestamp;
+  record.aeon_beginning = header.aeon_beginning;
+  record.log2_num_lanes = header.log2_num_lanes;
+
+  bool const valid =
+      ToRaw(header.hash, record.hash) && ToRaw(header.previous_hash, record.previous_hash) &&
+      ToOptionalRaw(header.merkle_hash, record.merkle_hash, MERKLE_HASH_PRESENT, record.present) &&
+      ToOptionalRaw(header.skip_hash, record.skip_hash, SKIP_HASH_PRESENT, record.present) &&
+      ToOptionalRaw(header.next_hash, record.next_hash, NEXT_HASH_PRESENT, record.present);
+
+  if (!valid)
+  {
+    return false;
+  }
+
+  uint64_t slot{0};
+  Record   existing;
+  if (Find(header.hash, slot, existing))
+  {
+    stack_.Set(slot, record);
+  }
+  else
+  {
+    slots_.emplace(Key(record.hash), stack_.Push(record));
+  }
+
+  return true;
+}
+
+/**
+ * Update the forward reference of a stored header, leaving the rest of the record untouched
+ *
+ * @param hash The hash of the block
+ * @param next_hash The hash of its child
+ * @return true if the header is stored and has been updated, otherwise false
+ */
+bool BlockHeaderStore::SetNextHash(BlockHash const &hash, BlockHash const &next_hash)
+{
+  uint64_t slot{0};
+  Record   record;
+  if (!Find(hash, slot, record))
+  {
+    return false;
+  }
+
+  record.present &= ~static_cast<uint32_t>(NEXT_HASH_PRESENT);
+  if (!ToOptionalRaw(next_hash, record.next_hash, NEXT_HASH_PRESENT, record.present))
+  {
+    return false;
+  }
+
+  stack_.Set(slot, record);
+
+  return true;
+}
+
+std::size_t BlockHeaderStore::size() const
+{
+  return stack_.size();
+}
+
+uint64_t BlockHeaderStore::Key(RawHash const &hash)
+{
+  uint64_t key{0};
+  std::memcpy(&key, hash.data(), sizeof(key));
+  return key;
+}
+
+uint64_t BlockHeaderStore::Key(BlockHash const &hash)
+{
+  uint64_t key{0};
+  std::memcpy(&key, hash.pointer(), std::min(sizeof(key), hash.size()));
+  return key;
+}
+
+bool BlockHeaderStore::Find(BlockHash const &hash, uint64_t &slot, Record &record) const
+{
+  if (hash.size() != chain::HASH_SIZE)
+  {
+    return false;
+  }
+
+  auto const candidates = slots_.equal_range(Key(hash));
+  for (auto it = candidates.first; it != candidates.second; ++it)
+  {
+    stack_.Get(it->second, record);
+    if (std::equal(record.hash.begin(), record.hash.end(), hash.pointer()))
+    {
+      slot = it->second;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace ledger
+}  // namespace fetch
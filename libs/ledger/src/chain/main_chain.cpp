@@ -48,7 +48,34 @@ namespace ledger {
 
 namespace {
 constexpr char const *BLOOM_FILTER_STORE = "chain.bloom.db";
+constexpr char const *HEIGHT_INDEX_STORE = "chain.height.db";
+constexpr char const *HEADER_STORE       = "chain.headers.db";
 constexpr uint64_t    OVERLAP            = 400000;
+
+constexpr uint64_t ClearLowestBit(uint64_t value)
+{
+  return value & (value - 1u);
+}
+
+/**
+ * Determine the block number of the block which a block's skip hash refers to. The choice of
+ * numbers means that any earlier block of a chain can be reached in O(log n) steps, combining
+ * skips with single steps back to the previous block.
+ *
+ * @param block_number The block number of the block
+ * @return The block number of its skip block
+ */
+constexpr uint64_t SkipBlockNumber(uint64_t block_number)
+{
+  if (block_number < 2u)
+  {
+    return 0;
+  }
+
+  return ((block_number & 1u) != 0u) ? ClearLowestBit(ClearLowestBit(block_number - 1u)) + 1u
+                                     : ClearLowestBit(block_number);
+}
+
 }  // namespace
 
 const uint64_t DIRTY_TIMEOUT{600};
@@ -82,8 +109,9 @@ MainChain::MainChain(Mode mode, bool dirty_block_functionality)
 {
   if (Mode::IN_MEMORY_DB != mode)
   {
-    // create the block store
-    block_store_ = std::make_unique<BlockStore>();
+    // create the block and header stores
+    block_store_  = std::make_unique<BlockStore>();
+    header_store_ = std::make_unique<BlockHeaderStore>();
 
     RecoverFromFile(mode);
   }
@@ -119,10 +147,15 @@ void MainChain::Reset()
   if (block_store_)
   {
     block_store_->New("chain.db", "chain.index.db");
+    header_store_->New(HEADER_STORE);
     head_store_.close();
     head_store_.open("chain.head.db",
                      std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+    height_store_.close();
+    height_store_.open(HEIGHT_INDEX_STORE,
+                       std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
   }
+  height_index_size_ = 0;
 
   std::ofstream out(BLOOM_FILTER_STORE, std::ios::binary | std::ios::out | std::ios::trunc);
   bloom_filter_.Reset();
@@ -258,11 +291,11 @@ bool MainChain::LookupReference(BlockHash const &hash, BlockHash &next_hash) con
     next_hash = forward_references_.find(hash)->second;
     return true;
   default:
-    auto parent_block = GetBlock(hash);
-    assert(parent_block);
     assert(heaviest_.ChainLabel() != 0);
     // check if this block is cached and known to lie on the current heaviest chain
-    if (parent_block->chain_label == heaviest_.ChainLabel())
+    BlockPtr parent_block;
+    if (LookupBlockFromCache(hash, parent_block) &&
+        (parent_block->chain_label == heaviest_.ChainLabel()))
     {
       // it is
       auto references_range = forward_references_.equal_range(hash);
@@ -282,16 +315,17 @@ bool MainChain::LookupReference(BlockHash const &hash, BlockHash &next_hash) con
     }
     else
     {
-      // we need to descend from tip
-      auto next_block = HeaviestChainBlockAbove(parent_block->block_number);
-      if (!next_block)
+      // we need to descend from tip, which only needs the headers of the blocks
+      BlockHeader parent;
+      BlockHeader next;
+      if (!LookupHeader(hash, parent) || !HeaviestChainHeaderAbove(parent.block_number, next))
       {
         // there was a failure on block lookup attempt
         return false;
       }
-      if (next_block->previous_hash == hash)
+      if (next.previous_hash == hash)
       {
-        next_hash = next_block->hash;
+        next_hash = next.hash;
         return true;
       }
     }
@@ -337,33 +371,42 @@ MainChain::BlockMap::size_type MainChain::UncacheBlock(BlockHash const &hash) co
 /**
  * Internal: insert a block into the permanent store maintaining references
  *
+ * The forward reference of the stored parent is updated both in its header, which is what lookups
+ * read, and in its record, so that the header store can be recovered from the block store.
+ *
  * @param block The block to be kept
  */
 void MainChain::KeepBlock(BlockPtr const &block) const
 {
   assert(static_cast<bool>(block));
   assert(static_cast<bool>(block_store_));
+  assert(static_cast<bool>(header_store_));
 
   auto const &hash{block->hash};
 
-  DbRecord record;
-
   if (!block->IsGenesis())
   {
     // notify stored parent
-    if (block_store_->Get(storage::ResourceID(block->previous_hash), record))
+    BlockHeader parent;
+    if (LoadHeader(block->previous_hash, parent))
     {
-      if (record.next_hash != hash)
+      if (parent.next_hash != hash)
       {
-        record.next_hash = hash;
-        block_store_->Set(storage::ResourceID(record.hash()), record);
+        DbRecord record;
+        if (block_store_->Get(storage::ResourceID(parent.hash), record))
+        {
+          record.next_hash = hash;
+          block_store_->Set(storage::ResourceID(parent.hash), record);
+        }
+
+        header_store_->SetNextHash(parent.hash, hash);
       }
-      // before checking for this block's children in storage, reset next_hash to genesis
-      record.next_hash = Digest{};
       CacheReference(block->previous_hash, hash, true);
     }
   }
-  record.block = *block;
+
+  // before checking for this block's children in storage, next_hash is left empty
+  BlockHeader header{*block};
 
   // detect if any of this block's children has made it to the store already
   {
@@ -375,15 +418,20 @@ void MainChain::KeepBlock(BlockPtr const &block) const
       auto const &child{ref_it->second};
       if (block_store_->Has(storage::ResourceID(child)))
       {
-        record.next_hash = child;
+        header.next_hash = child;
         CacheReference(hash, child, true);
         break;
       }
     }
   }
 
-  // now write the block itself; if next_hash is genesis, it will be rewritten later by a child
+  // now write the block itself; if next_hash is empty, it will be set later by a child
+  DbRecord record;
+  record.block     = *block;
+  record.next_hash = header.next_hash;
+
   block_store_->Set(storage::ResourceID(hash), record);
+  header_store_->Set(header);
 }
 
 /**
@@ -396,25 +444,26 @@ void MainChain::KeepBlock(BlockPtr const &block) const
 bool MainChain::LoadBlock(BlockHash const &hash, Block &block, BlockHash *next_hash) const
 {
   assert(static_cast<bool>(block_store_));
+  assert(static_cast<bool>(header_store_));
 
   DbRecord record;
   if (block_store_->Get(storage::ResourceID(hash), record))
   {
-    block = record.block;
+    // headers are preferred to the record, as a lost header store is recovered from the records
+    BlockHeader header;
+    if (!header_store_->Get(hash, header))
+    {
+      BackfillHeader(record, header);
+    }
+
+    block = std::move(record.block);
     AddBlockToBloomFilter(block);
     if (next_hash != nullptr)
     {
-      *next_hash = record.next_hash;
+      *next_hash = header.next_hash;
     }
     // update references assuming those from storage are unique
-    if (!block.IsGenesis())
-    {
-      CacheReference(block.previous_hash, hash, true);
-    }
-    if (!record.next_hash.empty())
-    {
-      CacheReference(hash, record.next_hash, true);
-    }
+    CacheStoredReferences(header);
 
     return true;
   }
@@ -422,6 +471,67 @@ bool MainChain::LoadBlock(BlockHash const &hash, Block &block, BlockHash *next_h
   return false;
 }
 
+/**
+ * Internal: load the header of a block from the permanent store, without its body
+ *
+ * @param[in]  hash The hash of the block to be loaded
+ * @param[out] header The location of the header
+ * @return True iff the block is found in the storage
+ */
+bool MainChain::LoadHeader(BlockHash const &hash, BlockHeader &header) const
+{
+  assert(static_cast<bool>(block_store_));
+  assert(static_cast<bool>(header_store_));
+
+  if (!header_store_->Get(hash, header))
+  {
+    DbRecord record;
+    if (!block_store_->Get(storage::ResourceID(hash), record))
+    {
+      return false;
+    }
+
+    BackfillHeader(record, header);
+  }
+
+  // update references assuming those from storage are unique
+  CacheStoredReferences(header);
+
+  return true;
+}
+
+/**
+ * Internal: create the header of a block which was stored before the header store was, and add it
+ * to the header store
+ *
+ * @param record The stored record of the block
+ * @param[out] header The header of the block
+ */
+void MainChain::BackfillHeader(DbRecord const &record, BlockHeader &header) const
+{
+  header           = BlockHeader{record.block};
+  header.next_hash = record.next_hash;
+
+  header_store_->Set(header);
+}
+
+/**
+ * Internal: cache the forward references of a stored block
+ *
+ * @param header The header of the stored block
+ */
+void MainChain::CacheStoredReferences(BlockHeader const &header) const
+{
+  if (!header.IsGenesis())
+  {
+    CacheReference(header.previous_hash, header.hash, true);
+  }
+  if (!header.next_hash.empty())
+  {
+    CacheReference(header.hash, header.next_hash, true);
+  }
+}
+
 void MainChain::AddBlockToBloomFilter(Block const &block) const
 {
   for (auto const &slice : block.slices)
@@ -606,39 +716,47 @@ BlockPtr MainChain::GetLabeledSubchainStart() const
  * Internal: Update blocks of the current heaviest chain setting their chain_label
  * equal to heaviest_.ChainLabel().
  *
+ * Only cached blocks can be coloured, so the part of the descent below the cache only reads the
+ * headers of the blocks.
+ *
  * @param limit the earliest block number, this colouring stops at.
- * @return the heaviest chain block right above the limit
+ * @param[out] header the header of the heaviest chain block right above the limit
+ * @return true if successful, otherwise false
  */
-BlockPtr MainChain::HeaviestChainBlockAbove(uint64_t limit) const
+bool MainChain::HeaviestChainHeaderAbove(uint64_t limit, BlockHeader &header) const
 {
-  MilliTimer myTimer("MainChain::HeaviestChainBlockAbove");
+  MilliTimer myTimer("MainChain::HeaviestChainHeaderAbove");
   FETCH_LOCK(lock_);
   assert(heaviest_.ChainLabel() != 0);
 
-  auto block = GetLabeledSubchainStart();
-  assert(block);
+  auto const start = GetLabeledSubchainStart();
+  assert(start);
+  header = BlockHeader{*start};
 
   // Descend down to limit.
-  while (block->block_number > limit + 1)
+  while (header.block_number > limit + 1)
   {
-    assert(!block->IsGenesis());
-    auto const &previous_hash = block->previous_hash;
-    if (!LookupBlock(previous_hash, block))
-    {
-      FETCH_LOG_ERROR(LOGGING_NAME, "Block lookup failure for block: 0x", ToHex(previous_hash),
-                      " when recovering the previous block on the heaviest chain");
-      return {};
-    }
-    if (IsBlockInCache(block->hash))
+    assert(!header.IsGenesis());
+    auto const previous_hash = header.previous_hash;
+
+    BlockPtr block;
+    if (LookupBlockFromCache(previous_hash, block))
     {
       // Colour this block.
       block->chain_label = heaviest_.ChainLabel();
       // labeled_subchain_start_ is the earliest cached block known to belong to the heaviest chain.
       labeled_subchain_start_ = block;
+      header                  = BlockHeader{*block};
+    }
+    else if (!LookupHeader(previous_hash, header))
+    {
+      FETCH_LOG_ERROR(LOGGING_NAME, "Block lookup failure for block: 0x", ToHex(previous_hash),
+                      " when recovering the previous block on the heaviest chain");
+      return false;
     }
   }
 
-  return block;
+  return true;
 }
 
 /**
@@ -708,6 +826,7 @@ MainChain::Travelogue MainChain::TimeTravel(BlockHash current_hash, std::size_t
   auto const heaviest = GetHeaviestBlock();
 
   BlockPtr block;
+  bool     on_heaviest_branch{false};
   if (current_hash.empty())
   {
     // start of the sync, from genesis
@@ -715,8 +834,22 @@ MainChain::Travelogue MainChain::TimeTravel(BlockHash current_hash, std::size_t
   }
   else
   {
-    // Note: this is inefficient
-    if (!LookupBlock(current_hash, block, &next_hash))
+    // only the forward reference of the block we sync from is needed, not its body
+    bool        found{false};
+    BlockHeader header;
+    if (LookupBlockFromCache(current_hash, block))
+    {
+      // Check if it is on the heaviest chain.
+      on_heaviest_branch = (block->chain_label == heaviest_.ChainLabel());
+      found              = LookupReference(current_hash, next_hash);
+    }
+    else if (header_store_ && LoadHeader(current_hash, header))
+    {
+      next_hash = header.next_hash;
+      found     = !next_hash.empty() || LookupReference(current_hash, next_hash);
+    }
+
+    if (!found)
     {
       FETCH_LOG_DEBUG(LOGGING_NAME, "Block lookup failure for block: 0x", ToHex(current_hash),
                       " during time travel. Note, next hash: ", next_hash);
@@ -725,9 +858,6 @@ MainChain::Travelogue MainChain::TimeTravel(BlockHash current_hash, std::size_t
     }
   }
 
-  // We have the block we want to sync forward from. Check if it is on the heaviest chain.
-  bool const on_heaviest_branch = (block && (block->chain_label == heaviest_.ChainLabel()));
-
   std::size_t const output_limit = std::min(limit, std::size_t{UPPER_BOUND});
 
   bool not_done = true;
@@ -765,6 +895,53 @@ MainChain::Travelogue MainChain::TimeTravel(BlockHash current_hash, std::size_t
   return {heaviest->hash, heaviest->block_number, status, std::move(result)};
 }
 
+/**
+ * Find the block of a chain at a given block number
+ *
+ * @param hash The hash of the block whose chain is to be searched
+ * @param block_number The block number of the block to be found
+ * @return The ancestor if found, otherwise an empty pointer
+ */
+BlockPtr MainChain::GetAncestor(BlockHash const &hash, uint64_t block_number) const
+{
+  MilliTimer myTimer("MainChain::GetAncestor", 500);
+
+  FETCH_LOCK(lock_);
+
+  BlockHeader header;
+  if (!LookupHeader(hash, header) || !LookupAncestor(header, block_number))
+  {
+    return {};
+  }
+
+  return LookupBlock(header.hash);
+}
+
+/**
+ * Find the block which began the aeon of a block, which is the most recent block of its chain to
+ * have begun an aeon, or genesis if there is none. The block is looked up by its number, descending
+ * the chain of the given block.
+ *
+ * @param hash The hash of the block whose aeon is to be found
+ * @return The block which began the aeon if found, otherwise an empty pointer. This is also the
+ * case when the block was stored before aeon beginnings were recorded.
+ */
+BlockPtr MainChain::GetAeonBeginning(BlockHash const &hash) const
+{
+  MilliTimer myTimer("MainChain::GetAeonBeginning", 500);
+
+  FETCH_LOCK(lock_);
+
+  BlockHeader header;
+  if (!LookupHeader(hash, header) || (header.aeon_beginning > header.block_number) ||
+      !LookupAncestor(header, header.aeon_beginning))
+  {
+    return {};
+  }
+
+  return LookupBlock(header.hash);
+}
+
 /**
  * Get a common sub tree from the chain.
  *
@@ -789,101 +966,199 @@ bool MainChain::GetPathToCommonAncestor(Blocks &blocks, BlockHash tip_hash, Bloc
 
   FETCH_LOCK(lock_);
 
-  bool success{true};
-
   // clear the output structure
   blocks.clear();
 
-  BlockPtr left, right;
+  // the path is found using the headers of the blocks, only the returned blocks are loaded
+  BlockHeader tip;
+  if (!LookupHeader(tip_hash, tip))
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to look up block (left): 0x", ToHex(tip_hash));
+    return false;
+  }
+
+  BlockHeader node;
+  if (!LookupHeader(node_hash, node))
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to look up block (right): 0x", ToHex(node_hash));
+    return false;
+  }
 
-  BlockHash left_hash  = std::move(tip_hash);
-  BlockHash right_hash = std::move(node_hash);
+  BlockHeader ancestor;
+  if (!LookupCommonAncestor(tip, node, ancestor))
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to find common ancestor of: 0x", ToHex(tip_hash),
+                   " and 0x", ToHex(node_hash));
+    return false;
+  }
 
-  std::deque<BlockPtr> res;
+  FETCH_LOG_DEBUG(LOGGING_NAME, "Left: 0x", ToHex(tip_hash), " -> ", tip.block_number,
+                  " Right: 0x", ToHex(node_hash), " -> ", node.block_number, " Ancestor: 0x",
+                  ToHex(ancestor.hash), " -> ", ancestor.block_number);
 
-  // The algorithm implemented here is effectively a coordinated parallel walk about from the two
-  // input tips until the a common ancestor is located.
-  for (;;)
+  // when the most recent blocks are wanted the tip is always returned, even for a zero limit
+  if ((limit == 0) && (behaviour == BehaviourWhenLimit::RETURN_MOST_RECENT))
   {
-    // load up the left side
-    if (!left || left->hash != left_hash)
-    {
-      left = LookupBlock(left_hash);
-      if (!left)
-      {
-        FETCH_LOG_WARN(LOGGING_NAME, "Unable to look up block (left): 0x", ToHex(left_hash));
-        success = false;
-        break;
-      }
+    limit = 1;
+  }
 
-      // left side always loaded into output queue as we traverse
-      // blocks.push_back(left);
-      res.push_back(left);
-      bool break_loop = false;
+  // the path runs from the tip down to and including the common ancestor
+  uint64_t const path_length = (tip.block_number - ancestor.block_number) + 1u;
+  uint64_t const count       = std::min(path_length, limit);
+  if (count == 0)
+  {
+    return true;
+  }
 
-      switch (behaviour)
-      {
-      case BehaviourWhenLimit::RETURN_LEAST_RECENT:
-        if (res.size() > limit)
-        {
-          res.pop_front();
-        }
-        break;
-      case BehaviourWhenLimit::RETURN_MOST_RECENT:
-        if (res.size() >= limit)
-        {
-          break_loop = true;
-        }
-        break;
-      }
+  // when only the least recent part of the path is needed skip straight to its start
+  BlockHeader start = tip;
+  if ((behaviour == BehaviourWhenLimit::RETURN_LEAST_RECENT) &&
+      !LookupAncestor(start, ancestor.block_number + count - 1u))
+  {
+    return false;
+  }
 
-      if (break_loop)
-      {
-        break;
-      }
-    }
+  BlockPtr block = LookupBlock(start.hash);
 
-    // load up the right side
-    if (!right || right->hash != right_hash)
+  blocks.reserve(count);
+  while (block)
+  {
+    blocks.push_back(block);
+    if (blocks.size() == count)
     {
-      right = LookupBlock(right_hash);
-      if (!right)
-      {
-        FETCH_LOG_WARN(LOGGING_NAME, "Unable to look up block (right): 0x", ToHex(right_hash));
-        success = false;
-        break;
-      }
+      return true;
     }
 
-    FETCH_LOG_DEBUG(LOGGING_NAME, "Left: 0x", ToHex(left_hash), " -> ", left->block_number,
-                    " Right: 0x", ToHex(right_hash), " -> ", right->block_number);
-
-    if (left_hash == right_hash)
+    auto const previous_hash = block->previous_hash;
+    if (!LookupBlock(previous_hash, block))
     {
+      FETCH_LOG_WARN(LOGGING_NAME, "Unable to look up block: 0x", ToHex(previous_hash));
       break;
     }
+  }
 
-    if (left->block_number <= right->block_number)
+  // If a lookup error has occurred then we do not return anything
+  blocks.clear();
+
+  return false;
+}
+
+/**
+ * Internal: Find the block of the chain ending with a given block, at a given block number.
+ *
+ * The stored part of the heaviest chain is answered from the height index. Elsewhere the chain is
+ * descended using the skip hashes of the blocks, which takes O(log n) lookups. Only the headers of
+ * the blocks are read.
+ *
+ * @param[in,out] header The header of the block to start from, replaced by that of the ancestor
+ * @param block_number The block number of the ancestor
+ * @return true if the ancestor was found, otherwise false
+ */
+bool MainChain::LookupAncestor(BlockHeader &header, uint64_t block_number) const
+{
+  if (header.block_number < block_number)
+  {
+    return false;
+  }
+
+  bool check_height_index{true};
+  while (header.block_number > block_number)
+  {
+    // once the walk has reached the stored heaviest chain the rest of it can be looked up directly
+    if (check_height_index && (header.block_number < height_index_size_))
     {
-      right_hash = right->previous_hash;
+      check_height_index = false;
+
+      BlockHash indexed_hash;
+      if (LookupHeightIndex(header.block_number, indexed_hash) && (indexed_hash == header.hash) &&
+          LookupHeightIndex(block_number, indexed_hash))
+      {
+        return LookupHeader(indexed_hash, header);
+      }
     }
 
-    if (left->block_number >= right->block_number)
+    uint64_t const skip_number     = SkipBlockNumber(header.block_number);
+    uint64_t const previous_number = SkipBlockNumber(header.block_number - 1u);
+
+    // skip unless this overshoots, or unless skipping from the previous block gets closer
+    bool const use_skip =
+        !header.skip_hash.empty() &&
+        ((skip_number == block_number) ||
+         ((skip_number > block_number) &&
+          !((previous_number + 2u < skip_number) && (previous_number >= block_number))));
+
+    auto const next_hash = use_skip ? header.skip_hash : header.previous_hash;
+    if (!LookupHeader(next_hash, header))
     {
-      left_hash = left->previous_hash;
+      FETCH_LOG_WARN(LOGGING_NAME, "Block lookup failure for block: 0x", ToHex(next_hash),
+                     " when looking up ancestor: ", block_number);
+      return false;
     }
   }
 
-  blocks.resize(res.size());
-  std::move(res.begin(), res.end(), blocks.begin());
+  return true;
+}
 
-  // If a lookup error has occurred then we do not return anything
-  if (!success)
+/**
+ * Internal: Find the most recent block which two chains have in common.
+ *
+ * Below the common ancestor the two chains agree and above it they differ, so the search gallops
+ * down from the top until the chains agree and then bisects the last interval. Short forks are
+ * therefore resolved in a handful of ancestor lookups.
+ *
+ * @param left The header of the tip of the first chain
+ * @param right The header of the tip of the second chain
+ * @param[out] ancestor The header of the common ancestor
+ * @return true if the common ancestor was found, otherwise false
+ */
+bool MainChain::LookupCommonAncestor(BlockHeader left, BlockHeader right,
+                                     BlockHeader &ancestor) const
+{
+  uint64_t upper = std::min(left.block_number, right.block_number);
+
+  if (!LookupAncestor(left, upper) || !LookupAncestor(right, upper))
   {
-    blocks.clear();
+    return false;
   }
 
-  return success;
+  if (left.hash == right.hash)
+  {
+    ancestor = std::move(left);
+    return true;
+  }
+
+  // the chains differ at upper, and are assumed to agree at lower (genesis at the latest)
+  uint64_t lower{0};
+  bool     galloping{true};
+  for (uint64_t distance = 1; upper - lower > 1u;)
+  {
+    uint64_t const middle = galloping ? upper - std::min(distance, upper - lower - 1u)
+                                      : lower + ((upper - lower) / 2u);
+
+    BlockHeader left_middle  = left;
+    BlockHeader right_middle = right;
+    if (!LookupAncestor(left_middle, middle) || !LookupAncestor(right_middle, middle))
+    {
+      return false;
+    }
+
+    if (left_middle.hash == right_middle.hash)
+    {
+      lower     = middle;
+      galloping = false;
+    }
+    else
+    {
+      upper = middle;
+      left  = std::move(left_middle);
+      right = std::move(right_middle);
+    }
+
+    distance *= 2u;
+  }
+
+  // left is now the first block of its chain after the common ancestor
+  return LookupHeader(left.previous_hash, ancestor);
 }
 
 /**
@@ -1013,8 +1288,11 @@ void MainChain::RecoverFromFile(Mode mode)
   if (Mode::CREATE_PERSISTENT_DB == mode)
   {
     block_store_->New("chain.db", "chain.index.db");
+    header_store_->New(HEADER_STORE);
     head_store_.open("chain.head.db",
                      std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+    height_store_.open(HEIGHT_INDEX_STORE,
+                       std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
 
     std::ofstream out(BLOOM_FILTER_STORE, std::ios::binary | std::ios::out | std::ios::trunc);
     bloom_filter_.Reset();
@@ -1022,6 +1300,7 @@ void MainChain::RecoverFromFile(Mode mode)
     return;
   }
   assert(mode == Mode::LOAD_PERSISTENT_DB);
+  bool bloom_filter_loaded{false};
   if (Mode::LOAD_PERSISTENT_DB == mode)
   {
     using namespace fetch::serializers;
@@ -1029,6 +1308,17 @@ void MainChain::RecoverFromFile(Mode mode)
     block_store_->Load("chain.db", "chain.index.db");
     head_store_.open("chain.head.db", std::ios::binary | std::ios::in | std::ios::out);
 
+    // headers missing from the header store are recovered from the block store when looked up
+    header_store_->Load(HEADER_STORE);
+
+    // the height index is rebuilt while walking the chain below, so it may be missing
+    height_store_.open(HEIGHT_INDEX_STORE, std::ios::binary | std::ios::in | std::ios::out);
+    if (!height_store_.is_open())
+    {
+      height_store_.open(HEIGHT_INDEX_STORE,
+                         std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+    }
+
     std::ifstream in(BLOOM_FILTER_STORE, std::ios::binary | std::ios::in);
 
     if (in.is_open())
@@ -1040,12 +1330,16 @@ void MainChain::RecoverFromFile(Mode mode)
         LargeObjectSerializeHelper buffer{bloom_filter_data};
 
         buffer >> bloom_filter_;
+
+        bloom_filter_loaded = true;
       }
       catch (std::exception const &e)
       {
         FETCH_LOG_ERROR(LOGGING_NAME,
                         "Failed to load Bloom filter from storage! Reason: ", e.what());
-        Reset();
+
+        // the filter is repopulated as the blocks are loaded while walking the chain below
+        bloom_filter_.Reset();
       }
     }
   }
@@ -1060,21 +1354,40 @@ void MainChain::RecoverFromFile(Mode mode)
   if (!head_block_hash.empty() && LoadBlock(head_block_hash, *head))
   {
     auto block_index = head->block_number;
+    SetHeightIndex(block_index, head_block_hash);
 
-    // Copy head block so as to walk down the chain
-    BlockPtr next = std::make_shared<Block>(*head);
+    // Walk down the chain, reading only the headers of the blocks unless their transactions are
+    // needed to repopulate the Bloom filter
+    auto const load_previous = [this, bloom_filter_loaded](BlockHeader &header) {
+      BlockHash const previous_hash = header.previous_hash;
+      if (bloom_filter_loaded)
+      {
+        return LoadHeader(previous_hash, header);
+      }
 
-    while (LoadBlock(next->previous_hash, *next))
+      Block block;
+      if (!LoadBlock(previous_hash, block))
+      {
+        return false;
+      }
+
+      header = BlockHeader{block};
+      return true;
+    };
+
+    BlockHeader next{*head};
+    while (load_previous(next))
     {
-      if (next->block_number != block_index - 1)
+      if (next.block_number != block_index - 1)
       {
         FETCH_LOG_WARN(LOGGING_NAME,
                        "Discontinuity found when walking main chain during recovery. Current: ",
-                       block_index, " prev: ", next->block_number, " Resetting");
+                       block_index, " prev: ", next.block_number, " Resetting");
         break;
       }
 
-      block_index = next->block_number;
+      block_index = next.block_number;
+      SetHeightIndex(block_index, next.hash);
     }
 
     if (block_index != 0)
@@ -1088,6 +1401,9 @@ void MainChain::RecoverFromFile(Mode mode)
       FETCH_LOG_INFO(LOGGING_NAME,
                      "Recovering main chain with heaviest block: ", head->block_number);
 
+      // every block from genesis to the head has been indexed by the walk
+      height_index_size_ = head->block_number + 1u;
+
       // Add heaviest to cache
       CacheBlock(head);
 
@@ -1123,12 +1439,18 @@ void MainChain::RecoverFromFile(Mode mode)
   if (!recovery_complete)
   {
     block_store_->New("chain.db", "chain.index.db");
+    header_store_->New(HEADER_STORE);
 
     // reopen the file and clear the contents
     head_store_.close();
     head_store_.open("chain.head.db",
                      std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
 
+    height_store_.close();
+    height_store_.open(HEIGHT_INDEX_STORE,
+                       std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+    height_index_size_ = 0;
+
     std::ofstream out(BLOOM_FILTER_STORE, std::ios::binary | std::ios::out | std::ios::trunc);
     bloom_filter_.Reset();
   }
@@ -1176,16 +1498,18 @@ void MainChain::WriteToFile()
 
       KeepBlock(block);
       SetHeadHash(block->hash);
+      SetHeightIndex(block->block_number, block->hash);
+      height_index_size_ = 1;
     }
     else
     {
       FETCH_LOG_DEBUG(LOGGING_NAME, "Writing block. ", block->block_number);
 
-      // Recover the current head block from the file
-      BlockPtr current_file_head = std::make_shared<Block>();
-      BlockPtr block_head        = block;
+      // Recover the header of the current head block from the file
+      BlockHeader current_file_head;
+      BlockPtr    block_head = block;
 
-      LoadBlock(GetHeadHash(), *current_file_head);
+      LoadHeader(GetHeadHash(), current_file_head);
 
       // Now keep adding the block and its prev to the file until we are certain the file contains
       // an unbroken chain. Assuming that the current_file_head is unbroken we can write until we
@@ -1193,15 +1517,17 @@ void MainChain::WriteToFile()
       for (;;)
       {
         KeepBlock(block);
+        SetHeightIndex(block->block_number, block->hash);
 
         // Keep the current_file_head one block behind
-        while (current_file_head->block_number > block->block_number - 1)
+        while (current_file_head.block_number > block->block_number - 1)
         {
-          LoadBlock(current_file_head->previous_hash, *current_file_head);
+          BlockHash const previous_hash = current_file_head.previous_hash;
+          LoadHeader(previous_hash, current_file_head);
         }
 
         // Successful case
-        if (current_file_head->hash == block->previous_hash)
+        if (current_file_head.hash == block->previous_hash)
         {
           break;
         }
@@ -1212,6 +1538,9 @@ void MainChain::WriteToFile()
 
       // Success - we kept a copy of the new head to write
       SetHeadHash(block_head->hash);
+
+      // blocks above the new head may be left over from a previous fork, exclude them
+      height_index_size_ = block_head->block_number + 1u;
     }
 
     // Clear the block from ram
@@ -1569,6 +1898,17 @@ BlockStatus MainChain::InsertBlock(BlockPtr const &block, bool evaluate_loose_bl
   // update the final (total) weight for this block
   block->total_weight = prev_block->total_weight + block->weight;
 
+  // link the block to an earlier block of its chain so that ancestor lookups can skip down it
+  BlockHeader skip_block{*prev_block};
+  if (LookupAncestor(skip_block, SkipBlockNumber(block->block_number)))
+  {
+    block->skip_hash = skip_block.hash;
+  }
+
+  // remember where the aeon of the block began, unless the parent's was not recorded
+  block->aeon_beginning = block->block_entropy.IsAeonBeginning() ? block->block_number
+                                                                 : prev_block->aeon_beginning;
+
   // At this point we can proceed knowing that the block is building upon existing tip
 
   // At this point we have a new block with a prev that's known and not loose. Update tips
@@ -1690,6 +2030,28 @@ bool MainChain::LookupBlockFromStorage(BlockHash const &hash, BlockPtr &block,
   return success;
 }
 
+/**
+ * Attempt to look up the header of a block, first in the in memory cache and then in the
+ * persistent header store. The body of a stored block is not loaded.
+ *
+ * Note: the next hash of the header is only set for stored blocks
+ *
+ * @param hash The hash of the block to search for
+ * @param header The output header to be populated
+ * @return true if successful, otherwise false
+ */
+bool MainChain::LookupHeader(BlockHash const &hash, BlockHeader &header) const
+{
+  BlockPtr block;
+  if (LookupBlockFromCache(hash, block))
+  {
+    header = BlockHeader{*block};
+    return true;
+  }
+
+  return header_store_ && LoadHeader(hash, header);
+}
+
 /**
  * No Locking: Determine is a specified block is in the cache
  *
@@ -1838,10 +2200,11 @@ bool MainChain::ReindexTips()
 BlockPtr MainChain::CreateGenesisBlock()
 {
   auto genesis           = std::make_shared<Block>();
-  genesis->previous_hash = chain::ZERO_HASH;
-  genesis->hash          = chain::GetGenesisDigest();
-  genesis->merkle_hash   = chain::GetGenesisMerkleRoot();
-  genesis->is_loose      = false;
+  genesis->previous_hash  = chain::ZERO_HASH;
+  genesis->hash           = chain::GetGenesisDigest();
+  genesis->merkle_hash    = chain::GetGenesisMerkleRoot();
+  genesis->is_loose       = false;
+  genesis->aeon_beginning = 0;
 
   return genesis;
 }
@@ -1987,6 +2350,51 @@ void MainChain::SetHeadHash(BlockHash const &hash)
                     static_cast<std::streamsize>(hash.size()));
 }
 
+/**
+ * Internal: Record the hash of the stored heaviest chain block at a given block number
+ *
+ * @param block_number The block number of the block
+ * @param hash The hash of the block
+ */
+void MainChain::SetHeightIndex(uint64_t block_number, BlockHash const &hash)
+{
+  assert(hash.size() == chain::HASH_SIZE);
+
+  height_store_.seekp(static_cast<std::streamoff>(block_number * chain::HASH_SIZE));
+  height_store_.write(reinterpret_cast<char const *>(hash.pointer()),
+                      static_cast<std::streamsize>(hash.size()));
+}
+
+/**
+ * Internal: Look up the hash of the stored heaviest chain block at a given block number
+ *
+ * @param block_number The block number to look up
+ * @param[out] hash The hash of the block
+ * @return true if the block number is indexed, otherwise false
+ */
+bool MainChain::LookupHeightIndex(uint64_t block_number, BlockHash &hash) const
+{
+  if (block_number >= height_index_size_)
+  {
+    return false;
+  }
+
+  byte_array::ByteArray buffer;
+  buffer.Resize(chain::HASH_SIZE);
+
+  height_store_.seekg(static_cast<std::streamoff>(block_number * chain::HASH_SIZE));
+  height_store_.read(reinterpret_cast<char *>(buffer.pointer()),
+                     static_cast<std::streamsize>(buffer.size()));
+  if (!height_store_)
+  {
+    height_store_.clear();
+    return false;
+  }
+
+  hash = buffer;
+  return true;
+}
+
 /**
  * Strip transactions in container that already exist in the blockchain
  *
@@ -2012,20 +2420,34 @@ DigestSet MainChain::DetectDuplicateTransactions(BlockHash const &           sta
     return {};
   }
 
-  DigestSet potential_duplicates{};
+  // query the Bloom filter for all of the transactions at once
+  ProgressiveBloomFilter::Elements       digests{};
+  ProgressiveBloomFilter::ElementIndices valid_until{};
+  ProgressiveBloomFilter::MatchResults   matches{};
+
+  digests.reserve(transactions.size());
+  valid_until.reserve(transactions.size());
   for (auto const &tx_layout : transactions)
   {
-    std::pair<bool, std::size_t> const result =
-        bloom_filter_.Match(tx_layout.digest(), tx_layout.valid_until());
-    bloom_filter_queried_bit_count_->set(result.second);
-    if (result.first)
+    digests.emplace_back(tx_layout.digest());
+    valid_until.emplace_back(tx_layout.valid_until());
+  }
+
+  bloom_filter_.MatchBatch(digests, valid_until, matches);
+
+  DigestSet potential_duplicates{};
+  for (std::size_t i = 0; i < digests.size(); ++i)
+  {
+    if (matches[i] != 0)
     {
       bloom_filter_positive_count_->increment();
-      potential_duplicates.insert(tx_layout.digest());
+      potential_duplicates.insert(digests[i]);
     }
-    bloom_filter_query_count_->increment();
   }
 
+  bloom_filter_queried_bit_count_->set(BlockedBloomFilter::BITS_PER_ELEMENT);
+  bloom_filter_query_count_->add(digests.size());
+
   DigestSet duplicates{};
   if (!potential_duplicates.empty())
   {
@@ -2066,6 +2488,7 @@ void MainChain::FlushToDisk(bool flush_bloom)
   if (block_store_)
   {
     block_store_->Flush(false);
+    header_store_->Flush();
   }
 
   if (flush_bloom && (mode_ != Mode::IN_MEMORY_DB))
@@ -22,6 +22,8 @@
 #include "core/serializers/main_serializer.hpp"
 #include "http/json_response.hpp"
 #include "json/document.hpp"
+#include "json/exceptions.hpp"
+#include "json/reader.hpp"
 #include "ledger/chaincode/chain_code_factory.hpp"
 #include "ledger/chaincode/contract.hpp"
 #include "ledger/chaincode/contract_context.hpp"
@@ -84,20 +86,18 @@ std::string GenerateTimestamp()
   return {buffer};
 }
 
-bool CreateTxFromJson(Variant const &tx_obj, std::vector<ConstByteArray> &txs,
-                      TransactionProcessor &processor)
+bool CreateTxFromJson(json::JSONReader &reader, std::vector<chain::TransactionPtr> &decoded)
 {
   auto tx = std::make_shared<chain::Transaction>();
 
-  if (chain::FromJsonTransaction(tx_obj, *tx))
+  if (chain::FromJsonTransaction(reader, *tx))
   {
     if (tx->charge_limit() > chain::Transaction::MAXIMUM_TX_CHARGE_LIMIT)
     {
       return false;
     }
 
-    txs.emplace_back(tx->digest());
-    processor.AddTransaction(std::move(tx));
+    decoded.emplace_back(std::move(tx));
 
     return true;
   }
@@ -388,33 +388,39 @@ ContractHttpInterface::SubmitTxStatus ContractHttpInterface::SubmitJsonTx(
   std::size_t submitted{0};
   std::size_t expected_count{0};
 
-  // parse the JSON request
-  json::JSONDocument doc{request.body()};
+  // index the JSON request, the transactions are then decoded straight out of the document
+  json::JSONReader                   reader{request.body()};
+  std::vector<chain::TransactionPtr> decoded{};
 
   FETCH_LOG_DEBUG(LOGGING_NAME, "NEW TRANSACTION RECEIVED");
   FETCH_LOG_DEBUG(LOGGING_NAME, request.body());
 
-  if (doc.root().IsArray())
+  if (reader.PeekType() == json::JSONReader::ValueType::ARRAY)
   {
-    expected_count = doc.root().size();
-    for (std::size_t i = 0, end = doc.root().size(); i < end; ++i)
+    reader.EnterArray();
+    while (reader.NextElement())
     {
-      auto const success = CreateTxFromJson(doc[i], txs, processor_);
-      if (success)
-      {
-        ++submitted;
-      }
+      ++expected_count;
+      CreateTxFromJson(reader, decoded);
     }
   }
   else
   {
     expected_count = 1;
+    CreateTxFromJson(reader, decoded);
+  }
 
-    auto const success = CreateTxFromJson(doc.root(), txs, processor_);
-    if (success)
-    {
-      ++submitted;
-    }
+  if (!reader.AtEnd())
+  {
+    throw json::JSONParseException("Unexpected data after the end of the JSON document");
+  }
+
+  // only submit the transactions once the whole of the document is known to be well formed
+  for (auto &tx : decoded)
+  {
+    txs.emplace_back(tx->digest());
+    processor_.AddTransaction(std::move(tx));
+    ++submitted;
   }
 
   FETCH_LOG_DEBUG(LOGGING_NAME, "Submitted ", submitted, " transactions from ",
@@ -0,0 +1,294 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "crypto/sha256.hpp"
+#include "ledger/chaincode/executable_store.hpp"
+#include "logging/logging.hpp"
+#include "storage/resource_mapper.hpp"
+#include "telemetry/counter.hpp"
+#include "telemetry/registry.hpp"
+#include "vm/compiler.hpp"
+#include "vm/vm.hpp"
+#include "vm_modules/vm_factory.hpp"
+
+#include <exception>
+#include <utility>
+
+namespace fetch {
+namespace ledger {
+namespace {
+
+// bumped whenever the layout of the serialised executables changes
+constexpr uint8_t FORMAT_VERSION = 1;
+constexpr uint8_t SEPARATOR      = 0;
+
+/**
+ * Compute the fingerprint of the builtin opcodes of the VM
+ *
+ * Executables refer to opcodes by number, so they can not be reused by a node whose VM numbers
+ * its opcodes differently.
+ *
+ * @return The fingerprint
+ */
+byte_array::ConstByteArray ComputeOpcodeFingerprint()
+{
+  vm::Module         module;
+  vm::Compiler const compiler{&module};
+  vm::VM const       vm{&module};
+
+  crypto::SHA256 hasher{};
+
+  for (auto const &opcode_info : vm.GetOpcodeInfoArray())
+  {
+    hasher.Update(opcode_info.unique_name);
+    hasher.Update(&SEPARATOR, sizeof(SEPARATOR));
+  }
+
+  return hasher.Final();
+}
+
+}  // namespace
+
+constexpr std::size_t ExecutableStore::MAX_CACHED_EXECUTABLES;
+
+ExecutableStore &ExecutableStore::Instance()
+{
+  static ExecutableStore instance;
+  return instance;
+}
+
+ExecutableStore::ExecutableStore()
+  : memory_hits_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_executable_store_memory_hits_total",
+        "The number of compiled executables found in memory")}
+  , disk_hits_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_executable_store_disk_hits_total",
+        "The number of compiled executables loaded from disk")}
+  , compilations_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_executable_store_compilations_total",
+        "The number of contracts compiled from source")}
+{}
+
+/**
+ * Attach a database so that compiled executables are persisted across restarts
+ *
+ * @param doc_file The path to the document file
+ * @param index_file The path to the index file
+ */
+void ExecutableStore::Load(std::string const &doc_file, std::string const &index_file)
+{
+  auto store = std::make_unique<storage::ObjectStore<CompiledExecutable>>();
+  store->Load(doc_file, index_file, true);
+
+  FETCH_LOCK(store_lock_);
+  store_ = std::move(store);
+}
+
+/**
+ * Look up the executable for a contract, compiling it only if no usable copy has been stored
+ *
+ * @param digest The digest of the contract source
+ * @param module The module the contract will be executed with
+ * @param files The contract source
+ * @param errors The compilation errors, populated on failure
+ * @return The executable if successful, otherwise an empty pointer
+ */
+ExecutableStore::ExecutablePtr ExecutableStore::GetOrCompile(ConstByteArray const &  digest,
+                                                             ModulePtr const &       module,
+                                                             vm::SourceFiles const &files,
+                                                             Errors &                errors)
+{
+  // setting up a compiler populates the type and function tables of the module, which the VM
+  // relies on even when no compilation is needed
+  vm::Compiler const compiler{module.get()};
+
+  auto const fingerprint = Fingerprint(*module);
+
+  auto executable = LookupInMemory(digest, fingerprint);
+  if (executable)
+  {
+    memory_hits_->increment();
+    return executable;
+  }
+
+  executable = LookupOnDisk(digest, fingerprint);
+  if (executable)
+  {
+    disk_hits_->increment();
+    Insert(digest, fingerprint, executable);
+    return executable;
+  }
+
+  auto compiled = std::make_shared<vm::Executable>();
+  errors        = vm_modules::VMFactory::Compile(module, files, *compiled);
+  compilations_->increment();
+
+  if (!errors.empty())
+  {
+    return {};
+  }
+
+  executable = std::move(compiled);
+  Persist(digest, fingerprint, *executable);
+  Insert(digest, fingerprint, executable);
+
+  return executable;
+}
+
+std::size_t ExecutableStore::size() const
+{
+  FETCH_LOCK(lock_);
+  return cache_.size();
+}
+
+/**
+ * Drop all of the executables held in memory
+ */
+void ExecutableStore::Clear()
+{
+  FETCH_LOCK(lock_);
+  cache_.clear();
+}
+
+/**
+ * Compute the fingerprint of the VM opcodes and of the types and functions registered with a
+ * module
+ *
+ * Serialised executables refer to all of these by number, so they can only be reused with a module
+ * that has the same fingerprint.
+ *
+ * @param module The module (after compiler setup)
+ * @return The fingerprint
+ */
+ExecutableStore::ConstByteArray ExecutableStore::Fingerprint(vm::Module const &module)
+{
+  static ConstByteArray const opcode_fingerprint = ComputeOpcodeFingerprint();
+
+  crypto::SHA256 hasher{};
+  hasher.Update(&FORMAT_VERSION, sizeof(FORMAT_VERSION));
+  hasher.Update(opcode_fingerprint);
+
+  for (auto const &type_info : module.GetTypeInfoArray())
+  {
+    hasher.Update(type_info.name);
+    hasher.Update(&SEPARATOR, sizeof(SEPARATOR));
+  }
+
+  for (auto const &function_info : module.GetFunctionInfoArray())
+  {
+    hasher.Update(function_info.unique_name);
+    hasher.Update(&SEPARATOR, sizeof(SEPARATOR));
+  }
+
+  return hasher.Final();
+}
+
+ExecutableStore::ExecutablePtr ExecutableStore::LookupInMemory(ConstByteArray const &digest,
+                                                               ConstByteArray const &fingerprint)
+{
+  FETCH_LOCK(lock_);
+
+  auto it = cache_.find(digest);
+  if ((it != cache_.end()) && (it->second.module_fingerprint == fingerprint))
+  {
+    return it->second.executable;
+  }
+
+  return {};
+}
+
+ExecutableStore::ExecutablePtr ExecutableStore::LookupOnDisk(ConstByteArray const &digest,
+                                                             ConstByteArray const &fingerprint)
+{
+  FETCH_LOCK(store_lock_);
+
+  if (!store_)
+  {
+    return {};
+  }
+
+  try
+  {
+    CompiledExecutable compiled{};
+    if (store_->Get(storage::ResourceID{digest}, compiled) &&
+        (compiled.module_fingerprint == fingerprint))
+    {
+      return std::make_shared<vm::Executable const>(std::move(compiled.executable));
+    }
+  }
+  catch (std::exception const &ex)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to load stored executable: ", ex.what());
+  }
+
+  return {};
+}
+
+void ExecutableStore::Persist(ConstByteArray const &digest, ConstByteArray const &fingerprint,
+                              vm::Executable const &executable)
+{
+  FETCH_LOCK(store_lock_);
+
+  if (!store_)
+  {
+    return;
+  }
+
+  try
+  {
+    store_->Set(storage::ResourceID{digest}, CompiledExecutable{fingerprint, executable});
+  }
+  catch (std::exception const &ex)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to persist executable: ", ex.what());
+  }
+}
+
+void ExecutableStore::Insert(ConstByteArray const &digest, ConstByteArray const &fingerprint,
+                             ExecutablePtr const &executable)
+{
+  FETCH_LOCK(lock_);
+
+  if ((cache_.size() >= MAX_CACHED_EXECUTABLES) && (cache_.find(digest) == cache_.end()))
+  {
+    // evict the executables which are not currently held by any contract
+    for (auto it = cache_.begin(); it != cache_.end();)
+    {
+      if (it->second.executable.use_count() == 1)
+      {
+        it = cache_.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+
+    // when every executable is in use, one of them has to go. The contracts holding it are not
+    // affected, later lookups will find it on disk.
+    if (cache_.size() >= MAX_CACHED_EXECUTABLES)
+    {
+      cache_.erase(cache_.begin());
+    }
+  }
+
+  cache_[digest] = Entry{fingerprint, executable};
+}
+
+}  // namespace ledger
+}  // namespace fetch
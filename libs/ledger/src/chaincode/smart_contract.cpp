@@ -16,6 +16,7 @@
 //
 //------------------------------------------------------------------------------
 
+#include "chain/constants.hpp"
 #include "chain/transaction.hpp"
 #include "core/byte_array/decoders.hpp"
 #include "core/byte_array/encoders.hpp"
@@ -24,6 +25,7 @@
 #include "crypto/sha256.hpp"
 #include "ledger/chaincode/contract.hpp"
 #include "ledger/chaincode/contract_context.hpp"
+#include "ledger/chaincode/executable_store.hpp"
 #include "ledger/chaincode/smart_contract.hpp"
 #include "ledger/chaincode/smart_contract_exception.hpp"
 #include "ledger/chaincode/smart_contract_factory.hpp"
@@ -105,7 +107,6 @@ constexpr char const *LOGGING_NAME = "SmartContract";
 SmartContract::SmartContract(std::string const &source)
   : source_{source}
   , digest_{fetch::crypto::Hash<fetch::crypto::SHA256>(ConstByteArray(source))}
-  , executable_{std::make_shared<Executable>()}
   , module_{VMFactory::GetModule(VMFactory::USE_SMART_CONTRACTS)}
 {
   if (source_.empty())
@@ -122,12 +123,13 @@ SmartContract::SmartContract(std::string const &source)
   module_->CreateFreeFunction(
       "getContext", [this](vm::VM *) -> vm_modules::ledger::ContextPtr { return context_; });
 
-  // create and compile the executable
-  fetch::vm::SourceFiles files  = {{"default.etch", source}};
-  auto                   errors = vm_modules::VMFactory::Compile(module_, files, *executable_);
+  // look up the compiled executable, only compiling the source if it has not been seen before
+  fetch::vm::SourceFiles  files = {{"default.etch", source}};
+  ExecutableStore::Errors errors;
+  executable_ = ExecutableStore::Instance().GetOrCompile(digest_, module_, files, errors);
 
   // if there are any compilation errors
-  if (!errors.empty())
+  if (!executable_)
   {
     throw SmartContractException(SmartContractException::Category::COMPILATION, std::move(errors));
   }
@@ -491,6 +493,7 @@ Contract::Result SmartContract::InvokeAction(std::string const &name, chain::Tra
 
   // Get clean VM instance
   auto vm = std::make_unique<vm::VM>(module_.get());
+  vm->SetLegacyUInt256Arithmetic(context().block_index < chain::CORRECTED_UINT256_ARITHMETIC_BLOCK);
 
   context_ = vm_modules::ledger::Context::Factory(vm.get(), tx, context().block_index);
 
@@ -567,6 +570,7 @@ Contract::Result SmartContract::InvokeAction(std::string const &name, chain::Tra
                               });
 
     vm::VM vm2{&module};
+    vm2.SetLegacyUInt256Arithmetic(vm->legacy_uint256_arithmetic());
     loaded_contract->context_ =
         vm_modules::ledger::Context::Factory(&vm2, tx, context().block_index);
 
@@ -683,6 +687,7 @@ Contract::Result SmartContract::InvokeInit(chain::Address const &    owner,
   auto vm = std::make_unique<vm::VM>(module_.get());
 
   auto const block_index = context().block_index;
+  vm->SetLegacyUInt256Arithmetic(block_index < chain::CORRECTED_UINT256_ARITHMETIC_BLOCK);
 
   context_ = vm_modules::ledger::Context::Factory(vm.get(), tx, block_index);
 
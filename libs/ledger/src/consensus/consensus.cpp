@@ -26,6 +26,7 @@
 
 #include <ctime>
 #include <random>
+#include <unordered_map>
 #include <utility>
 
 using fetch::core::TrimToSize;
@@ -78,6 +79,12 @@ using StakeManagerPtr = Consensus::StakeManagerPtr;
 using fetch::ledger::Block;
 using fetch::ledger::BlockPtr;
 using fetch::ledger::MainChain;
+using fetch::ledger::NotarisationService;
+
+using fetch::byte_array::ConstByteArray;
+using fetch::crypto::VerifiedSignatureCache;
+
+using AggregateSignature = NotarisationService::AggregateSignature;
 
 using DRNG = fetch::random::LinearCongruentialGenerator;
 
@@ -105,6 +112,28 @@ T DeterministicShuffle(T &container, uint64_t entropy)
   return container;
 }
 
+// A notarisation is the aggregate signature of the previous block hash by the signers of the aeon
+// containing the previous block, so the previous hash (which pins the chain and therefore the
+// aeon keys and threshold) together with the signer record and signature identify a valid check
+ConstByteArray SignerRecordAsBytes(AggregateSignature const &notarisation)
+{
+  auto const &signers = notarisation.second;
+  return ConstByteArray(signers.data(), signers.size());
+}
+
+bool IsVerifiedNotarisation(VerifiedSignatureCache const &cache, Block const &block)
+{
+  auto const &notarisation = block.block_entropy.block_notarisation;
+  return cache.Contains(block.previous_hash, SignerRecordAsBytes(notarisation),
+                        notarisation.first.getStr());
+}
+
+void AddVerifiedNotarisation(VerifiedSignatureCache &cache, ConstByteArray const &previous_hash,
+                             AggregateSignature const &notarisation)
+{
+  cache.Add(previous_hash, SignerRecordAsBytes(notarisation), notarisation.first.getStr());
+}
+
 }  // namespace
 
 Consensus::Consensus(StakeManagerPtr stake, BeaconSetupServicePtr beacon_setup,
@@ -210,6 +239,25 @@ BlockPtr GetBlockPriorTo(Block const &current, MainChain const &chain)
 }
 
 Block Consensus::GetBeginningOfAeon(Block const &current, MainChain const &chain) const
+{
+  return GetBeginningOfAeon(
+      current, chain, [&chain](Block const &block) { return GetBlockPriorTo(block, chain); },
+      true);
+}
+
+/**
+ * Find the first block of the aeon containing a block. Predecessors of the block which are not in
+ * the chain are walked back through, after which the chain looks the beginning up by its number.
+ *
+ * @param current The block whose aeon is wanted
+ * @param chain The chain holding the earlier blocks
+ * @param prior_to Lookup of the block preceding a block
+ * @param update_cache Whether a block found by walking back may be cached, which must only be the
+ * case when all of the blocks looked up are already in the chain
+ * @return The first block of the aeon
+ */
+Block Consensus::GetBeginningOfAeon(Block const &current, MainChain const &chain,
+                                    PriorBlockLookup const &prior_to, bool update_cache) const
 {
   MilliTimer const timer{"GetBeginningOfAeon ", 1000};
   Block            ret          = current;
@@ -231,10 +279,15 @@ Block Consensus::GetBeginningOfAeon(Block const &current, MainChain const &chain
   FETCH_LOG_INFO(LOGGING_NAME, "Failed to lookup nearest aeon: ", nearest_aeon, ", looking up.");
 
   // Walk back the chain until we see a block specifying an aeon beginning (corner
-  // case for true genesis)
+  // case for true genesis). The chain knows where the aeon of its own blocks began, so the walk
+  // only steps through blocks it does not hold, or which were stored without an aeon beginning.
   while (!ret.block_entropy.IsAeonBeginning() && ret.block_number != 0)
   {
-    auto prior = GetBlockPriorTo(ret, chain);
+    auto prior = chain.GetAeonBeginning(ret.previous_hash);
+    if (!prior)
+    {
+      prior = prior_to(ret);
+    }
 
     if (!prior)
     {
@@ -249,7 +302,10 @@ Block Consensus::GetBeginningOfAeon(Block const &current, MainChain const &chain
   if (ret.block_number == nearest_aeon)
   {
     // Put in cache if we did do the chain walk
-    aeon_beginning_cache_[ret.block_number] = ret;
+    if (update_cache)
+    {
+      aeon_beginning_cache_[ret.block_number] = ret;
+    }
   }
   else
   {
@@ -268,6 +324,12 @@ bool Consensus::VerifyNotarisation(Block const &block) const
   // not contain a notarisation
   if (notarisation_ && block.block_number > 1)
   {
+    // Skip the pairing check if this notarisation has been verified before
+    if (IsVerifiedNotarisation(verified_notarisations_, block))
+    {
+      return true;
+    }
+
     // Try to verify with notarisation units in notarisation_
     auto previous_notarised_block = chain_.GetBlock(block.previous_hash);
 
@@ -289,9 +351,12 @@ bool Consensus::VerifyNotarisation(Block const &block) const
         auto threshold                 = GetThreshold(*previous_notarised_block);
         auto ordered_notarisation_keys = aeon_block.block_entropy.aeon_notarisation_keys;
 
-        return notarisation_->Verify(previous_notarised_block->hash,
-                                     block.block_entropy.block_notarisation,
-                                     ordered_notarisation_keys, threshold);
+        if (!notarisation_->Verify(previous_notarised_block->hash,
+                                   block.block_entropy.block_notarisation,
+                                   ordered_notarisation_keys, threshold))
+        {
+          return false;
+        }
       }
       catch (std::exception const &ex)
       {
@@ -308,10 +373,107 @@ bool Consensus::VerifyNotarisation(Block const &block) const
     {
       return false;
     }
+
+    AddVerifiedNotarisation(verified_notarisations_, block.previous_hash,
+                            block.block_entropy.block_notarisation);
   }
   return true;
 }
 
+/**
+ * Verify the notarisations of a sequence of blocks, ordered earliest to latest, ahead of them being
+ * validated one at a time. Each notarisation is checked in the same way as by VerifyNotarisation,
+ * but the pairing checks are made without holding the lock, and the notarisations which pass are
+ * cached so that ValidBlock does not check them again. This stops at the first notarisation which
+ * fails or can not be checked yet, leaving it and the rest of the blocks to ValidBlock.
+ *
+ * @param blocks The blocks to be verified
+ */
+void Consensus::VerifyNotarisations(Blocks const &blocks) const
+{
+  if (!notarisation_)
+  {
+    return;
+  }
+
+  MilliTimer const timer{"VerifyNotarisations ", 1000};
+
+  // Blocks of the sequence are not in the chain yet, so predecessors are looked up among them first
+  std::unordered_map<Digest, BlockPtr> sequence;
+
+  auto const prior_to = [this, &sequence](Block const &block) {
+    auto const it = sequence.find(block.previous_hash);
+    return (it != sequence.end()) ? it->second : GetBlockPriorTo(block, chain_);
+  };
+
+  for (auto const &block : blocks)
+  {
+    sequence[block->hash] = block;
+
+    // Genesis is not notarised so blocks with block number 1 do not contain a notarisation
+    if (block->block_number <= 1 || IsVerifiedNotarisation(verified_notarisations_, *block))
+    {
+      continue;
+    }
+
+    BlockPtr                           previous;
+    BlockEntropy::AeonNotarisationKeys aeon_notarisation_keys;
+    uint32_t                           threshold{0};
+
+    {
+      FETCH_LOCK(mutex_);
+
+      previous = prior_to(*block);
+      if (!previous)
+      {
+        break;
+      }
+
+      // The threshold is only known once the cabinet of the aeon has been seen
+      uint64_t const last_snapshot =
+          previous->block_number - (previous->block_number % aeon_period_);
+      if (cabinet_history_.find(last_snapshot) == cabinet_history_.end())
+      {
+        break;
+      }
+
+      try
+      {
+        // Blocks of the sequence have not been validated, so the aeon found is not cached
+        aeon_notarisation_keys =
+            GetBeginningOfAeon(*previous, chain_, prior_to, false)
+                .block_entropy.aeon_notarisation_keys;
+        threshold = GetThreshold(*previous);
+      }
+      catch (std::exception const &ex)
+      {
+        FETCH_LOG_WARN(LOGGING_NAME, __func__, ": ", ex.what());
+        break;
+      }
+    }
+
+    auto const &notarisation = block->block_entropy.block_notarisation;
+
+    auto result = notarisation_->Verify(previous->block_number, previous->hash, notarisation);
+    if (result == NotarisationResult::CAN_NOT_VERIFY)
+    {
+      result = NotarisationService::Verify(previous->hash, notarisation, aeon_notarisation_keys,
+                                           threshold)
+                   ? NotarisationResult::PASS_VERIFICATION
+                   : NotarisationResult::FAIL_VERIFICATION;
+    }
+
+    if (result != NotarisationResult::PASS_VERIFICATION)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Found block with an invalid notarisation during sync: 0x",
+                     block->hash.ToHex());
+      break;
+    }
+
+    AddVerifiedNotarisation(verified_notarisations_, previous->hash, notarisation);
+  }
+}
+
 uint64_t Consensus::GetBlockGenerationWeight(Block const &current, Identity const &identity) const
 {
   MilliTimer const timer{"GetBlockGenerationWeight ", 1000};
@@ -945,14 +1107,24 @@ Status Consensus::ValidBlock(Block const &current) const
     return Status::NO;
   }
 
-  if (beacon_ &&
-      !dkg::BeaconManager::Verify(group_pub_key, block_preceeding->block_entropy.EntropyAsSHA256(),
-                                  current.block_entropy.group_signature))
+  if (beacon_)
   {
-    consensus_last_validate_block_failure_->set(11);
-    consensus_validate_block_failures_total_->increment();
-    FETCH_LOG_WARN(LOGGING_NAME, "Found block whose entropy isn't a signature of the previous!");
-    return Status::NO;
+    auto const  entropy         = block_preceeding->block_entropy.EntropyAsSHA256();
+    auto const &group_signature = current.block_entropy.group_signature;
+
+    if (!verified_entropy_.Contains(entropy, group_pub_key, group_signature))
+    {
+      if (!dkg::BeaconManager::Verify(group_pub_key, entropy, group_signature))
+      {
+        consensus_last_validate_block_failure_->set(11);
+        consensus_validate_block_failures_total_->increment();
+        FETCH_LOG_WARN(LOGGING_NAME,
+                       "Found block whose entropy isn't a signature of the previous!");
+        return Status::NO;
+      }
+
+      verified_entropy_.Add(entropy, group_pub_key, group_signature);
+    }
   }
 
   if (!VerifyNotarisation(current))
@@ -1007,6 +1179,10 @@ void Consensus::Reset(StakeSnapshot const &snapshot)
   }
 
   cabinet_history_[current_block_.block_number] = stake_->Reset(snapshot, max_cabinet_size_);
+
+  // The thresholds the cached notarisations were checked against may no longer hold
+  verified_notarisations_.Clear();
+  verified_entropy_.Clear();
 }
 
 void Consensus::SetMaxCabinetSize(uint16_t size)
@@ -16,6 +16,7 @@
 //
 //------------------------------------------------------------------------------
 
+#include "chain/constants.hpp"
 #include "core/containers/trim_to_size.hpp"
 #include "ledger/chain/block.hpp"
 #include "ledger/consensus/stake_manager.hpp"
@@ -36,6 +37,13 @@ constexpr char const *LOGGING_NAME = "StakeMgr";
 
 storage::ResourceAddress const STAKE_STORAGE_ADDRESS{"fetch.token.state.aggregation.stake"};
 
+StakeSnapshot::CabinetSelection CabinetSelectionFor(uint64_t block_number)
+{
+  return (block_number >= chain::WEIGHTED_CABINET_SELECTION_BLOCK)
+             ? StakeSnapshot::CabinetSelection::WEIGHTED_SAMPLING
+             : StakeSnapshot::CabinetSelection::SHUFFLED_SCAN;
+}
+
 }  // namespace
 
 void StakeManager::UpdateCurrentBlock(BlockIndex block_index)
@@ -70,7 +78,8 @@ StakeManager::CabinetPtr StakeManager::BuildCabinet(
   auto snapshot = LookupStakeSnapshot(current.block_number);
   if (snapshot)
   {
-    cabinet = snapshot->BuildCabinet(current.block_entropy.EntropyAsU64(), cabinet_size, whitelist);
+    cabinet = snapshot->BuildCabinet(current.block_entropy.EntropyAsU64(), cabinet_size, whitelist,
+                                     CabinetSelectionFor(current.block_number));
   }
 
   return cabinet;
@@ -81,7 +90,8 @@ StakeManager::CabinetPtr StakeManager::BuildCabinet(
     ConsensusInterface::Minerwhitelist const &whitelist) const
 {
   auto snapshot = LookupStakeSnapshot(block_number);
-  return snapshot->BuildCabinet(entropy, cabinet_size, whitelist);
+  return snapshot->BuildCabinet(entropy, cabinet_size, whitelist,
+                                CabinetSelectionFor(block_number));
 }
 
 bool StakeManager::Save(StorageInterface &storage)
@@ -146,7 +156,7 @@ StakeManager::CabinetPtr StakeManager::ResetInternal(StakeSnapshotPtr &&snapshot
   stake_history_.clear();
   stake_history_[0] = snapshot;
 
-  CabinetPtr new_cabinet = snapshot->BuildCabinet(0, cabinet_size);
+  CabinetPtr new_cabinet = snapshot->BuildCabinet(0, cabinet_size, {}, CabinetSelectionFor(0));
 
   // current
   current_             = std::move(snapshot);
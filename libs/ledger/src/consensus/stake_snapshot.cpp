@@ -19,9 +19,12 @@
 #include "core/digest.hpp"
 #include "core/random/lcg.hpp"
 #include "ledger/consensus/stake_snapshot.hpp"
+#include "vectorise/platform.hpp"
 
 #include <algorithm>
+#include <cassert>
 #include <unordered_set>
+#include <vector>
 
 namespace fetch {
 namespace ledger {
@@ -30,17 +33,124 @@ using Identity    = crypto::Identity;
 using IdentitySet = std::unordered_set<Identity>;
 using DRNG        = random::LinearCongruentialGenerator;
 
+namespace {
+
+/**
+ * A Fenwick (binary indexed) tree of stakes, from which stakers can be drawn in proportion to their
+ * stake and then removed, each in O(log n)
+ */
+class StakeTree
+{
+public:
+  explicit StakeTree(std::vector<uint64_t> const &stakes)
+    : tree_(stakes.size() + 1, 0)
+  {
+    // linear time construction, each node passes its sum on to its parent
+    for (std::size_t i = 1; i < tree_.size(); ++i)
+    {
+      tree_[i] += stakes[i - 1];
+      total_ += stakes[i - 1];
+
+      std::size_t const parent = i + (i & (~i + 1u));
+      if (parent < tree_.size())
+      {
+        tree_[parent] += tree_[i];
+      }
+    }
+
+    while ((top_bit_ << 1u) < tree_.size())
+    {
+      top_bit_ <<= 1u;
+    }
+  }
+
+  uint64_t total() const
+  {
+    return total_;
+  }
+
+  /**
+   * Find the staker whose stake covers a position in the cumulative stake
+   *
+   * @param position The position, which must be less than the total
+   * @return The index of the staker
+   */
+  std::size_t Find(uint64_t position) const
+  {
+    std::size_t index{0};
+    for (std::size_t bit = top_bit_; bit != 0; bit >>= 1u)
+    {
+      std::size_t const next = index + bit;
+      if ((next < tree_.size()) && (tree_[next] <= position))
+      {
+        index = next;
+        position -= tree_[next];
+      }
+    }
+
+    return index;
+  }
+
+  void Remove(std::size_t index, uint64_t stake)
+  {
+    total_ -= stake;
+    for (std::size_t i = index + 1; i < tree_.size(); i += i & (~i + 1u))
+    {
+      tree_[i] -= stake;
+    }
+  }
+
+private:
+  std::vector<uint64_t> tree_;
+  uint64_t              total_{0};
+  std::size_t           top_bit_{1};
+};
+
+/**
+ * Draw a position uniformly from [0, bound). Only the upper bits of the generator are used, since
+ * the lower bits of an LCG with a power of two modulus have short periods, and draws which fall
+ * outside the bound are rejected rather than wrapped, so that no position is favoured.
+ *
+ * @param rng The generator
+ * @param bound The exclusive upper bound, which must not be zero
+ * @return The position
+ */
+uint64_t DrawBelow(DRNG &rng, uint64_t bound)
+{
+  assert(bound != 0);
+
+  if (bound == 1)
+  {
+    return 0;
+  }
+
+  // keep just enough bits to cover the bound, so that at least half of the draws are accepted
+  uint64_t const shift = platform::CountLeadingZeroes64(bound - 1);
+
+  uint64_t position = rng() >> shift;
+  while (position >= bound)
+  {
+    position = rng() >> shift;
+  }
+
+  return position;
+}
+
+}  // namespace
+
 /**
  * Given the source of entropy, generate a selection of stakes identities based on proportional
  * probability against stakes.
  *
  * @param entropy The seed source of entropy
  * @param count The size of the selection
+ * @param whitelist If not empty, the only identities which may be selected
+ * @param selection The selection scheme, which must be the one used for the block being built on
  * @return The selection of identities
  */
 StakeSnapshot::CabinetPtr StakeSnapshot::BuildCabinet(
-    uint64_t entropy, std::size_t count,
-    std::set<byte_array::ConstByteArray> const &whitelist) const
+    uint64_t entropy, std::size_t count, std::set<byte_array::ConstByteArray> const &whitelist,
+    CabinetSelection selection) const
 {
   FETCH_LOG_DEBUG(LOGGING_NAME, "Building cabinet from pool of: ", stake_index_.size());
 
@@ -51,26 +161,51 @@ StakeSnapshot::CabinetPtr StakeSnapshot::BuildCabinet(
   // Pre filter against the whitelist if necessary
   if (!whitelist.empty())
   {
-    for (auto it = stake_index.begin(); it != stake_index.end();)
-    {
-      if (whitelist.find((*it)->identity.identifier()) == whitelist.end())
+    auto const not_whitelisted = [&whitelist](RecordPtr const &record) {
+      if (whitelist.find(record->identity.identifier()) != whitelist.end())
       {
-        FETCH_LOG_WARN(LOGGING_NAME, "Removing staker since not in whitelist: ",
-                       (*it)->identity.identifier().ToBase64());
-        it = stake_index.erase(it);
+        return false;
       }
-      else
-      {
-        ++it;
-      }
-    }
+
+      FETCH_LOG_WARN(LOGGING_NAME, "Removing staker since not in whitelist: ",
+                     record->identity.identifier().ToBase64());
+      return true;
+    };
+
+    auto const last = std::remove_if(stake_index.begin(), stake_index.end(), not_whitelisted);
+    stake_index.erase(last, stake_index.end());
+  }
+
+  switch (selection)
+  {
+  case CabinetSelection::SHUFFLED_SCAN:
+    SelectByShuffledScan(entropy, count, stake_index, *cabinet);
+    break;
+  case CabinetSelection::WEIGHTED_SAMPLING:
+    SelectByWeightedSampling(entropy, count, stake_index, *cabinet);
+    break;
   }
 
+  return cabinet;
+}
+
+/**
+ * The original cabinet selection, kept unchanged for the blocks which were built with it. Each
+ * member costs a shuffle and a scan of all of the stakes, so it is O(count * n).
+ *
+ * @param entropy The seed source of entropy
+ * @param count The size of the selection
+ * @param stake_index The stakes to select from
+ * @param cabinet The selection of identities
+ */
+void StakeSnapshot::SelectByShuffledScan(uint64_t entropy, std::size_t count,
+                                         StakeIndex &stake_index, Cabinet &cabinet) const
+{
   if (count >= identity_index_.size())
   {
     for (auto const &record : stake_index)
     {
-      cabinet->emplace_back(record->identity);
+      cabinet.emplace_back(record->identity);
     }
   }
   else
@@ -103,7 +238,7 @@ StakeSnapshot::CabinetPtr StakeSnapshot::BuildCabinet(
 
           if (chosen_identities.find(record->identity) == chosen_identities.end())
           {
-            cabinet->emplace_back(record->identity);
+            cabinet.emplace_back(record->identity);
             chosen_identities.emplace(record->identity);
 
             // exit from the search loop
@@ -119,8 +254,52 @@ StakeSnapshot::CabinetPtr StakeSnapshot::BuildCabinet(
       }
     }
   }
+}
 
-  return cabinet;
+/**
+ * Select the cabinet by drawing members one at a time with probability proportional to their
+ * stake, removing each member from the draw once it has been selected. The stakes are kept in a
+ * Fenwick tree so the selection is O(n log n) overall, dominated by sorting the stakes into a
+ * deterministic order.
+ *
+ * Stakers without any stake are never selected, so the cabinet can be smaller than requested.
+ *
+ * @param entropy The seed source of entropy
+ * @param count The size of the selection
+ * @param stake_index The stakes to select from
+ * @param cabinet The selection of identities
+ */
+void StakeSnapshot::SelectByWeightedSampling(uint64_t entropy, std::size_t count,
+                                             StakeIndex &stake_index, Cabinet &cabinet)
+{
+  if (count >= stake_index.size())
+  {
+    for (auto const &record : stake_index)
+    {
+      cabinet.emplace_back(record->identity);
+    }
+
+    return;
+  }
+
+  // ensure the stake list is in a deterministic state
+  std::sort(stake_index.begin(), stake_index.end(),
+            [](RecordPtr const &a, RecordPtr const &b) { return a->identity < b->identity; });
+
+  std::vector<uint64_t> stakes(stake_index.size());
+  std::transform(stake_index.begin(), stake_index.end(), stakes.begin(),
+                 [](RecordPtr const &record) { return record->stake; });
+
+  StakeTree tree{stakes};
+  DRNG      rng(entropy);
+
+  while ((cabinet.size() < count) && (tree.total() != 0))
+  {
+    std::size_t const index = tree.Find(DrawBelow(rng, tree.total()));
+
+    cabinet.emplace_back(stake_index[index]->identity);
+    tree.Remove(index, stakes[index]);
+  }
 }
 
 /**
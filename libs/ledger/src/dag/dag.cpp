@@ -21,6 +21,7 @@
 #include "ledger/dag/dag.hpp"
 #include "ledger/dag/dag_node.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <random>
 #include <string>
@@ -28,6 +29,8 @@
 
 using namespace fetch::ledger;
 
+constexpr DAG::NodeID DAG::INVALID_NODE_ID;
+
 DAG::DAG(std::string db_name, bool load, CertificatePtr certificate)
   : db_name_{std::move(db_name)}
   , certificate_{std::move(certificate)}
@@ -42,7 +45,7 @@ DAG::DAG(std::string db_name, bool load, CertificatePtr certificate)
     previous_epochs_.clear();
     all_tips_.clear();
     tips_.clear();
-    node_pool_.clear();
+    ClearPoolInternal();
     loose_nodes_.clear();
     loose_nodes_lookup_.clear();
     recently_added_.clear();
@@ -51,6 +54,7 @@ DAG::DAG(std::string db_name, bool load, CertificatePtr certificate)
     // for epoch 0 - this should always be empty
     previous_epoch_ = DAGEpoch{};
     previous_epoch_.Finalise();
+    RebuildEpochIndexInternal();
   };
 
   // If everything is in order we can recreate our epoch state by pushing from the store into our
@@ -98,6 +102,7 @@ DAG::DAG(std::string db_name, bool load, CertificatePtr certificate)
     previous_epoch_ = previous_epochs_.front();
     previous_epochs_.pop_front();
     most_recent_epoch_ = previous_epoch_.block_number;
+    RebuildEpochIndexInternal();
 
     return true;
   };
@@ -251,7 +256,7 @@ void DAG::SetReferencesInternal(DAGNodePtr const &node)
   uint64_t &wei          = node->weight;
 
   // Corner case - not enough nodes to reference - just point a single reference to the prev epoch
-  if (node_pool_.size() < PARAMETER_REFERENCES_TO_BE_TIP)
+  if (node_ids_.size() < PARAMETER_REFERENCES_TO_BE_TIP)
   {
     prevs.push_back(previous_epoch_.hash);
     oldest_epoch = most_recent_epoch_;
@@ -299,12 +304,11 @@ void DAG::SetReferencesInternal(DAGNodePtr const &node)
   else
   {
     // In the case there are not enough tips to reference, choose non-tip nodes
-    // TODO(HUT): inefficient, but node pool is almost certainly small
-    std::unordered_map<NodeHash, DAGNodePtr> node_pool_copy = node_pool_;
+    auto it = node_ids_.begin();
 
-    while (prevs.size() < PARAMETER_REFERENCES_TO_BE_TIP && !node_pool_copy.empty())
+    while (prevs.size() < PARAMETER_REFERENCES_TO_BE_TIP && it != node_ids_.end())
     {
-      auto &node_ref = (node_pool_copy.begin())->second;
+      auto const &node_ref = nodes_[it->second];
 
       prevs.push_back(node_ref->hash);
 
@@ -318,7 +322,7 @@ void DAG::SetReferencesInternal(DAGNodePtr const &node)
         oldest_epoch = node_ref->oldest_epoch_referenced;
       }
 
-      node_pool_copy.erase(node_pool_copy.begin());
+      ++it;
     }
   }
 }
@@ -354,7 +358,7 @@ bool DAG::IsLooseInternal(DAGNodePtr const &node) const
 {
   for (auto const &dag_node_prev : node->previous)
   {
-    if (node_pool_.find(dag_node_prev) == node_pool_.end() &&
+    if (node_ids_.find(dag_node_prev) == node_ids_.end() &&
         !HashInPrevEpochsInternal(dag_node_prev))
     {
       return true;
@@ -369,7 +373,7 @@ void DAG::AddLooseNodeInternal(DAGNodePtr const &node)
 {
   for (auto const &dag_node_prev : node->previous)
   {
-    if (node_pool_.find(dag_node_prev) == node_pool_.end() &&
+    if (node_ids_.find(dag_node_prev) == node_ids_.end() &&
         !HashInPrevEpochsInternal(dag_node_prev))
     {
       loose_nodes_lookup_[dag_node_prev].push_back(node);
@@ -381,33 +385,14 @@ void DAG::AddLooseNodeInternal(DAGNodePtr const &node)
 // Check whether the hash refers to anything considered valid that's not in the node pool
 bool DAG::HashInPrevEpochsInternal(DAGHash const &hash) const
 {
-  // Check if hash is a node in epoch
-  if (previous_epoch_.Contains(hash))
-  {
-    return true;
-  }
-
-  // check if hash is epoch/prev epochs
-  if (hash == previous_epoch_.hash)
-  {
-    return true;
-  }
-
-  for (auto const &epoch : previous_epochs_)
-  {
-    if (hash == epoch.hash || epoch.Contains(hash))
-    {
-      return true;
-    }
-  }
-
-  return false;
+  // the epochs still in the validity period, and their nodes, are indexed
+  return recent_hashes_.find(hash) != recent_hashes_.end();
 }
 
 // check whether the node has already been added for this period
 bool DAG::AlreadySeenInternal(DAGNodePtr const &node) const
 {
-  return node_pool_.find(node->hash) != node_pool_.end() || HashInPrevEpochsInternal(node->hash);
+  return node_ids_.find(node->hash) != node_ids_.end() || HashInPrevEpochsInternal(node->hash);
 }
 
 bool DAG::TooOldInternal(uint64_t oldest_reference) const
@@ -466,10 +451,10 @@ std::shared_ptr<DAGNode> DAG::GetDAGNodeInternal(DAGHash const &hash, bool inclu
                                                  bool &was_loose)
 {
   // Find in node pool
-  auto it2 = node_pool_.find(hash);
-  if (it2 != node_pool_.end())
+  auto pool_node = LookupPoolNodeInternal(hash);
+  if (pool_node)
   {
-    return node_pool_[hash];
+    return pool_node;
   }
 
   was_loose = false;
@@ -532,7 +517,7 @@ bool DAG::PushInternal(DAGNodePtr const &node)
   }
 
   // Add to node pool, update any tips that advance due to this
-  node_pool_[node->hash] = node;
+  AddPoolNodeInternal(node);
   AdvanceTipsInternal(node);
 
   // There is now a chance that adding this node completed some loose nodes.
@@ -633,45 +618,49 @@ DAGEpoch DAG::CreateEpoch(uint64_t block_number)
     it++;
   }
 
-  // Find all un-finalised nodes given tips in epoch
-  std::set<DAGHash> all_nodes_to_add;
+  // Find all un-finalised nodes given tips in epoch. Since finalised nodes leave the node pool
+  // this only visits the nodes added since the last epoch
+  std::vector<DAGHash> all_nodes_to_add;
+  std::vector<DAGHash> data_nodes_to_add;
+  std::vector<DAGHash> solution_nodes_to_add;
 
-  auto on_node = [&all_nodes_to_add](NodeHash current) { all_nodes_to_add.insert(current); };
+  auto on_node = [&](NodeID current) -> bool {
+    auto const &dag_node_to_add = nodes_[current];
 
-  auto terminating_condition = [&all_nodes_to_add](NodeHash current) -> bool {
-    // Terminate when already seen node for efficiency reasons
-    return all_nodes_to_add.find(current) != all_nodes_to_add.end();
-  };
-
-  // Traverse down from the tips (for unaccounted for dagnodes), adding
-  // tips to all_nodes_to_add
-  TraverseFromTips(tips_to_add, on_node, terminating_condition);
-
-  ret.tips      = tips_to_add;
-  ret.all_nodes = all_nodes_to_add;
-
-  DAGNodePtr dag_node_to_add;
-
-  // Fill the TX field
-  // TODO(HUT): this needs ordering
-  for (auto const &dag_node_hash : all_nodes_to_add)
-  {
-    dag_node_to_add = node_pool_.at(dag_node_hash);
+    all_nodes_to_add.push_back(dag_node_to_add->hash);
 
+    // Fill the TX field
+    // TODO(HUT): this needs ordering
     switch (dag_node_to_add->type)
     {
     case DAGNode::WORK:
-      ret.solution_nodes.insert(dag_node_to_add->hash);
+      solution_nodes_to_add.push_back(dag_node_to_add->hash);
       break;
     case DAGNode::DATA:
-      ret.data_nodes.insert(dag_node_to_add->hash);
+      data_nodes_to_add.push_back(dag_node_to_add->hash);
       break;
     case DAGNode::ARBITRARY:
       break;
     case DAGNode::GENESIS:
       break;
     }
-  }
+
+    return true;
+  };
+
+  // Traverse down from the tips (for unaccounted for dagnodes)
+  TraverseFromTips(tips_to_add, on_node);
+
+  // sorted input allows the sets to be built in linear time
+  auto ToSet = [](std::vector<DAGHash> &hashes) {
+    std::sort(hashes.begin(), hashes.end());
+    return std::set<DAGHash>(hashes.begin(), hashes.end());
+  };
+
+  ret.tips           = tips_to_add;
+  ret.all_nodes      = ToSet(all_nodes_to_add);
+  ret.data_nodes     = ToSet(data_nodes_to_add);
+  ret.solution_nodes = ToSet(solution_nodes_to_add);
 
   ret.Finalise();
 
@@ -707,12 +696,11 @@ bool DAG::CommitEpoch(DAGEpoch new_epoch)
     // Note that unaffected tips will remain valid but will have less elements
 
     // move finalised nodes into long term storage
-    auto it_node_to_rmv = node_pool_.find(node_hash);
-    if (it_node_to_rmv != node_pool_.end())
+    auto node_to_remove = LookupPoolNodeInternal(node_hash);
+    if (node_to_remove)
     {
-      DAGNodePtr &node_to_remove = it_node_to_rmv->second;
       finalised_dag_nodes_.Set(storage::ResourceID(node_to_remove->hash.hash), *node_to_remove);
-      node_pool_.erase(it_node_to_rmv);
+      RemovePoolNodeInternal(node_hash);
     }
     else if (loose_nodes_.find(node_hash) != loose_nodes_.end())
     {
@@ -740,12 +728,14 @@ bool DAG::CommitEpoch(DAGEpoch new_epoch)
   {
     previous_epochs_.push_back(previous_epoch_);
     previous_epoch_ = new_epoch;
+    IndexEpochInternal(previous_epoch_);
 
     if (previous_epochs_.size() > (EPOCH_VALIDITY_PERIOD - 1))
     {
       auto &front_epoch = previous_epochs_.front();
       assert(!front_epoch.hash.empty());
       SetEpochInStorage(std::to_string(front_epoch.block_number), front_epoch, true);
+      UnindexEpochInternal(front_epoch);
       previous_epochs_.pop_front();
     }
   }
@@ -755,6 +745,9 @@ bool DAG::CommitEpoch(DAGEpoch new_epoch)
   // Some tips will now refer to parts of the dag that are too old. Need to refresh these
   UpdateStaleTipsInternal();
 
+  // Renumber what is left of the node pool now the finalised and stale nodes have been removed
+  CompactPoolInternal();
+
   // Some nodes will have been looking for this hash, heal these
   HealLooseBlocksInternal(new_epoch.hash);
 
@@ -770,105 +763,47 @@ void DAG::Flush()
   finalised_dag_nodes_.Flush(false);
 }
 
-void DAG::TraverseFromTips(std::set<DAGHash> const &            tip_hashes,
-                           std::function<void(NodeHash)> const &on_node,
-                           std::function<bool(NodeHash)> const &terminating_condition)
+// Depth first search of the node pool from the tips, visiting each node at most once. The search
+// continues through the references of a node only if on_node returns true, and terminates at
+// references outside of the pool (epochs and finalised nodes)
+void DAG::TraverseFromTips(std::set<DAGHash> const &          tip_hashes,
+                           std::function<bool(NodeID)> const &on_node)
 {
+  std::vector<bool> visited(nodes_.size(), false);
+  NodeIDs           to_visit;
+
+  auto Visit = [this, &visited, &to_visit](NodeID id) {
+    if ((id != INVALID_NODE_ID) && nodes_[id] && !visited[id])
+    {
+      visited[id] = true;
+      to_visit.push_back(id);
+    }
+  };
+
   for (auto const &tip_hash : tip_hashes)
   {
-    if (node_pool_.find(tip_hash) == node_pool_.end())
+    auto const it = node_ids_.find(tip_hash);
+    if (it == node_ids_.end())
     {
       throw std::runtime_error("Tip found in DAG that refers nowhere");
     }
 
-    NodeHash              start = node_pool_[tip_hash]->hash;
-    DAGNodePtr            dag_node_to_add;
-    std::vector<uint64_t> switch_choices{0};
-    std::vector<NodeHash> switch_hashes{start};
+    Visit(it->second);
+  }
+
+  while (!to_visit.empty())
+  {
+    NodeID const current = to_visit.back();
+    to_visit.pop_back();
 
-    if (HashInPrevEpochsInternal(start))
+    if (!on_node(current))
     {
-      throw std::runtime_error("Tip found in DAG that refers to something finalised");
+      continue;
     }
 
-    // Depth first search of the dag until reaching a finalised node/hash
-    // Warning: If the dag is circular this will not terminate
-    while (!switch_choices.empty())
+    for (std::size_t i = previous_offsets_[current]; i < previous_offsets_[current + 1]; ++i)
     {
-      start = switch_hashes.back();  // Hash under evaluation
-
-      // Hash 'terminates' - refers to already used hash
-      if (HashInPrevEpochsInternal(start))
-      {
-        switch_choices.pop_back();
-        switch_hashes.pop_back();
-        continue;
-      }
-
-      if (start.IsEpoch())
-      {
-        switch_choices.pop_back();
-        switch_hashes.pop_back();
-        continue;
-      }
-
-      // Check user supplied terminating condition (usually at least this would be that
-      // the hash and by definition subgraph have already been added)
-      if (terminating_condition(start))
-      {
-        switch_choices.pop_back();
-        switch_hashes.pop_back();
-        continue;
-      }
-
-      auto node_it = node_pool_.find(start);
-      if (node_it != node_pool_.end())
-      {
-        dag_node_to_add = node_it->second;
-      }
-      else
-      {
-        for (uint64_t i = 1; i <= EPOCH_VALIDITY_PERIOD; ++i)
-        {
-          if (previous_epochs_.size() >= i)
-          {
-            if (previous_epochs_[previous_epochs_.size() - i].Contains(start))
-            {
-              dag_node_to_add = std::make_shared<DAGNode>();
-              finalised_dag_nodes_.Get(storage::ResourceID(start.hash), *dag_node_to_add);
-              break;
-            }
-          }
-        }
-      }
-      if (!dag_node_to_add)
-      {
-        FETCH_LOG_ERROR(LOGGING_NAME,
-                        "TraverseFromTips: unable to lookup node with hash=", start.ToBase64());
-        switch_choices.pop_back();
-        switch_hashes.pop_back();
-        continue;
-      }
-
-      // Attempt to take the path specified by switch choices, else add it
-      dag_node_to_add = node_pool_.at(start);
-
-      // If all paths are exhausted for this hash
-      if (switch_choices.back() == dag_node_to_add->previous.size())
-      {
-        on_node(start);
-        /* all_nodes_to_add.insert(start); */
-        switch_choices.pop_back();
-        switch_hashes.pop_back();
-        continue;
-      }
-
-      // There are unexplored paths still - explore one of these
-      start = dag_node_to_add->previous[switch_choices.back()];
-      switch_hashes.push_back(start);
-
-      switch_choices[switch_choices.size() - 1]++;
-      switch_choices.push_back(0);
+      Visit(previous_ids_[i]);
     }
   }
 }
@@ -878,11 +813,9 @@ void DAG::UpdateStaleTipsInternal()
 {
   // for tips that now contain a subgraph that is out of scope (not in recent epochs),
   // delete, traverse these and create new tips that are in scope
-  std::set<NodeHash>
-                     stale_tips_to_delete;  // Tips that somewhere in their dag refer to an old dag node
-  std::set<NodeHash> stale_nodes;           // Nodes that refer somewhere to an old dag node
-  std::set<NodeHash> new_tip_locations;  // Nodes that were referenced by a now stale dag tip, but
-                                         // are themselves still ok
+  std::set<NodeHash> stale_tips_to_delete;  // Tips that somewhere in their dag refer to an old node
+  NodeIDs            stale_nodes;           // Nodes that refer somewhere to an old dag node
+  NodeIDs            new_tip_locations;     // Nodes referenced by a now stale tip, but themselves ok
 
   for (auto const &tip : all_tips_)
   {
@@ -893,37 +826,25 @@ void DAG::UpdateStaleTipsInternal()
     }
   }
 
-  auto on_node = [&stale_nodes](NodeHash current) { stale_nodes.insert(current); };
-
-  auto terminating_condition = [this, &stale_nodes, &new_tip_locations](NodeHash current) -> bool {
-    // Terminate when already seen node for efficiency reasons
-    if (stale_nodes.find(current) != stale_nodes.end())
-    {
-      return true;
-    }
-
+  auto on_node = [this, &stale_nodes, &new_tip_locations](NodeID current) -> bool {
     // Terminate when this node is healthy - this is a new tip
-    DAGNodePtr dag_node_to_check;
-
-    if (node_pool_.find(current) != node_pool_.end())
+    if (!TooOldInternal(nodes_[current]->oldest_epoch_referenced))
     {
-      dag_node_to_check = node_pool_[current];
-
-      if (!TooOldInternal(dag_node_to_check->oldest_epoch_referenced))
-      {
-        new_tip_locations.insert(current);
-        return true;
-      }
+      new_tip_locations.push_back(current);
+      return false;
     }
 
-    return false;
+    stale_nodes.push_back(current);
+    return true;
   };
 
-  TraverseFromTips(stale_tips_to_delete, on_node, terminating_condition);
+  TraverseFromTips(stale_tips_to_delete, on_node);
 
   // Cleanup - remove old tips and nodes - note that stale_tips_to_delete is a subset of stale_nodes
-  for (auto const &stale_node_hash : stale_nodes)
+  for (auto const &stale_node : stale_nodes)
   {
+    NodeHash const stale_node_hash = nodes_[stale_node]->hash;
+
     auto it = tips_.find(stale_node_hash);
 
     if (it != tips_.end())
@@ -931,13 +852,13 @@ void DAG::UpdateStaleTipsInternal()
       DeleteTip(it->second->id);
     }
 
-    node_pool_.erase(stale_node_hash);
+    RemovePoolNodeInternal(stale_node_hash);
   }
 
   // Update : new tips need to be created
   for (auto const &new_tip_loc : new_tip_locations)
   {
-    DAGNodePtr node = node_pool_.at(new_tip_loc);
+    DAGNodePtr const &node = nodes_[new_tip_loc];
 
     DAGTipPtr new_dag_tip =
         std::make_shared<DAGTip>(node->hash, node->oldest_epoch_referenced, node->weight);
@@ -1160,7 +1081,7 @@ bool DAG::RevertToEpoch(uint64_t epoch_bn_to_revert)
     previous_epochs_.clear();
     all_tips_.clear();
     tips_.clear();
-    node_pool_.clear();
+    ClearPoolInternal();
     loose_nodes_.clear();
     loose_nodes_lookup_.clear();
     recently_added_.clear();
@@ -1168,6 +1089,7 @@ bool DAG::RevertToEpoch(uint64_t epoch_bn_to_revert)
 
     previous_epoch_ = DAGEpoch{};
     previous_epoch_.Finalise();
+    RebuildEpochIndexInternal();
     return true;
   }
 
@@ -1243,6 +1165,7 @@ bool DAG::RevertToEpoch(uint64_t epoch_bn_to_revert)
   previous_epoch_  = previous_epochs_.back();
   previous_epochs_.pop_back();
   most_recent_epoch_ = epoch_bn_to_revert;
+  RebuildEpochIndexInternal();
 
   assert(previous_epochs_.size() < EPOCH_VALIDITY_PERIOD);
 
@@ -1317,6 +1240,128 @@ bool DAG::HasEpoch(EpochHash const &hash)
   return all_stored_epochs_.Get(storage::ResourceID(hash.hash), dummy);
 }
 
+DAG::DAGNodePtr DAG::LookupPoolNodeInternal(NodeHash const &hash) const
+{
+  auto const it = node_ids_.find(hash);
+  return (it != node_ids_.end()) ? nodes_[it->second] : DAGNodePtr{};
+}
+
+// Add a node to the pool under the next id. Its references are in the pool or finalised before it
+// is added, so references always point to lower ids
+void DAG::AddPoolNodeInternal(DAGNodePtr const &node)
+{
+  auto const id = static_cast<NodeID>(nodes_.size());
+
+  for (auto const &dag_node_prev : node->previous)
+  {
+    auto const it = node_ids_.find(dag_node_prev);
+    previous_ids_.push_back((it != node_ids_.end()) ? it->second : INVALID_NODE_ID);
+  }
+
+  previous_offsets_.push_back(previous_ids_.size());
+  nodes_.push_back(node);
+  node_ids_[node->hash] = id;
+}
+
+// Remove a node from the pool, its id remains allocated until the pool is compacted
+void DAG::RemovePoolNodeInternal(NodeHash const &hash)
+{
+  auto const it = node_ids_.find(hash);
+  if (it != node_ids_.end())
+  {
+    nodes_[it->second].reset();
+    node_ids_.erase(it);
+  }
+}
+
+// Renumber the nodes remaining in the pool, dropping references to nodes which have left it
+void DAG::CompactPoolInternal()
+{
+  NodeIDs                  new_ids(nodes_.size(), INVALID_NODE_ID);
+  std::vector<DAGNodePtr>  nodes;
+  std::vector<std::size_t> previous_offsets{0};
+  NodeIDs                  previous_ids;
+
+  nodes.reserve(node_ids_.size());
+  previous_offsets.reserve(node_ids_.size() + 1);
+
+  for (std::size_t id = 0; id < nodes_.size(); ++id)
+  {
+    if (!nodes_[id])
+    {
+      continue;
+    }
+
+    new_ids[id] = static_cast<NodeID>(nodes.size());
+
+    // references are to lower ids so have already been renumbered
+    for (std::size_t i = previous_offsets_[id]; i < previous_offsets_[id + 1]; ++i)
+    {
+      auto const previous_id = previous_ids_[i];
+      previous_ids.push_back((previous_id != INVALID_NODE_ID) ? new_ids[previous_id]
+                                                              : INVALID_NODE_ID);
+    }
+
+    previous_offsets.push_back(previous_ids.size());
+    node_ids_[nodes_[id]->hash] = new_ids[id];
+    nodes.push_back(std::move(nodes_[id]));
+  }
+
+  nodes_            = std::move(nodes);
+  previous_offsets_ = std::move(previous_offsets);
+  previous_ids_     = std::move(previous_ids);
+}
+
+void DAG::ClearPoolInternal()
+{
+  node_ids_.clear();
+  nodes_.clear();
+  previous_offsets_.assign(1, 0);
+  previous_ids_.clear();
+}
+
+void DAG::IndexEpochInternal(DAGEpoch const &epoch)
+{
+  recent_hashes_[epoch.hash] = epoch.block_number;
+
+  for (auto const &node_hash : epoch.all_nodes)
+  {
+    recent_hashes_[node_hash] = epoch.block_number;
+  }
+}
+
+void DAG::UnindexEpochInternal(DAGEpoch const &epoch)
+{
+  auto const Unindex = [this, &epoch](DAGHash const &hash) {
+    auto const it = recent_hashes_.find(hash);
+
+    // the hash might also be part of a more recent epoch
+    if ((it != recent_hashes_.end()) && (it->second == epoch.block_number))
+    {
+      recent_hashes_.erase(it);
+    }
+  };
+
+  Unindex(epoch.hash);
+
+  for (auto const &node_hash : epoch.all_nodes)
+  {
+    Unindex(node_hash);
+  }
+}
+
+void DAG::RebuildEpochIndexInternal()
+{
+  recent_hashes_.clear();
+
+  for (auto const &epoch : previous_epochs_)
+  {
+    IndexEpochInternal(epoch);
+  }
+
+  IndexEpochInternal(previous_epoch_);
+}
+
 // Delete tip by id
 void DAG::DeleteTip(DAGTipID tip_id)
 {
@@ -508,6 +508,10 @@ void ExecutionManager::MonitorThreadEntrypoint()
         std::size_t num_errors{0};
         std::size_t num_fatal_errors{0};
 
+        // execution results are written to the status cache once for the whole slice
+        TransactionStatusInterface::ExecutionResults execution_results{};
+        execution_results.reserve(execution_plan_[current_slice].size());
+
         // look through all execution items and determine if it was successful
         for (auto const &item : execution_plan_[current_slice])
         {
@@ -537,10 +541,12 @@ void ExecutionManager::MonitorThreadEntrypoint()
           aggregate_block_fees += item->fee();
           item->AggregateStakeUpdates(aggregated_stake_events);
 
-          if (tx_status_cache_)
-          {
-            tx_status_cache_->Update(item->digest(), item->result());
-          }
+          execution_results.emplace_back(item->digest(), item->result());
+        }
+
+        if (tx_status_cache_)
+        {
+          tx_status_cache_->UpdateBatch(execution_results);
         }
 
         // only provide debug if required
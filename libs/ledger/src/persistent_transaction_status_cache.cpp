@@ -189,7 +189,8 @@ namespace {
 
 constexpr char const *LOGGING_NAME = "PersistentTxCache";
 
-using TxStatus = PersistentTransactionStatusCache::TxStatus;
+using TxStatus   = PersistentTransactionStatusCache::TxStatus;
+using TxStatuses = PersistentTransactionStatusCache::TxStatuses;
 
 storage::ResourceID CreateRID(Digest digest)
 {
@@ -284,6 +285,45 @@ void PersistentTransactionStatusCache::Update(Digest digest, ContractExecutionRe
   UpdateStatus(digest, retrieved_status);
 }
 
+/**
+ * Query the status of a number of transactions at once
+ *
+ * @param digests The digests of the transactions
+ * @return The status objects, in the same order as the digests
+ */
+TxStatuses PersistentTransactionStatusCache::QueryBatch(Digests const &digests) const
+{
+  TxStatuses statuses{};
+  statuses.reserve(digests.size());
+
+  FETCH_LOCK(lock_);
+  for (auto const &digest : digests)
+  {
+    statuses.emplace_back(LookupStatus(digest));
+  }
+
+  return statuses;
+}
+
+/**
+ * Update the contract execution results for a number of transactions at once
+ *
+ * @param results The transaction digests and their contract execution results
+ */
+void PersistentTransactionStatusCache::UpdateBatch(ExecutionResults const &results)
+{
+  FETCH_LOCK(lock_);
+  for (auto const &result : results)
+  {
+    auto retrieved_status = LookupStatus(result.first);
+
+    retrieved_status.status               = TransactionStatus::EXECUTED;
+    retrieved_status.contract_exec_result = result.second;
+
+    UpdateStatus(result.first, retrieved_status);
+  }
+}
+
 /**
  * Attempt to lookup a previously stored transaction status from the disk
  *
@@ -261,6 +261,26 @@ void MainChainRpcService::HandleChainResponse(Address const &address, Begin begi
 {
   std::map<BlockStatus, std::size_t> status_stats;
 
+  // recompute the digests, so that the notarisations of the whole range can be verified before
+  // the blocks are validated individually
+  ConsensusInterface::Blocks blocks;
+  for (auto it = begin; it != end; ++it)
+  {
+    auto const &block = *it;
+
+    // skip the genesis block
+    if (!block->IsGenesis())
+    {
+      block->UpdateDigest();
+      blocks.push_back(block);
+    }
+  }
+
+  if (consensus_)
+  {
+    consensus_->VerifyNotarisations(blocks);
+  }
+
   for (auto it = begin; it != end; ++it)
   {
     auto block = *it;
@@ -271,9 +291,6 @@ void MainChainRpcService::HandleChainResponse(Address const &address, Begin begi
       continue;
     }
 
-    // recompute the digest
-    block->UpdateDigest();
-
     // add the block
     if (!ValidBlock(*block))
     {
@@ -559,21 +576,17 @@ State MainChainRpcService::WalkBack()
     back_stride_ *= 2;
   }
 
-  // TODO (nobody): we should consider once if this linear crawlback is worth improving
-  for (std::size_t i = 0; i < blocks_back; ++i)
+  // the chain walks the headers down to the ancestor, only its body is loaded
+  auto next_block_resolving =
+      chain_.GetAncestor(block_resolving_->hash, current_height - blocks_back);
+  if (!next_block_resolving)
   {
-    assert(!block_resolving_->IsGenesis());
-    auto next_block_resolving = chain_.GetBlock(block_resolving_->previous_hash);
-    if (!next_block_resolving)
-    {
-      FETCH_LOG_CRITICAL(LOGGING_NAME, __func__, ": block 0x",
-                         block_resolving_->previous_hash.ToHex(),
-                         ", previous to current resolving 0x", block_resolving_->hash.ToHex(),
-                         ", is not on the chain");
-      return State::SYNCHRONISING;
-    }
-    block_resolving_ = std::move(next_block_resolving);
+    FETCH_LOG_CRITICAL(LOGGING_NAME, __func__, ": ancestor ", current_height - blocks_back,
+                       " of current resolving 0x", block_resolving_->hash.ToHex(),
+                       ", is not on the chain");
+    return State::SYNCHRONISING;
   }
+  block_resolving_ = std::move(next_block_resolving);
 
   // now re-try requesting blocks from this point
   return State::REQUEST_NEXT_BLOCKS;
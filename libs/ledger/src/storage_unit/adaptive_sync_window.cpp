@@ -0,0 +1,131 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/storage_unit/adaptive_sync_window.hpp"
+
+#include <algorithm>
+
+namespace fetch {
+namespace ledger {
+namespace {
+
+// A round must improve on the previous rate by this factor for the window to grow
+constexpr double GROWTH_THRESHOLD = 1.05;
+
+// A round which falls below this fraction of the previous rate shrinks the window
+constexpr double BACK_OFF_THRESHOLD = 0.8;
+
+// Lower bound on the duration of a round, so that instantaneous rounds do not skew the rate
+constexpr std::chrono::microseconds MINIMUM_ROUND_DURATION{100};
+
+}  // namespace
+
+constexpr std::size_t AdaptiveSyncWindow::DEFAULT_INITIAL_WINDOW;
+constexpr std::size_t AdaptiveSyncWindow::DEFAULT_MAXIMUM_WINDOW;
+
+/**
+ * Construct the window
+ *
+ * @param initial_window The number of requests that can initially be in flight
+ * @param maximum_window The upper bound on the number of requests in flight
+ * @param now The current time
+ */
+AdaptiveSyncWindow::AdaptiveSyncWindow(std::size_t initial_window, std::size_t maximum_window,
+                                       Timepoint now)
+  : maximum_window_{std::max<std::size_t>(maximum_window, 1)}
+  , window_{std::min(std::max<std::size_t>(initial_window, 1), maximum_window_)}
+  , round_start_{now}
+{}
+
+/**
+ * Record a successful response, re-evaluating the window at the end of each round
+ *
+ * @param num_objects The number of objects delivered by the response
+ * @param now The time the response was received
+ */
+void AdaptiveSyncWindow::OnSuccess(std::size_t num_objects, Timepoint now)
+{
+  round_objects_ += num_objects;
+  ++round_responses_;
+
+  if (round_responses_ < window_)
+  {
+    return;
+  }
+
+  using Seconds = std::chrono::duration<double>;
+
+  auto const duration   = std::max<Clock::duration>(now - round_start_, MINIMUM_ROUND_DURATION);
+  auto const round_rate = static_cast<double>(round_objects_) / Seconds{duration}.count();
+
+  if (round_rate >= rate_ * GROWTH_THRESHOLD)
+  {
+    window_ = std::min(slow_start_ ? window_ * 2 : window_ + 1, maximum_window_);
+  }
+  else
+  {
+    slow_start_ = false;
+
+    if (round_rate < rate_ * BACK_OFF_THRESHOLD)
+    {
+      window_ = std::max<std::size_t>(window_ - 1, 1);
+    }
+  }
+
+  rate_ = round_rate;
+  StartRound(now);
+}
+
+/**
+ * Record a failed or timed out request, halving the window
+ *
+ * @param now The time the failure was observed
+ */
+void AdaptiveSyncWindow::OnFailure(Timepoint now)
+{
+  slow_start_ = false;
+  window_     = std::max<std::size_t>(window_ / 2, 1);
+
+  StartRound(now);
+}
+
+/**
+ * @return The number of requests that can currently be in flight
+ */
+std::size_t AdaptiveSyncWindow::window() const
+{
+  return window_;
+}
+
+/**
+ * @return The number of objects per second delivered during the last complete round
+ */
+double AdaptiveSyncWindow::rate() const
+{
+  return rate_;
+}
+
+void AdaptiveSyncWindow::StartRound(Timepoint now)
+{
+  round_responses_ = 0;
+  round_objects_   = 0;
+  round_start_     = now;
+}
+
+}  // namespace ledger
+}  // namespace fetch
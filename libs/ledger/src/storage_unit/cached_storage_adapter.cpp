@@ -43,17 +43,21 @@ CachedStorageAdapter::~CachedStorageAdapter() = default;
 void CachedStorageAdapter::Flush()
 {
   cache_.ApplyVoid([this](auto &cache) {
+    WriteBatch batch;
+
     for (auto &entry : cache)
     {
       if (!entry.second.flushed)
       {
-        // set the value on the storage engine
-        storage_.Set(entry.first, entry.second.value);
+        batch.emplace_back(entry.first, entry.second.value);
 
         // signal the entry as flushed
         entry.second.flushed = true;
       }
     }
+
+    // set all the values on the storage engine together
+    storage_.SetBatch(batch);
   });
 }
 
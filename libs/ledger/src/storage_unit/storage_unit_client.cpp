@@ -511,6 +511,52 @@ void StorageUnitClient::Set(ResourceAddress const &key, StateValue const &value)
   }
 }
 
+/**
+ * Write a group of values, sending a single request to each of the lanes involved
+ *
+ * @param batch The key value pairs to be written
+ */
+void StorageUnitClient::SetBatch(WriteBatch const &batch)
+{
+  using LaneBatch = fetch::storage::NewRevertibleDocumentStore::WriteBatch;
+
+  // split the updates by lane, preserving their order
+  std::vector<LaneBatch> lane_batches(num_lanes());
+  for (auto const &entry : batch)
+  {
+    ResourceID const &resource = entry.first.as_resource_id();
+    lane_batches.at(resource.lane(log2_num_lanes_)).emplace_back(resource, entry.second);
+  }
+
+  try
+  {
+    std::vector<Promise> promises;
+    promises.reserve(lane_batches.size());
+
+    for (ShardIndex lane = 0; lane < lane_batches.size(); ++lane)
+    {
+      if (lane_batches[lane].empty())
+      {
+        continue;
+      }
+
+      promises.emplace_back(rpc_client_->CallSpecificAddress(
+          LookupAddress(lane), RPC_STATE, RevertibleDocumentStoreProtocol::SET_BATCH,
+          lane_batches[lane]));
+    }
+
+    // wait for all the lanes to apply their updates
+    for (auto &promise : promises)
+    {
+      promise->Wait();
+    }
+  }
+  catch (std::exception const &e)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Failed to call SET_BATCH (store documents), because: ", e.what());
+  }
+}
+
 bool StorageUnitClient::Lock(ShardIndex index)
 {
   bool success{false};
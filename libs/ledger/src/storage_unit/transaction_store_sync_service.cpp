@@ -25,14 +25,13 @@
 #include "telemetry/gauge.hpp"
 #include "telemetry/registry.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <memory>
 
 using namespace std::chrono_literals;
 
-static constexpr std::size_t MAX_REQUESTS_PER_NODE = 2;
-
 static char const *FETCH_MAYBE_UNUSED ToString(fetch::ledger::tx_sync::State state)
 {
   using State = fetch::ledger::tx_sync::State;
@@ -92,6 +91,24 @@ TransactionStoreSyncService::TransactionStoreSyncService(Config const &cfg, Mudd
   , subtree_failure_total_{telemetry::Registry::Instance().CreateCounter(
         "ledger_tx_store_sync_service_subtree_failure_total",
         "The total number of subtree request failures observed")}
+  , subtree_transactions_total_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_tx_store_sync_service_subtree_transactions_total",
+        "The total number of transactions received from subtree requests")}
+  , subtree_roots_total_{telemetry::Registry::Instance().CreateGauge<uint64_t>(
+        "ledger_tx_store_sync_service_subtree_roots",
+        "The number of subtree roots the current sync has been split into")}
+  , subtree_roots_completed_total_{telemetry::Registry::Instance().CreateGauge<uint64_t>(
+        "ledger_tx_store_sync_service_subtree_roots_completed",
+        "The number of subtree roots of the current sync which have been received")}
+  , subtree_requests_in_flight_{telemetry::Registry::Instance().CreateGauge<uint64_t>(
+        "ledger_tx_store_sync_service_subtree_requests_in_flight",
+        "The number of subtree requests currently in flight")}
+  , subtree_request_window_{telemetry::Registry::Instance().CreateGauge<uint64_t>(
+        "ledger_tx_store_sync_service_subtree_request_window",
+        "The number of subtree requests that may be in flight across all peers")}
+  , subtree_sync_rate_{telemetry::Registry::Instance().CreateGauge<uint64_t>(
+        "ledger_tx_store_sync_service_subtree_sync_rate",
+        "The number of transactions per second being received from subtree requests")}
   , current_tss_state_{telemetry::Registry::Instance().CreateGauge<uint64_t>(
         "current_tss_state", "The state in the state machine of the tx store")}
   , current_tss_peers_{telemetry::Registry::Instance().CreateGauge<uint64_t>(
@@ -208,6 +225,10 @@ TransactionStoreSyncService::State TransactionStoreSyncService::OnResolvingObjec
     {
       roots_to_sync_.emplace(i);
     }
+
+    subtree_roots_completed_ = 0;
+    subtree_roots_total_->set(end);
+    UpdateSubtreeProgress();
   }
 
   if (roots_to_sync_.empty())
@@ -228,51 +249,77 @@ TransactionStoreSyncService::State TransactionStoreSyncService::OnQuerySubtree()
 
   auto const directly_connected_peers = muddle_.GetDirectlyConnectedPeers();
 
-  std::size_t const maximum_inflight = MAX_REQUESTS_PER_NODE * directly_connected_peers.size();
-  std::size_t const total_inflight   = pending_subtree_.GetNumPending();
-  std::size_t const roots_to_query = maximum_inflight - std::min(total_inflight, maximum_inflight);
-
-  // sanity check that this is not the case
-  std::size_t requests_made{0};
-  for (auto const &connection : directly_connected_peers)
+  // forget the flow control of peers which have gone away once their requests have resolved
+  for (auto it = subtree_peers_.begin(); it != subtree_peers_.end();)
   {
-    // if there are no further roots to sync then we need to exit
-    if (roots_to_sync_.empty())
+    bool const is_connected =
+        std::find(directly_connected_peers.begin(), directly_connected_peers.end(), it->first) !=
+        directly_connected_peers.end();
+
+    if (!is_connected && it->second.in_flight == 0)
     {
-      break;
+      it = subtree_peers_.erase(it);
     }
-
-    // if we have reached the maximum inflight requests
-    if (requests_made >= roots_to_query)
+    else
     {
-      break;
+      ++it;
     }
+  }
 
-    // extract the next root to sync
-    auto root = roots_to_sync_.front();
-    roots_to_sync_.pop();
+  // hand out the roots to the peers in turn, each peer taking as many as its window allows so that
+  // the faster peers end up serving the bulk of the sync
+  bool made_request{true};
+  while (made_request && !roots_to_sync_.empty())
+  {
+    made_request = false;
 
-    byte_array::ByteArray transactions_prefix;
-    transactions_prefix.Resize(std::size_t{ResourceID::RESOURCE_ID_SIZE_IN_BYTES});
-    *reinterpret_cast<decltype(root) *>(transactions_prefix.char_pointer()) = root;
+    for (auto const &connection : directly_connected_peers)
+    {
+      // if there are no further roots to sync then we need to exit
+      if (roots_to_sync_.empty())
+      {
+        break;
+      }
 
-    auto promise = PromiseOfTxList(client_->CallSpecificAddress(
-        connection, RPC_TX_STORE_SYNC, TransactionStoreSyncProtocol::PULL_SUBTREE,
-        transactions_prefix, root_size_));
+      // if we have reached the maximum inflight requests for this peer
+      auto &peer = subtree_peers_[connection];
+      if (peer.in_flight >= peer.window.window())
+      {
+        continue;
+      }
+
+      // extract the next root to sync
+      auto root = roots_to_sync_.front();
+      roots_to_sync_.pop();
+
+      byte_array::ByteArray transactions_prefix;
+      transactions_prefix.Resize(std::size_t{ResourceID::RESOURCE_ID_SIZE_IN_BYTES});
+      *reinterpret_cast<decltype(root) *>(transactions_prefix.char_pointer()) = root;
 
-    promise_id_to_roots_[promise.id()] = root;
-    pending_subtree_.Add(root, promise);
+      auto promise = PromiseOfTxList(client_->CallSpecificAddress(
+          connection, RPC_TX_STORE_SYNC, TransactionStoreSyncProtocol::PULL_SUBTREE,
+          transactions_prefix, root_size_));
 
-    subtree_requests_total_->increment();
-    ++requests_made;
+      subtree_requests_[root] = connection;
+      pending_subtree_.Add(root, promise);
+      ++peer.in_flight;
+
+      subtree_requests_total_->increment();
+      made_request = true;
+    }
   }
 
   promise_wait_timeout_.Set(cfg_.promise_wait_timeout);
 
-  FETCH_LOG_INFO(LOGGING_NAME, "Lane ", cfg_.lane_id, ": ", "QueryingSubtree: requested ",
-                 orig_num_of_roots - roots_to_sync_.size(),
-                 " root(s). Remaining roots to sync: ", roots_to_sync_.size(), " / ",
-                 uint64_t{1ull << root_size_});
+  if (orig_num_of_roots != roots_to_sync_.size())
+  {
+    FETCH_LOG_INFO(LOGGING_NAME, "Lane ", cfg_.lane_id, ": ", "QueryingSubtree: requested ",
+                   orig_num_of_roots - roots_to_sync_.size(),
+                   " root(s). Remaining roots to sync: ", roots_to_sync_.size(), " / ",
+                   uint64_t{1ull << root_size_});
+  }
+
+  UpdateSubtreeProgress();
 
   return State::RESOLVING_SUBTREE;
 }
@@ -280,7 +327,28 @@ TransactionStoreSyncService::State TransactionStoreSyncService::OnQuerySubtree()
 TransactionStoreSyncService::State TransactionStoreSyncService::OnResolvingSubtree()
 {
   current_tss_state_->set(static_cast<uint64_t>(state_machine_->state()));
-  auto counts = pending_subtree_.Resolve();
+  auto       counts = pending_subtree_.Resolve();
+  auto const now    = AdaptiveSyncWindow::Clock::now();
+
+  // returns the request of a root to the flow control of the peer it was made to
+  auto const complete_request = [this](uint64_t root) -> SubtreePeer * {
+    SubtreePeer *peer{nullptr};
+
+    auto const request = subtree_requests_.find(root);
+    if (request != subtree_requests_.end())
+    {
+      auto const it = subtree_peers_.find(request->second);
+      if (it != subtree_peers_.end())
+      {
+        peer = &it->second;
+        --peer->in_flight;
+      }
+
+      subtree_requests_.erase(request);
+    }
+
+    return peer;
+  };
 
   // resolve the sub-trees promises
   std::size_t synced_tx{0};
@@ -289,6 +357,15 @@ TransactionStoreSyncService::State TransactionStoreSyncService::OnResolvingSubtr
     FETCH_LOG_INFO(LOGGING_NAME, "Lane ", cfg_.lane_id, ": ", "Got ", result.promised.size(),
                    " subtree objects!");
 
+    auto *peer = complete_request(result.key);
+    if (peer != nullptr)
+    {
+      peer->window.OnSuccess(result.promised.size(), now);
+    }
+
+    ++subtree_roots_completed_;
+    subtree_transactions_total_->add(result.promised.size());
+
     for (auto &tx : result.promised)
     {
       // this transaction is not recent
@@ -315,15 +392,24 @@ TransactionStoreSyncService::State TransactionStoreSyncService::OnResolvingSubtr
 
     for (auto &fail : pending_subtree_.GetFailures(MAX_SUBTREE_RESOLUTION_PER_CYCLE))
     {
-      roots_to_sync_.push(promise_id_to_roots_[fail.promise.id()]);
+      auto *peer = complete_request(fail.key);
+      if (peer != nullptr)
+      {
+        peer->window.OnFailure(now);
+      }
+
+      roots_to_sync_.push(fail.key);
     }
 
     subtree_failure_total_->add(static_cast<uint64_t>(counts.failed));
   }
 
-  // evaluate if the syncing process if complete, this can only be the case when there are no in
-  // flight requests and we have successfully evaluated all the roots we are after
-  bool const is_subtree_sync_complete = roots_to_sync_.empty() && counts.pending == 0;
+  UpdateSubtreeProgress();
+
+  // evaluate if the syncing process if complete, this can only be the case when there are no
+  // outstanding requests (in flight or waiting to be processed) and we have successfully evaluated
+  // all the roots we are after
+  bool const is_subtree_sync_complete = roots_to_sync_.empty() && subtree_requests_.empty();
   if (!is_subtree_sync_complete)
   {
     state_machine_->Delay(10ms);
@@ -333,7 +419,8 @@ TransactionStoreSyncService::State TransactionStoreSyncService::OnResolvingSubtr
   FETCH_LOG_INFO(LOGGING_NAME, "Completed sub-tree syncing");
 
   // cleanup
-  promise_id_to_roots_.clear();
+  subtree_peers_.clear();
+  UpdateSubtreeProgress();
 
   // if we get this far then we have completed the subtree sync process
   return State::QUERY_OBJECTS;
@@ -467,6 +554,22 @@ TransactionStoreSyncService::State TransactionStoreSyncService::OnTrimCache()
   return State::QUERY_OBJECTS;
 }
 
+void TransactionStoreSyncService::UpdateSubtreeProgress()
+{
+  uint64_t window{0};
+  double   rate{0.0};
+  for (auto const &peer : subtree_peers_)
+  {
+    window += peer.second.window.window();
+    rate += peer.second.window.rate();
+  }
+
+  subtree_roots_completed_total_->set(subtree_roots_completed_);
+  subtree_requests_in_flight_->set(subtree_requests_.size());
+  subtree_request_window_->set(window);
+  subtree_sync_rate_->set(static_cast<uint64_t>(rate));
+}
+
 void TransactionStoreSyncService::OnTransaction(TransactionPtr const &tx)
 {
   ResourceID const rid(tx->digest());
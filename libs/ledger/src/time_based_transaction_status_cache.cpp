@@ -26,8 +26,26 @@ namespace {
 
 constexpr std::chrono::hours   LIFETIME{24};
 constexpr std::chrono::minutes INTERVAL{5};
+constexpr uint64_t             LIFETIME_EPOCHS = LIFETIME / INTERVAL;
 
-using TxStatus = TimeBasedTransactionStatusCache::TxStatus;
+using TxStatus   = TimeBasedTransactionStatusCache::TxStatus;
+using TxStatuses = TimeBasedTransactionStatusCache::TxStatuses;
+
+constexpr std::size_t SHARD_MASK = TimeBasedTransactionStatusCache::NUM_SHARDS - 1u;
+
+static_assert((TimeBasedTransactionStatusCache::NUM_SHARDS & SHARD_MASK) == 0,
+              "Number of shards must be a power of two");
+
+// The leading bytes of the digest are used by the hash map, the trailing one selects the shard
+std::size_t ShardIndex(Digest const &digest)
+{
+  if (digest.empty())
+  {
+    return 0;
+  }
+
+  return static_cast<std::size_t>(digest[digest.size() - 1u]) & SHARD_MASK;
+}
 
 }  // namespace
 
@@ -39,10 +57,12 @@ using TxStatus = TimeBasedTransactionStatusCache::TxStatus;
  */
 TxStatus TimeBasedTransactionStatusCache::Query(Digest digest) const
 {
-  FETCH_LOCK(mtx_);
+  auto const &shard = LookupShard(digest);
 
-  auto const it = cache_.find(digest);
-  if (cache_.end() != it)
+  FETCH_LOCK(shard.lock);
+
+  auto const it = shard.cache.find(digest);
+  if (shard.cache.end() != it)
   {
     return it->second.status;
   }
@@ -58,10 +78,6 @@ TxStatus TimeBasedTransactionStatusCache::Query(Digest digest) const
  */
 void TimeBasedTransactionStatusCache::Update(Digest digest, TransactionStatus status)
 {
-  auto const now{clock_->Now()};
-
-  FETCH_LOCK(mtx_);
-
   if (TransactionStatus::EXECUTED == status)
   {
     FETCH_LOG_WARN("TransactionStatusCache",
@@ -74,18 +90,16 @@ void TimeBasedTransactionStatusCache::Update(Digest digest, TransactionStatus st
         "contract execution result");
   }
 
-  auto it = cache_.find(digest);
+  auto const epoch = CurrentEpoch();
 
-  if (it == cache_.end())
-  {
-    cache_.emplace(digest, CacheEntry{TxStatus{status}, now});
-  }
-  else
   {
-    it->second.status.status = status;
+    auto &shard = LookupShard(digest);
+
+    FETCH_LOCK(shard.lock);
+    LookupOrCreate(shard, digest, epoch).status.status = status;
   }
 
-  PruneCacheIfNecessary(now);
+  PruneCacheIfNecessary(epoch);
 }
 
 /**
@@ -96,63 +110,173 @@ void TimeBasedTransactionStatusCache::Update(Digest digest, TransactionStatus st
  */
 void TimeBasedTransactionStatusCache::Update(Digest digest, ContractExecutionResult exec_result)
 {
-  static constexpr TransactionStatus EXECUTED_STATUS{TransactionStatus::EXECUTED};
-
-  auto const now{clock_->Now()};
+  auto const epoch = CurrentEpoch();
 
-  FETCH_LOCK(mtx_);
-
-  // update the cache
-  auto it = cache_.find(digest);
-  if (it == cache_.end())
   {
-    FETCH_LOG_DEBUG("TransactionStatusCache",
-                    "Updating contract execution status for transaction "
-                    "which is missing in the tx status cache. (tx digest: 0x",
-                    digest.ToHex(), ")");
+    auto &shard = LookupShard(digest);
+
+    FETCH_LOCK(shard.lock);
 
-    cache_.emplace(digest, CacheEntry{TxStatus{EXECUTED_STATUS, exec_result}, now});
+    auto &entry                       = LookupOrCreate(shard, digest, epoch);
+    entry.status.status               = TransactionStatus::EXECUTED;
+    entry.status.contract_exec_result = exec_result;
   }
-  else
+
+  PruneCacheIfNecessary(epoch);
+}
+
+/**
+ * Query the status of a number of transactions at once
+ *
+ * @param digests The digests of the transactions
+ * @return The status objects, in the same order as the digests
+ */
+TxStatuses TimeBasedTransactionStatusCache::QueryBatch(Digests const &digests) const
+{
+  TxStatuses statuses(digests.size());
+
+  // visit each shard once, taking its lock a single time for all of its digests
+  for (std::size_t shard_index = 0; shard_index < NUM_SHARDS; ++shard_index)
   {
-    it->second.status.status               = EXECUTED_STATUS;
-    it->second.status.contract_exec_result = exec_result;
+    auto const &shard = shards_[shard_index];
+
+    FETCH_LOCK(shard.lock);
+    for (std::size_t i = 0; i < digests.size(); ++i)
+    {
+      if (ShardIndex(digests[i]) != shard_index)
+      {
+        continue;
+      }
+
+      auto const it = shard.cache.find(digests[i]);
+      if (shard.cache.end() != it)
+      {
+        statuses[i] = it->second.status;
+      }
+    }
   }
 
-  PruneCacheIfNecessary(now);
+  return statuses;
 }
 
-void TimeBasedTransactionStatusCache::PruneCache(Timestamp const &until)
+/**
+ * Update the contract execution results for a number of transactions at once
+ *
+ * @param results The transaction digests and their contract execution results
+ */
+void TimeBasedTransactionStatusCache::UpdateBatch(ExecutionResults const &results)
 {
-  fetch::generics::MilliTimer timer{"TxStatusCache::Prune"};
+  auto const epoch = CurrentEpoch();
 
-  auto it = cache_.begin();
-  while (it != cache_.end())
+  for (std::size_t shard_index = 0; shard_index < NUM_SHARDS; ++shard_index)
   {
-    auto const age = until - it->second.timestamp;
+    auto &shard = shards_[shard_index];
 
-    if (age > LIFETIME)
+    FETCH_LOCK(shard.lock);
+    for (auto const &result : results)
     {
-      it = cache_.erase(it);
+      if (ShardIndex(result.first) != shard_index)
+      {
+        continue;
+      }
+
+      auto &entry                       = LookupOrCreate(shard, result.first, epoch);
+      entry.status.status               = TransactionStatus::EXECUTED;
+      entry.status.contract_exec_result = result.second;
     }
-    else
+  }
+
+  PruneCacheIfNecessary(epoch);
+}
+
+TimeBasedTransactionStatusCache::Epoch TimeBasedTransactionStatusCache::CurrentEpoch() const
+{
+  auto const elapsed = clock_->Now() - origin_;
+  if (elapsed.count() < 0)
+  {
+    return 0;
+  }
+
+  return static_cast<Epoch>(elapsed / INTERVAL);
+}
+
+TimeBasedTransactionStatusCache::Shard &TimeBasedTransactionStatusCache::LookupShard(
+    Digest const &digest)
+{
+  return shards_[ShardIndex(digest)];
+}
+
+TimeBasedTransactionStatusCache::Shard const &TimeBasedTransactionStatusCache::LookupShard(
+    Digest const &digest) const
+{
+  return shards_[ShardIndex(digest)];
+}
+
+/**
+ * Lookup the entry for a transaction, creating it in the current epoch if it is missing. The
+ * shard lock must be held by the caller.
+ */
+TimeBasedTransactionStatusCache::CacheEntry &TimeBasedTransactionStatusCache::LookupOrCreate(
+    Shard &shard, Digest const &digest, Epoch epoch)
+{
+  auto it = shard.cache.find(digest);
+  if (it != shard.cache.end())
+  {
+    return it->second;
+  }
+
+  if (shard.epochs.empty() || (shard.epochs.back().epoch != epoch))
+  {
+    shard.epochs.emplace_back(EpochDigests{epoch, {}});
+  }
+  shard.epochs.back().digests.push_back(digest);
+
+  return shard.cache.emplace(digest, CacheEntry{TxStatus{}, epoch}).first->second;
+}
+
+/**
+ * Remove the entries of all epochs which have passed their lifetime. The shard lock must be held
+ * by the caller.
+ */
+void TimeBasedTransactionStatusCache::PruneShard(Shard &shard, Epoch until)
+{
+  while (!shard.epochs.empty() && ((shard.epochs.front().epoch + LIFETIME_EPOCHS) < until))
+  {
+    for (auto const &digest : shard.epochs.front().digests)
     {
-      ++it;
+      shard.cache.erase(digest);
     }
+
+    shard.epochs.pop_front();
   }
+}
 
-  last_clean_ = until;
+void TimeBasedTransactionStatusCache::PruneCache(Epoch current)
+{
+  fetch::generics::MilliTimer timer{"TxStatusCache::Prune"};
+
+  for (auto &shard : shards_)
+  {
+    FETCH_LOCK(shard.lock);
+    PruneShard(shard, current);
+  }
 }
 
-void TimeBasedTransactionStatusCache::PruneCacheIfNecessary(Timestamp const &until)
+void TimeBasedTransactionStatusCache::PruneCacheIfNecessary(Epoch current)
 {
-  auto const delta_prune = until - last_clean_;
-  if (delta_prune < INTERVAL)
+  // only one caller prunes the cache for each new epoch
+  auto last_clean = last_clean_.load();
+  if (current <= last_clean)
+  {
+    return;
+  }
+
+  if (!last_clean_.compare_exchange_strong(last_clean, current))
   {
     return;
   }
 
-  PruneCache(until);
+  PruneCache(current);
 }
 
 }  // namespace ledger
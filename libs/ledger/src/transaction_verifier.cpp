@@ -31,6 +31,7 @@
 #include <algorithm>
 #include <chrono>
 #include <string>
+#include <thread>
 
 namespace fetch {
 namespace ledger {
@@ -80,12 +81,15 @@ telemetry::CounterPtr CreateCounter(std::string const &prefix, std::string const
  * Construct a transaction verifier queue
  *
  * @param sink The destination for verified transactions
- * @param verifying_threads The number of verifying threads to be used
+ * @param verifying_threads The number of verifying threads to be used, zero for one per hardware
+ * thread
  * @param name The name of the verifier
  */
 TransactionVerifier::TransactionVerifier(TransactionSink &sink, std::size_t verifying_threads,
                                          std::string const &name)
-  : verifying_threads_(verifying_threads)
+  : verifying_threads_((verifying_threads != 0u)
+                           ? verifying_threads
+                           : std::max<std::size_t>(std::thread::hardware_concurrency(), 1))
   , name_(name)
   , sink_(sink)
   , unverified_queue_length_(
@@ -19,11 +19,14 @@
 #include "core/byte_array/decoders.hpp"
 #include "core/macros.hpp"
 #include "http/json_response.hpp"
+#include "json/document.hpp"
 #include "ledger/transaction_status_cache.hpp"
 #include "ledger/tx_status_http_interface.hpp"
 #include "logging/logging.hpp"
 #include "variant/variant.hpp"
 
+#include <cctype>
+#include <cstddef>
 #include <utility>
 
 namespace fetch {
@@ -33,9 +36,16 @@ namespace {
 
 constexpr char const *LOGGING_NAME = "TxStatusHttp";
 
+// upper bound on the number of transactions in a single bulk status query
+constexpr std::size_t MAX_BULK_QUERY_SIZE = 1000;
+constexpr std::size_t DIGEST_HEX_LENGTH   = 64;
+
+using fetch::byte_array::ConstByteArray;
 using fetch::byte_array::FromHex;
 using fetch::variant::Variant;
 
+using Digests = TransactionStatusInterface::Digests;
+
 constexpr PublicTxStatus Convert(TransactionStatus       tx_processing_pipeline_status,
                                  ContractExecutionStatus contract_exec_status)
 {
@@ -109,6 +119,74 @@ Variant ToVariant(Digest const &digest, TransactionStatusInterface::TxStatus con
 
   return retval;
 }
+
+bool IsHexDigest(ConstByteArray const &value)
+{
+  if (value.size() != DIGEST_HEX_LENGTH)
+  {
+    return false;
+  }
+
+  for (std::size_t i = 0; i < value.size(); ++i)
+  {
+    if (std::isxdigit(value[i]) == 0)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Extract the digests from the body of a bulk status query, which is expected to be of the form:
+ *
+ *   {"txs": ["<hex digest>", ...]}
+ *
+ * @param body The body of the request
+ * @param digests The output list of digests
+ * @return true if the request was well formed, otherwise false
+ */
+bool ParseDigests(ConstByteArray const &body, Digests &digests)
+{
+  json::JSONDocument doc{};
+
+  try
+  {
+    doc.Parse(body);
+  }
+  catch (std::exception const &ex)
+  {
+    FETCH_LOG_DEBUG(LOGGING_NAME, "Unable to parse bulk status query: ", ex.what());
+    return false;
+  }
+
+  auto const &root = doc.root();
+  if (!root.IsObject() || !root.Has("txs") || !root["txs"].IsArray())
+  {
+    return false;
+  }
+
+  auto const &txs = root["txs"];
+  if (txs.size() > MAX_BULK_QUERY_SIZE)
+  {
+    return false;
+  }
+
+  digests.reserve(txs.size());
+  for (std::size_t i = 0; i < txs.size(); ++i)
+  {
+    if (!txs[i].IsString() || !IsHexDigest(txs[i].As<ConstByteArray>()))
+    {
+      return false;
+    }
+
+    digests.emplace_back(FromHex(txs[i].As<ConstByteArray>()));
+  }
+
+  return true;
+}
+
 }  // namespace
 
 TxStatusHttpInterface::TxStatusHttpInterface(TxStatusCachePtr status_cache)
@@ -136,6 +214,29 @@ TxStatusHttpInterface::TxStatusHttpInterface(TxStatusCachePtr status_cache)
 
         return http::CreateJsonResponse("{}", http::Status::CLIENT_ERROR_BAD_REQUEST);
       });
+
+  Post("/api/status/txs", "Retrieves the status of a number of transactions.",
+       [this](http::ViewParameters const &params, http::HTTPRequest const &request) {
+         FETCH_UNUSED(params);
+
+         Digests digests{};
+         if (!ParseDigests(request.body(), digests))
+         {
+           return http::CreateJsonResponse("{}", http::Status::CLIENT_ERROR_BAD_REQUEST);
+         }
+
+         // all of the statuses are looked up together to limit contention on the cache
+         auto const statuses = status_cache_->QueryBatch(digests);
+
+         auto response{Variant::Object()};
+         response["txs"] = Variant::Array(digests.size());
+         for (std::size_t i = 0; i < digests.size(); ++i)
+         {
+           response["txs"][i] = ToVariant(digests[i], statuses[i]);
+         }
+
+         return http::CreateJsonResponse(response);
+       });
 }
 
 }  // namespace ledger
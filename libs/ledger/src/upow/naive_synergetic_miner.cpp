@@ -197,6 +197,9 @@ WorkPtr NaiveSynergeticMiner::MineSolution(chain::Address const &contract_addres
     return {};
   }
 
+  // the work is verified as part of the block following the current epoch
+  contract->SetBlockIndex(dag_->CurrentEpoch() + 1);
+
   // build up a work instance
   auto work = std::make_shared<Work>(contract_address, prover_->identity());
 
@@ -16,6 +16,7 @@
 //
 //------------------------------------------------------------------------------
 
+#include "chain/constants.hpp"
 #include "crypto/hash.hpp"
 #include "crypto/sha256.hpp"
 #include "json/document.hpp"
@@ -230,6 +231,8 @@ Status SynergeticContract::DefineProblem(ProblemData const &problem_data)
     vm->SetChargeLimit(charge_limit_);
   }
 
+  vm->SetLegacyUInt256Arithmetic(block_index_ < chain::CORRECTED_UINT256_ARITHMETIC_BLOCK);
+
   // create the problem data
   auto problems = CreateProblemData(vm.get(), problem_data);
 
@@ -268,6 +271,8 @@ Status SynergeticContract::Work(vectorise::UInt<256> const &nonce, WorkScore &sc
     vm->SetChargeLimit(charge_limit_);
   }
 
+  vm->SetLegacyUInt256Arithmetic(block_index_ < chain::CORRECTED_UINT256_ARITHMETIC_BLOCK);
+
   // create the nonce object to be passed into the work function
   auto hashed_nonce = vm->CreateNewObject<UInt256Wrapper>(nonce);
 
@@ -321,6 +326,8 @@ Status SynergeticContract::Complete(chain::Address const &address, BitVector con
     vm->SetChargeLimit(charge_limit_);
   }
 
+  vm->SetLegacyUInt256Arithmetic(block_index_ < chain::CORRECTED_UINT256_ARITHMETIC_BLOCK);
+
   // setup the storage infrastructure
   CachedStorageAdapter storage_cache(*storage_);
   StateSentinelAdapter state_sentinel{storage_cache, address.display(), shards};
@@ -364,6 +371,11 @@ void SynergeticContract::SetChargeLimit(uint64_t charge_limit)
   charge_limit_ = charge_limit;
 }
 
+void SynergeticContract::SetBlockIndex(uint64_t block_index)
+{
+  block_index_ = block_index;
+}
+
 bool SynergeticContract::HasProblem() const
 {
   return static_cast<bool>(problem_);
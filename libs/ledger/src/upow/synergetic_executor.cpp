@@ -86,6 +86,8 @@ void SynergeticExecutor::Verify(WorkQueue &solutions, ProblemData const &problem
         return;
       }
 
+      contract->SetBlockIndex(solution->block_index());
+
       // define the problem
       auto const status = contract->DefineProblem(problem_data);
       if (SynergeticContract::Status::SUCCESS != status)
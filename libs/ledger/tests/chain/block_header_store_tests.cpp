@@ -0,0 +1,164 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "chain/constants.hpp"
+#include "crypto/sha256.hpp"
+#include "ledger/chain/block_header_store.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using fetch::ledger::BlockHash;
+using fetch::ledger::BlockHeader;
+using fetch::ledger::BlockHeaderStore;
+
+constexpr char const *HEADER_FILE = "block_header_store_tests.db";
+
+BlockHash CreateHash(uint64_t i)
+{
+  fetch::crypto::SHA256 hasher;
+  hasher.Update(reinterpret_cast<uint8_t *>(&i), sizeof(uint64_t));
+  return hasher.Final();
+}
+
+// Headers of a chain of blocks, the first one being genesis
+std::vector<BlockHeader> CreateChain(uint64_t length)
+{
+  std::vector<BlockHeader> headers(length);
+  for (uint64_t i = 0; i < length; ++i)
+  {
+    auto &header          = headers[i];
+    header.hash           = CreateHash(i + 1);
+    header.previous_hash  = (i == 0) ? fetch::chain::ZERO_HASH : headers[i - 1].hash;
+    header.merkle_hash    = CreateHash(i + 1000000);
+    header.skip_hash      = (i < 2) ? BlockHash{} : headers[i / 2].hash;
+    header.block_number   = i;
+    header.weight         = 1 + (i % 7);
+    header.total_weight   = (i == 0) ? header.weight : headers[i - 1].total_weight + header.weight;
+    header.timestamp      = 1500000000 + i;
+    header.log2_num_lanes = 2;
+  }
+
+  return headers;
+}
+
+void ExpectEqual(BlockHeader const &expected, BlockHeader const &actual)
+{
+  EXPECT_EQ(expected.hash, actual.hash);
+  EXPECT_EQ(expected.previous_hash, actual.previous_hash);
+  EXPECT_EQ(expected.merkle_hash, actual.merkle_hash);
+  EXPECT_EQ(expected.skip_hash, actual.skip_hash);
+  EXPECT_EQ(expected.next_hash, actual.next_hash);
+  EXPECT_EQ(expected.block_number, actual.block_number);
+  EXPECT_EQ(expected.weight, actual.weight);
+  EXPECT_EQ(expected.total_weight, actual.total_weight);
+  EXPECT_EQ(expected.timestamp, actual.timestamp);
+  EXPECT_EQ(expected.log2_num_lanes, actual.log2_num_lanes);
+  EXPECT_EQ(expected.IsGenesis(), actual.IsGenesis());
+}
+
+TEST(BlockHeaderStoreTests, HeadersAreStoredAndUpdated)
+{
+  BlockHeaderStore store;
+  store.New(HEADER_FILE);
+
+  auto headers = CreateChain(50);
+  for (auto const &header : headers)
+  {
+    ASSERT_TRUE(store.Set(header));
+  }
+  EXPECT_EQ(store.size(), headers.size());
+
+  // forward references are set in place
+  for (std::size_t i = 0; i + 1 < headers.size(); ++i)
+  {
+    headers[i].next_hash = headers[i + 1].hash;
+    ASSERT_TRUE(store.SetNextHash(headers[i].hash, headers[i].next_hash));
+  }
+
+  // storing a header again replaces it
+  headers[10].timestamp = 42;
+  ASSERT_TRUE(store.Set(headers[10]));
+  EXPECT_EQ(store.size(), headers.size());
+
+  for (auto const &expected : headers)
+  {
+    BlockHeader actual;
+    ASSERT_TRUE(store.Get(expected.hash, actual));
+    ExpectEqual(expected, actual);
+  }
+
+  ASSERT_TRUE(store.SetNextHash(headers[20].hash, BlockHash{}));
+  BlockHeader cleared;
+  ASSERT_TRUE(store.Get(headers[20].hash, cleared));
+  EXPECT_TRUE(cleared.next_hash.empty());
+
+  EXPECT_FALSE(store.Has(CreateHash(12345)));
+  EXPECT_FALSE(store.SetNextHash(CreateHash(12345), headers[0].hash));
+}
+
+TEST(BlockHeaderStoreTests, HeadersAreFoundAfterReload)
+{
+  auto const headers = CreateChain(3000);
+
+  {
+    BlockHeaderStore store;
+    store.New(HEADER_FILE);
+    for (auto const &header : headers)
+    {
+      ASSERT_TRUE(store.Set(header));
+    }
+    store.Flush();
+  }
+
+  BlockHeaderStore store;
+  store.Load(HEADER_FILE);
+  ASSERT_EQ(store.size(), headers.size());
+
+  for (auto const &expected : headers)
+  {
+    BlockHeader actual;
+    ASSERT_TRUE(store.Get(expected.hash, actual));
+    ExpectEqual(expected, actual);
+  }
+}
+
+TEST(BlockHeaderStoreTests, MalformedHeadersAreRejected)
+{
+  BlockHeaderStore store;
+  store.New(HEADER_FILE);
+
+  auto header = CreateChain(2).back();
+
+  auto missing_hash = header;
+  missing_hash.hash = BlockHash{};
+  EXPECT_FALSE(store.Set(missing_hash));
+
+  auto short_skip      = header;
+  short_skip.skip_hash = fetch::byte_array::ConstByteArray{"short"};
+  EXPECT_FALSE(store.Set(short_skip));
+
+  EXPECT_EQ(store.size(), 0);
+  EXPECT_FALSE(store.Has(header.hash));
+}
+
+}  // namespace
@@ -195,6 +195,31 @@ TEST_F(MainChainSubTreeTests, CheckCommonSubTree2)
   EXPECT_EQ(genesis->hash, blocks[1]->hash);
 }
 
+TEST_F(MainChainSubTreeTests, CheckZeroLimit)
+{
+  auto genesis = block_generator_();
+  auto b1      = block_generator_(genesis);
+  auto b2      = block_generator_(genesis);
+  auto b3      = block_generator_(b2);
+
+  for (auto const &block : {b1, b2, b3})
+  {
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*block));
+  }
+
+  // the tip is still returned when the most recent blocks are wanted
+  Blocks blocks;
+  EXPECT_TRUE(chain_->GetPathToCommonAncestor(blocks, b3->hash, b1->hash, 0,
+                                              MainChain::BehaviourWhenLimit::RETURN_MOST_RECENT));
+  ASSERT_EQ(1, blocks.size());
+  EXPECT_EQ(b3->hash, blocks[0]->hash);
+
+  // but nothing is when the least recent ones are
+  EXPECT_TRUE(chain_->GetPathToCommonAncestor(blocks, b3->hash, b1->hash, 0,
+                                              MainChain::BehaviourWhenLimit::RETURN_LEAST_RECENT));
+  EXPECT_TRUE(blocks.empty());
+}
+
 TEST_F(MainChainSubTreeTests, CheckLooseBlocks)
 {
   // Simple tree structure
@@ -25,16 +25,20 @@
 #include "core/containers/set_difference.hpp"
 #include "crypto/ecdsa.hpp"
 #include "ledger/chain/block.hpp"
+#include "ledger/chain/block_db_record.hpp"
 #include "ledger/chain/main_chain.hpp"
 #include "ledger/chain/time_travelogue.hpp"
 #include "ledger/testing/block_generator.hpp"
+#include "storage/object_store.hpp"
 
 #include "gtest/gtest.h"
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdio>
 #include <memory>
 #include <random>
+#include <set>
 #include <sstream>
 #include <vector>
 
@@ -43,9 +47,12 @@ namespace {
 using namespace fetch;
 
 using fetch::ledger::Block;
+using fetch::ledger::BlockDbRecord;
 using fetch::ledger::BlockStatus;
 using fetch::ledger::MainChain;
 using fetch::ledger::testing::BlockGenerator;
+using fetch::storage::ObjectStore;
+using fetch::storage::ResourceID;
 
 using Rng               = std::mt19937_64;
 using MainChainPtr      = std::unique_ptr<MainChain>;
@@ -995,6 +1002,230 @@ TEST_P(MainChainTests, AddingBlockWithDuplicateTxInSameBlockFails)
   ASSERT_EQ(chain_->GetHeaviestBlockHash(), genesis->hash);
 }
 
+TEST_P(MainChainTests, AncestorsAreFoundOnMainAndSideChains)
+{
+  static constexpr std::size_t MAIN_CHAIN_LENGTH = 100;
+  static constexpr std::size_t FORK_POINT        = 60;
+  static constexpr std::size_t SIDE_CHAIN_LENGTH = 10;
+
+  auto const genesis = generator_->Generate();
+
+  // the heaviest chain is long enough to have been partly flushed to storage
+  std::vector<BlockPtr> main_chain{genesis};
+  for (std::size_t i = 1; i <= MAIN_CHAIN_LENGTH; ++i)
+  {
+    main_chain.push_back(generator_->Generate(main_chain.back()));
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*main_chain.back()));
+  }
+
+  std::vector<BlockPtr> side_chain{main_chain.begin(), main_chain.begin() + FORK_POINT + 1};
+  for (std::size_t i = 1; i <= SIDE_CHAIN_LENGTH; ++i)
+  {
+    side_chain.push_back(generator_->Generate(side_chain.back()));
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*side_chain.back()));
+  }
+  ASSERT_EQ(main_chain.back()->hash, chain_->GetHeaviestBlockHash());
+
+  for (auto const *blocks : {&main_chain, &side_chain})
+  {
+    for (std::size_t start = 0; start < blocks->size(); start += 7)
+    {
+      for (std::size_t block_number = 0; block_number <= start; ++block_number)
+      {
+        auto const ancestor = chain_->GetAncestor((*blocks)[start]->hash, block_number);
+        ASSERT_TRUE(ancestor);
+        EXPECT_EQ((*blocks)[block_number]->hash, ancestor->hash);
+      }
+
+      EXPECT_FALSE(chain_->GetAncestor((*blocks)[start]->hash, start + 1));
+    }
+  }
+
+  // the least recent part of the path ends at the fork point
+  ledger::Blocks path;
+  ASSERT_TRUE(chain_->GetPathToCommonAncestor(path, main_chain.back()->hash,
+                                              side_chain.back()->hash, 5,
+                                              MainChain::BehaviourWhenLimit::RETURN_LEAST_RECENT));
+  ASSERT_EQ(5, path.size());
+  for (std::size_t i = 0; i < path.size(); ++i)
+  {
+    EXPECT_EQ(main_chain[FORK_POINT + 4 - i]->hash, path[i]->hash);
+  }
+
+  // and the most recent part starts at the tip
+  ASSERT_TRUE(chain_->GetPathToCommonAncestor(path, side_chain.back()->hash,
+                                              main_chain.back()->hash, 5,
+                                              MainChain::BehaviourWhenLimit::RETURN_MOST_RECENT));
+  ASSERT_EQ(5, path.size());
+  for (std::size_t i = 0; i < path.size(); ++i)
+  {
+    EXPECT_EQ(side_chain[side_chain.size() - 1 - i]->hash, path[i]->hash);
+  }
+
+  // without a limit the path includes the fork point
+  ASSERT_TRUE(chain_->GetPathToCommonAncestor(path, side_chain.back()->hash,
+                                              main_chain[FORK_POINT + 1]->hash));
+  ASSERT_EQ(SIDE_CHAIN_LENGTH + 1, path.size());
+  EXPECT_EQ(main_chain[FORK_POINT]->hash, path.back()->hash);
+}
+
+TEST_P(MainChainTests, AeonBeginningsAreFoundOnMainAndSideChains)
+{
+  static constexpr std::size_t MAIN_CHAIN_LENGTH = 100;
+  static constexpr std::size_t FORK_POINT        = 60;
+  static constexpr std::size_t SIDE_CHAIN_LENGTH = 10;
+
+  // a later aeon can begin part way through an earlier one
+  std::set<std::size_t> const main_beginnings{1, 41, 45, 81};
+  std::set<std::size_t> const side_beginnings{63};
+
+  auto const extend = [this](std::vector<BlockPtr> &blocks, bool aeon_beginning) {
+    auto block = generator_->Generate(blocks.back());
+    if (aeon_beginning)
+    {
+      block->block_entropy.confirmations[0] = "signature";
+      block->UpdateDigest();
+    }
+
+    blocks.push_back(block);
+    return chain_->AddBlock(*block);
+  };
+
+  std::vector<BlockPtr> main_chain{generator_->Generate()};
+  for (std::size_t i = 1; i <= MAIN_CHAIN_LENGTH; ++i)
+  {
+    ASSERT_EQ(BlockStatus::ADDED, extend(main_chain, main_beginnings.count(i) != 0));
+  }
+
+  std::vector<BlockPtr> side_chain{main_chain.begin(), main_chain.begin() + FORK_POINT + 1};
+  for (std::size_t i = FORK_POINT + 1; i <= FORK_POINT + SIDE_CHAIN_LENGTH; ++i)
+  {
+    ASSERT_EQ(BlockStatus::ADDED, extend(side_chain, side_beginnings.count(i) != 0));
+  }
+  ASSERT_EQ(main_chain.back()->hash, chain_->GetHeaviestBlockHash());
+
+  auto const check = [this](std::vector<BlockPtr> const &blocks) {
+    std::size_t beginning{0};
+    for (auto const &block : blocks)
+    {
+      if (block->block_entropy.IsAeonBeginning())
+      {
+        beginning = block->block_number;
+      }
+
+      auto const found = chain_->GetAeonBeginning(block->hash);
+      ASSERT_TRUE(found);
+      EXPECT_EQ(blocks[beginning]->hash, found->hash);
+    }
+  };
+
+  check(main_chain);
+  check(side_chain);
+}
+
+TEST_P(MainChainTests, StoredChainIsTraversedAfterReload)
+{
+  static constexpr std::size_t CHAIN_LENGTH = 100;
+
+  if (GetParam() != MainChain::Mode::CREATE_PERSISTENT_DB)
+  {
+    return;
+  }
+
+  std::vector<BlockPtr> blocks{generator_->Generate()};
+  for (std::size_t i = 1; i <= CHAIN_LENGTH; ++i)
+  {
+    blocks.push_back(generator_->Generate(blocks.back()));
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*blocks.back()));
+  }
+
+  // only the stored part of the chain is recovered, with none of it in the cache
+  chain_.reset();
+  chain_ = std::make_unique<MainChain>(MainChain::Mode::LOAD_PERSISTENT_DB);
+  auto const head = chain_->GetHeaviestBlock();
+  ASSERT_TRUE(head);
+  ASSERT_GT(head->block_number, 0);
+  ASSERT_LT(head->block_number, CHAIN_LENGTH);
+  ASSERT_EQ(blocks[head->block_number]->hash, head->hash);
+
+  for (std::size_t block_number = 0; block_number <= head->block_number; ++block_number)
+  {
+    auto const ancestor = chain_->GetAncestor(head->hash, block_number);
+    ASSERT_TRUE(ancestor);
+    EXPECT_TRUE(IsSameBlock(*blocks[block_number], *ancestor));
+  }
+
+  // the stored blocks know where their aeon began
+  auto const aeon_beginning = chain_->GetAeonBeginning(head->hash);
+  ASSERT_TRUE(aeon_beginning);
+  EXPECT_EQ(blocks[0]->hash, aeon_beginning->hash);
+
+  // the forward references of the stored blocks are followed from their headers
+  auto const travelogue = chain_->TimeTravel(blocks[10]->hash);
+  ASSERT_EQ(head->block_number - 10, travelogue.blocks.size());
+  for (std::size_t i = 0; i < travelogue.blocks.size(); ++i)
+  {
+    EXPECT_TRUE(IsSameBlock(*blocks[11 + i], *travelogue.blocks[i]));
+  }
+}
+
+TEST_P(MainChainTests, StoredChainIsTraversedWithoutTheHeaderStore)
+{
+  static constexpr std::size_t CHAIN_LENGTH = 100;
+
+  if (GetParam() != MainChain::Mode::CREATE_PERSISTENT_DB)
+  {
+    return;
+  }
+
+  std::vector<BlockPtr> blocks{generator_->Generate()};
+  for (std::size_t i = 1; i <= CHAIN_LENGTH; ++i)
+  {
+    blocks.push_back(generator_->Generate(blocks.back()));
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*blocks.back()));
+  }
+
+  chain_.reset();
+
+  // the records of the stored blocks refer to their stored children as well as the headers do
+  std::size_t num_stored{0};
+  {
+    ObjectStore<BlockDbRecord> block_store;
+    block_store.Load("chain.db", "chain.index.db");
+
+    BlockDbRecord record;
+    while ((num_stored + 1 < blocks.size()) &&
+           block_store.Get(ResourceID(blocks[num_stored]->hash), record))
+    {
+      if (block_store.Has(ResourceID(blocks[num_stored + 1]->hash)))
+      {
+        EXPECT_EQ(blocks[num_stored + 1]->hash, record.next_hash);
+      }
+      ++num_stored;
+    }
+  }
+  ASSERT_GT(num_stored, 10);
+
+  // losing the header store leaves the headers to be recovered from the block records
+  std::remove("chain.headers.db");
+  chain_ = std::make_unique<MainChain>(MainChain::Mode::LOAD_PERSISTENT_DB);
+  auto const head = chain_->GetHeaviestBlock();
+  ASSERT_TRUE(head);
+  ASSERT_EQ(num_stored - 1, head->block_number);
+  ASSERT_EQ(blocks[head->block_number]->hash, head->hash);
+
+  auto const travelogue = chain_->TimeTravel(blocks[10]->hash);
+  ASSERT_EQ(head->block_number - 10, travelogue.blocks.size());
+  for (std::size_t i = 0; i < travelogue.blocks.size(); ++i)
+  {
+    EXPECT_TRUE(IsSameBlock(*blocks[11 + i], *travelogue.blocks[i]));
+  }
+
+  auto const aeon_beginning = chain_->GetAeonBeginning(head->hash);
+  ASSERT_TRUE(aeon_beginning);
+  EXPECT_EQ(blocks[0]->hash, aeon_beginning->hash);
+}
+
 INSTANTIATE_TEST_SUITE_P(ParamBased, MainChainTests,
                          ::testing::Values(MainChain::Mode::CREATE_PERSISTENT_DB,
                                            MainChain::Mode::IN_MEMORY_DB));
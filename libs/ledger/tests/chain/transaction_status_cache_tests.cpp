@@ -21,7 +21,9 @@
 
 #include "gtest/gtest.h"
 
+#include <cstddef>
 #include <memory>
+#include <utility>
 
 namespace {
 
@@ -31,6 +33,9 @@ using fetch::ledger::ContractExecutionStatus;
 using fetch::ledger::TimeBasedTransactionStatusCache;
 using fetch::ledger::TransactionStatus;
 
+using Digests          = TimeBasedTransactionStatusCache::Digests;
+using ExecutionResults = TimeBasedTransactionStatusCache::ExecutionResults;
+
 using AdjustableClockPtr = fetch::moment::AdjustableClockPtr;
 using Timestamp          = fetch::moment::ClockInterface::Timestamp;
 
@@ -118,4 +123,82 @@ TEST_F(TransactionStatusCacheTests, CheckPruning)
   EXPECT_EQ(TransactionStatus::SUBMITTED, cache_.Query(tx3).status);
 }
 
+TEST_F(TransactionStatusCacheTests, CheckBatchUpdateAndQuery)
+{
+  Digests          digests{};
+  ExecutionResults results{};
+
+  // enough transactions to be spread over all of the shards
+  for (std::size_t i = 0; i < 200; ++i)
+  {
+    digests.emplace_back(GenerateDigest());
+
+    ContractExecutionResult result{};
+    result.status       = ContractExecutionStatus::SUCCESS;
+    result.return_value = static_cast<int64_t>(i);
+
+    results.emplace_back(digests.back(), result);
+  }
+
+  // a transaction which is only pending and one which is unknown to the cache
+  auto const pending = GenerateDigest();
+  auto const unknown = GenerateDigest();
+  cache_.Update(pending, TransactionStatus::PENDING);
+
+  cache_.UpdateBatch(results);
+
+  digests.emplace_back(pending);
+  digests.emplace_back(unknown);
+
+  auto const statuses = cache_.QueryBatch(digests);
+  ASSERT_EQ(statuses.size(), digests.size());
+
+  for (std::size_t i = 0; i < results.size(); ++i)
+  {
+    EXPECT_EQ(TransactionStatus::EXECUTED, statuses[i].status);
+    EXPECT_EQ(ContractExecutionStatus::SUCCESS, statuses[i].contract_exec_result.status);
+    EXPECT_EQ(static_cast<int64_t>(i), statuses[i].contract_exec_result.return_value);
+    EXPECT_EQ(TransactionStatus::EXECUTED, cache_.Query(digests[i]).status);
+  }
+
+  EXPECT_EQ(TransactionStatus::PENDING, statuses[results.size()].status);
+  EXPECT_EQ(TransactionStatus::UNKNOWN, statuses[results.size() + 1].status);
+}
+
+TEST_F(TransactionStatusCacheTests, CheckPruningKeepsRecentTransactions)
+{
+  Digests old_txs{};
+  Digests recent_txs{};
+
+  for (std::size_t i = 0; i < 50; ++i)
+  {
+    old_txs.emplace_back(GenerateDigest());
+    cache_.Update(old_txs.back(), TransactionStatus::PENDING);
+  }
+
+  clock_->Advance(std::chrono::hours{12});
+
+  for (std::size_t i = 0; i < 50; ++i)
+  {
+    recent_txs.emplace_back(GenerateDigest());
+    cache_.Update(recent_txs.back(), TransactionStatus::MINED);
+  }
+
+  // updating an old transaction does not extend its lifetime
+  cache_.Update(old_txs.front(), TransactionStatus::MINED);
+
+  clock_->Advance(std::chrono::hours{13});
+  cache_.Update(GenerateDigest(), TransactionStatus::SUBMITTED);
+
+  for (auto const &tx : old_txs)
+  {
+    EXPECT_EQ(TransactionStatus::UNKNOWN, cache_.Query(tx).status);
+  }
+
+  for (auto const &tx : recent_txs)
+  {
+    EXPECT_EQ(TransactionStatus::MINED, cache_.Query(tx).status);
+  }
+}
+
 }  // namespace
@@ -0,0 +1,163 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "http/request.hpp"
+#include "http/response.hpp"
+#include "json/document.hpp"
+#include "ledger/tx_status_http_interface.hpp"
+#include "time_based_transaction_status_cache.hpp"
+#include "transaction_status_cache_test.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using fetch::byte_array::ConstByteArray;
+using fetch::http::HTTPRequest;
+using fetch::http::HTTPResponse;
+using fetch::http::Method;
+using fetch::http::Status;
+using fetch::http::ViewParameters;
+using fetch::json::JSONDocument;
+using fetch::ledger::ContractExecutionResult;
+using fetch::ledger::ContractExecutionStatus;
+using fetch::ledger::TimeBasedTransactionStatusCache;
+using fetch::ledger::TransactionStatus;
+using fetch::ledger::TxStatusHttpInterface;
+
+class TxStatusHttpInterfaceTests : public TransactionStatusCacheTest
+{
+protected:
+  HTTPResponse PostStatusQuery(std::string const &body)
+  {
+    for (auto const &view : interface_.views())
+    {
+      if ((view.method == Method::POST) && (view.route == "/api/status/txs"))
+      {
+        HTTPRequest request{};
+        request.SetMethod(Method::POST);
+        request.SetURI(view.route);
+        request.SetBody(body);
+
+        return view.view(ViewParameters{}, request);
+      }
+    }
+
+    throw std::runtime_error("The bulk status query view is not registered");
+  }
+
+  std::shared_ptr<TimeBasedTransactionStatusCache> cache_{
+      std::make_shared<TimeBasedTransactionStatusCache>()};
+  TxStatusHttpInterface interface_{cache_};
+};
+
+TEST_F(TxStatusHttpInterfaceTests, StatusesOfKnownAndUnknownTransactionsAreReturnedInOrder)
+{
+  auto const pending  = GenerateDigest();
+  auto const unknown  = GenerateDigest();
+  auto const executed = GenerateDigest();
+
+  cache_->Update(pending, TransactionStatus::PENDING);
+
+  ContractExecutionResult result{};
+  result.status       = ContractExecutionStatus::SUCCESS;
+  result.return_value = 7;
+  result.charge       = 3;
+  cache_->Update(executed, TransactionStatus::PENDING);
+  cache_->Update(executed, result);
+
+  std::string const body = R"({"txs": [")" + static_cast<std::string>(pending.ToHex()) + R"(", ")" +
+                           static_cast<std::string>(unknown.ToHex()) + R"(", ")" +
+                           static_cast<std::string>(executed.ToHex()) + R"("]})";
+
+  auto const response = PostStatusQuery(body);
+  ASSERT_EQ(response.status(), Status::SUCCESS_OK);
+
+  JSONDocument doc{response.body()};
+  auto const &txs = doc.root()["txs"];
+  ASSERT_TRUE(txs.IsArray());
+  ASSERT_EQ(txs.size(), 3);
+
+  EXPECT_EQ(txs[0]["tx"].As<ConstByteArray>(), pending.ToHex());
+  EXPECT_EQ(txs[0]["status"].As<ConstByteArray>(), "Pending");
+
+  EXPECT_EQ(txs[1]["tx"].As<ConstByteArray>(), unknown.ToHex());
+  EXPECT_EQ(txs[1]["status"].As<ConstByteArray>(), "Unknown");
+
+  EXPECT_EQ(txs[2]["tx"].As<ConstByteArray>(), executed.ToHex());
+  EXPECT_EQ(txs[2]["status"].As<ConstByteArray>(), "Executed");
+  EXPECT_EQ(txs[2]["exit_code"].As<int64_t>(), 7);
+  EXPECT_EQ(txs[2]["charge"].As<int64_t>(), 3);
+}
+
+TEST_F(TxStatusHttpInterfaceTests, EmptyQueriesAreAnsweredWithAnEmptyList)
+{
+  auto const response = PostStatusQuery(R"({"txs": []})");
+  ASSERT_EQ(response.status(), Status::SUCCESS_OK);
+
+  JSONDocument doc{response.body()};
+  ASSERT_TRUE(doc.root()["txs"].IsArray());
+  EXPECT_EQ(doc.root()["txs"].size(), 0);
+}
+
+TEST_F(TxStatusHttpInterfaceTests, MalformedQueriesAreRejected)
+{
+  std::string const digest = static_cast<std::string>(GenerateDigest().ToHex());
+
+  std::vector<std::string> const bodies{
+      "",
+      "not json",
+      R"({"txs": [")" + digest,                        // truncated document
+      R"(["deadbeef"])",                               // not an object
+      R"({"digests": []})",                            // missing the list
+      R"({"txs": "deadbeef"})",                        // not a list
+      R"({"txs": [42]})",                              // not a string
+      R"({"txs": ["deadbeef"]})",                      // too short
+      R"({"txs": [")" + digest + R"(0"]})",            // too long
+      R"({"txs": ["g)" + digest.substr(1) + R"("]})",  // not hex
+  };
+
+  for (auto const &body : bodies)
+  {
+    EXPECT_EQ(PostStatusQuery(body).status(), Status::CLIENT_ERROR_BAD_REQUEST) << body;
+  }
+}
+
+TEST_F(TxStatusHttpInterfaceTests, OversizedQueriesAreRejected)
+{
+  std::string const digest = static_cast<std::string>(GenerateDigest().ToHex());
+
+  std::string body = R"({"txs": [)";
+  for (std::size_t i = 0; i < 1001; ++i)
+  {
+    body += (i == 0) ? "\"" : ", \"";
+    body += digest + "\"";
+  }
+  body += "]}";
+
+  EXPECT_EQ(PostStatusQuery(body).status(), Status::CLIENT_ERROR_BAD_REQUEST);
+}
+
+}  // namespace
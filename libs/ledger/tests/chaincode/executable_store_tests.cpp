@@ -0,0 +1,170 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "crypto/sha256.hpp"
+#include "ledger/chaincode/executable_store.hpp"
+#include "vm/module.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+namespace {
+
+using fetch::byte_array::ConstByteArray;
+using fetch::ledger::ExecutableStore;
+using fetch::vm::Module;
+using fetch::vm::SourceFile;
+using fetch::vm::SourceFiles;
+
+constexpr char const *DOCUMENT_FILE = "executable_store_tests.db";
+constexpr char const *INDEX_FILE    = "executable_store_tests.index.db";
+
+char const *CONTRACT_TEXT = R"(
+  function main() : Int32
+    return 40 + 2;
+  endfunction
+)";
+
+// Source which does not compile, a store returning an executable for it has not compiled it
+char const *BROKEN_TEXT = R"(
+  function main(
+)";
+
+ConstByteArray Digest(std::string const &text)
+{
+  return fetch::crypto::Hash<fetch::crypto::SHA256>(text);
+}
+
+SourceFiles Source(char const *text)
+{
+  return {SourceFile{"contract.etch", text}};
+}
+
+class ExecutableStoreTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    std::remove(DOCUMENT_FILE);
+    std::remove(INDEX_FILE);
+  }
+
+  void TearDown() override
+  {
+    std::remove(DOCUMENT_FILE);
+    std::remove(INDEX_FILE);
+  }
+
+  std::shared_ptr<Module> module_{std::make_shared<Module>()};
+  ExecutableStore::Errors errors_;
+};
+
+TEST_F(ExecutableStoreTests, executables_are_compiled_on_a_miss)
+{
+  ExecutableStore store;
+
+  auto const executable =
+      store.GetOrCompile(Digest(CONTRACT_TEXT), module_, Source(CONTRACT_TEXT), errors_);
+  ASSERT_TRUE(executable);
+  EXPECT_TRUE(errors_.empty());
+  EXPECT_NE(executable->FindFunction("main"), nullptr);
+  EXPECT_EQ(store.size(), 1);
+
+  // a different digest is a miss, whatever is in the store
+  auto const broken =
+      store.GetOrCompile(Digest(BROKEN_TEXT), module_, Source(BROKEN_TEXT), errors_);
+  EXPECT_FALSE(broken);
+  EXPECT_FALSE(errors_.empty());
+  EXPECT_EQ(store.size(), 1);
+}
+
+TEST_F(ExecutableStoreTests, executables_are_shared_on_a_hit)
+{
+  ExecutableStore store;
+
+  auto const digest = Digest(CONTRACT_TEXT);
+  auto const first  = store.GetOrCompile(digest, module_, Source(CONTRACT_TEXT), errors_);
+  ASSERT_TRUE(first);
+
+  // the source is not looked at again, so this would fail if it was recompiled
+  auto const second =
+      store.GetOrCompile(digest, std::make_shared<Module>(), Source(BROKEN_TEXT), errors_);
+  EXPECT_EQ(first, second);
+  EXPECT_TRUE(errors_.empty());
+
+  store.Clear();
+  EXPECT_EQ(store.size(), 0);
+  EXPECT_FALSE(store.GetOrCompile(digest, module_, Source(BROKEN_TEXT), errors_));
+}
+
+TEST_F(ExecutableStoreTests, executables_are_not_shared_with_a_different_module)
+{
+  ExecutableStore store;
+
+  auto const digest = Digest(CONTRACT_TEXT);
+  ASSERT_TRUE(store.GetOrCompile(digest, module_, Source(CONTRACT_TEXT), errors_));
+
+  // an extra function changes the indices of the functions registered after it
+  auto other_module = std::make_shared<Module>();
+  other_module->CreateFreeFunction("answer", [](fetch::vm::VM *) -> int32_t { return 42; });
+
+  EXPECT_NE(ExecutableStore::Fingerprint(*module_), ExecutableStore::Fingerprint(*other_module));
+  EXPECT_FALSE(store.GetOrCompile(digest, other_module, Source(BROKEN_TEXT), errors_));
+  EXPECT_FALSE(errors_.empty());
+
+  auto const recompiled = store.GetOrCompile(digest, other_module, Source(CONTRACT_TEXT), errors_);
+  ASSERT_TRUE(recompiled);
+
+  // the entry now belongs to the other module
+  EXPECT_EQ(store.GetOrCompile(digest, other_module, Source(BROKEN_TEXT), errors_), recompiled);
+  EXPECT_FALSE(store.GetOrCompile(digest, module_, Source(BROKEN_TEXT), errors_));
+}
+
+TEST_F(ExecutableStoreTests, executables_are_loaded_from_disk_after_a_restart)
+{
+  auto const digest = Digest(CONTRACT_TEXT);
+
+  {
+    ExecutableStore store;
+    store.Load(DOCUMENT_FILE, INDEX_FILE);
+    ASSERT_TRUE(store.GetOrCompile(digest, module_, Source(CONTRACT_TEXT), errors_));
+  }
+
+  ExecutableStore store;
+  store.Load(DOCUMENT_FILE, INDEX_FILE);
+  EXPECT_EQ(store.size(), 0);
+
+  auto const executable = store.GetOrCompile(digest, module_, Source(BROKEN_TEXT), errors_);
+  ASSERT_TRUE(executable);
+  EXPECT_TRUE(errors_.empty());
+  EXPECT_NE(executable->FindFunction("main"), nullptr);
+  EXPECT_EQ(store.size(), 1);
+
+  // entries compiled against another module are not used
+  auto other_module = std::make_shared<Module>();
+  other_module->CreateFreeFunction("answer", [](fetch::vm::VM *) -> int32_t { return 42; });
+
+  store.Clear();
+  EXPECT_FALSE(store.GetOrCompile(digest, other_module, Source(BROKEN_TEXT), errors_));
+}
+
+}  // namespace
@@ -164,6 +164,43 @@ protected:
     return ret;
   }
 
+  // append a block to the chain without consulting consensus, optionally starting a new aeon
+  // which is run by the given members
+  BlockPtr NextBlock(Block const &previous, Members const &qual, bool aeon_beginning)
+  {
+    BlockPtr ret = std::make_shared<Block>();
+
+    ret->block_number               = previous.block_number + 1;
+    ret->block_entropy.block_number = ret->block_number;
+    ret->previous_hash              = previous.hash;
+    ret->miner_id                   = cabinet_[0];
+
+    for (auto const &member : qual)
+    {
+      ret->block_entropy.qualified.insert(member.identifier());
+    }
+
+    if (aeon_beginning)
+    {
+      ret->block_entropy.HashSelf();
+
+      for (auto const &key : cabinet_priv_keys_)
+      {
+        if (ret->block_entropy.qualified.count(key->identity().identifier()) != 0u)
+        {
+          ret->block_entropy
+              .confirmations[ret->block_entropy.ToQualIndex(key->identity().identifier())] =
+              key->Sign(ret->block_entropy.digest);
+        }
+      }
+    }
+
+    ret->UpdateDigest();
+    chain_.AddBlock(*ret);
+
+    return ret;
+  }
+
   // Initialise these before the test
   fetch::crypto::mcl::details::MCLInitialiser init_before_others_{};
 
@@ -400,3 +437,20 @@ TEST_F(ConsensusTests, not_aeon_beginning)
 
   ASSERT_EQ(consensus_->ValidBlock(*block), ledger::ConsensusInterface::Status::NO);
 }
+
+TEST_F(ConsensusTests, weights_come_from_the_most_recent_aeon_beginning)
+{
+  // the aeon which was expected to start at block 1 is replaced by one starting at block 5, as
+  // happens when a cabinet is re-elected part way through a period
+  Members const later_qual{cabinet_[3]};
+
+  BlockPtr block = NextBlock(*chain_.GetHeaviestBlock(), qual_, true);
+  for (uint64_t block_number = 2; block_number <= 7; ++block_number)
+  {
+    block = NextBlock(*block, (block_number < 5) ? qual_ : later_qual, block_number == 5);
+  }
+
+  ASSERT_EQ(block->block_number, 7);
+  EXPECT_EQ(consensus_->GetBlockGenerationWeight(*block, cabinet_[3]), 1);
+  EXPECT_EQ(consensus_->GetBlockGenerationWeight(*block, cabinet_[0]), 0);
+}
@@ -287,3 +287,34 @@ TEST_F(DagTests, CheckDagGetNode)
   EXPECT_EQ(dag_->GetDAGNode(dag_nodes.back().hash, dummy), true);
   EXPECT_EQ(dag_->GetDAGNode(dummy_hash, dummy), false);
 }
+
+// Check that each epoch only contains the nodes added since the previous one
+TEST_F(DagTests, CheckEpochsOnlyContainNewNodes)
+{
+  std::set<ledger::DAGHash> all_epoched_nodes;
+
+  for (uint64_t epoch_index = 1; epoch_index <= 6; ++epoch_index)
+  {
+    std::size_t const nodes_in_epoch = 10 * epoch_index;
+
+    for (std::size_t dag_node_index = 0; dag_node_index < nodes_in_epoch; ++dag_node_index)
+    {
+      dag_->AddArbitrary(std::to_string(epoch_index) + ":" + std::to_string(dag_node_index));
+    }
+
+    auto const epoch = dag_->CreateEpoch(epoch_index);
+    ASSERT_EQ(epoch.all_nodes.size(), nodes_in_epoch);
+
+    for (auto const &node_hash : epoch.all_nodes)
+    {
+      EXPECT_TRUE(all_epoched_nodes.insert(node_hash).second);
+    }
+
+    ASSERT_TRUE(dag_->CommitEpoch(epoch));
+  }
+
+  // an epoch without new nodes is empty
+  auto const empty_epoch = dag_->CreateEpoch(7);
+  EXPECT_TRUE(empty_epoch.all_nodes.empty());
+  EXPECT_TRUE(dag_->CommitEpoch(empty_epoch));
+}
@@ -24,7 +24,9 @@
 
 #include "gtest/gtest.h"
 
+#include <cstddef>
 #include <memory>
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -33,6 +35,8 @@ namespace {
 using fetch::crypto::Identity;
 using fetch::ledger::StakeSnapshot;
 
+using CabinetSelection = StakeSnapshot::CabinetSelection;
+
 using RNG              = fetch::random::LinearCongruentialGenerator;
 using StakeSnapshotPtr = std::unique_ptr<StakeSnapshot>;
 using StakeMap         = std::unordered_map<Identity, uint64_t>;
@@ -167,4 +171,126 @@ TEST_F(StakeSnapshotTests, TooSmallSampleSize)
   ASSERT_EQ(pool.size(), sample->size());
 }
 
+TEST_F(StakeSnapshotTests, WeightedSamplingIsDeterministicAndUnique)
+{
+  auto const pool = GenerateRandomStakePool(200);
+  ASSERT_EQ(200, pool.size());
+
+  auto const reference = snapshot_->BuildCabinet(42, 50, {}, CabinetSelection::WEIGHTED_SAMPLING);
+  ASSERT_TRUE(static_cast<bool>(reference));
+  ASSERT_EQ(50, reference->size());
+
+  for (std::size_t i = 0; i < 5; ++i)
+  {
+    auto const other = snapshot_->BuildCabinet(42, 50, {}, CabinetSelection::WEIGHTED_SAMPLING);
+
+    ASSERT_TRUE(static_cast<bool>(other));
+    EXPECT_EQ(*reference, *other);
+  }
+
+  // a different source of entropy should give a different cabinet
+  auto const other = snapshot_->BuildCabinet(43, 50, {}, CabinetSelection::WEIGHTED_SAMPLING);
+  ASSERT_TRUE(static_cast<bool>(other));
+  EXPECT_NE(*reference, *other);
+
+  IdentitySet identity_set{};
+  for (auto const &identity : *reference)
+  {
+    EXPECT_NE(pool.find(identity), pool.end());
+    identity_set.emplace(identity);
+  }
+  EXPECT_EQ(identity_set.size(), reference->size());
+}
+
+TEST_F(StakeSnapshotTests, WeightedSamplingFavoursLargerStakes)
+{
+  auto const large = GenerateRandomIdentity(rng_);
+  auto const small = GenerateRandomIdentity(rng_);
+
+  snapshot_->UpdateStake(large, 9000);
+  snapshot_->UpdateStake(small, 1000);
+
+  // with a single seat the larger staker should win in proportion to its stake
+  std::size_t large_selected{0};
+  for (uint64_t entropy = 0; entropy < 1000; ++entropy)
+  {
+    auto const cabinet =
+        snapshot_->BuildCabinet(entropy, 1, {}, CabinetSelection::WEIGHTED_SAMPLING);
+    ASSERT_TRUE(static_cast<bool>(cabinet));
+    ASSERT_EQ(1, cabinet->size());
+
+    if (cabinet->front() == large)
+    {
+      ++large_selected;
+    }
+  }
+
+  EXPECT_GT(large_selected, 850);
+  EXPECT_LT(large_selected, 950);
+}
+
+TEST_F(StakeSnapshotTests, WeightedSamplingDoesNotDependOnTheLowBitsOfTheEntropy)
+{
+  auto const first  = GenerateRandomIdentity(rng_);
+  auto const second = GenerateRandomIdentity(rng_);
+
+  snapshot_->UpdateStake(first, 1);
+  snapshot_->UpdateStake(second, 1);
+
+  // the lowest bit of each LCG output only depends on the lowest bit of the seed, so a draw taken
+  // from it would pick the same staker for every even source of entropy
+  std::size_t first_selected{0};
+  for (uint64_t entropy = 0; entropy < 2000; entropy += 2)
+  {
+    auto const cabinet =
+        snapshot_->BuildCabinet(entropy, 1, {}, CabinetSelection::WEIGHTED_SAMPLING);
+    ASSERT_TRUE(static_cast<bool>(cabinet));
+    ASSERT_EQ(1, cabinet->size());
+
+    if (cabinet->front() == first)
+    {
+      ++first_selected;
+    }
+  }
+
+  EXPECT_GT(first_selected, 400);
+  EXPECT_LT(first_selected, 600);
+}
+
+TEST_F(StakeSnapshotTests, WeightedSamplingRespectsWhitelist)
+{
+  auto const pool = GenerateRandomStakePool(20);
+  ASSERT_EQ(20, pool.size());
+
+  std::set<fetch::byte_array::ConstByteArray> whitelist{};
+  for (auto const &element : pool)
+  {
+    if (whitelist.size() == 10)
+    {
+      break;
+    }
+
+    whitelist.emplace(element.first.identifier());
+  }
+
+  auto const cabinet =
+      snapshot_->BuildCabinet(42, 5, whitelist, CabinetSelection::WEIGHTED_SAMPLING);
+  ASSERT_TRUE(static_cast<bool>(cabinet));
+  ASSERT_EQ(5, cabinet->size());
+
+  for (auto const &identity : *cabinet)
+  {
+    EXPECT_NE(whitelist.find(identity.identifier()), whitelist.end());
+  }
+}
+
+TEST_F(StakeSnapshotTests, WeightedSamplingTooSmallSampleSize)
+{
+  auto const pool   = GenerateRandomStakePool(3);
+  auto const sample = snapshot_->BuildCabinet(200, 10, {}, CabinetSelection::WEIGHTED_SAMPLING);
+
+  ASSERT_TRUE(static_cast<bool>(sample));
+  ASSERT_EQ(pool.size(), sample->size());
+}
+
 }  // namespace
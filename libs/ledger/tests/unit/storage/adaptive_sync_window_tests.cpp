@@ -0,0 +1,125 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/storage_unit/adaptive_sync_window.hpp"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstddef>
+
+namespace {
+
+using fetch::ledger::AdaptiveSyncWindow;
+using Timepoint = AdaptiveSyncWindow::Timepoint;
+
+using namespace std::chrono_literals;
+
+constexpr std::size_t INITIAL_WINDOW = 2;
+constexpr std::size_t MAXIMUM_WINDOW = 16;
+
+class AdaptiveSyncWindowTests : public ::testing::Test
+{
+protected:
+  // Complete a round in which every response delivers the given number of objects and takes the
+  // given time, as if the responses of the whole window arrived together
+  void CompleteRound(std::size_t objects_per_response, std::chrono::milliseconds duration)
+  {
+    now_ += duration;
+
+    auto const responses = window_.window();
+    for (std::size_t i = 0; i < responses; ++i)
+    {
+      window_.OnSuccess(objects_per_response, now_);
+    }
+  }
+
+  Timepoint          now_{};
+  AdaptiveSyncWindow window_{INITIAL_WINDOW, MAXIMUM_WINDOW, now_};
+};
+
+TEST_F(AdaptiveSyncWindowTests, WindowIsClampedOnConstruction)
+{
+  EXPECT_EQ(AdaptiveSyncWindow(0, 4).window(), 1);
+  EXPECT_EQ(AdaptiveSyncWindow(10, 4).window(), 4);
+  EXPECT_EQ(AdaptiveSyncWindow(3, 0).window(), 1);
+}
+
+TEST_F(AdaptiveSyncWindowTests, WindowGrowsWhileThroughputImproves)
+{
+  EXPECT_EQ(window_.window(), 2);
+
+  // the latency of each round is the same, so the larger windows deliver proportionally more
+  CompleteRound(100, 100ms);
+  EXPECT_EQ(window_.window(), 4);
+  EXPECT_DOUBLE_EQ(window_.rate(), 2000.0);
+
+  CompleteRound(100, 100ms);
+  EXPECT_EQ(window_.window(), 8);
+
+  CompleteRound(100, 100ms);
+  EXPECT_EQ(window_.window(), 16);
+
+  // bounded by the maximum
+  CompleteRound(100, 100ms);
+  EXPECT_EQ(window_.window(), MAXIMUM_WINDOW);
+}
+
+TEST_F(AdaptiveSyncWindowTests, WindowHoldsWhenThroughputStopsImproving)
+{
+  CompleteRound(100, 100ms);
+  EXPECT_EQ(window_.window(), 4);
+
+  // the peer is saturated: twice the requests take twice as long
+  CompleteRound(100, 200ms);
+  EXPECT_EQ(window_.window(), 4);
+
+  CompleteRound(100, 200ms);
+  EXPECT_EQ(window_.window(), 4);
+
+  // after leaving slow start the window only grows linearly
+  CompleteRound(100, 100ms);
+  EXPECT_EQ(window_.window(), 5);
+}
+
+TEST_F(AdaptiveSyncWindowTests, WindowShrinksWhenThroughputDrops)
+{
+  CompleteRound(100, 100ms);
+  CompleteRound(100, 100ms);
+  EXPECT_EQ(window_.window(), 8);
+
+  CompleteRound(100, 500ms);
+  EXPECT_EQ(window_.window(), 7);
+}
+
+TEST_F(AdaptiveSyncWindowTests, FailuresHalveTheWindow)
+{
+  CompleteRound(100, 100ms);
+  CompleteRound(100, 100ms);
+  EXPECT_EQ(window_.window(), 8);
+
+  window_.OnFailure(now_);
+  EXPECT_EQ(window_.window(), 4);
+
+  window_.OnFailure(now_);
+  window_.OnFailure(now_);
+  window_.OnFailure(now_);
+  EXPECT_EQ(window_.window(), 1);
+}
+
+}  // namespace
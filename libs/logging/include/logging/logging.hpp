@@ -89,9 +89,23 @@ void SetLogLevel(char const *name, LogLevel level);
 
 void SetGlobalLogLevel(LogLevel level);
 
+/**
+ * Determine if a message at the given level would be emitted by the named logger
+ *
+ * This is intended to be checked before a message is formatted. The per-logger handle is
+ * resolved once per name and cached per thread, so the check does not take any locks.
+ *
+ * @param level The level of log message
+ * @param name The name of the origin
+ * @return true if the message would be logged, otherwise false
+ */
+bool IsLogLevelEnabled(LogLevel level, char const *name);
+
 /**
  * Log a simple message
  *
+ * Messages are handed over to a background thread which writes them to the output sinks.
+ *
  * @param level The level of log message
  * @param name The name of the origin
  * @param message The message
@@ -113,37 +127,55 @@ LogLevelMap GetLogLevelMap();
 template <typename... Args>
 void LogTraceV2(char const *name, Args &&... args)
 {
-  Log(LogLevel::TRACE, name, detail::Format(std::forward<Args>(args)...));
+  if (IsLogLevelEnabled(LogLevel::TRACE, name))
+  {
+    Log(LogLevel::TRACE, name, detail::Format(std::forward<Args>(args)...));
+  }
 }
 
 template <typename... Args>
 void LogDebugV2(char const *name, Args &&... args)
 {
-  Log(LogLevel::DEBUG, name, detail::Format(std::forward<Args>(args)...));
+  if (IsLogLevelEnabled(LogLevel::DEBUG, name))
+  {
+    Log(LogLevel::DEBUG, name, detail::Format(std::forward<Args>(args)...));
+  }
 }
 
 template <typename... Args>
 void LogInfoV2(char const *name, Args &&... args)
 {
-  Log(LogLevel::INFO, name, detail::Format(std::forward<Args>(args)...));
+  if (IsLogLevelEnabled(LogLevel::INFO, name))
+  {
+    Log(LogLevel::INFO, name, detail::Format(std::forward<Args>(args)...));
+  }
 }
 
 template <typename... Args>
 void LogWarningV2(char const *name, Args &&... args)
 {
-  Log(LogLevel::WARNING, name, detail::Format(std::forward<Args>(args)...));
+  if (IsLogLevelEnabled(LogLevel::WARNING, name))
+  {
+    Log(LogLevel::WARNING, name, detail::Format(std::forward<Args>(args)...));
+  }
 }
 
 template <typename... Args>
 void LogErrorV2(char const *name, Args &&... args)
 {
-  Log(LogLevel::ERROR, name, detail::Format(std::forward<Args>(args)...));
+  if (IsLogLevelEnabled(LogLevel::ERROR, name))
+  {
+    Log(LogLevel::ERROR, name, detail::Format(std::forward<Args>(args)...));
+  }
 }
 
 template <typename... Args>
 void LogCriticalV2(char const *name, Args &&... args)
 {
-  Log(LogLevel::CRITICAL, name, detail::Format(std::forward<Args>(args)...));
+  if (IsLogLevelEnabled(LogLevel::CRITICAL, name))
+  {
+    Log(LogLevel::CRITICAL, name, detail::Format(std::forward<Args>(args)...));
+  }
 }
 
 /// @}
@@ -151,10 +183,17 @@ void LogCriticalV2(char const *name, Args &&... args)
 /// @name Logging Macros
 /// @{
 
+// The level is checked before any of the arguments are evaluated, such that disabled log
+// statements do not pay for building their message
+#define FETCH_LOG_IF_ENABLED(level, name, ...)                       \
+  (fetch::IsLogLevelEnabled(level, name)                             \
+       ? fetch::Log(level, name, fetch::detail::Format(__VA_ARGS__)) \
+       : (void)0)
+
 // Trace
 #if FETCH_COMPILE_LOGGING_LEVEL >= 6
 #define FETCH_LOG_TRACE_ENABLED
-#define FETCH_LOG_TRACE(name, ...) fetch::LogTraceV2(name, __VA_ARGS__)
+#define FETCH_LOG_TRACE(name, ...) FETCH_LOG_IF_ENABLED(fetch::LogLevel::TRACE, name, __VA_ARGS__)
 #else
 #define FETCH_LOG_TRACE(name, ...) (void)name
 #endif
@@ -162,7 +201,7 @@ void LogCriticalV2(char const *name, Args &&... args)
 // Debug
 #if FETCH_COMPILE_LOGGING_LEVEL >= 5
 #define FETCH_LOG_DEBUG_ENABLED
-#define FETCH_LOG_DEBUG(name, ...) fetch::LogDebugV2(name, __VA_ARGS__)
+#define FETCH_LOG_DEBUG(name, ...) FETCH_LOG_IF_ENABLED(fetch::LogLevel::DEBUG, name, __VA_ARGS__)
 #else
 #define FETCH_LOG_DEBUG(name, ...) (void)name
 #endif
@@ -170,7 +209,7 @@ void LogCriticalV2(char const *name, Args &&... args)
 // Info
 #if FETCH_COMPILE_LOGGING_LEVEL >= 4
 #define FETCH_LOG_INFO_ENABLED
-#define FETCH_LOG_INFO(name, ...) fetch::LogInfoV2(name, __VA_ARGS__)
+#define FETCH_LOG_INFO(name, ...) FETCH_LOG_IF_ENABLED(fetch::LogLevel::INFO, name, __VA_ARGS__)
 #else
 #define FETCH_LOG_INFO(name, ...) (void)name
 #endif
@@ -178,7 +217,7 @@ void LogCriticalV2(char const *name, Args &&... args)
 // Warn
 #if FETCH_COMPILE_LOGGING_LEVEL >= 3
 #define FETCH_LOG_WARN_ENABLED
-#define FETCH_LOG_WARN(name, ...) fetch::LogWarningV2(name, __VA_ARGS__)
+#define FETCH_LOG_WARN(name, ...) FETCH_LOG_IF_ENABLED(fetch::LogLevel::WARNING, name, __VA_ARGS__)
 #else
 #define FETCH_LOG_WARN(name, ...) (void)name
 #endif
@@ -186,7 +225,7 @@ void LogCriticalV2(char const *name, Args &&... args)
 // Error
 #if FETCH_COMPILE_LOGGING_LEVEL >= 2
 #define FETCH_LOG_ERROR_ENABLED
-#define FETCH_LOG_ERROR(name, ...) fetch::LogErrorV2(name, __VA_ARGS__)
+#define FETCH_LOG_ERROR(name, ...) FETCH_LOG_IF_ENABLED(fetch::LogLevel::ERROR, name, __VA_ARGS__)
 #else
 #define FETCH_LOG_ERROR(name, ...) (void)name
 #endif
@@ -194,7 +233,8 @@ void LogCriticalV2(char const *name, Args &&... args)
 // Critical
 #if FETCH_COMPILE_LOGGING_LEVEL >= 1
 #define FETCH_LOG_CRITICAL_ENABLED
-#define FETCH_LOG_CRITICAL(name, ...) fetch::LogCriticalV2(name, __VA_ARGS__)
+#define FETCH_LOG_CRITICAL(name, ...) \
+  FETCH_LOG_IF_ENABLED(fetch::LogLevel::CRITICAL, name, __VA_ARGS__)
 #else
 #define FETCH_LOG_CRITICAL(name, ...) (void)name
 #endif
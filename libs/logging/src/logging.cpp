@@ -26,6 +26,7 @@
 #pragma clang diagnostic ignored "-Wsign-conversion"
 #endif
 
+#include "spdlog/async.h"
 #include "spdlog/sinks/dup_filter_sink.h"
 #include "spdlog/sinks/stdout_color_sinks.h"
 #include "spdlog/spdlog.h"
@@ -40,7 +41,12 @@
 
 #include "logging/logging.hpp"
 
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 
 #ifdef FETCH_ENABLE_BACKTRACE
@@ -58,12 +64,24 @@ namespace {
 class LogRegistry
 {
 public:
+  using Logger    = spdlog::logger;
+  using LoggerPtr = std::shared_ptr<Logger>;
+
+  // Handles are never released, so references to them can be cached for the lifetime of the
+  // process without holding the registry lock
+  struct Handle
+  {
+    std::string name;
+    LoggerPtr   logger;
+  };
+
   // Construction / Destruction
   LogRegistry();
   LogRegistry(LogRegistry const &) = delete;
   LogRegistry(LogRegistry &&)      = delete;
   ~LogRegistry()                   = default;
 
+  bool IsEnabled(LogLevel level, char const *name);
   void Log(LogLevel level, char const *name, std::string &&message);
   void SetLevel(char const *name, LogLevel level);
   void SetGlobalLevel(LogLevel level);
@@ -80,15 +98,20 @@ public:
   }
 
 private:
-  using Logger    = spdlog::logger;
-  using LoggerPtr = std::shared_ptr<Logger>;
-  using Registry  = std::unordered_map<std::string, LoggerPtr>;
+  using HandlePtr  = std::unique_ptr<Handle>;
+  using Registry   = std::unordered_map<std::string, HandlePtr>;
+  using ThreadPool = spdlog::details::thread_pool;
+
+  static constexpr std::size_t QUEUE_SIZE         = 8192;
+  static constexpr std::size_t MAX_CACHED_HANDLES = 1024;
 
-  Logger &GetLogger(char const *name);
+  Handle &GetHandle(char const *name);
+  Handle &CreateHandle(char const *name);
 
-  std::mutex            lock_;
-  Registry              registry_;
-  std::atomic<LogLevel> global_level_{LogLevel::TRACE};
+  std::mutex                  lock_;
+  std::shared_ptr<ThreadPool> thread_pool_;  ///< Must outlive the loggers that write through it
+  Registry                    registry_;
+  std::atomic<LogLevel>       global_level_{LogLevel::TRACE};
 };
 
 LogRegistry                                          registry;
@@ -154,8 +177,21 @@ spdlog::level::level_enum ConvertFromLevel(LogLevel level)
   return new_level;
 }
 
+constexpr std::size_t LogRegistry::QUEUE_SIZE;
+constexpr std::size_t LogRegistry::MAX_CACHED_HANDLES;
+
 LogRegistry::LogRegistry() = default;
 
+bool LogRegistry::IsEnabled(LogLevel level, char const *name)
+{
+  if (level < global_level_)
+  {
+    return false;
+  }
+
+  return GetHandle(name).logger->should_log(ConvertFromLevel(level));
+}
+
 void LogRegistry::Log(LogLevel level, char const *name, std::string &&message)
 {
   if (level < global_level_)
@@ -163,22 +199,14 @@ void LogRegistry::Log(LogLevel level, char const *name, std::string &&message)
     return;
   }
 
-  std::lock_guard<std::mutex> guard(lock_);
-  GetLogger(name).log(ConvertFromLevel(level), message);
+  // formatting the line and writing it to the sinks happens on the logging thread
+  GetHandle(name).logger->log(ConvertFromLevel(level), message);
 }
 
 void LogRegistry::SetLevel(char const *name, LogLevel level)
 {
-  std::lock_guard<std::mutex> guard(lock_);
-
   // Ensure logger exists to avoid races with setting level
-  GetLogger(name);
-
-  auto it = registry_.find(name);
-  if (it != registry_.end())
-  {
-    it->second->set_level(ConvertFromLevel(level));
-  }
+  GetHandle(name).logger->set_level(ConvertFromLevel(level));
 }
 
 void LogRegistry::SetGlobalLevel(LogLevel level)
@@ -195,40 +223,75 @@ LogLevelMap LogRegistry::GetLogLevelMap()
 
   for (auto const &element : registry_)
   {
-    level_map[element.first] = ConvertToLevel(element.second->level());
+    level_map[element.first] = ConvertToLevel(element.second->logger->level());
   }
 
   return level_map;
 }
 
-LogRegistry::Logger &LogRegistry::GetLogger(char const *name)
+LogRegistry::Handle &LogRegistry::GetHandle(char const *name)
 {
-  auto it = registry_.find(name);
-  if (it == registry_.end())
+  // Most names are the LOGGING_NAME constant of a class, so the handle is cached against the
+  // address of the name. The name is still compared since the pointer might refer to a
+  // buffer which has since been reused for a different name.
+  thread_local std::unordered_map<char const *, Handle *> cache;
+
+  // names built at runtime can leave stale addresses behind, keep the cache bounded
+  if (cache.size() >= MAX_CACHED_HANDLES)
+  {
+    cache.clear();
+  }
+
+  auto &handle = cache[name];
+  if ((handle == nullptr) || (std::strcmp(handle->name.c_str(), name) != 0))
   {
-    // create the new logger instance - note it suppresses duplicate messages
-    auto dup_filter =
-        std::make_shared<spdlog::sinks::dup_filter_sink_mt>(std::chrono::milliseconds(100));
+    handle = &CreateHandle(name);
+  }
 
-    if (!COLOUR_SINK)
-    {
-      COLOUR_SINK = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-    }
+  return *handle;
+}
 
-    dup_filter->add_sink(COLOUR_SINK);
+LogRegistry::Handle &LogRegistry::CreateHandle(char const *name)
+{
+  std::lock_guard<std::mutex> guard(lock_);
 
-    auto logger = std::make_shared<spdlog::logger>(name, dup_filter);
+  auto it = registry_.find(name);
+  if (it != registry_.end())
+  {
+    return *(it->second);
+  }
 
-    logger->set_level(ConvertFromLevel(global_level()));
-    logger->set_pattern("%^[%L]%$ %Y/%m/%d %T | %-30n : %v");
+  // messages are written out by a single background thread, created on first use
+  if (!thread_pool_)
+  {
+    thread_pool_ = std::make_shared<ThreadPool>(QUEUE_SIZE, 1);
+  }
 
-    // keep a reference of it
-    registry_[name] = logger;
+  // create the new logger instance - note it suppresses duplicate messages
+  auto dup_filter =
+      std::make_shared<spdlog::sinks::dup_filter_sink_mt>(std::chrono::milliseconds(100));
 
-    return *logger;
+  if (!COLOUR_SINK)
+  {
+    COLOUR_SINK = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
   }
 
-  return *(it->second);
+  dup_filter->add_sink(COLOUR_SINK);
+
+  auto logger = std::make_shared<spdlog::async_logger>(name, dup_filter, thread_pool_,
+                                                       spdlog::async_overflow_policy::block);
+
+  logger->set_level(ConvertFromLevel(global_level()));
+  logger->set_pattern("%^[%L]%$ %Y/%m/%d %T | %-30n : %v");
+
+  // errors (including the fatal signal handler's) are flushed as soon as the writer reaches them
+  logger->flush_on(spdlog::level::err);
+
+  // keep a reference of it
+  auto &handle = registry_[name];
+  handle       = std::make_unique<Handle>(Handle{name, std::move(logger)});
+
+  return *handle;
 }
 
 }  // namespace
@@ -243,6 +306,11 @@ void SetGlobalLogLevel(LogLevel level)
   registry.SetGlobalLevel(level);
 }
 
+bool IsLogLevelEnabled(LogLevel level, char const *name)
+{
+  return registry.IsEnabled(level, name);
+}
+
 void Log(LogLevel level, char const *name, std::string &&message)
 {
   registry.Log(level, name, std::move(message));
@@ -0,0 +1,95 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/uint/montgomery.hpp"
+#include "vectorise/uint/uint.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+
+namespace {
+
+using UInt256 = fetch::vectorise::UInt<256>;
+
+// A number with the given number of non-zero 64-bit limbs
+UInt256 Number(int64_t limbs, uint64_t seed)
+{
+  UInt256 ret;
+  for (int64_t i = 0; i < limbs; ++i)
+  {
+    seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+    ret.ElementAt(static_cast<std::size_t>(i)) = seed | 1u;
+  }
+
+  return ret;
+}
+
+void BM_UInt256_Multiply(benchmark::State &state)
+{
+  UInt256 const a = Number(4, 1);
+  UInt256 const b = Number(state.range(0), 2);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(a * b);
+  }
+}
+
+void BM_UInt256_Divide(benchmark::State &state)
+{
+  UInt256 const a = Number(4, 1);
+  UInt256 const b = Number(state.range(0), 2);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(a / b);
+  }
+}
+
+void BM_UInt256_Modulo(benchmark::State &state)
+{
+  UInt256 const a = Number(4, 1);
+  UInt256 const b = Number(state.range(0), 2);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(a % b);
+  }
+}
+
+void BM_UInt256_ModPow(benchmark::State &state)
+{
+  UInt256 const base     = Number(4, 1);
+  UInt256 const exponent = Number(4, 2);
+  UInt256       modulus  = Number(state.range(0), 3);
+  if (state.range(1) == 0)
+  {
+    // even moduli are not reduced in Montgomery form
+    modulus.ElementAt(0) &= ~uint64_t{1};
+  }
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(fetch::vectorise::ModPow(base, exponent, modulus));
+  }
+}
+
+BENCHMARK(BM_UInt256_Multiply)->DenseRange(1, 4);
+BENCHMARK(BM_UInt256_Divide)->DenseRange(1, 4);
+BENCHMARK(BM_UInt256_Modulo)->DenseRange(1, 4);
+BENCHMARK(BM_UInt256_ModPow)->Ranges({{1, 4}, {0, 1}});
+
+}  // namespace
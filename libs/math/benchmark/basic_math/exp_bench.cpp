@@ -18,8 +18,11 @@
 
 #include "core/random/lcg.hpp"
 #include "math/approx_exp.hpp"
+#include "math/activation_functions/sigmoid.hpp"
 #include "math/base_types.hpp"
 #include "math/standard_functions/exp.hpp"
+#include "math/tensor/tensor.hpp"
+#include "math/trigonometry.hpp"
 #include "vectorise/fixed_point/fixed_point.hpp"
 
 #include "benchmark/benchmark.h"
@@ -73,4 +76,94 @@ BENCHMARK_TEMPLATE(BM_exp, fetch::fixed_point::fp32_t)->RangeMultiplier(10)->Ran
 BENCHMARK_TEMPLATE(BM_exp, fetch::fixed_point::fp64_t)->RangeMultiplier(10)->Range(1, 1000000);
 BENCHMARK_TEMPLATE(BM_exp, fetch::fixed_point::fp128_t)->RangeMultiplier(10)->Range(1, 1000000);
 
+// Values spread over the range of the fixed point exponent
+template <typename Type>
+fetch::math::Tensor<Type> ExponentRangeInput(fetch::math::SizeType size)
+{
+  fetch::math::Tensor<Type> input({size});
+  input.FillUniformRandom();
+  return input * fetch::math::Type<Type>("40") - fetch::math::Type<Type>("20");
+}
+
+template <typename Type>
+static void BM_TensorExp(benchmark::State &state)
+{
+  auto const                input = ExponentRangeInput<Type>(
+      static_cast<fetch::math::SizeType>(state.range(0)));
+  fetch::math::Tensor<Type> output(input.shape());
+
+  for (auto _ : state)
+  {
+    fetch::math::Exp(input, output);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Type>
+static void BM_TensorSigmoid(benchmark::State &state)
+{
+  auto const                input = ExponentRangeInput<Type>(
+      static_cast<fetch::math::SizeType>(state.range(0)));
+  fetch::math::Tensor<Type> output(input.shape());
+
+  for (auto _ : state)
+  {
+    fetch::math::Sigmoid(input, output);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Type>
+static void BM_TensorTanH(benchmark::State &state)
+{
+  auto const                input = ExponentRangeInput<Type>(
+      static_cast<fetch::math::SizeType>(state.range(0)));
+  fetch::math::Tensor<Type> output(input.shape());
+
+  for (auto _ : state)
+  {
+    fetch::math::TanH(input, output);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_TensorExp, float)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK_TEMPLATE(BM_TensorExp, double)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK_TEMPLATE(BM_TensorExp, fetch::fixed_point::fp32_t)
+    ->RangeMultiplier(8)
+    ->Range(64, 1 << 18);
+BENCHMARK_TEMPLATE(BM_TensorExp, fetch::fixed_point::fp64_t)
+    ->RangeMultiplier(8)
+    ->Range(64, 1 << 18);
+BENCHMARK_TEMPLATE(BM_TensorExp, fetch::fixed_point::fp128_t)
+    ->RangeMultiplier(8)
+    ->Range(64, 1 << 18);
+
+BENCHMARK_TEMPLATE(BM_TensorSigmoid, float)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK_TEMPLATE(BM_TensorSigmoid, double)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK_TEMPLATE(BM_TensorSigmoid, fetch::fixed_point::fp32_t)
+    ->RangeMultiplier(8)
+    ->Range(64, 1 << 18);
+BENCHMARK_TEMPLATE(BM_TensorSigmoid, fetch::fixed_point::fp64_t)
+    ->RangeMultiplier(8)
+    ->Range(64, 1 << 18);
+BENCHMARK_TEMPLATE(BM_TensorSigmoid, fetch::fixed_point::fp128_t)
+    ->RangeMultiplier(8)
+    ->Range(64, 1 << 18);
+
+BENCHMARK_TEMPLATE(BM_TensorTanH, float)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK_TEMPLATE(BM_TensorTanH, double)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK_TEMPLATE(BM_TensorTanH, fetch::fixed_point::fp32_t)
+    ->RangeMultiplier(8)
+    ->Range(64, 1 << 18);
+BENCHMARK_TEMPLATE(BM_TensorTanH, fetch::fixed_point::fp64_t)
+    ->RangeMultiplier(8)
+    ->Range(64, 1 << 18);
+BENCHMARK_TEMPLATE(BM_TensorTanH, fetch::fixed_point::fp128_t)
+    ->RangeMultiplier(8)
+    ->Range(64, 1 << 18);
+
 }  // namespace
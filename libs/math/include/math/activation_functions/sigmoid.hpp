@@ -23,6 +23,36 @@
 namespace fetch {
 namespace math {
 
+namespace details {
+
+/**
+ * Apply the vectorised fp64 kernel, which is bit for bit identical to the element wise definition
+ * below, to whole registers. Tensors with padding are left to the element wise loop.
+ * @return true if ret has been computed
+ */
+template <typename ArrayType>
+meta::IfIsFixedPoint64<typename ArrayType::Type, bool> VectorisedSigmoid(ArrayType const &t,
+                                                                         ArrayType &      ret)
+{
+  if ((t.shape() != ret.shape()) || (t.size() < t.data().padded_size()))
+  {
+    return false;
+  }
+
+  ret.data().in_parallel().Apply([](auto const &a, auto &c) { c = fetch::vectorise::Sigmoid(a); },
+                                 t.data());
+  return true;
+}
+
+template <typename ArrayType>
+meta::IfIsNotFixedPoint64<typename ArrayType::Type, bool> VectorisedSigmoid(
+    ArrayType const & /*t*/, ArrayType & /*ret*/)
+{
+  return false;
+}
+
+}  // namespace details
+
 /**
  * The sigmoid function - numerically stable
  * @tparam ArrayType
@@ -34,6 +64,11 @@ void Sigmoid(ArrayType const &t, ArrayType &ret)
 {
   using Type = typename ArrayType::Type;
 
+  if (details::VectorisedSigmoid(t, ret))
+  {
+    return;
+  }
+
   auto array_it = t.cbegin();
   auto rit      = ret.begin();
 
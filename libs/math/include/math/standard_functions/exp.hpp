@@ -59,20 +59,47 @@ meta::IfIsArithmetic<Type, Type> Exp(Type const &x)
   return ret;
 }
 
+namespace details {
+
+/**
+ * Apply the vectorised fp64 kernel, which is bit for bit identical to fp64_t::Exp, to whole
+ * registers. Tensors with padding are left to the element wise loop.
+ * @return true if ret has been computed
+ */
+template <typename ArrayType>
+meta::IfIsFixedPoint64<typename ArrayType::Type, bool> VectorisedExp(ArrayType const &array,
+                                                                     ArrayType &      ret)
+{
+  if (array.size() < array.data().padded_size())
+  {
+    return false;
+  }
+
+  ret.data().in_parallel().Apply([](auto const &a, auto &c) { c = fetch::vectorise::Exp(a); },
+                                 array.data());
+  return true;
+}
+
+// The vectorised kernels of the other types only approximate the scalar definition
+template <typename ArrayType>
+meta::IfIsNotFixedPoint64<typename ArrayType::Type, bool> VectorisedExp(ArrayType const & /*array*/,
+                                                                        ArrayType & /*ret*/)
+{
+  return false;
+}
+
+}  // namespace details
+
 template <typename ArrayType>
 meta::IfIsMathArray<ArrayType, void> Exp(ArrayType const &array, ArrayType &ret)
 {
   assert(ret.shape() == array.shape());
 
-  // TODO(ML-523); re-enable vectorisation only after replacing exp implementation
-  // with one that does not require expensive divisions
-  //  if (array.size() >= array.data().padded_size())
-  //  {
-  //    ret.data().in_parallel().Apply([](auto const &a, auto &c) { c = fetch::vectorise::Exp(a); },
-  //                                   array.data());
-  //  }
-  //  else
-  //  {
+  if (details::VectorisedExp(array, ret))
+  {
+    return;
+  }
+
   auto it1 = array.cbegin();
   auto rit = ret.begin();
   while (it1.is_valid())
@@ -81,7 +108,6 @@ meta::IfIsMathArray<ArrayType, void> Exp(ArrayType const &array, ArrayType &ret)
     ++it1;
     ++rit;
   }
-  //  }
 }
 
 template <typename ArrayType>
@@ -90,7 +116,6 @@ meta::IfIsMathArray<ArrayType, ArrayType> Exp(ArrayType const &array)
   ArrayType ret{array.shape()};
   Exp(array, ret);
   return ret;
-  return ret;
 }
 
 }  // namespace math
@@ -19,6 +19,7 @@
 
 #include "math/kernels/trigonometry.hpp"
 #include "math/meta/math_type_traits.hpp"
+#include "vectorise/math/standard_functions.hpp"
 
 #include <cassert>
 
@@ -240,6 +241,36 @@ fetch::math::meta::IfIsMathArray<ArrayType, ArrayType> CosH(ArrayType const &x)
   return ret;
 }
 
+namespace details {
+
+/**
+ * Apply the vectorised fp64 kernel, which is bit for bit identical to fp64_t::TanH, to whole
+ * registers. Tensors with padding, or a differently shaped ret, are left to the element wise loop.
+ * @return true if ret has been computed
+ */
+template <typename ArrayType>
+meta::IfIsFixedPoint64<typename ArrayType::Type, bool> VectorisedTanH(ArrayType const &x,
+                                                                      ArrayType &      ret)
+{
+  if ((x.shape() != ret.shape()) || (x.size() < x.data().padded_size()))
+  {
+    return false;
+  }
+
+  ret.data().in_parallel().Apply([](auto const &a, auto &c) { c = fetch::vectorise::TanH(a); },
+                                 x.data());
+  return true;
+}
+
+template <typename ArrayType>
+meta::IfIsNotFixedPoint64<typename ArrayType::Type, bool> VectorisedTanH(ArrayType const & /*x*/,
+                                                                         ArrayType & /*ret*/)
+{
+  return false;
+}
+
+}  // namespace details
+
 /**
  * maps every element of the array x to ret = TanH(x)
  * @param x - array
@@ -248,6 +279,11 @@ template <typename ArrayType>
 fetch::math::meta::IfIsMathArray<ArrayType, void> TanH(ArrayType const &x, ArrayType &ret)
 {
   assert(ret.size() == x.size());
+  if (details::VectorisedTanH(x, ret))
+  {
+    return;
+  }
+
   kernels::TanH s;
   auto          x_it = x.cbegin();
   auto          rit  = ret.begin();
@@ -22,6 +22,9 @@
 
 #include "gtest/gtest.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace fetch {
 namespace math {
 namespace test {
@@ -192,6 +195,49 @@ TYPED_TEST(SigmoidTest, sigmoid_11)
   ASSERT_TRUE(output.AllClose(numpy_output, fetch::math::function_tolerance<DataType>()));
 }
 
+TYPED_TEST(SigmoidTest, sigmoid_matches_element_wise_definition)
+{
+  using DataType  = typename TypeParam::Type;
+  using SizeType  = fetch::math::SizeType;
+  using ArrayType = TypeParam;
+
+  // Both unpadded and padded shapes, which are evaluated by different code paths
+  for (auto const &shape : std::vector<std::vector<SizeType>>{{64, 8}, {7, 5}})
+  {
+    ArrayType A(shape);
+
+    int32_t i = 0;
+    for (auto it = A.begin(); it.is_valid(); ++it)
+    {
+      *it = static_cast<DataType>(i % 44) / static_cast<DataType>(2) - static_cast<DataType>(21) +
+            static_cast<DataType>(i % 7) / static_cast<DataType>(9);
+      ++i;
+    }
+
+    ArrayType ret = fetch::math::Sigmoid(A);
+
+    auto it  = A.cbegin();
+    auto rit = ret.cbegin();
+    while (it.is_valid())
+    {
+      DataType expected{0};
+      if (*it >= DataType{0})
+      {
+        fetch::math::Exp(static_cast<DataType>(-*it), expected);
+        fetch::math::Divide(DataType{1}, static_cast<DataType>(1 + expected), expected);
+      }
+      else
+      {
+        fetch::math::Exp(*it, expected);
+        fetch::math::Divide(expected, static_cast<DataType>(expected + DataType{1}), expected);
+      }
+      EXPECT_EQ(*rit, expected);
+      ++it;
+      ++rit;
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace math
 }  // namespace fetch
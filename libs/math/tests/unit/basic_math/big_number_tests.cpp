@@ -16,7 +16,11 @@
 //
 //------------------------------------------------------------------------------
 
+#include "core/byte_array/decoders.hpp"
 #include "core/byte_array/encoders.hpp"
+#include "core/random/lcg.hpp"
+#include "vectorise/uint/legacy.hpp"
+#include "vectorise/uint/montgomery.hpp"
 #include "vectorise/uint/uint.hpp"
 
 #include "gmock/gmock.h"
@@ -36,6 +40,54 @@ using testing::HasSubstr;
 using UInt72 = UInt<72>;
 constexpr UInt72::WideType UInt72_WideType_Max{~UInt72::WideType{0}};
 
+template <uint16_t S>
+UInt<S> FromHexString(char const *hex)
+{
+  return UInt<S>{FromHex(ConstByteArray{hex}), platform::Endian::BIG};
+}
+
+// Random numbers of random length, biased towards limbs which exercise carries and borrows
+template <uint16_t S>
+UInt<S> RandomUInt(random::LinearCongruentialGenerator &rng)
+{
+  static constexpr uint64_t EDGES[] = {0, 1, 0x8000000000000000, 0x7fffffffffffffff,
+                                       0xffffffffffffffff, 0xffffffff00000000};
+
+  UInt<S>    ret;
+  auto const size = 1 + rng() % UInt<S>::WIDE_ELEMENTS;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    auto const r     = rng();
+    ret.ElementAt(i) = (r % 3 == 0) ? EDGES[(r >> 8) % 6] : rng();
+  }
+
+  return ret & UInt<S>::max;
+}
+
+template <uint16_t S>
+void TestDivisionWithRemainder()
+{
+  random::LinearCongruentialGenerator rng;
+  for (std::size_t i = 0; i < 10000; ++i)
+  {
+    auto const dividend = RandomUInt<S>(rng);
+    auto       divisor  = RandomUInt<S>(rng);
+    if (divisor == UInt<S>::_0)
+    {
+      divisor = UInt<S>::_1;
+    }
+
+    UInt<S> quotient;
+    UInt<S> remainder;
+    UInt<S>::Divide(dividend, divisor, quotient, remainder);
+
+    ASSERT_LT(remainder, divisor);
+    ASSERT_EQ(dividend, quotient * divisor + remainder);
+    ASSERT_EQ(quotient, dividend / divisor);
+    ASSERT_EQ(remainder, dividend % divisor);
+  }
+}
+
 TEST(big_number_gtest, elementary_left_shift)
 {
   UInt<256> n1(0ull);
@@ -144,6 +196,66 @@ TEST(big_number_gtest, subtraction_tests)
   EXPECT_EQ(n3.ElementAt(3), 0);
 }
 
+TEST(big_number_gtest, addition_carries_through_all_ones_limbs)
+{
+  // 1 + (2^128 - 1), the pending carry meets a limb of the operand which is all ones
+  UInt<256> n1 = UInt<256>::_1;
+  UInt<256> n2;
+  n2.ElementAt(0) = ULONG_MAX;
+  n2.ElementAt(1) = ULONG_MAX;
+
+  UInt<256> n3 = n1 + n2;
+  EXPECT_EQ(n3.ElementAt(0), 0);
+  EXPECT_EQ(n3.ElementAt(1), 0);
+  EXPECT_EQ(n3.ElementAt(2), 1);
+  EXPECT_EQ(n3.ElementAt(3), 0);
+
+  // the same sum the other way round
+  n3 = n2 + n1;
+  EXPECT_EQ(n3.ElementAt(0), 0);
+  EXPECT_EQ(n3.ElementAt(1), 0);
+  EXPECT_EQ(n3.ElementAt(2), 1);
+  EXPECT_EQ(n3.ElementAt(3), 0);
+
+  // the carry ripples through every limb and out of the top one
+  n2.ElementAt(2) = ULONG_MAX;
+  n2.ElementAt(3) = ULONG_MAX;
+  n1 += n2;
+  EXPECT_EQ(n1, UInt<256>::_0);
+}
+
+TEST(big_number_gtest, subtraction_borrows_through_all_ones_limbs)
+{
+  // 2^128 - (2^128 - 2^64 + 1), the pending borrow meets a limb of the operand which is all ones
+  UInt<256> n1;
+  n1.ElementAt(2) = 1;
+  UInt<256> n2;
+  n2.ElementAt(0) = 1;
+  n2.ElementAt(1) = ULONG_MAX;
+
+  UInt<256> n3 = n1 - n2;
+  EXPECT_EQ(n3.ElementAt(0), ULONG_MAX);
+  EXPECT_EQ(n3.ElementAt(1), 0);
+  EXPECT_EQ(n3.ElementAt(2), 0);
+  EXPECT_EQ(n3.ElementAt(3), 0);
+
+  // 2^192 - 1 borrows from every limb up to the top one
+  n1 = UInt<256>::_0;
+  n1.ElementAt(3) = 1;
+  n1 -= UInt<256>::_1;
+  EXPECT_EQ(n1.ElementAt(0), ULONG_MAX);
+  EXPECT_EQ(n1.ElementAt(1), ULONG_MAX);
+  EXPECT_EQ(n1.ElementAt(2), ULONG_MAX);
+  EXPECT_EQ(n1.ElementAt(3), 0);
+
+  // and back again
+  n1 += UInt<256>::_1;
+  EXPECT_EQ(n1.ElementAt(0), 0);
+  EXPECT_EQ(n1.ElementAt(1), 0);
+  EXPECT_EQ(n1.ElementAt(2), 0);
+  EXPECT_EQ(n1.ElementAt(3), 1);
+}
+
 template <typename LongUInt>
 void TestTrimmedWideSize()
 {
@@ -244,6 +356,171 @@ TEST(big_number_gtest, division_tests)
   EXPECT_EQ(n5.ElementAt(3), 0);
 }
 
+TEST(big_number_gtest, division_with_remainder_tests)
+{
+  TestDivisionWithRemainder<64>();
+  TestDivisionWithRemainder<72>();
+  TestDivisionWithRemainder<256>();
+  TestDivisionWithRemainder<512>();
+}
+
+TEST(big_number_gtest, division_quotient_estimate_correction_test)
+{
+  // The first estimate of the quotient digit is one too large and has to be corrected by adding
+  // the divisor back
+  UInt<256> n1;
+  n1.ElementAt(2) = 0xffffffff00000000;
+  UInt<256> n2;
+  n2.ElementAt(0) = 2;
+  n2.ElementAt(2) = 2;
+
+  UInt<256> quotient;
+  UInt<256> remainder;
+  UInt<256>::Divide(n1, n2, quotient, remainder);
+  EXPECT_EQ(quotient, UInt<256>{0x7fffffff7fffffffull});
+  EXPECT_EQ(remainder.ElementAt(0), 0x0000000100000002);
+  EXPECT_EQ(remainder.ElementAt(1), 0xffffffffffffffff);
+  EXPECT_EQ(remainder.ElementAt(2), 1);
+  EXPECT_EQ(remainder.ElementAt(3), 0);
+}
+
+TEST(big_number_gtest, division_by_zero_throws)
+{
+  UInt<256> n{42ull};
+  EXPECT_THROW(n /= UInt<256>::_0, std::runtime_error);
+  EXPECT_THROW(n %= UInt<256>::_0, std::runtime_error);
+  EXPECT_EQ(n, UInt<256>{42ull});
+}
+
+// The legacy kernels give the results of the original UInt<256> operators, which contracts of
+// blocks before the corrected arithmetic still depend on
+TEST(big_number_gtest, legacy_addition_and_subtraction_drop_carries_into_all_ones_limbs)
+{
+  UInt<256> one_two_eight;
+  one_two_eight.ElementAt(0) = ULONG_MAX;
+  one_two_eight.ElementAt(1) = ULONG_MAX;
+
+  // 1 + (2^128 - 1) loses the carry out of the first limb, but not the other way round
+  UInt<256> n = legacy::Add(UInt<256>::_1, one_two_eight);
+  EXPECT_EQ(n, UInt<256>::_0);
+  EXPECT_NE(n, UInt<256>::_1 + one_two_eight);
+
+  n = legacy::Add(one_two_eight, UInt<256>::_1);
+  EXPECT_EQ(n.ElementAt(0), 0);
+  EXPECT_EQ(n.ElementAt(1), 0);
+  EXPECT_EQ(n.ElementAt(2), 1);
+  EXPECT_EQ(n.ElementAt(3), 0);
+
+  // 2^128 - (2^128 - 2^64 + 1) loses the borrow out of the first limb
+  UInt<256> n1;
+  n1.ElementAt(2) = 1;
+  UInt<256> n2;
+  n2.ElementAt(0) = 1;
+  n2.ElementAt(1) = ULONG_MAX;
+
+  n = legacy::Subtract(n1, n2);
+  EXPECT_EQ(n.ElementAt(0), ULONG_MAX);
+  EXPECT_EQ(n.ElementAt(1), 0);
+  EXPECT_EQ(n.ElementAt(2), 1);
+  EXPECT_EQ(n.ElementAt(3), 0);
+  EXPECT_NE(n, n1 - n2);
+
+  // a smaller minuend was taken as zero
+  n = legacy::Subtract(UInt<256>::_1, UInt<256>{2ull});
+  EXPECT_EQ(n, legacy::Subtract(UInt<256>::_0, UInt<256>{2ull}));
+  EXPECT_EQ(n.ElementAt(0), ULONG_MAX - 1);
+  EXPECT_EQ(n.ElementAt(3), ULONG_MAX);
+}
+
+TEST(big_number_gtest, legacy_multiplication_and_division_results_are_unchanged)
+{
+  // (2^128 - 1)^2 drops a carry out of the third column
+  UInt<256> n1;
+  n1.ElementAt(0) = ULONG_MAX;
+  n1.ElementAt(1) = ULONG_MAX;
+
+  UInt<256> n = legacy::Multiply(n1, n1);
+  EXPECT_EQ(n.ElementAt(0), 1);
+  EXPECT_EQ(n.ElementAt(1), 0);
+  EXPECT_EQ(n.ElementAt(2), ULONG_MAX - 1);
+  EXPECT_EQ(n.ElementAt(3), ULONG_MAX - 1);
+  EXPECT_EQ((n1 * n1).ElementAt(3), ULONG_MAX);
+
+  // (2^64 - 2) * 2^128 / (2^128 - 2) is one too large
+  n1 = UInt<256>::_0;
+  n1.ElementAt(2) = ULONG_MAX - 1;
+  UInt<256> n2;
+  n2.ElementAt(0) = ULONG_MAX - 1;
+  n2.ElementAt(1) = ULONG_MAX;
+
+  EXPECT_EQ(legacy::Divide(n1, n2), UInt<256>{ULONG_MAX});
+  EXPECT_EQ(n1 / n2, UInt<256>{ULONG_MAX - 1});
+
+  // 2^128 % 0xe28e19dd6d78060f keeps the top bit of the dividend
+  n1 = UInt<256>::_0;
+  n1.ElementAt(2) = 1;
+  n2 = UInt<256>{0xe28e19dd6d78060full};
+
+  n = legacy::Modulo(n1, n2);
+  EXPECT_EQ(n.ElementAt(0), 0x51c99b09582342c8);
+  EXPECT_EQ(n.ElementAt(1), 0);
+  EXPECT_EQ(n.ElementAt(2), 1);
+  EXPECT_EQ(n.ElementAt(3), 0);
+  EXPECT_EQ(n1 % n2, UInt<256>{0x51c99b09582342c8ull});
+
+  // results which were already correct stay the same
+  EXPECT_EQ(legacy::Multiply(UInt<256>{6ull}, UInt<256>{7ull}), UInt<256>{42ull});
+  EXPECT_EQ(legacy::Divide(UInt<256>{42ull}, UInt<256>{5ull}), UInt<256>{8ull});
+  EXPECT_EQ(legacy::Modulo(UInt<256>{42ull}, UInt<256>{5ull}), UInt<256>{2ull});
+  EXPECT_THROW(legacy::Divide(UInt<256>{42ull}, UInt<256>::_0), std::runtime_error);
+}
+
+TEST(big_number_gtest, modular_exponentiation_tests)
+{
+  auto const prime = FromHexString<256>(
+      "7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed");
+  auto const x = FromHexString<256>(
+      "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef");
+
+  // Fermat's little theorem
+  EXPECT_EQ(ModPow(x, prime - 1ull, prime), UInt<256>::_1);
+  EXPECT_EQ(ModPow(x, prime, prime), x);
+  EXPECT_EQ(ModPow(x, UInt<256>::_0, prime), UInt<256>::_1);
+
+  UInt<256> const base{0xdeadbeefdeadbeefull};
+  UInt<256> const exponent{0x10001ull};
+  EXPECT_EQ(ModPow(base, exponent, prime),
+            FromHexString<256>("0568cfdaf2992b22af362fc0658a9ae9de286605830a58f6f64c0bf51f03f633"));
+
+  // even moduli take the path without Montgomery form
+  auto const even = FromHexString<256>("0100000000000000000000000000000000010000000000000000");
+  EXPECT_EQ(ModPow(base, exponent, even),
+            FromHexString<256>("1b28cc9ce023b0a9df29614a2e51522ca7f02a8fd0251dbeef"));
+  EXPECT_EQ(ModPow(base, exponent, UInt<256>::_1), UInt<256>::_0);
+  EXPECT_THROW(ModPow(base, exponent, UInt<256>::_0), std::runtime_error);
+}
+
+TEST(big_number_gtest, montgomery_form_tests)
+{
+  auto const prime = FromHexString<256>(
+      "7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed");
+  Montgomery<256> const field{prime};
+
+  random::LinearCongruentialGenerator rng;
+  for (std::size_t i = 0; i < 1000; ++i)
+  {
+    auto const a = RandomUInt<256>(rng) % prime;
+    auto const b = RandomUInt<256>(rng) % prime;
+
+    auto const ma = field.ToMontgomery(a);
+    auto const mb = field.ToMontgomery(b);
+    ASSERT_EQ(field.FromMontgomery(ma), a);
+    ASSERT_EQ(field.FromMontgomery(field.Multiply(ma, mb)), MulMod(a, b, prime));
+  }
+
+  EXPECT_THROW(Montgomery<256>{UInt<256>{10ull}}, std::runtime_error);
+}
+
 TEST(big_number_gtest, msb_lsb_tests)
 {
   UInt<256> n1;
@@ -442,7 +719,7 @@ TEST(big_number_gtest, test_issue_1383_overflow_division_2)
   EXPECT_EQ(UInt72{2ull}, x4 / x2);
   EXPECT_EQ(UInt72{6ull}, x4 + x2);
   EXPECT_EQ(UInt72{2ull}, x4 - x2);
-  // EXPECT_EQ(UInt72{0ull}, x4 % x2);
+  EXPECT_EQ(UInt72{0ull}, x4 % x2);
 }
 
 TEST(big_number_gtest, test_issue_1383_max)
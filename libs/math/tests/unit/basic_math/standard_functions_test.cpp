@@ -19,9 +19,14 @@
 #include "test_types.hpp"
 
 #include "math/standard_functions/clamp.hpp"
+#include "math/standard_functions/exp.hpp"
+#include "math/trigonometry.hpp"
 
 #include "gtest/gtest.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace fetch {
 namespace math {
 namespace test {
@@ -128,6 +133,73 @@ TYPED_TEST(StandardFunctionTests, clamp_array_2D_test)
   EXPECT_EQ(A, A_clamp_expected);
 }
 
+TYPED_TEST(StandardFunctionTests, exp_matches_element_wise_exp_test)
+{
+  using DataType  = typename TypeParam::Type;
+  using ArrayType = TypeParam;
+
+  // Both unpadded and padded shapes, which are evaluated by different code paths
+  for (auto const &shape : std::vector<std::vector<SizeType>>{{64, 8}, {7, 5}})
+  {
+    ArrayType A(shape);
+
+    int32_t i = 0;
+    for (auto it = A.begin(); it.is_valid(); ++it)
+    {
+      *it = static_cast<DataType>(i % 44) / static_cast<DataType>(2) - static_cast<DataType>(21) +
+            static_cast<DataType>(i % 7) / static_cast<DataType>(9);
+      ++i;
+    }
+
+    ArrayType ret = Exp(A);
+
+    auto it  = A.cbegin();
+    auto rit = ret.cbegin();
+    while (it.is_valid())
+    {
+      DataType expected{0};
+      Exp(*it, expected);
+      EXPECT_EQ(*rit, expected);
+      ++it;
+      ++rit;
+    }
+  }
+}
+
+TYPED_TEST(StandardFunctionTests, tanh_matches_element_wise_tanh_test)
+{
+  using DataType  = typename TypeParam::Type;
+  using ArrayType = TypeParam;
+
+  // Both unpadded and padded shapes, which are evaluated by different code paths
+  for (auto const &shape : std::vector<std::vector<SizeType>>{{64, 8}, {7, 5}})
+  {
+    ArrayType A(shape);
+
+    int32_t i = 0;
+    for (auto it = A.begin(); it.is_valid(); ++it)
+    {
+      *it = static_cast<DataType>(i % 44) / static_cast<DataType>(2) - static_cast<DataType>(21) +
+            static_cast<DataType>(i % 7) / static_cast<DataType>(9);
+      ++i;
+    }
+
+    ArrayType ret = TanH(A);
+
+    kernels::TanH tanh;
+    auto          it  = A.cbegin();
+    auto          rit = ret.cbegin();
+    while (it.is_valid())
+    {
+      DataType expected{0};
+      tanh(*it, expected);
+      EXPECT_EQ(*rit, expected);
+      ++it;
+      ++rit;
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace math
 }  // namespace fetch
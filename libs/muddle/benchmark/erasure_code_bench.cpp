@@ -0,0 +1,114 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "core/random/lcg.hpp"
+#include "muddle/erasure_code.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <cstdint>
+
+using fetch::byte_array::ByteArray;
+using fetch::byte_array::ConstByteArray;
+using fetch::muddle::FragmentMerkleTree;
+using fetch::muddle::ReedSolomonCodec;
+using RNG = fetch::random::LinearCongruentialGenerator;
+
+namespace {
+
+constexpr std::size_t MESSAGE_SIZE = 1u << 16u;
+
+RNG rng;
+
+ConstByteArray GenerateRandomData(std::size_t length)
+{
+  ByteArray buffer;
+  buffer.Resize(length);
+
+  for (std::size_t i = 0; i < length; ++i)
+  {
+    buffer[i] = static_cast<uint8_t>(rng());
+  }
+
+  return ConstByteArray{buffer};
+}
+
+// The codec parameters used by the erasure coded RBC for a given cabinet size
+ReedSolomonCodec CreateCodec(std::size_t cabinet_size)
+{
+  std::size_t const threshold =
+      (cabinet_size % 3 == 0) ? (cabinet_size / 3 - 1) : (cabinet_size / 3);
+
+  return ReedSolomonCodec{cabinet_size - 2 * threshold, cabinet_size};
+}
+
+void ErasureCode_Encode(benchmark::State &state)
+{
+  auto const cabinet_size = static_cast<std::size_t>(state.range(0));
+  auto const codec        = CreateCodec(cabinet_size);
+  auto const message      = GenerateRandomData(MESSAGE_SIZE);
+
+  std::size_t fragment_size{0};
+  for (auto _ : state)
+  {
+    auto const               fragments = codec.Encode(message);
+    FragmentMerkleTree const tree{fragments};
+    benchmark::DoNotOptimize(tree.root());
+
+    fragment_size = fragments.front().size();
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * MESSAGE_SIZE));
+
+  // Bytes the broadcaster sends (its fragments plus the echo of its own) against the RBC
+  auto const coded_bytes = 2 * (cabinet_size - 1) * fragment_size;
+  auto const full_bytes  = (cabinet_size - 1) * MESSAGE_SIZE;
+
+  state.counters["fragment_bytes"]        = static_cast<double>(fragment_size);
+  state.counters["broadcaster_bytes"]     = static_cast<double>(coded_bytes);
+  state.counters["rbc_broadcaster_bytes"] = static_cast<double>(full_bytes);
+}
+
+void ErasureCode_DecodeFromParity(benchmark::State &state)
+{
+  auto const cabinet_size = static_cast<std::size_t>(state.range(0));
+  auto const codec        = CreateCodec(cabinet_size);
+  auto const fragments    = codec.Encode(GenerateRandomData(MESSAGE_SIZE));
+
+  // worst case for the decoder: the fragments which arrive first are the parity fragments
+  ReedSolomonCodec::FragmentMap available{};
+  for (std::size_t i = cabinet_size - codec.data_fragments(); i < cabinet_size; ++i)
+  {
+    available[static_cast<uint32_t>(i)] = fragments[i];
+  }
+
+  for (auto _ : state)
+  {
+    ConstByteArray decoded{};
+    benchmark::DoNotOptimize(codec.Decode(available, decoded));
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * MESSAGE_SIZE));
+}
+
+}  // namespace
+
+BENCHMARK(ErasureCode_Encode)->RangeMultiplier(2)->Range(4, 128);
+BENCHMARK(ErasureCode_DecodeFromParity)->RangeMultiplier(2)->Range(4, 128);
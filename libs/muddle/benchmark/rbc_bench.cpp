@@ -20,6 +20,7 @@
 #include "core/reactor.hpp"
 #include "crypto/ecdsa.hpp"
 #include "muddle/create_muddle_fake.hpp"
+#include "muddle/erasure_coded_rbc.hpp"
 #include "muddle/muddle_interface.hpp"
 #include "muddle/punishment_broadcast_channel.hpp"
 #include "muddle/rbc.hpp"
@@ -172,6 +173,47 @@ struct RBCNode : public AbstractRBCNode
   RBC rbc;
 };
 
+struct ErasureCodedRBCNode : public AbstractRBCNode
+{
+  using ErasureCodedRBC                     = fetch::muddle::ErasureCodedRBC;
+  static constexpr const char *LOGGING_NAME = "ErasureCodedRBCNode";
+
+  ErasureCodedRBCNode(uint16_t port_number, uint16_t index)
+    : AbstractRBCNode(port_number, index)
+    , rbc{muddle->GetEndpoint(), muddle_certificate->identity().identifier(),
+          [this](MuddleAddress const &from, ConstByteArray const &payload) -> void {
+            FETCH_LOCK(mutex);
+            answers[from] = payload;
+          },
+          nullptr}
+  {}
+
+  ~ErasureCodedRBCNode() override
+  {
+    reactor.Stop();
+  }
+
+  void ResetCabinet(RBC::CabinetMembers const &members) override
+  {
+    rbc.ResetCabinet(members);
+  }
+
+  void SendMessage() override
+  {
+    rbc.Broadcast(MessageType(std::to_string(muddle_port)));
+  }
+
+  void Enable(bool enable) override
+  {
+    rbc.Enable(enable);
+  }
+
+  void PrepareForTest(uint16_t /*test*/) override
+  {}
+
+  ErasureCodedRBC rbc;
+};
+
 struct PBCNode : public AbstractRBCNode
 {
   using PBC                                 = fetch::muddle::PunishmentBroadcastChannel;
@@ -223,7 +265,7 @@ struct PBCNode : public AbstractRBCNode
   PBC      punishment_broadcast_channel;
 };
 
-// Test either the PBCNode or the RBCNode
+// Test either the PBCNode, the RBCNode or the ErasureCodedRBCNode
 template <class RBC_TYPE>
 void DKGWithEcho(benchmark::State &state)
 {
@@ -232,7 +274,8 @@ void DKGWithEcho(benchmark::State &state)
 
   // The reliable broadcast channel needs the network to be torn down since it's hard
   // to guarantee messages aren't in flight between test iterations
-  if (std::is_same<RBC_TYPE, RBCNode>::value || USING_FAKE_MUDDLES)
+  if (std::is_same<RBC_TYPE, RBCNode>::value ||
+      std::is_same<RBC_TYPE, ErasureCodedRBCNode>::value || USING_FAKE_MUDDLES)
   {
     REUSING_MUDDLES = false;
   }
@@ -388,3 +431,4 @@ void DKGWithEcho(benchmark::State &state)
 
 BENCHMARK_TEMPLATE(DKGWithEcho, PBCNode)->Range(4, 100)->Unit(benchmark::kMillisecond);
 BENCHMARK_TEMPLATE(DKGWithEcho, RBCNode)->Range(4, 64)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(DKGWithEcho, ErasureCodedRBCNode)->Range(4, 64)->Unit(benchmark::kMillisecond);
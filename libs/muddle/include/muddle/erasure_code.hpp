@@ -0,0 +1,90 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace fetch {
+namespace muddle {
+
+/**
+ * Systematic Reed-Solomon code over GF(2^8).
+ *
+ * A message is split into `data_fragments` equally sized fragments which are extended with
+ * parity fragments (rows of a Cauchy matrix) up to `total_fragments`. Any `data_fragments` of the
+ * encoded fragments are sufficient to recover the original message.
+ */
+class ReedSolomonCodec
+{
+public:
+  using ConstByteArray = byte_array::ConstByteArray;
+  using Fragments      = std::vector<ConstByteArray>;
+  using FragmentMap    = std::map<uint32_t, ConstByteArray>;
+
+  static constexpr std::size_t MAX_FRAGMENTS = 256;
+
+  ReedSolomonCodec(std::size_t data_fragments, std::size_t total_fragments);
+
+  Fragments Encode(ConstByteArray const &message) const;
+  bool      Decode(FragmentMap const &fragments, ConstByteArray &message) const;
+
+  std::size_t data_fragments() const;
+  std::size_t total_fragments() const;
+
+private:
+  using Matrix = std::vector<uint8_t>;
+
+  uint8_t GeneratorElement(std::size_t row, std::size_t column) const;
+
+  std::size_t data_fragments_;
+  std::size_t total_fragments_;
+  Matrix      parity_matrix_;  ///< (total - data) x data Cauchy matrix
+};
+
+/**
+ * Merkle tree over a set of fragments which is able to produce and check inclusion proofs
+ */
+class FragmentMerkleTree
+{
+public:
+  using ConstByteArray = byte_array::ConstByteArray;
+  using Digest         = ConstByteArray;
+  using Proof          = std::vector<Digest>;
+  using Fragments      = std::vector<ConstByteArray>;
+
+  explicit FragmentMerkleTree(Fragments const &fragments);
+
+  Digest const &root() const;
+  Proof         Prove(std::size_t index) const;
+
+  static bool Verify(Digest const &root, std::size_t index, std::size_t count,
+                     ConstByteArray const &fragment, Proof const &proof);
+
+private:
+  using Level = std::vector<Digest>;
+
+  std::vector<Level> levels_;
+};
+
+}  // namespace muddle
+}  // namespace fetch
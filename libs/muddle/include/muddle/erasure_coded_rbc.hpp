@@ -0,0 +1,249 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "core/mutex.hpp"
+#include "core/serializers/base_types.hpp"
+#include "core/serializers/main_serializer.hpp"
+#include "core/service_ids.hpp"
+#include "muddle/erasure_code.hpp"
+#include "muddle/muddle_endpoint.hpp"
+#include "muddle/rbc.hpp"
+#include "muddle/rbc_messages.hpp"
+
+#include <bitset>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace fetch {
+namespace muddle {
+
+/**
+ * Messages used by the erasure coded reliable broadcast channel.
+ *
+ * FragmentDisperse - fragment sent by the broadcaster to the member holding its index
+ * FragmentEcho - a member's own fragment forwarded to the rest of the cabinet
+ * FragmentReady - signals that the member has seen enough fragments for a Merkle root
+ */
+enum class FragmentMessageType : uint8_t
+{
+  F_DISPERSE = 1,
+  F_ECHO,
+  F_READY
+};
+
+struct FragmentMessage
+{
+  using ConstByteArray = byte_array::ConstByteArray;
+  using Digest         = FragmentMerkleTree::Digest;
+  using Proof          = FragmentMerkleTree::Proof;
+
+  FragmentMessageType type{FragmentMessageType::F_DISPERSE};
+  uint16_t            channel{0};  ///< Channel Id of the broadcast channel
+  uint32_t            id{0};       ///< Cabinet index of the broadcaster
+  uint8_t             counter{0};  ///< Counter for messages sent by the broadcaster
+  uint32_t            index{0};    ///< Index of the fragment
+  Digest              root{};      ///< Merkle root over all of the fragments
+  ConstByteArray      fragment{};  ///< Fragment contents (empty for ready messages)
+  Proof               proof{};     ///< Inclusion proof of the fragment under the root
+
+  TagType tag() const;
+};
+
+/**
+ * Reliable broadcast channel which disperses Reed-Solomon coded fragments of each message
+ * instead of sending the message in full to every member (asynchronous verifiable information
+ * dispersal).
+ *
+ * The broadcaster splits the message into n fragments, any n - 2f of which recover it, and
+ * commits to them with a Merkle root. Each member receives only its own fragment and echoes it to
+ * the rest of the cabinet. The broadcaster's uplink therefore carries roughly n |m| / (n - 2f)
+ * (about 3 |m|) plus proofs rather than the (n - 1) |m| of the RBC, with the remaining load spread
+ * evenly over the cabinet. Members become ready after n - f consistent echoes (or f + 1 readies),
+ * and deliver after 2f + 1 readies once the decoded message re-encodes to the same root.
+ */
+class ErasureCodedRBC : public BroadcastChannelInterface
+{
+public:
+  using Endpoint        = muddle::MuddleEndpoint;
+  using ConstByteArray  = byte_array::ConstByteArray;
+  using MuddleAddress   = ConstByteArray;
+  using CabinetMembers  = std::set<MuddleAddress>;
+  using SubscriptionPtr = std::shared_ptr<muddle::Subscription>;
+  using Digest          = FragmentMerkleTree::Digest;
+  using CallbackFunction =
+      std::function<void(MuddleAddress const &, byte_array::ConstByteArray const &)>;
+  using CertificatePtr = std::shared_ptr<fetch::crypto::Prover>;
+  using CodecPtr       = std::unique_ptr<ReedSolomonCodec>;
+
+  static constexpr char const *LOGGING_NAME = "ErasureCodedRBC";
+
+  ErasureCodedRBC(Endpoint &endpoint, MuddleAddress address, CallbackFunction call_back,
+                  CertificatePtr const &certificate = nullptr,
+                  uint16_t channel = CHANNEL_RBC_ERASURE_CODED, bool ordered_delivery = true);
+  ErasureCodedRBC(ErasureCodedRBC const &) = delete;
+  ErasureCodedRBC(ErasureCodedRBC &&)      = delete;
+  ~ErasureCodedRBC() override;
+
+  /// Channel Operation
+  /// @{
+  void Broadcast(SerialisedMessage const &msg);
+  bool ResetCabinet(CabinetMembers const &cabinet) override;
+  void Enable(bool enable) override;
+  void SetQuestion(ConstByteArray const &unused, ConstByteArray const &answer) override
+  {
+    FETCH_UNUSED(unused);
+    Broadcast(answer);
+  }
+
+  WeakRunnable GetRunnable() override
+  {
+    return {};
+  }
+  /// @}
+
+  ErasureCodedRBC &operator=(ErasureCodedRBC const &) = delete;
+  ErasureCodedRBC &operator=(ErasureCodedRBC &&) = delete;
+
+private:
+  using FlagType = std::bitset<sizeof(FragmentMessageType) * 8>;
+
+  struct Dispersal
+  {
+    ReedSolomonCodec::FragmentMap fragments{};     ///< Verified fragments indexed by member
+    uint32_t                      ready_count{0};
+  };
+
+  struct BroadcastState
+  {
+    std::map<Digest, Dispersal> dispersals{};  ///< Fragments received for each Merkle root
+    bool                        echo_sent{false};
+    bool                        ready_sent{false};
+    bool                        decoded{false};
+    SerialisedMessage           message{};  ///< Decoded message awaiting delivery
+  };
+
+  struct Party
+  {
+    std::unordered_map<TagType, FlagType> flags;            ///< Message types received per tag
+    uint8_t                               deliver_s = 1;    ///< Counter for messages delivered
+    std::map<uint8_t, TagType>            undelivered_msg;  ///< Decoded tags by sequence counter
+  };
+
+  using PartyList = std::vector<Party>;
+
+  /// Events - not thread safe
+  /// @{
+  void OnMessage(MuddleAddress const &from, FragmentMessage const &msg);
+  void OnDisperse(FragmentMessage const &msg, uint32_t sender_index);
+  void OnEcho(FragmentMessage const &msg, uint32_t sender_index);
+  void OnReady(FragmentMessage const &msg, uint32_t sender_index);
+  /// @}
+
+  /// Helper functions - not thread safe
+  /// @{
+  void     Send(FragmentMessage const &msg, MuddleAddress const &address);
+  void     InternalBroadcast(FragmentMessage const &msg);
+  void     SendReady(FragmentMessage const &msg);
+  void     TryDecode(FragmentMessage const &msg);
+  void     Deliver(SerialisedMessage const &msg, uint32_t sender_index);
+  bool     CheckTag(FragmentMessage const &msg);
+  bool     SetPartyFlag(uint32_t sender_index, TagType tag, FragmentMessageType msg_type);
+  bool     VerifyFragment(FragmentMessage const &msg) const;
+  uint32_t CabinetIndex(MuddleAddress const &other_address) const;
+  /// @}
+
+  mutable Mutex lock_;
+
+  uint16_t channel_{CHANNEL_RBC_ERASURE_CODED};
+  bool     enabled_{true};
+  bool     ordered_delivery_;
+
+  uint32_t  id_{0};           ///< Rank derived from position in current_cabinet_
+  uint8_t   msg_counter_{0};  ///< Counter for messages we have broadcast
+  uint32_t  threshold_{0};    ///< Maximum number of byzantine members tolerated
+  PartyList parties_;         ///< Keeps track of messages from cabinet members
+  CodecPtr  codec_;           ///< Codec for the current cabinet size
+
+  std::unordered_map<TagType, BroadcastState> broadcasts_;  ///< map from tag to broadcasts
+
+  MuddleAddress const address_;               ///< Our muddle address
+  Endpoint &          endpoint_;              ///< The muddle endpoint to communicate on
+  CabinetMembers      current_cabinet_;       ///< The cabinet (including ourselves)
+  CallbackFunction    deliver_msg_callback_;  ///< Callback for delivered messages
+  SubscriptionPtr     subscription_;          ///< For receiving messages on the channel
+};
+
+}  // namespace muddle
+
+namespace serializers {
+
+template <typename D>
+struct MapSerializer<muddle::FragmentMessage, D>
+{
+public:
+  using Type       = muddle::FragmentMessage;
+  using DriverType = D;
+
+  static uint8_t const TYPE     = 1;
+  static uint8_t const CHANNEL  = 2;
+  static uint8_t const ID       = 3;
+  static uint8_t const COUNTER  = 4;
+  static uint8_t const INDEX    = 5;
+  static uint8_t const ROOT     = 6;
+  static uint8_t const FRAGMENT = 7;
+  static uint8_t const PROOF    = 8;
+
+  template <typename Constructor>
+  static void Serialize(Constructor &map_constructor, Type const &msg)
+  {
+    auto map = map_constructor(8);
+    map.Append(TYPE, static_cast<uint8_t>(msg.type));
+    map.Append(CHANNEL, msg.channel);
+    map.Append(ID, msg.id);
+    map.Append(COUNTER, msg.counter);
+    map.Append(INDEX, msg.index);
+    map.Append(ROOT, msg.root);
+    map.Append(FRAGMENT, msg.fragment);
+    map.Append(PROOF, msg.proof);
+  }
+
+  template <typename MapDeserializer>
+  static void Deserialize(MapDeserializer &map, Type &msg)
+  {
+    uint8_t type{0};
+    map.ExpectKeyGetValue(TYPE, type);
+    map.ExpectKeyGetValue(CHANNEL, msg.channel);
+    map.ExpectKeyGetValue(ID, msg.id);
+    map.ExpectKeyGetValue(COUNTER, msg.counter);
+    map.ExpectKeyGetValue(INDEX, msg.index);
+    map.ExpectKeyGetValue(ROOT, msg.root);
+    map.ExpectKeyGetValue(FRAGMENT, msg.fragment);
+    map.ExpectKeyGetValue(PROOF, msg.proof);
+
+    msg.type = static_cast<muddle::FragmentMessageType>(type);
+  }
+};
+
+}  // namespace serializers
+}  // namespace fetch
@@ -20,6 +20,7 @@
 #include "moment/clock_interfaces.hpp"
 #include "muddle/address.hpp"
 #include "muddle/peer_selection_mode.hpp"
+#include "muddle/router_configuration.hpp"
 #include "muddle/tracker_configuration.hpp"
 #include "network/uri.hpp"
 
@@ -302,6 +303,13 @@ public:
    * @param config The configuration for the peer tracker
    */
   virtual void SetTrackerConfiguration(TrackerConfiguration const &config) = 0;
+
+  /**
+   * Sets the router configuration, must be called before the muddle is started
+   *
+   * @param config The configuration for the router
+   */
+  virtual void SetRouterConfiguration(RouterConfiguration const &config) = 0;
   /// @}
 };
 
@@ -21,7 +21,11 @@
 #include "core/byte_array/const_byte_array.hpp"
 #include "core/mutex.hpp"
 #include "core/serializers/main_serializer.hpp"
+#include "crypto/hash.hpp"
+#include "crypto/hmac.hpp"
 #include "crypto/prover.hpp"
+#include "crypto/sha256.hpp"
+#include "crypto/sha512.hpp"
 #include "crypto/verifier.hpp"
 
 #include <array>
@@ -68,17 +72,29 @@ namespace muddle {
  * │                          Stamp (if any)                         │
  *
  * └ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ┘
+ *
+ * The stamp is normally the ECDSA signature of the sender. Packets of the AUTHENTICATED_VERSION
+ * instead carry a HMAC-SHA512 keyed with the ECDH shared key of the sender and the target. Only
+ * the target is able to check these, which it can do without any public key operations, so they
+ * are only used for packets sent to a directly connected peer.
  */
 class Packet
 {
 public:
-  static constexpr std::size_t ADDRESS_SIZE   = 64;
-  static constexpr std::size_t SIGNATURE_SIZE = 64;
+  static constexpr std::size_t ADDRESS_SIZE          = 64;
+  static constexpr std::size_t SIGNATURE_SIZE        = 64;
+  static constexpr uint8_t     VERSION               = 2;  ///< Stamp is a signature
+  static constexpr uint8_t     AUTHENTICATED_VERSION = 3;  ///< Stamp is a shared key MAC
+
+  static_assert(crypto::SHA512::SIZE_IN_BYTES == SIGNATURE_SIZE,
+                "Authentication codes must fit in place of the signature");
 
   using RawAddress = std::array<uint8_t, ADDRESS_SIZE>;
   using Address    = byte_array::ConstByteArray;
   using Payload    = byte_array::ConstByteArray;
   using Stamp      = byte_array::ConstByteArray;
+  using Digest     = byte_array::ConstByteArray;
+  using SharedKey  = byte_array::ConstByteArray;
 
   struct RoutingHeader
   {
@@ -125,6 +141,7 @@ public:
   bool              IsBroadcast() const noexcept;
   bool              IsExchange() const noexcept;
   bool              IsStamped() const noexcept;
+  bool              IsAuthenticated() const noexcept;
   bool              IsEncrypted() const noexcept;
   uint8_t           GetTTL() const noexcept;
   uint16_t          GetService() const noexcept;
@@ -138,6 +155,7 @@ public:
   Payload const &   GetPayload() const noexcept;
   Stamp const &     GetStamp() const noexcept;
   std::size_t       GetPacketSize() const;
+  Digest            GetDigest() const;
 
   // Setters
   void SetDirect(bool set = true) noexcept;
@@ -160,6 +178,9 @@ public:
   void Sign(crypto::Prover const &prover);
   bool Verify() const;
 
+  void Authenticate(SharedKey const &shared_key);
+  bool VerifyAuthentication(SharedKey const &shared_key) const;
+
 private:
   RoutingHeader header_{};  ///< The header containing primarily routing information
   Payload       payload_;   ///< The payload of the message
@@ -172,6 +193,7 @@ private:
 
   void         SetStamped(bool set = true) noexcept;
   BinaryHeader StaticHeader() const noexcept;
+  Stamp        ComputeAuthenticationCode(SharedKey const &shared_key) const;
 
   template <typename V, typename D>
   friend struct serializers::MapSerializer;
@@ -183,7 +205,7 @@ inline Packet::Packet(Address const &source_address, uint32_t network_id)
   std::memset(&header_, 0, sizeof(header_));
 
   // mark the packet with the version
-  header_.version = 2;
+  header_.version = VERSION;
   header_.network = network_id;
 
   // add the sender
@@ -216,6 +238,11 @@ inline bool Packet::IsStamped() const noexcept
   return header_.stamped != 0u;
 }
 
+inline bool Packet::IsAuthenticated() const noexcept
+{
+  return IsStamped() && (header_.version == AUTHENTICATED_VERSION);
+}
+
 inline bool Packet::IsEncrypted() const noexcept
 {
   return header_.encrypted != 0u;
@@ -374,6 +401,7 @@ inline void Packet::SetPayload(Payload const &payload)
 inline void Packet::SetStamped(bool set) noexcept
 {
   header_.stamped = static_cast<uint32_t>(set);
+  header_.version = VERSION;
 }
 
 inline Packet::BinaryHeader Packet::StaticHeader() const noexcept
@@ -403,7 +431,7 @@ inline void Packet::Sign(crypto::Prover const &prover)
 
 inline bool Packet::Verify() const
 {
-  if (!IsStamped())
+  if (!IsStamped() || IsAuthenticated())
   {
     return false;  // null signature is not genuine in non-trusted networks
   }
@@ -412,6 +440,70 @@ inline bool Packet::Verify() const
   return retVal;
 }
 
+inline void Packet::Authenticate(SharedKey const &shared_key)
+{
+  SetStamped();
+  header_.version = AUTHENTICATED_VERSION;
+
+  stamp_ = ComputeAuthenticationCode(shared_key);
+}
+
+inline bool Packet::VerifyAuthentication(SharedKey const &shared_key) const
+{
+  if (!IsAuthenticated())
+  {
+    return false;
+  }
+
+  auto const expected = ComputeAuthenticationCode(shared_key);
+  if (expected.size() != stamp_.size())
+  {
+    return false;
+  }
+
+  // compare in constant time so that the check does not leak how much of the code matched
+  uint8_t difference{0};
+  for (std::size_t i = 0; i < expected.size(); ++i)
+  {
+    difference = static_cast<uint8_t>(difference | (expected[i] ^ stamp_[i]));
+  }
+
+  return difference == 0;
+}
+
+inline Packet::Stamp Packet::ComputeAuthenticationCode(SharedKey const &shared_key) const
+{
+  auto const header = StaticHeader();
+
+  byte_array::ByteArray message{};
+  message.Append(byte_array::ConstByteArray{header.data(), header.size()}, payload_);
+
+  return crypto::Hmac<crypto::SHA512>(shared_key, message);
+}
+
+/**
+ * Compute a digest which uniquely identifies the contents of the packet, including its stamp but
+ * not its TTL, which changes as the packet travels through the network
+ *
+ * @return The digest of the packet
+ */
+inline Packet::Digest Packet::GetDigest() const
+{
+  auto const header = StaticHeader();
+
+  crypto::SHA256 hasher{};
+  hasher.Reset();
+  hasher.Update(header.data(), header.size());
+  hasher.Update(payload_);
+
+  if (IsStamped())
+  {
+    hasher.Update(stamp_);
+  }
+
+  return hasher.Final();
+}
+
 inline std::size_t Packet::GetPacketSize() const
 {
   std::size_t size{sizeof(RoutingHeader)};
@@ -34,6 +34,8 @@ struct RouterConfiguration
   Duration temporary_connection_length{
       std::chrono::seconds(4)};  ///< Time should be slightly longer than the retry period
   uint32_t retry_delay_ms{2000};
+  bool     shared_key_authentication{
+      false};  ///< Stamp unicast packets to direct peers with a sender/target ECDH shared key MAC
 };
 
 }  // namespace muddle
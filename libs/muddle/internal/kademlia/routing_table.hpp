@@ -0,0 +1,91 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "kademlia/bucket.hpp"
+#include "kademlia/peer_info.hpp"
+#include "kademlia/primitives.hpp"
+#include "muddle/packet.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace fetch {
+namespace muddle {
+
+/**
+ * Kademlia buckets which keep the addresses of their peers in a contiguous array.
+ *
+ * Every entry stores the 20 byte Kademlia address of the peer as three byte swapped words
+ * together with its verification flag, so that the XOR distance to a target is three word wide
+ * XORs and comparing two distances is an integer comparison. Nearest peer lookups scan the
+ * entries of the buckets around the target and keep the closest ones in a fixed size heap,
+ * which means no intermediate containers are allocated and only the returned peers are copied.
+ *
+ * The table is not thread safe.
+ */
+class RoutingTable
+{
+public:
+  using BucketId    = Bucket::BucketId;
+  using Address     = Packet::Address;
+  using PeerInfoPtr = std::shared_ptr<PeerInfo>;
+  using Peers       = std::deque<PeerInfo>;
+
+  static constexpr uint64_t    KADEMLIA_MAX_ID_BITS = KademliaAddress::KADEMLIA_MAX_ID_BITS;
+  static constexpr std::size_t MAX_NEAREST_PEERS    = 64;
+
+  /// Bucket management
+  /// @{
+  void        Insert(BucketId bucket_id, PeerInfoPtr const &peer);
+  bool        Erase(BucketId bucket_id, Address const &address);
+  std::size_t size(BucketId bucket_id) const;
+  std::size_t active_buckets() const;
+  /// @}
+
+  Peers FindNearest(KademliaAddress const &target, BucketId bucket_id, std::size_t count,
+                    bool scan_left = true, bool scan_right = true) const;
+
+private:
+  struct Key
+  {
+    uint64_t high{0};      ///< Bytes 19 to 12 of the Kademlia address
+    uint64_t middle{0};    ///< Bytes 11 to 4 of the Kademlia address
+    uint32_t low{0};       ///< Bytes 3 to 0 of the Kademlia address
+    uint32_t verified{0};  ///< Whether the peer has been verified
+  };
+
+  struct Entries
+  {
+    std::vector<Key>         keys;
+    std::vector<PeerInfoPtr> peers;
+  };
+
+  using BucketArray = std::array<Entries, KADEMLIA_MAX_ID_BITS + 1>;
+
+  static Key CreateKey(KademliaAddress const &address, bool verified = false);
+
+  BucketArray buckets_;
+};
+
+}  // namespace muddle
+}  // namespace fetch
@@ -24,6 +24,7 @@
 #include "crypto/sha1.hpp"
 #include "kademlia/bucket.hpp"
 #include "kademlia/primitives.hpp"
+#include "kademlia/routing_table.hpp"
 #include "moment/clock_interfaces.hpp"
 #include "muddle/packet.hpp"
 
@@ -39,7 +40,6 @@ class KademliaTable
 public:
   static constexpr uint64_t KADEMLIA_MAX_ID_BITS = KademliaAddress::KADEMLIA_MAX_ID_BITS;
 
-  using Buckets        = std::array<Bucket, KADEMLIA_MAX_ID_BITS + 1>;
   using Peers          = std::deque<PeerInfo>;
   using Address        = Packet::Address;
   using PeerInfoPtr    = std::shared_ptr<PeerInfo>;
@@ -154,10 +154,8 @@ private:
   void AddDesiredPeerInternal(Address const &address, Duration const &expiry);
   void AddDesiredPeerInternal(Uri const &uri, Duration const &expiry);
 
-  Peers FindPeerInternal(KademliaAddress const &kam_address, uint64_t log_id, bool scan_left = true,
-                         bool scan_right = true);
-  Peers FindPeerByHammingInternal(KademliaAddress const &kam_address, uint64_t hamming_id,
-                                  bool scan_left = true, bool scan_right = true);
+  Peers FindPeerInternal(RoutingTable const &table, KademliaAddress const &kam_address,
+                         uint64_t bucket_id, bool scan_left = true, bool scan_right = true);
   std::string const logging_name_;
 
   // The mutex locking order should be in the order in which
@@ -176,8 +174,8 @@ private:
 
   /// @{
   mutable Mutex peer_info_mutex_;
-  Buckets       by_logarithm_;
-  Buckets       by_hamming_;
+  RoutingTable  by_logarithm_;
+  RoutingTable  by_hamming_;
   PeerMap       known_peers_;
   UriToPeerMap  known_uris_;
   /// @}
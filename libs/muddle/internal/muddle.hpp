@@ -190,6 +190,7 @@ public:
   void SetConfidence(Addresses const &addresses, Confidence confidence) override;
   void SetConfidence(ConfidenceMap const &map) override;
   void SetTrackerConfiguration(TrackerConfiguration const &config) override;
+  void SetRouterConfiguration(RouterConfiguration const &config) override;
   /// @}
 
   /// @name Internal Accessors
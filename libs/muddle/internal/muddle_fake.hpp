@@ -406,6 +406,11 @@ public:
   {
     throw std::runtime_error("SetTrackerConfiguration functionality not implemented");
   }
+
+  void SetRouterConfiguration(RouterConfiguration const & /*config*/) override
+  {
+    throw std::runtime_error("SetRouterConfiguration functionality not implemented");
+  }
   /// @}
 
 private:
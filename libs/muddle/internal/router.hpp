@@ -75,6 +75,7 @@ public:
   using Clock        = std::chrono::steady_clock;
   using Timepoint    = Clock::time_point;
   using EchoCache    = std::unordered_map<std::size_t, Timepoint>;
+  using VerifiedCache = std::unordered_map<Packet::Digest, Timepoint>;
 
   // Helper functions
   static Packet::RawAddress ConvertAddress(Packet::Address const &address);
@@ -92,6 +93,9 @@ public:
     return network_id_;
   }
 
+  // Configuration, must be applied before the router is started
+  void SetConfiguration(RouterConfiguration const &config);
+
   // Start / Stop
   void Start();
   void Stop();
@@ -172,9 +176,12 @@ private:
 
   bool IsEcho(Packet const &packet, bool register_echo = true);
   void CleanEchoCache();
+  void CleanVerifiedCache();
 
   PacketPtr const &Sign(PacketPtr const &p) const;
   bool             Genuine(PacketPtr const &p) const;
+  bool             VerifyBroadcast(Packet const &packet) const;
+  bool             LookupSharedKey(RawAddress const &peer, Packet::SharedKey &shared_key) const;
 
   telemetry::GaugePtr<uint64_t> CreateGauge(char const *name, char const *description) const;
   telemetry::HistogramPtr       CreateHistogram(char const *name, char const *description) const;
@@ -200,6 +207,14 @@ private:
   mutable Mutex echo_cache_lock_;
   EchoCache     echo_cache_;
 
+  /// Broadcasts reach a node once per neighbour, the signature only needs checking once
+  mutable Mutex         verified_cache_lock_;
+  mutable VerifiedCache verified_cache_;
+
+  /// ECDH shared keys with the peers that shared key authenticated packets are exchanged with
+  mutable Mutex                                             shared_keys_lock_;
+  mutable std::unordered_map<RawAddress, Packet::SharedKey> shared_keys_;
+
   ThreadPool dispatch_thread_pool_;
 
   /// Redelivery of packages
@@ -249,6 +264,7 @@ private:
   telemetry::CounterPtr         dispatch_complete_total_;
   telemetry::CounterPtr         foreign_packet_total_;
   telemetry::CounterPtr         fraudulent_packet_total_;
+  telemetry::CounterPtr         verified_cache_hit_total_;
   telemetry::CounterPtr         routing_table_updates_total_;
   telemetry::CounterPtr         echo_cache_trims_total_;
   telemetry::CounterPtr         echo_cache_removals_total_;
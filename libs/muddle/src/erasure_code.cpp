@@ -0,0 +1,512 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "crypto/sha256.hpp"
+#include "muddle/erasure_code.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace fetch {
+namespace muddle {
+namespace {
+
+using byte_array::ByteArray;
+using byte_array::ConstByteArray;
+
+// length prefix prepended to the message before it is split into fragments
+constexpr std::size_t LENGTH_PREFIX = sizeof(uint32_t);
+
+constexpr uint8_t LEAF_DOMAIN = 0;
+constexpr uint8_t NODE_DOMAIN = 1;
+
+/**
+ * Log / exp tables for GF(2^8) with the reducing polynomial x^8 + x^4 + x^3 + x^2 + 1
+ */
+class GaloisField
+{
+public:
+  GaloisField()
+  {
+    uint32_t value = 1;
+    for (std::size_t i = 0; i < 255; ++i)
+    {
+      exp_[i]       = static_cast<uint8_t>(value);
+      exp_[i + 255] = static_cast<uint8_t>(value);
+      log_[value]   = static_cast<uint8_t>(i);
+
+      value <<= 1u;
+      if ((value & 0x100u) != 0)
+      {
+        value ^= 0x11du;
+      }
+    }
+  }
+
+  uint8_t Multiply(uint8_t a, uint8_t b) const
+  {
+    if ((a == 0) || (b == 0))
+    {
+      return 0;
+    }
+
+    return exp_[std::size_t{log_[a]} + log_[b]];
+  }
+
+  uint8_t Inverse(uint8_t a) const
+  {
+    assert(a != 0);
+    return exp_[255u - log_[a]];
+  }
+
+  /**
+   * Accumulate coefficient * input into output (addition in GF(2^8) is xor)
+   */
+  void MultiplyAdd(uint8_t coefficient, uint8_t const *input, uint8_t *output,
+                   std::size_t length) const
+  {
+    if (coefficient == 0)
+    {
+      return;
+    }
+
+    if (coefficient == 1)
+    {
+      for (std::size_t i = 0; i < length; ++i)
+      {
+        output[i] ^= input[i];
+      }
+      return;
+    }
+
+    std::size_t const log_coefficient = log_[coefficient];
+    for (std::size_t i = 0; i < length; ++i)
+    {
+      if (input[i] != 0)
+      {
+        output[i] ^= exp_[log_coefficient + log_[input[i]]];
+      }
+    }
+  }
+
+private:
+  std::array<uint8_t, 510> exp_{};
+  std::array<uint8_t, 256> log_{};
+};
+
+GaloisField const &Field()
+{
+  static GaloisField const field{};
+  return field;
+}
+
+ByteArray ZeroedBuffer(std::size_t length)
+{
+  ByteArray buffer;
+  buffer.Resize(length);
+  std::memset(buffer.pointer(), 0, length);
+  return buffer;
+}
+
+/**
+ * Invert a square matrix in place using Gauss-Jordan elimination
+ *
+ * @return true if the matrix was invertible, otherwise false
+ */
+bool Invert(std::vector<uint8_t> &matrix, std::size_t size)
+{
+  auto const &field = Field();
+
+  std::vector<uint8_t> inverse(size * size, 0);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    inverse[i * size + i] = 1;
+  }
+
+  for (std::size_t column = 0; column < size; ++column)
+  {
+    // find a pivot for this column
+    std::size_t pivot = column;
+    while ((pivot < size) && (matrix[pivot * size + column] == 0))
+    {
+      ++pivot;
+    }
+
+    if (pivot == size)
+    {
+      return false;
+    }
+
+    if (pivot != column)
+    {
+      for (std::size_t i = 0; i < size; ++i)
+      {
+        std::swap(matrix[pivot * size + i], matrix[column * size + i]);
+        std::swap(inverse[pivot * size + i], inverse[column * size + i]);
+      }
+    }
+
+    // normalise the pivot row
+    uint8_t const scale = field.Inverse(matrix[column * size + column]);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      matrix[column * size + i]  = field.Multiply(matrix[column * size + i], scale);
+      inverse[column * size + i] = field.Multiply(inverse[column * size + i], scale);
+    }
+
+    // eliminate the column from all of the other rows
+    for (std::size_t row = 0; row < size; ++row)
+    {
+      uint8_t const factor = matrix[row * size + column];
+      if ((row == column) || (factor == 0))
+      {
+        continue;
+      }
+
+      field.MultiplyAdd(factor, &matrix[column * size], &matrix[row * size], size);
+      field.MultiplyAdd(factor, &inverse[column * size], &inverse[row * size], size);
+    }
+  }
+
+  matrix = std::move(inverse);
+  return true;
+}
+
+FragmentMerkleTree::Digest HashLeaf(ConstByteArray const &fragment)
+{
+  crypto::SHA256 hasher{};
+  hasher.Update(&LEAF_DOMAIN, sizeof(LEAF_DOMAIN));
+  hasher.Update(fragment);
+  return hasher.Final();
+}
+
+FragmentMerkleTree::Digest HashNode(ConstByteArray const &left, ConstByteArray const &right)
+{
+  crypto::SHA256 hasher{};
+  hasher.Update(&NODE_DOMAIN, sizeof(NODE_DOMAIN));
+  hasher.Update(left);
+  hasher.Update(right);
+  return hasher.Final();
+}
+
+std::size_t TreeDepth(std::size_t count)
+{
+  std::size_t depth = 0;
+  while ((std::size_t{1} << depth) < count)
+  {
+    ++depth;
+  }
+  return depth;
+}
+
+}  // namespace
+
+constexpr std::size_t ReedSolomonCodec::MAX_FRAGMENTS;
+
+/**
+ * Construct a codec
+ *
+ * @param data_fragments The number of fragments required to recover a message
+ * @param total_fragments The total number of fragments generated for each message
+ */
+ReedSolomonCodec::ReedSolomonCodec(std::size_t data_fragments, std::size_t total_fragments)
+  : data_fragments_{data_fragments}
+  , total_fragments_{total_fragments}
+{
+  if ((data_fragments_ == 0) || (data_fragments_ > total_fragments_) ||
+      (total_fragments_ > MAX_FRAGMENTS))
+  {
+    throw std::invalid_argument("Invalid Reed-Solomon code parameters");
+  }
+
+  auto const &      field            = Field();
+  std::size_t const parity_fragments = total_fragments_ - data_fragments_;
+
+  // Cauchy matrix 1 / (x_i + y_j) with x_i = data + i and y_j = j, all of which are distinct
+  parity_matrix_.resize(parity_fragments * data_fragments_);
+  for (std::size_t row = 0; row < parity_fragments; ++row)
+  {
+    for (std::size_t column = 0; column < data_fragments_; ++column)
+    {
+      auto const x = static_cast<uint8_t>(data_fragments_ + row);
+      auto const y = static_cast<uint8_t>(column);
+
+      parity_matrix_[row * data_fragments_ + column] = field.Inverse(static_cast<uint8_t>(x ^ y));
+    }
+  }
+}
+
+/**
+ * Encode a message into the complete set of fragments
+ *
+ * @param message The message to be encoded
+ * @return The fragments, all of the same size
+ */
+ReedSolomonCodec::Fragments ReedSolomonCodec::Encode(ConstByteArray const &message) const
+{
+  if (message.size() > std::numeric_limits<uint32_t>::max())
+  {
+    throw std::invalid_argument("Message too large to be erasure coded");
+  }
+
+  auto const &      field           = Field();
+  std::size_t const framed_length   = LENGTH_PREFIX + message.size();
+  std::size_t const fragment_length = (framed_length + data_fragments_ - 1) / data_fragments_;
+
+  // frame the message with its length and pad it to a whole number of fragments
+  ByteArray  framed = ZeroedBuffer(fragment_length * data_fragments_);
+  auto const length = static_cast<uint32_t>(message.size());
+  for (std::size_t i = 0; i < LENGTH_PREFIX; ++i)
+  {
+    framed[i] = static_cast<uint8_t>(length >> (8u * i));
+  }
+  if (!message.empty())
+  {
+    std::memcpy(framed.pointer() + LENGTH_PREFIX, message.pointer(), message.size());
+  }
+
+  Fragments fragments{};
+  fragments.reserve(total_fragments_);
+
+  for (std::size_t i = 0; i < data_fragments_; ++i)
+  {
+    fragments.emplace_back(framed.SubArray(i * fragment_length, fragment_length));
+  }
+
+  for (std::size_t row = 0; row < total_fragments_ - data_fragments_; ++row)
+  {
+    ByteArray parity = ZeroedBuffer(fragment_length);
+    for (std::size_t column = 0; column < data_fragments_; ++column)
+    {
+      field.MultiplyAdd(parity_matrix_[row * data_fragments_ + column],
+                        framed.pointer() + column * fragment_length, parity.pointer(),
+                        fragment_length);
+    }
+
+    fragments.emplace_back(std::move(parity));
+  }
+
+  return fragments;
+}
+
+/**
+ * Recover a message from a subset of its fragments
+ *
+ * @param fragments The available fragments indexed by their position in the encoding
+ * @param message The recovered message
+ * @return true if successful, otherwise false
+ */
+bool ReedSolomonCodec::Decode(FragmentMap const &fragments, ConstByteArray &message) const
+{
+  if (fragments.size() < data_fragments_)
+  {
+    return false;
+  }
+
+  auto const &      field           = Field();
+  std::size_t const fragment_length = fragments.begin()->second.size();
+
+  // select the first data_fragments of the available fragments
+  std::vector<uint32_t>               indices{};
+  std::vector<ConstByteArray const *> inputs{};
+  for (auto const &element : fragments)
+  {
+    if ((element.first >= total_fragments_) || (element.second.size() != fragment_length))
+    {
+      return false;
+    }
+
+    if (indices.size() < data_fragments_)
+    {
+      indices.push_back(element.first);
+      inputs.push_back(&element.second);
+    }
+  }
+
+  ByteArray framed = ZeroedBuffer(fragment_length * data_fragments_);
+
+  if (indices.back() < data_fragments_)
+  {
+    // all of the data fragments are present
+    for (std::size_t i = 0; i < data_fragments_; ++i)
+    {
+      if (fragment_length > 0)
+      {
+        std::memcpy(framed.pointer() + i * fragment_length, inputs[i]->pointer(), fragment_length);
+      }
+    }
+  }
+  else
+  {
+    std::vector<uint8_t> decoding(data_fragments_ * data_fragments_);
+    for (std::size_t row = 0; row < data_fragments_; ++row)
+    {
+      for (std::size_t column = 0; column < data_fragments_; ++column)
+      {
+        decoding[row * data_fragments_ + column] = GeneratorElement(indices[row], column);
+      }
+    }
+
+    if (!Invert(decoding, data_fragments_))
+    {
+      return false;
+    }
+
+    for (std::size_t row = 0; row < data_fragments_; ++row)
+    {
+      for (std::size_t column = 0; column < data_fragments_; ++column)
+      {
+        field.MultiplyAdd(decoding[row * data_fragments_ + column], inputs[column]->pointer(),
+                          framed.pointer() + row * fragment_length, fragment_length);
+      }
+    }
+  }
+
+  if (framed.size() < LENGTH_PREFIX)
+  {
+    return false;
+  }
+
+  uint32_t length = 0;
+  for (std::size_t i = 0; i < LENGTH_PREFIX; ++i)
+  {
+    length |= static_cast<uint32_t>(framed[i]) << (8u * i);
+  }
+
+  if (length > framed.size() - LENGTH_PREFIX)
+  {
+    return false;
+  }
+
+  message = framed.SubArray(LENGTH_PREFIX, length);
+  return true;
+}
+
+std::size_t ReedSolomonCodec::data_fragments() const
+{
+  return data_fragments_;
+}
+
+std::size_t ReedSolomonCodec::total_fragments() const
+{
+  return total_fragments_;
+}
+
+uint8_t ReedSolomonCodec::GeneratorElement(std::size_t row, std::size_t column) const
+{
+  if (row < data_fragments_)
+  {
+    return (row == column) ? 1 : 0;
+  }
+
+  return parity_matrix_[(row - data_fragments_) * data_fragments_ + column];
+}
+
+/**
+ * Build the tree for a set of fragments. The leaves are padded up to the next power of two
+ *
+ * @param fragments The fragments to be committed to
+ */
+FragmentMerkleTree::FragmentMerkleTree(Fragments const &fragments)
+{
+  std::size_t const width = std::size_t{1} << TreeDepth(fragments.size());
+
+  Level leaves{};
+  leaves.reserve(width);
+  for (auto const &fragment : fragments)
+  {
+    leaves.emplace_back(HashLeaf(fragment));
+  }
+  leaves.resize(width, HashLeaf(ConstByteArray{}));
+
+  levels_.emplace_back(std::move(leaves));
+  while (levels_.back().size() > 1)
+  {
+    auto const &below = levels_.back();
+
+    Level level{};
+    level.reserve(below.size() / 2);
+    for (std::size_t i = 0; i < below.size(); i += 2)
+    {
+      level.emplace_back(HashNode(below[i], below[i + 1]));
+    }
+
+    levels_.emplace_back(std::move(level));
+  }
+}
+
+FragmentMerkleTree::Digest const &FragmentMerkleTree::root() const
+{
+  return levels_.back().front();
+}
+
+/**
+ * Generate the inclusion proof for a fragment
+ *
+ * @param index The index of the fragment
+ * @return The sibling digests from the leaf up to (but not including) the root
+ */
+FragmentMerkleTree::Proof FragmentMerkleTree::Prove(std::size_t index) const
+{
+  Proof proof{};
+  proof.reserve(levels_.size() - 1);
+
+  for (std::size_t level = 0; level + 1 < levels_.size(); ++level)
+  {
+    proof.push_back(levels_[level][index ^ 1u]);
+    index >>= 1u;
+  }
+
+  return proof;
+}
+
+/**
+ * Check that a fragment is committed to by a Merkle root
+ *
+ * @param root The root of the tree
+ * @param index The index of the fragment
+ * @param count The total number of fragments in the tree
+ * @param fragment The fragment being checked
+ * @param proof The inclusion proof for the fragment
+ * @return true if the proof is valid, otherwise false
+ */
+bool FragmentMerkleTree::Verify(Digest const &root, std::size_t index, std::size_t count,
+                                ConstByteArray const &fragment, Proof const &proof)
+{
+  if ((index >= count) || (proof.size() != TreeDepth(count)))
+  {
+    return false;
+  }
+
+  Digest digest = HashLeaf(fragment);
+  for (auto const &sibling : proof)
+  {
+    digest = ((index & 1u) != 0) ? HashNode(sibling, digest) : HashNode(digest, sibling);
+    index >>= 1u;
+  }
+
+  return digest == root;
+}
+
+}  // namespace muddle
+}  // namespace fetch
@@ -0,0 +1,606 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "logging/logging.hpp"
+#include "muddle/erasure_coded_rbc.hpp"
+
+#include <cassert>
+#include <iterator>
+#include <string>
+#include <utility>
+
+namespace fetch {
+namespace muddle {
+
+/**
+ * Creates unique tag for the message out of the channel, id and message counter. Matches the
+ * layout of RBCMessage::tag
+ *
+ * @return Tag of message
+ */
+TagType FragmentMessage::tag() const
+{
+  TagType msg_tag = channel;
+  msg_tag <<= 48;
+  msg_tag |= id;
+  msg_tag <<= 32;
+  return (msg_tag | uint64_t(counter));
+}
+
+constexpr char const *ErasureCodedRBC::LOGGING_NAME;
+
+/**
+ * Creates instance of the erasure coded RBC
+ *
+ * @param endpoint The muddle endpoint to communicate on
+ * @param address The muddle endpoint address
+ * @param call_back The callback for messages which have completed the protocol
+ * @param channel The channel the messages are sent on
+ * @param ordered_delivery Whether messages from each member are delivered in the order sent
+ */
+ErasureCodedRBC::ErasureCodedRBC(Endpoint &endpoint, MuddleAddress address,
+                                 CallbackFunction call_back, CertificatePtr const & /*unused*/,
+                                 uint16_t channel, bool ordered_delivery)
+  : channel_{channel}
+  , ordered_delivery_{ordered_delivery}
+  , address_{std::move(address)}
+  , endpoint_{endpoint}
+  , deliver_msg_callback_{std::move(call_back)}
+  , subscription_(endpoint.Subscribe(SERVICE_RBC, channel_))
+{
+  subscription_->SetMessageHandler([this](MuddleAddress const &from, uint16_t, uint16_t, uint16_t,
+                                          muddle::Packet::Payload const &payload, MuddleAddress) {
+    RBCSerializer serialiser(payload);
+
+    FragmentMessage msg;
+    try
+    {
+      serialiser >> msg;
+    }
+    catch (...)
+    {
+      FETCH_LOG_ERROR(LOGGING_NAME, "Node ", id_,
+                      " caught an exception while deserializing fragment message.");
+      return;
+    }
+
+    try
+    {
+      FETCH_LOCK(lock_);
+      OnMessage(from, msg);
+    }
+    catch (...)
+    {
+      FETCH_LOG_CRITICAL(LOGGING_NAME, "Node ", id_,
+                         ": critical failure in erasure coded RBC, possibly due to malformed "
+                         "message.");
+    }
+  });
+}
+
+ErasureCodedRBC::~ErasureCodedRBC() = default;
+
+/**
+ * Enables or disables the channel. Disabling will clear all state that would continue the
+ * protocol
+ */
+void ErasureCodedRBC::Enable(bool enable)
+{
+  FETCH_LOCK(lock_);
+  enabled_ = enable;
+
+  if (!enabled_)
+  {
+    parties_.clear();
+    parties_.resize(current_cabinet_.size());
+    broadcasts_.clear();
+    msg_counter_ = 0;
+  }
+}
+
+/**
+ * Resets the channel for a new cabinet
+ */
+bool ErasureCodedRBC::ResetCabinet(CabinetMembers const &cabinet)
+{
+  FETCH_LOCK(lock_);
+
+  // Empty cabinets cannot be instated and every member needs a distinct fragment
+  if (cabinet.empty() || (cabinet.size() > ReedSolomonCodec::MAX_FRAGMENTS))
+  {
+    return false;
+  }
+
+  auto iterator = cabinet.find(address_);
+  if (iterator == cabinet.end())
+  {
+    return false;
+  }
+
+  current_cabinet_ = cabinet;
+
+  // Same threshold as the RBC
+  if (current_cabinet_.size() % 3 == 0)
+  {
+    threshold_ = static_cast<uint32_t>(current_cabinet_.size() / 3 - 1);
+  }
+  else
+  {
+    threshold_ = static_cast<uint32_t>(current_cabinet_.size() / 3);
+  }
+
+  assert(current_cabinet_.size() > 3 * threshold_);
+
+  // At least n - 2f honest members echo their fragments, so that many are needed to decode
+  codec_ = std::make_unique<ReedSolomonCodec>(current_cabinet_.size() - 2 * threshold_,
+                                              current_cabinet_.size());
+
+  id_ = static_cast<uint32_t>(std::distance(cabinet.begin(), iterator));
+
+  parties_.clear();
+  parties_.resize(current_cabinet_.size());
+  broadcasts_.clear();
+  msg_counter_ = 0;
+
+  return true;
+}
+
+/**
+ * Encodes a message and disperses one fragment to each of the cabinet members
+ *
+ * @param msg Serialised message to be broadcast
+ */
+void ErasureCodedRBC::Broadcast(SerialisedMessage const &msg)
+{
+  FETCH_LOCK(lock_);
+
+  if (!codec_)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to broadcast before the cabinet has been set");
+    return;
+  }
+
+  auto const               fragments = codec_->Encode(msg);
+  FragmentMerkleTree const tree{fragments};
+
+  FragmentMessage disperse{};
+  disperse.type    = FragmentMessageType::F_DISPERSE;
+  disperse.channel = channel_;
+  disperse.id      = id_;
+  disperse.counter = ++msg_counter_;
+  disperse.root    = tree.root();
+
+  FragmentMessage own_fragment{};
+
+  // Fragment i belongs to the i'th member of the cabinet
+  uint32_t index{0};
+  for (auto const &address : current_cabinet_)
+  {
+    disperse.index    = index;
+    disperse.fragment = fragments[index];
+    disperse.proof    = tree.Prove(index);
+
+    if (index == id_)
+    {
+      own_fragment = disperse;
+    }
+    else
+    {
+      Send(disperse, address);
+    }
+
+    ++index;
+  }
+
+  OnDisperse(own_fragment, id_);
+}
+
+/**
+ * Sends a message to a particular address
+ */
+void ErasureCodedRBC::Send(FragmentMessage const &msg, MuddleAddress const &address)
+{
+  RBCSerializerCounter msg_counter;
+  msg_counter << msg;
+
+  RBCSerializer msg_serializer;
+  msg_serializer.Reserve(msg_counter.size());
+  msg_serializer << msg;
+
+  endpoint_.Send(address, SERVICE_RBC, channel_, msg_serializer.data());
+}
+
+/**
+ * Sends a message to all of the other members of the cabinet
+ */
+void ErasureCodedRBC::InternalBroadcast(FragmentMessage const &msg)
+{
+  RBCSerializerCounter msg_counter;
+  msg_counter << msg;
+
+  RBCSerializer msg_serializer;
+  msg_serializer.Reserve(msg_counter.size());
+  msg_serializer << msg;
+
+  for (auto const &address : current_cabinet_)
+  {
+    if (address != address_)
+    {
+      endpoint_.Send(address, SERVICE_RBC, channel_, msg_serializer.data());
+    }
+  }
+}
+
+/**
+ * Handler for all incoming messages
+ *
+ * @param from Muddle address of sender
+ * @param msg The fragment message
+ */
+void ErasureCodedRBC::OnMessage(MuddleAddress const &from, FragmentMessage const &msg)
+{
+  if (!enabled_)
+  {
+    return;
+  }
+
+  if ((current_cabinet_.find(from) == current_cabinet_.end()) || (msg.channel != channel_))
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Received message from unknown sender/wrong channel");
+    return;
+  }
+
+  if (msg.id >= parties_.size())
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Node ", id_, " received message with unknown tag id");
+    return;
+  }
+
+  uint32_t const sender_index = CabinetIndex(from);
+
+  switch (msg.type)
+  {
+  case FragmentMessageType::F_DISPERSE:
+    OnDisperse(msg, sender_index);
+    break;
+  case FragmentMessageType::F_ECHO:
+    OnEcho(msg, sender_index);
+    break;
+  case FragmentMessageType::F_READY:
+    OnReady(msg, sender_index);
+    break;
+  default:
+    FETCH_LOG_WARN(LOGGING_NAME, "Node: ", id_, " can not process payload from node ",
+                   sender_index);
+  }
+}
+
+/**
+ * Handler for the fragment sent by the broadcaster. If valid, the fragment is echoed to the rest
+ * of the cabinet
+ *
+ * @param msg The disperse message
+ * @param sender_index Index of sender in current_cabinet_
+ */
+void ErasureCodedRBC::OnDisperse(FragmentMessage const &msg, uint32_t sender_index)
+{
+  TagType const tag = msg.tag();
+
+  if ((sender_index != msg.id) || (msg.index != id_))
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "onDisperse: Node ", id_, " received wrong fragment from node ",
+                   sender_index, " for msg ", tag);
+    return;
+  }
+
+  if (!SetPartyFlag(sender_index, tag, FragmentMessageType::F_DISPERSE))
+  {
+    return;
+  }
+
+  if (!VerifyFragment(msg))
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "onDisperse: Node ", id_, " received invalid proof from node ",
+                   sender_index, " for msg ", tag);
+    return;
+  }
+
+  auto &state = broadcasts_[tag];
+  if (state.echo_sent || state.decoded)
+  {
+    return;
+  }
+  state.echo_sent = true;
+
+  FragmentMessage echo{msg};
+  echo.type = FragmentMessageType::F_ECHO;
+
+  InternalBroadcast(echo);
+  OnEcho(echo, id_);
+}
+
+/**
+ * Handler for the fragments echoed by the other members. Sends a ready message once n - f
+ * fragments have been received for the same root
+ *
+ * @param msg The echo message
+ * @param sender_index Index of sender in current_cabinet_
+ */
+void ErasureCodedRBC::OnEcho(FragmentMessage const &msg, uint32_t sender_index)
+{
+  TagType const tag = msg.tag();
+
+  if (msg.index != sender_index)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "onEcho: Node ", id_, " received foreign fragment from node ",
+                   sender_index, " for msg ", tag);
+    return;
+  }
+
+  if (!SetPartyFlag(sender_index, tag, FragmentMessageType::F_ECHO))
+  {
+    return;
+  }
+
+  if (!VerifyFragment(msg))
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "onEcho: Node ", id_, " received invalid proof from node ",
+                   sender_index, " for msg ", tag);
+    return;
+  }
+
+  auto &state = broadcasts_[tag];
+  if (state.decoded)
+  {
+    return;
+  }
+
+  auto &dispersal                   = state.dispersals[msg.root];
+  dispersal.fragments[sender_index] = msg.fragment;
+
+  if (!state.ready_sent && (dispersal.fragments.size() == current_cabinet_.size() - threshold_))
+  {
+    SendReady(msg);
+  }
+
+  TryDecode(msg);
+}
+
+/**
+ * Handler for ready messages. Amplifies the ready message after f + 1 have been received and
+ * attempts to decode after 2f + 1
+ *
+ * @param msg The ready message
+ * @param sender_index Index of sender in current_cabinet_
+ */
+void ErasureCodedRBC::OnReady(FragmentMessage const &msg, uint32_t sender_index)
+{
+  TagType const tag = msg.tag();
+
+  if (!SetPartyFlag(sender_index, tag, FragmentMessageType::F_READY))
+  {
+    return;
+  }
+
+  auto &state = broadcasts_[tag];
+  if (state.decoded)
+  {
+    return;
+  }
+
+  auto &dispersal = state.dispersals[msg.root];
+  ++dispersal.ready_count;
+
+  if (!state.ready_sent && (dispersal.ready_count == threshold_ + 1))
+  {
+    SendReady(msg);
+  }
+
+  TryDecode(msg);
+}
+
+void ErasureCodedRBC::SendReady(FragmentMessage const &msg)
+{
+  broadcasts_[msg.tag()].ready_sent = true;
+
+  FragmentMessage ready{};
+  ready.type    = FragmentMessageType::F_READY;
+  ready.channel = msg.channel;
+  ready.id      = msg.id;
+  ready.counter = msg.counter;
+  ready.index   = id_;
+  ready.root    = msg.root;
+
+  InternalBroadcast(ready);
+  OnReady(ready, id_);
+}
+
+/**
+ * Decodes the message for a root once 2f + 1 members are ready and enough fragments have been
+ * received. The decoded message is only accepted if it re-encodes to the same root, which ensures
+ * that all honest members decode the same message from any subset of the fragments
+ *
+ * @param msg A message referring to the tag and root
+ */
+void ErasureCodedRBC::TryDecode(FragmentMessage const &msg)
+{
+  TagType const tag = msg.tag();
+
+  auto state_it = broadcasts_.find(tag);
+  if ((state_it == broadcasts_.end()) || state_it->second.decoded)
+  {
+    return;
+  }
+
+  auto &state        = state_it->second;
+  auto  dispersal_it = state.dispersals.find(msg.root);
+  if (dispersal_it == state.dispersals.end())
+  {
+    return;
+  }
+
+  auto const &dispersal = dispersal_it->second;
+  if ((dispersal.ready_count < 2 * threshold_ + 1) ||
+      (dispersal.fragments.size() < codec_->data_fragments()))
+  {
+    return;
+  }
+
+  SerialisedMessage message{};
+  bool const        valid = codec_->Decode(dispersal.fragments, message) &&
+                     (FragmentMerkleTree{codec_->Encode(message)}.root() == msg.root);
+
+  // The fragments are no longer needed once the message has been decoded
+  state.decoded = true;
+  state.dispersals.clear();
+
+  if (!valid)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Node ", id_, " received inconsistent fragments for msg ", tag,
+                   " from node ", msg.id);
+    return;
+  }
+
+  state.message = message;
+
+  if ((msg.id != id_) && CheckTag(msg))
+  {
+    FETCH_LOG_DEBUG(LOGGING_NAME, "Node ", id_, " delivered msg ", tag, " with counter ",
+                    std::to_string(msg.counter), " and id ", msg.id);
+
+    Deliver(message, msg.id);
+  }
+}
+
+/**
+ * Delivers messages which have reached the end of the protocol
+ *
+ * @param msg Serialised message which has been reliably broadcast
+ * @param sender_index Index of sender in current_cabinet_
+ */
+void ErasureCodedRBC::Deliver(SerialisedMessage const &msg, uint32_t sender_index)
+{
+  assert(parties_.size() == current_cabinet_.size());
+
+  MuddleAddress miner_id{*std::next(current_cabinet_.begin(), sender_index)};
+
+  // Unlock and lock here to allow the callback function to use the channel
+  lock_.unlock();
+  deliver_msg_callback_(miner_id, msg);
+  lock_.lock();
+
+  if (sender_index >= parties_.size())
+  {
+    return;
+  }
+
+  ++parties_[sender_index].deliver_s;
+
+  // Try to deliver old messages
+  auto &party       = parties_[sender_index];
+  auto  old_tag_msg = party.undelivered_msg.begin();
+
+  while (old_tag_msg != party.undelivered_msg.end() && old_tag_msg->first == party.deliver_s)
+  {
+    SerialisedMessage const old_msg = broadcasts_[old_tag_msg->second].message;
+    party.undelivered_msg.erase(old_tag_msg);
+
+    lock_.unlock();
+    deliver_msg_callback_(miner_id, old_msg);
+    lock_.lock();
+
+    if (sender_index >= parties_.size())
+    {
+      return;
+    }
+
+    auto &current_party = parties_[sender_index];
+    ++current_party.deliver_s;
+    old_tag_msg = current_party.undelivered_msg.begin();
+  }
+}
+
+/**
+ * Checks the message counter is the next one to be delivered for the broadcaster. If it is
+ * ahead, the message is queued for delivery later
+ *
+ * @param msg A message referring to the decoded tag
+ * @return Bool for whether the message can be delivered now
+ */
+bool ErasureCodedRBC::CheckTag(FragmentMessage const &msg)
+{
+  assert(msg.id < current_cabinet_.size());
+  assert(parties_.size() == current_cabinet_.size());
+
+  if (!ordered_delivery_)
+  {
+    return true;
+  }
+
+  auto &party = parties_[msg.id];
+  if (msg.counter == party.deliver_s)
+  {
+    return true;
+  }
+
+  if (msg.counter > party.deliver_s)
+  {
+    party.undelivered_msg.emplace(msg.counter, msg.tag());
+  }
+
+  return false;
+}
+
+/**
+ * Sets the message flag for the sender for the message type and tag
+ *
+ * @return Bool for whether this is the first message of this type for the tag
+ */
+bool ErasureCodedRBC::SetPartyFlag(uint32_t sender_index, TagType tag,
+                                   FragmentMessageType msg_type)
+{
+  assert(parties_.size() == current_cabinet_.size());
+
+  auto &flags = parties_[sender_index].flags[tag];
+  auto  index = static_cast<uint32_t>(msg_type);
+  if (flags[index])
+  {
+    FETCH_LOG_TRACE(LOGGING_NAME, "Node ", id_, " repeated msg type ",
+                    static_cast<uint8_t>(msg_type), " with tag ", tag);
+    return false;
+  }
+
+  flags.set(index);
+  return true;
+}
+
+bool ErasureCodedRBC::VerifyFragment(FragmentMessage const &msg) const
+{
+  return FragmentMerkleTree::Verify(msg.root, msg.index, current_cabinet_.size(), msg.fragment,
+                                    msg.proof);
+}
+
+uint32_t ErasureCodedRBC::CabinetIndex(MuddleAddress const &other_address) const
+{
+  auto iter = current_cabinet_.find(other_address);
+  assert(iter != current_cabinet_.end());
+  return static_cast<uint32_t>(std::distance(current_cabinet_.begin(), iter));
+}
+
+}  // namespace muddle
+}  // namespace fetch
@@ -0,0 +1,250 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "kademlia/routing_table.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace fetch {
+namespace muddle {
+namespace {
+
+struct Candidate
+{
+  uint32_t unverified;
+  uint64_t high;
+  uint64_t middle;
+  uint32_t low;
+  uint32_t bucket_id;
+  uint32_t slot;
+};
+
+// Same order as PeerInfo: verified peers first, then by increasing distance
+bool IsCloser(Candidate const &a, Candidate const &b)
+{
+  if (a.unverified != b.unverified)
+  {
+    return a.unverified < b.unverified;
+  }
+
+  if (a.high != b.high)
+  {
+    return a.high < b.high;
+  }
+
+  if (a.middle != b.middle)
+  {
+    return a.middle < b.middle;
+  }
+
+  return a.low < b.low;
+}
+
+template <typename T>
+T LoadBigEndian(uint8_t const *words, std::size_t most_significant)
+{
+  T ret{0};
+  for (std::size_t i = 0; i < sizeof(T); ++i)
+  {
+    ret = static_cast<T>((ret << 8u) | words[most_significant - i]);
+  }
+  return ret;
+}
+
+}  // namespace
+
+/**
+ * Converts a Kademlia address into its key. Distances are compared from the last byte of the
+ * address downwards, so the bytes are packed into the words most significant first.
+ */
+RoutingTable::Key RoutingTable::CreateKey(KademliaAddress const &address, bool verified)
+{
+  static_assert(KademliaAddress::ADDRESS_SIZE == 20, "Key layout assumes 160 bit addresses");
+
+  Key key;
+  key.high     = LoadBigEndian<uint64_t>(address.words, 19);
+  key.middle   = LoadBigEndian<uint64_t>(address.words, 11);
+  key.low      = LoadBigEndian<uint32_t>(address.words, 3);
+  key.verified = static_cast<uint32_t>(verified);
+
+  return key;
+}
+
+/**
+ * Adds a peer to a bucket. The peer must not already be present in the bucket.
+ *
+ * @param bucket_id The bucket to add the peer to
+ * @param peer The peer to be added
+ */
+void RoutingTable::Insert(BucketId bucket_id, PeerInfoPtr const &peer)
+{
+  assert(bucket_id <= KADEMLIA_MAX_ID_BITS);
+
+  auto &entries = buckets_[bucket_id];
+  entries.keys.push_back(CreateKey(peer->kademlia_address, peer->verified));
+  entries.peers.push_back(peer);
+}
+
+/**
+ * Removes a peer from a bucket
+ *
+ * @param bucket_id The bucket to remove the peer from
+ * @param address The muddle address of the peer
+ * @return true if the peer was present, otherwise false
+ */
+bool RoutingTable::Erase(BucketId bucket_id, Address const &address)
+{
+  assert(bucket_id <= KADEMLIA_MAX_ID_BITS);
+
+  auto &entries = buckets_[bucket_id];
+  for (std::size_t i = 0; i < entries.peers.size(); ++i)
+  {
+    if (entries.peers[i]->address == address)
+    {
+      // the order within a bucket is not significant
+      entries.keys[i]  = entries.keys.back();
+      entries.peers[i] = std::move(entries.peers.back());
+      entries.keys.pop_back();
+      entries.peers.pop_back();
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+std::size_t RoutingTable::size(BucketId bucket_id) const
+{
+  if (bucket_id > KADEMLIA_MAX_ID_BITS)
+  {
+    return 0;
+  }
+
+  return buckets_[bucket_id].peers.size();
+}
+
+std::size_t RoutingTable::active_buckets() const
+{
+  std::size_t ret{0};
+  for (auto const &entries : buckets_)
+  {
+    ret += static_cast<std::size_t>(!entries.peers.empty());
+  }
+  return ret;
+}
+
+/**
+ * Finds the peers nearest to a target.
+ *
+ * Candidates are taken from the given bucket, and its neighbours are added on either side until
+ * at least count candidates have been seen. The count closest of these are returned, verified
+ * peers first and otherwise ordered by their distance to the target.
+ *
+ * @param target The Kademlia address to search for
+ * @param bucket_id The bucket to start the search from
+ * @param count The number of peers to return
+ * @param scan_left Whether buckets below bucket_id may be searched
+ * @param scan_right Whether buckets above bucket_id may be searched
+ * @return The nearest peers, with their distance set relative to the target
+ */
+RoutingTable::Peers RoutingTable::FindNearest(KademliaAddress const &target, BucketId bucket_id,
+                                              std::size_t count, bool scan_left,
+                                              bool scan_right) const
+{
+  if (bucket_id > KADEMLIA_MAX_ID_BITS)
+  {
+    return {};
+  }
+
+  // Widening the range of buckets searched until there are enough candidates
+  std::size_t candidates      = buckets_[bucket_id].peers.size();
+  BucketId    left            = bucket_id;
+  BucketId    right           = bucket_id;
+  bool        need_more_peers = candidates < count;
+
+  while (need_more_peers)
+  {
+    need_more_peers = false;
+
+    if (scan_left && (left != 0))
+    {
+      left -= 1;
+      candidates += buckets_[left].peers.size();
+      need_more_peers = candidates < count;
+    }
+
+    if (scan_right && (right < KADEMLIA_MAX_ID_BITS))
+    {
+      right += 1;
+      candidates += buckets_[right].peers.size();
+      need_more_peers = candidates < count;
+    }
+  }
+
+  // Selecting the nearest candidates with a bounded max heap, the root being the furthest
+  std::size_t const                        limit = std::min(count, MAX_NEAREST_PEERS);
+  std::array<Candidate, MAX_NEAREST_PEERS> nearest;
+  std::size_t                              nearest_size{0};
+
+  Key const target_key = CreateKey(target);
+  for (BucketId id = left; id <= right; ++id)
+  {
+    auto const &keys = buckets_[id].keys;
+    for (std::size_t slot = 0; slot < keys.size(); ++slot)
+    {
+      auto const &key = keys[slot];
+
+      Candidate const candidate{static_cast<uint32_t>(key.verified == 0),
+                                key.high ^ target_key.high,
+                                key.middle ^ target_key.middle,
+                                key.low ^ target_key.low,
+                                static_cast<uint32_t>(id),
+                                static_cast<uint32_t>(slot)};
+
+      if (nearest_size < limit)
+      {
+        nearest[nearest_size++] = candidate;
+        std::push_heap(nearest.begin(), nearest.begin() + nearest_size, IsCloser);
+      }
+      else if ((limit != 0) && IsCloser(candidate, nearest.front()))
+      {
+        std::pop_heap(nearest.begin(), nearest.begin() + nearest_size, IsCloser);
+        nearest[nearest_size - 1] = candidate;
+        std::push_heap(nearest.begin(), nearest.begin() + nearest_size, IsCloser);
+      }
+    }
+  }
+
+  std::sort_heap(nearest.begin(), nearest.begin() + nearest_size, IsCloser);
+
+  Peers ret;
+  for (std::size_t i = 0; i < nearest_size; ++i)
+  {
+    auto const &candidate = nearest[i];
+
+    ret.push_back(*buckets_[candidate.bucket_id].peers[candidate.slot]);
+    ret.back().distance = GetKademliaDistance(ret.back().kademlia_address, target);
+  }
+
+  return ret;
+}
+
+}  // namespace muddle
+}  // namespace fetch
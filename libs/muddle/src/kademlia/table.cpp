@@ -39,87 +39,18 @@ KademliaTable::KademliaTable(Address const &own_address, NetworkId const &networ
   , own_kad_address_{KademliaAddress::Create(own_address)}
 {}
 
-KademliaTable::Peers KademliaTable::FindPeerInternal(KademliaAddress const &kam_address,
-                                                     uint64_t log_id, bool scan_left,
+KademliaTable::Peers KademliaTable::FindPeerInternal(RoutingTable const &table,
+                                                     KademliaAddress const &kam_address,
+                                                     uint64_t bucket_id, bool scan_left,
                                                      bool scan_right)
 {
+  auto const max_peers = kademlia_max_peers_per_bucket();
 
-  // Checking that we are within bounds
-  if (log_id > KADEMLIA_MAX_ID_BITS)
-  {
-    return {};
-  }
-
-  // Creating initial list
-  std::unordered_map<Address, PeerInfo> results;
-  {
-    FETCH_LOCK(peer_info_mutex_);
-    for (auto &p : by_logarithm_[log_id].peers)
-    {
-      results.insert({p->address, *p});
-    }
-  }
-  // Preparing to search nearby buckets in case there is not
-  // enough peers in the current bucket.
-  auto left            = log_id;
-  auto right           = log_id;
-  bool need_more_peers = results.size() < kademlia_max_peers_per_bucket();
-
-  // Checking if we need to go to other buckets to add more
-  // peers.
-  while (need_more_peers)
-  {
-    need_more_peers = false;
-
-    // Searhcing the buckets left of the main bucket
-    if (scan_left && (left != 0))
-    {
-      FETCH_LOCK(peer_info_mutex_);
-      left -= 1;
-      for (auto const &p : by_logarithm_[left].peers)
-      {
-        results.insert({p->address, *p});
-      }
-
-      need_more_peers = results.size() < kademlia_max_peers_per_bucket();
-    }
-
-    // And the ones right of the main bucket.
-    if (scan_right && (right < KADEMLIA_MAX_ID_BITS))
-    {
-      FETCH_LOCK(peer_info_mutex_);
-      right += 1;
-
-      for (auto const &p : by_logarithm_[right].peers)
-      {
-        results.insert({p->address, *p});
-      }
-
-      need_more_peers = results.size() < kademlia_max_peers_per_bucket();
-    }
-  }
-
-  // Worst cast size of the return is at this point
-  // 3 * kademlia_max_peers_per_bucket_ - 1. We now
-  // trim and sort according to distance
-  assert(results.size() < 3 * kademlia_max_peers_per_bucket());
-  Peers ret;
-  for (auto &peer : results)
-  {
-    peer.second.distance = GetKademliaDistance(peer.second.kademlia_address, kam_address);
-    ret.push_back(peer.second);
-  }
-
-  // Sorting according to distance
-  std::sort(ret.begin(), ret.end());
-
-  // Trimming the list
-  while (ret.size() > kademlia_max_peers_per_bucket())
-  {
-    ret.pop_back();
-  }
-
-  return ret;
+  // The routing table widens the search to the neighbouring buckets
+  // until there are enough candidates and returns the nearest of them
+  // sorted according to distance
+  FETCH_LOCK(peer_info_mutex_);
+  return table.FindNearest(kam_address, bucket_id, max_peers, scan_left, scan_right);
 }
 
 KademliaTable::Peers KademliaTable::FindPeer(Address const &address)
@@ -130,7 +61,7 @@ KademliaTable::Peers KademliaTable::FindPeer(Address const &address)
   auto dist        = GetKademliaDistance(own_kad_address_, kam_address);
   auto log_id      = Bucket::IdByLogarithm(dist);
 
-  return FindPeerInternal(kam_address, log_id);
+  return FindPeerInternal(by_logarithm_, kam_address, log_id);
 }
 
 KademliaTable::Peers KademliaTable::FindPeer(Address const &address, uint64_t log_id,
@@ -139,90 +70,7 @@ KademliaTable::Peers KademliaTable::FindPeer(Address const &address, uint64_t lo
   // Computing the Kademlia distance and the
   // corresponding bucket.
   auto kam_address = KademliaAddress::Create(address);
-  return FindPeerInternal(kam_address, log_id, scan_left, scan_right);
-}
-
-KademliaTable::Peers KademliaTable::FindPeerByHammingInternal(KademliaAddress const &kam_address,
-                                                              uint64_t hamming_id, bool scan_left,
-                                                              bool scan_right)
-{
-  // TODO(tfr): Merge with other function.
-  // Checking that we are within bounds
-  if (hamming_id > KADEMLIA_MAX_ID_BITS)
-  {
-    return {};
-  }
-
-  // Creating initial list
-  std::unordered_map<Address, PeerInfo> results;
-  {
-    FETCH_LOCK(peer_info_mutex_);
-
-    for (auto &p : by_hamming_[hamming_id].peers)
-    {
-      results.insert({p->address, *p});
-    }
-  }
-  // Preparing to search nearby buckets in case there is not
-  // enough peers in the current bucket.
-  auto left            = hamming_id;
-  auto right           = hamming_id;
-  bool need_more_peers = results.size() < kademlia_max_peers_per_bucket();
-
-  // Checking if we need to go to other buckets to add more
-  // peers.
-  while (need_more_peers)
-  {
-    need_more_peers = false;
-
-    // Searhcing the buckets left of the main bucket
-    if (scan_left && (left != 0))
-    {
-      left -= 1;
-      FETCH_LOCK(peer_info_mutex_);
-      for (auto const &p : by_hamming_[left].peers)
-      {
-        results.insert({p->address, *p});
-      }
-
-      need_more_peers = results.size() < kademlia_max_peers_per_bucket();
-    }
-
-    // And the ones right of the main bucket.
-    if (scan_right && (right < KADEMLIA_MAX_ID_BITS))
-    {
-      right += 1;
-      FETCH_LOCK(peer_info_mutex_);
-      for (auto const &p : by_hamming_[right].peers)
-      {
-        results.insert({p->address, *p});
-      }
-
-      need_more_peers = results.size() < kademlia_max_peers_per_bucket();
-    }
-  }
-
-  // Worst cast size of the return is at this point
-  // 3 * kademlia_max_peers_per_bucket_ - 1. We now
-  // trim and sort according to distance
-  assert(results.size() < 3 * kademlia_max_peers_per_bucket());
-  Peers ret;
-  for (auto &peer : results)
-  {
-    peer.second.distance = GetKademliaDistance(peer.second.kademlia_address, kam_address);
-    ret.push_back(peer.second);
-  }
-
-  // Sorting according to distance
-  std::sort(ret.begin(), ret.end());
-
-  // Trimming the list
-  while (ret.size() > kademlia_max_peers_per_bucket())
-  {
-    ret.pop_back();
-  }
-
-  return ret;
+  return FindPeerInternal(by_logarithm_, kam_address, log_id, scan_left, scan_right);
 }
 
 KademliaTable::Peers KademliaTable::FindPeerByHamming(Address const &address)
@@ -231,14 +79,14 @@ KademliaTable::Peers KademliaTable::FindPeerByHamming(Address const &address)
   auto dist        = GetKademliaDistance(own_kad_address_, kam_address);
   auto hamming_id  = Bucket::IdByHamming(dist);
 
-  return FindPeerByHammingInternal(kam_address, hamming_id);
+  return FindPeerInternal(by_hamming_, kam_address, hamming_id);
 }
 
 KademliaTable::Peers KademliaTable::FindPeerByHamming(Address const &address, uint64_t hamming_id,
                                                       bool scan_left, bool scan_right)
 {
   auto kam_address = KademliaAddress::Create(address);
-  return FindPeerInternal(kam_address, hamming_id, scan_left, scan_right);
+  return FindPeerInternal(by_hamming_, kam_address, hamming_id, scan_left, scan_right);
 }
 
 void KademliaTable::ReportSuccessfulConnectAttempt(Uri const &uri)
@@ -306,46 +154,12 @@ void KademliaTable::ReportLiveliness(Address const &address, Address const &repo
 
   assert(log_id <= KADEMLIA_MAX_ID_BITS);
 
-  // Fetching the log bucket and finding the peer if it exists in it
-  {
-    FETCH_LOCK(peer_info_mutex_);
-
-    auto &log_bucket = by_logarithm_[log_id];
-    auto  log_it     = log_bucket.peers.begin();
-    for (; log_it != log_bucket.peers.end(); ++log_it)
-    {
-      if (address == (*log_it)->address)
-      {
-        log_bucket.peers.erase(log_it);
-        break;
-      }
-    }
-  }
-
-  // Fetching the hamming bucket and finding the peer if it exists in it
-  {
-    FETCH_LOCK(peer_info_mutex_);
-    auto &hamming_bucket = by_hamming_[hamming_id];
-    auto  hamming_it     = hamming_bucket.peers.begin();
-    for (; hamming_it != hamming_bucket.peers.end(); ++hamming_it)
-    {
-      if (address == (*hamming_it)->address)
-      {
-        hamming_bucket.peers.erase(hamming_it);
-        break;
-      }
-    }
-  }
-
   // Peer is already known but not in any
   // log_bucket.
   {
     FETCH_LOCK(peer_info_mutex_);
     PeerInfoPtr peerinfo;
 
-    auto &log_bucket     = by_logarithm_[log_id];
-    auto &hamming_bucket = by_hamming_[hamming_id];
-
     auto it = known_peers_.find(address);
     if (it != known_peers_.end())
     {
@@ -372,9 +186,12 @@ void KademliaTable::ReportLiveliness(Address const &address, Address const &repo
     peerinfo->message_count += 1;
     // TODO(tfr): peerinfo.last_activity
 
-    // Updating buckets
-    log_bucket.peers.insert(peerinfo);
-    hamming_bucket.peers.insert(peerinfo);
+    // Updating buckets, replacing the entries of the peer if it is
+    // already in them
+    by_logarithm_.Erase(log_id, address);
+    by_hamming_.Erase(hamming_id, address);
+    by_logarithm_.Insert(log_id, peerinfo);
+    by_hamming_.Insert(hamming_id, peerinfo);
   }
 
   // Updating own bucket
@@ -420,8 +237,6 @@ void KademliaTable::ReportExistence(PeerInfo const &info, Address const &reporte
   // bucket
   if (it == known_peers_.end())
   {
-    auto &      log_bucket  = by_logarithm_[log_id];
-    auto &      ham_bucket  = by_hamming_[hamming_id];
     PeerInfoPtr peerinfo    = std::make_shared<PeerInfo>(info);
     peerinfo->verified      = false;
     peerinfo->last_reporter = reporter;
@@ -429,14 +244,14 @@ void KademliaTable::ReportExistence(PeerInfo const &info, Address const &reporte
     known_peers_[info.address] = peerinfo;
 
     //
-    if (log_bucket.peers.size() < kademlia_max_peers_per_bucket_)
+    if (by_logarithm_.size(log_id) < kademlia_max_peers_per_bucket_)
     {
-      log_bucket.peers.insert(peerinfo);
+      by_logarithm_.Insert(log_id, peerinfo);
     }
 
-    if (ham_bucket.peers.size() < kademlia_max_peers_per_bucket_)
+    if (by_hamming_.size(hamming_id) < kademlia_max_peers_per_bucket_)
     {
-      ham_bucket.peers.insert(peerinfo);
+      by_hamming_.Insert(hamming_id, peerinfo);
     }
 
     if (peerinfo->uri.IsMuddleAddress())
@@ -507,13 +322,7 @@ KademliaTable::Uri KademliaTable::GetUri(Address const &address)
 std::size_t KademliaTable::active_buckets() const
 {
   FETCH_LOCK(peer_info_mutex_);
-
-  std::size_t ret{0};
-  for (auto &b : by_logarithm_)
-  {
-    ret += static_cast<std::size_t>(!b.peers.empty());
-  }
-  return ret;
+  return by_logarithm_.active_buckets();
 }
 
 void KademliaTable::SetCacheFile(std::string const &filename, bool load)
@@ -495,6 +495,11 @@ void Muddle::SetTrackerConfiguration(TrackerConfiguration const &config)
   peer_tracker_->SetConfiguration(config);
 }
 
+void Muddle::SetRouterConfiguration(RouterConfiguration const &config)
+{
+  router_.SetConfiguration(config);
+}
+
 /**
  * Update a map of address to confidence level
  *
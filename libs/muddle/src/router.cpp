@@ -26,6 +26,8 @@
 #include "core/serializers/base_types.hpp"
 #include "core/serializers/main_serializer.hpp"
 #include "core/service_ids.hpp"
+#include "crypto/ecdh.hpp"
+#include "crypto/ecdsa.hpp"
 #include "crypto/fnv.hpp"
 #include "crypto/secure_channel.hpp"
 #include "kademlia/peer_tracker.hpp"
@@ -298,6 +300,9 @@ Router::Router(NetworkId network_id, Address address, MuddleRegister &reg, Prove
         CreateCounter("ledger_router_foreign_packet_total", "The total number of foreign packets"))
   , fraudulent_packet_total_(CreateCounter("ledger_router_fraudulent_packet_total",
                                            "The total number of fraudulent packets"))
+  , verified_cache_hit_total_(
+        CreateCounter("ledger_router_verified_cache_hit_total",
+                      "The total number of broadcast packets already verified by this node"))
   , routing_table_updates_total_(CreateCounter("ledger_router_table_updates_total",
                                                "The total number of updates to the routing table"))
   , echo_cache_trims_total_(CreateCounter("ledger_router_echo_cache_trims_total",
@@ -318,6 +323,16 @@ Router::Router(NetworkId network_id, Address address, MuddleRegister &reg, Prove
                                             "The total number of connections dropped"))
 {}
 
+/**
+ * Update the configuration of the router
+ *
+ * @param config The new configuration
+ */
+void Router::SetConfiguration(RouterConfiguration const &config)
+{
+  config_ = config;
+}
+
 /**
  * Starts the routers internal dispatch thread pool
  */
@@ -346,7 +361,27 @@ bool Router::Genuine(PacketPtr const &p) const
 {
   bool genuine{true};
 
-  if (p->IsStamped() || p->IsBroadcast())
+  if (p->IsAuthenticated())
+  {
+    // only the target shares the key with the sender, so a relaying node could not check the
+    // packet. Senders only authenticate packets to directly connected peers, anything else
+    // arriving with a MAC is rejected rather than passed on unverified.
+    if (p->IsBroadcast() || (p->GetTargetRaw() != address_raw_))
+    {
+      genuine = false;
+    }
+    else
+    {
+      Packet::SharedKey shared_key{};
+      genuine = LookupSharedKey(p->GetSenderRaw(), shared_key) &&
+                p->VerifyAuthentication(shared_key);
+    }
+  }
+  else if (p->IsBroadcast())
+  {
+    genuine = VerifyBroadcast(*p);
+  }
+  else if (p->IsStamped())
   {
     genuine = p->Verify();
   }
@@ -354,10 +389,99 @@ bool Router::Genuine(PacketPtr const &p) const
   return genuine;
 }
 
+/**
+ * Verify the signature of a broadcast packet, consulting the cache of previously verified packets
+ *
+ * @param packet The packet to be verified
+ * @return true if the packet is genuine, otherwise false
+ */
+bool Router::VerifyBroadcast(Packet const &packet) const
+{
+  if (!packet.IsStamped())
+  {
+    return false;
+  }
+
+  auto const digest = packet.GetDigest();
+
+  {
+    FETCH_LOCK(verified_cache_lock_);
+    if (verified_cache_.find(digest) != verified_cache_.end())
+    {
+      verified_cache_hit_total_->increment();
+      return true;
+    }
+  }
+
+  if (!packet.Verify())
+  {
+    return false;
+  }
+
+  FETCH_LOCK(verified_cache_lock_);
+  verified_cache_.emplace(digest, Clock::now());
+
+  return true;
+}
+
+/**
+ * Lookup (or compute on first use) the ECDH shared key with a peer
+ *
+ * @param peer The address of the peer
+ * @param shared_key The output shared key
+ * @return true if successful, otherwise false
+ */
+bool Router::LookupSharedKey(RawAddress const &peer, Packet::SharedKey &shared_key) const
+{
+  static constexpr std::size_t MAX_SHARED_KEYS = 4096;
+
+  {
+    FETCH_LOCK(shared_keys_lock_);
+    auto it = shared_keys_.find(peer);
+    if (it != shared_keys_.end())
+    {
+      shared_key = it->second;
+      return true;
+    }
+  }
+
+  crypto::ECDSAVerifier const verifier{
+      crypto::Identity{crypto::SECP256K1_UNCOMPRESSED, ConvertAddress(peer)}};
+  if (!crypto::ComputeSharedKey(prover_, verifier, shared_key))
+  {
+    return false;
+  }
+
+  FETCH_LOCK(shared_keys_lock_);
+
+  // the keys are cheap to recompute compared to a signature, simply start over when full
+  if (shared_keys_.size() >= MAX_SHARED_KEYS)
+  {
+    shared_keys_.clear();
+  }
+  shared_keys_.emplace(peer, shared_key);
+
+  return true;
+}
+
 Router::PacketPtr const &Router::Sign(PacketPtr const &p) const
 {
   if (signing_enabled_)
   {
+    // unicast packets to a directly connected peer only need to convince that peer, which can be
+    // done with a MAC when both sides have shared key authentication enabled. Packets which are
+    // relayed keep their signature so that every hop can check them.
+    if (config_.shared_key_authentication && !p->IsBroadcast() && !p->IsDirect() && tracker_ &&
+        (LookupHandle(p->GetTargetRaw()) != 0u))
+    {
+      Packet::SharedKey shared_key{};
+      if (LookupSharedKey(p->GetTargetRaw(), shared_key))
+      {
+        p->Authenticate(shared_key);
+        return p;
+      }
+    }
+
     p->Sign(prover_);
   }
 
@@ -524,6 +648,7 @@ void Router::Broadcast(uint16_t service, uint16_t channel, Payload const &payloa
 void Router::Cleanup()
 {
   CleanEchoCache();
+  CleanVerifiedCache();
 }
 
 /**
@@ -956,6 +1081,29 @@ bool Router::IsEcho(Packet const &packet, bool register_echo)
   return is_echo;
 }
 
+/**
+ * Periodic function used to trim the cache of verified broadcasts
+ */
+void Router::CleanVerifiedCache()
+{
+  FETCH_LOCK(verified_cache_lock_);
+
+  auto const now = Clock::now();
+
+  auto it = verified_cache_.begin();
+  while (it != verified_cache_.end())
+  {
+    if ((now - it->second) > std::chrono::seconds{600})
+    {
+      it = verified_cache_.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
 /**
  * Periodic function used to trim the echo cache
  */
@@ -0,0 +1,394 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "fake_muddle_endpoint.hpp"
+
+#include "core/byte_array/byte_array.hpp"
+#include "core/byte_array/const_byte_array.hpp"
+#include "core/service_ids.hpp"
+#include "muddle/erasure_code.hpp"
+#include "muddle/erasure_coded_rbc.hpp"
+#include "muddle/network_id.hpp"
+#include "muddle/packet.hpp"
+#include "muddle/rbc.hpp"
+#include "muddle/rbc_messages.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using fetch::byte_array::ByteArray;
+using fetch::byte_array::ConstByteArray;
+using fetch::muddle::ErasureCodedRBC;
+using fetch::muddle::FragmentMerkleTree;
+using fetch::muddle::FragmentMessage;
+using fetch::muddle::FragmentMessageType;
+using fetch::muddle::NetworkId;
+using fetch::muddle::RBC;
+using fetch::muddle::RBCSerializer;
+using fetch::muddle::ReedSolomonCodec;
+
+using Address  = FakeMuddleEndpoint::Address;
+using Payload  = FakeMuddleEndpoint::Payload;
+using Messages = std::map<Address, std::vector<ConstByteArray>>;
+
+ConstByteArray CreateMessage(std::size_t length)
+{
+  std::string message(length, '\0');
+  for (std::size_t i = 0; i < length; ++i)
+  {
+    message[i] = static_cast<char>((i * 131u + 7u) & 0xFFu);
+  }
+  return message;
+}
+
+// addresses are ordered by index so that the cabinet index of a member matches its position
+Address CreateAddress(std::size_t index)
+{
+  std::string address(fetch::muddle::Packet::ADDRESS_SIZE, '\0');
+  address[0] = static_cast<char>(index);
+  return address;
+}
+
+/**
+ * Queues packets sent between endpoints so that they can be delivered outside of the sender's
+ * locks
+ */
+class LoopbackNetwork
+{
+public:
+  struct Packet
+  {
+    Address  from;
+    Address  to;
+    uint16_t service;
+    uint16_t channel;
+    Payload  payload;
+  };
+
+  void Register(FakeMuddleEndpoint &endpoint)
+  {
+    endpoints_[endpoint.GetAddress()] = &endpoint;
+  }
+
+  void Enqueue(Packet packet)
+  {
+    bytes_sent_[packet.from] += packet.payload.size();
+    queue_.emplace_back(std::move(packet));
+  }
+
+  void Run()
+  {
+    while (!queue_.empty())
+    {
+      Packet packet = queue_.front();
+      queue_.pop_front();
+
+      auto it = endpoints_.find(packet.to);
+      if (it != endpoints_.end())
+      {
+        it->second->SubmitPacket(packet.from, packet.service, packet.channel, packet.payload);
+      }
+    }
+  }
+
+  std::size_t bytes_sent(Address const &address)
+  {
+    return bytes_sent_[address];
+  }
+
+private:
+  std::deque<Packet>                      queue_;
+  std::map<Address, FakeMuddleEndpoint *> endpoints_;
+  std::map<Address, std::size_t>          bytes_sent_;
+};
+
+class LoopbackEndpoint : public FakeMuddleEndpoint
+{
+public:
+  using FakeMuddleEndpoint::Send;
+
+  LoopbackEndpoint(Address address, LoopbackNetwork &network)
+    : FakeMuddleEndpoint{std::move(address), NetworkId{"TEST"}}
+    , network_{network}
+  {
+    network_.Register(*this);
+  }
+
+  void Send(Address const &address, uint16_t service, uint16_t channel,
+            Payload const &message) override
+  {
+    network_.Enqueue({GetAddress(), address, service, channel, message});
+  }
+
+private:
+  LoopbackNetwork &network_;
+};
+
+template <typename Channel>
+class ChannelNetwork
+{
+public:
+  explicit ChannelNetwork(std::size_t size)
+  {
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      Address address{CreateAddress(i)};
+      cabinet.insert(address);
+
+      endpoints.emplace_back(std::make_unique<LoopbackEndpoint>(address, network));
+      channels.emplace_back(std::make_unique<Channel>(
+          *endpoints.back(), address,
+          [this, address](Address const &from, ConstByteArray const &payload) {
+            delivered[address][from].push_back(payload);
+          }));
+    }
+
+    for (auto &channel : channels)
+    {
+      EXPECT_TRUE(channel->ResetCabinet(cabinet));
+    }
+  }
+
+  LoopbackNetwork                                network;
+  std::set<Address>                              cabinet;
+  std::vector<std::unique_ptr<LoopbackEndpoint>> endpoints;
+  std::vector<std::unique_ptr<Channel>>          channels;
+  std::map<Address, Messages>                    delivered;
+};
+
+TEST(ErasureCodeTests, RecoversFromAnySufficientSubset)
+{
+  ReedSolomonCodec codec{3, 7};
+
+  for (std::size_t length : {0u, 1u, 5u, 64u, 1000u})
+  {
+    auto const message   = CreateMessage(length);
+    auto const fragments = codec.Encode(message);
+    ASSERT_EQ(fragments.size(), 7);
+
+    // every combination of three fragments
+    for (uint32_t mask = 0; mask < (1u << 7u); ++mask)
+    {
+      ReedSolomonCodec::FragmentMap subset{};
+      for (uint32_t i = 0; i < 7; ++i)
+      {
+        if ((mask & (1u << i)) != 0)
+        {
+          subset[i] = fragments[i];
+        }
+      }
+
+      ConstByteArray decoded{};
+      if (subset.size() < 3)
+      {
+        EXPECT_FALSE(codec.Decode(subset, decoded));
+        continue;
+      }
+
+      ASSERT_TRUE(codec.Decode(subset, decoded));
+      EXPECT_EQ(decoded, message);
+    }
+  }
+}
+
+TEST(ErasureCodeTests, RejectsInvalidParameters)
+{
+  EXPECT_THROW(ReedSolomonCodec(0, 4), std::invalid_argument);
+  EXPECT_THROW(ReedSolomonCodec(5, 4), std::invalid_argument);
+  EXPECT_THROW(ReedSolomonCodec(2, 257), std::invalid_argument);
+}
+
+TEST(ErasureCodeTests, MerkleProofsOnlyVerifyTheCommittedFragments)
+{
+  ReedSolomonCodec codec{2, 5};
+
+  auto const               fragments = codec.Encode(CreateMessage(100));
+  FragmentMerkleTree const tree{fragments};
+
+  for (std::size_t i = 0; i < fragments.size(); ++i)
+  {
+    auto const proof = tree.Prove(i);
+    EXPECT_TRUE(FragmentMerkleTree::Verify(tree.root(), i, fragments.size(), fragments[i], proof));
+
+    // wrong position or wrong contents
+    std::size_t const other = (i + 1) % fragments.size();
+    EXPECT_FALSE(
+        FragmentMerkleTree::Verify(tree.root(), other, fragments.size(), fragments[i], proof));
+    EXPECT_FALSE(
+        FragmentMerkleTree::Verify(tree.root(), i, fragments.size(), fragments[other], proof));
+    EXPECT_FALSE(FragmentMerkleTree::Verify(tree.root(), i, 9, fragments[i], proof));
+  }
+}
+
+/**
+ * Disperses a set of fragments on behalf of the first member of the cabinet, exactly as its
+ * channel would, whether or not the fragments are a valid encoding of a message
+ */
+void DisperseFragments(ChannelNetwork<ErasureCodedRBC> &network,
+                       ReedSolomonCodec::Fragments const &fragments)
+{
+  FragmentMerkleTree const tree{fragments};
+
+  FragmentMessage disperse{};
+  disperse.type    = FragmentMessageType::F_DISPERSE;
+  disperse.channel = fetch::CHANNEL_RBC_ERASURE_CODED;
+  disperse.id      = 0;
+  disperse.counter = 1;
+  disperse.root    = tree.root();
+
+  for (uint32_t index = 1; index < network.endpoints.size(); ++index)
+  {
+    disperse.index    = index;
+    disperse.fragment = fragments[index];
+    disperse.proof    = tree.Prove(index);
+
+    RBCSerializer serializer{};
+    serializer << disperse;
+
+    network.network.Enqueue({network.endpoints[0]->GetAddress(),
+                             network.endpoints[index]->GetAddress(), fetch::SERVICE_RBC,
+                             fetch::CHANNEL_RBC_ERASURE_CODED, serializer.data()});
+  }
+
+  network.network.Run();
+}
+
+TEST(ErasureCodedRBCTests, AllMembersDeliverEveryBroadcast)
+{
+  ChannelNetwork<ErasureCodedRBC> network{7};
+
+  std::map<Address, ConstByteArray> sent;
+  for (std::size_t i = 0; i < network.channels.size(); ++i)
+  {
+    auto const message = CreateMessage(200 + i);
+
+    network.channels[i]->Broadcast(message);
+    sent[network.endpoints[i]->GetAddress()] = message;
+  }
+  network.network.Run();
+
+  for (auto const &receiver : network.cabinet)
+  {
+    auto &messages = network.delivered[receiver];
+
+    // no member delivers its own broadcast
+    EXPECT_EQ(messages.size(), network.cabinet.size() - 1);
+    for (auto const &element : messages)
+    {
+      EXPECT_NE(element.first, receiver);
+      ASSERT_EQ(element.second.size(), 1);
+      EXPECT_EQ(element.second.front(), sent[element.first]);
+    }
+  }
+}
+
+TEST(ErasureCodedRBCTests, DeliversInOrderDespiteSilentMembers)
+{
+  ChannelNetwork<ErasureCodedRBC> network{4};
+
+  // a single faulty member can be tolerated in a cabinet of four
+  network.channels[3]->Enable(false);
+
+  network.channels[0]->Broadcast("first");
+  network.channels[0]->Broadcast("second");
+  network.network.Run();
+
+  for (std::size_t i = 1; i < 3; ++i)
+  {
+    auto &messages = network.delivered[network.endpoints[i]->GetAddress()];
+    auto &from_0   = messages[network.endpoints[0]->GetAddress()];
+
+    ASSERT_EQ(from_0.size(), 2);
+    EXPECT_EQ(from_0[0], "first");
+    EXPECT_EQ(from_0[1], "second");
+  }
+
+  EXPECT_TRUE(network.delivered[network.endpoints[3]->GetAddress()].empty());
+}
+
+TEST(ErasureCodedRBCTests, BroadcasterSendsLessThanTheFullMessageToEveryMember)
+{
+  std::size_t const    cabinet_size = 16;
+  ConstByteArray const message      = CreateMessage(10000);
+
+  ChannelNetwork<ErasureCodedRBC> coded{cabinet_size};
+  ChannelNetwork<RBC>             full{cabinet_size};
+
+  coded.channels[0]->Broadcast(message);
+  coded.network.Run();
+  full.channels[0]->Broadcast(message);
+  full.network.Run();
+
+  auto const &broadcaster = coded.endpoints[0]->GetAddress();
+  auto const &receiver    = coded.endpoints[1]->GetAddress();
+  ASSERT_EQ(coded.delivered[receiver].size(), 1);
+  ASSERT_EQ(full.delivered[receiver].size(), 1);
+
+  // the fragments are a sixth of the message, so even with the echo of its own fragment the
+  // broadcaster sends well under half of what the RBC does
+  EXPECT_LT(coded.network.bytes_sent(broadcaster) * 2, full.network.bytes_sent(broadcaster));
+}
+
+TEST(ErasureCodedRBCTests, FragmentsWhichDoNotReencodeToTheRootAreRejected)
+{
+  ReedSolomonCodec const codec{2, 4};
+  auto const             message = CreateMessage(100);
+
+  // the broadcaster only takes part through the fragments dispersed on its behalf
+  ChannelNetwork<ErasureCodedRBC> consistent{4};
+  consistent.channels[0]->Enable(false);
+  DisperseFragments(consistent, codec.Encode(message));
+
+  for (std::size_t i = 1; i < 4; ++i)
+  {
+    auto &from_0 = consistent.delivered[consistent.endpoints[i]->GetAddress()]
+                                       [consistent.endpoints[0]->GetAddress()];
+    ASSERT_EQ(from_0.size(), 1);
+    EXPECT_EQ(from_0.front(), message);
+  }
+
+  // every fragment carries a valid proof under the root, so all of them are echoed and every
+  // member becomes ready, but they are not an encoding of any single message
+  auto      fragments = codec.Encode(message);
+  ByteArray tampered{fragments[3].Copy()};
+  tampered[0] ^= 0xFFu;
+  fragments[3] = tampered;
+
+  ChannelNetwork<ErasureCodedRBC> inconsistent{4};
+  inconsistent.channels[0]->Enable(false);
+  DisperseFragments(inconsistent, fragments);
+
+  for (auto const &receiver : inconsistent.cabinet)
+  {
+    EXPECT_TRUE(inconsistent.delivered[receiver].empty());
+  }
+}
+
+}  // namespace
@@ -145,3 +145,26 @@ TEST_F(PacketTests, CheckIndifference)
   EXPECT_TRUE(packet_->IsStamped());
   EXPECT_TRUE(packet_->Verify());
 }
+
+TEST_F(PacketTests, CheckAuthentication)
+{
+  Packet::SharedKey const key{"a shared secret between the two peers"};
+  Packet::SharedKey const other_key{"some other secret"};
+
+  packet_->Authenticate(key);
+  EXPECT_TRUE(packet_->IsStamped());
+  EXPECT_TRUE(packet_->IsAuthenticated());
+  EXPECT_TRUE(packet_->VerifyAuthentication(key));
+  EXPECT_FALSE(packet_->VerifyAuthentication(other_key));
+  EXPECT_FALSE(packet_->Verify());
+
+  packet_->SetMessageNum(4);
+  EXPECT_FALSE(packet_->IsStamped());
+  EXPECT_FALSE(packet_->VerifyAuthentication(key));
+
+  // signing afterwards restores a regular stamp
+  packet_->Authenticate(key);
+  packet_->Sign(*prover_);
+  EXPECT_FALSE(packet_->IsAuthenticated());
+  EXPECT_TRUE(packet_->Verify());
+}
@@ -0,0 +1,215 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "crypto/sha256.hpp"
+#include "kademlia/bucket.hpp"
+#include "kademlia/peer_info.hpp"
+#include "kademlia/routing_table.hpp"
+#include "kademlia/table.hpp"
+#include "muddle/network_id.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using fetch::muddle::Bucket;
+using fetch::muddle::GetKademliaDistance;
+using fetch::muddle::KademliaAddress;
+using fetch::muddle::KademliaTable;
+using fetch::muddle::NetworkId;
+using fetch::muddle::PeerInfo;
+using fetch::muddle::RoutingTable;
+
+using Address     = RoutingTable::Address;
+using PeerInfoPtr = RoutingTable::PeerInfoPtr;
+using Peers       = RoutingTable::Peers;
+
+Address CreateAddress(uint64_t i)
+{
+  fetch::crypto::SHA256 hasher;
+  hasher.Update(reinterpret_cast<uint8_t *>(&i), sizeof(uint64_t));
+  return hasher.Final();
+}
+
+PeerInfoPtr CreatePeer(uint64_t i, bool verified)
+{
+  auto peer              = std::make_shared<PeerInfo>();
+  peer->address          = CreateAddress(i);
+  peer->kademlia_address = KademliaAddress::Create(peer->address);
+  peer->verified         = verified;
+  return peer;
+}
+
+uint64_t LogId(KademliaAddress const &own, KademliaAddress const &other)
+{
+  return Bucket::IdByLogarithm(GetKademliaDistance(own, other));
+}
+
+// Reference implementation: collect the bucket window and sort all of the candidates
+Peers FindNearestBySorting(std::vector<std::vector<PeerInfoPtr>> const &buckets,
+                           KademliaAddress const &target, uint64_t bucket_id, std::size_t count)
+{
+  std::vector<PeerInfo> candidates;
+  auto                  add = [&](uint64_t id) {
+    for (auto const &peer : buckets[id])
+    {
+      candidates.push_back(*peer);
+      candidates.back().distance = GetKademliaDistance(peer->kademlia_address, target);
+    }
+  };
+
+  add(bucket_id);
+  uint64_t left  = bucket_id;
+  uint64_t right = bucket_id;
+  bool     more  = candidates.size() < count;
+  while (more)
+  {
+    more = false;
+    if (left != 0)
+    {
+      add(--left);
+      more = candidates.size() < count;
+    }
+    if (right < RoutingTable::KADEMLIA_MAX_ID_BITS)
+    {
+      add(++right);
+      more = candidates.size() < count;
+    }
+  }
+
+  std::sort(candidates.begin(), candidates.end());
+  candidates.resize(std::min(candidates.size(), count));
+
+  return {candidates.begin(), candidates.end()};
+}
+
+TEST(RoutingTableTests, NearestPeersMatchSortingAllCandidates)
+{
+  auto const own = KademliaAddress::Create(CreateAddress(0));
+
+  RoutingTable                          table;
+  std::vector<std::vector<PeerInfoPtr>> buckets(RoutingTable::KADEMLIA_MAX_ID_BITS + 1);
+
+  for (uint64_t i = 1; i <= 500; ++i)
+  {
+    auto       peer   = CreatePeer(i, (i % 3) == 0);
+    auto const log_id = LogId(own, peer->kademlia_address);
+
+    table.Insert(log_id, peer);
+    buckets[log_id].push_back(peer);
+  }
+
+  for (uint64_t i = 1000; i < 1050; ++i)
+  {
+    auto const target = KademliaAddress::Create(CreateAddress(i));
+    auto const log_id = LogId(own, target);
+
+    for (std::size_t count : {1u, 5u, 20u, 64u})
+    {
+      auto const expected = FindNearestBySorting(buckets, target, log_id, count);
+      auto const actual   = table.FindNearest(target, log_id, count);
+
+      ASSERT_EQ(actual.size(), expected.size());
+      for (std::size_t j = 0; j < actual.size(); ++j)
+      {
+        EXPECT_EQ(actual[j].address, expected[j].address);
+        EXPECT_EQ(actual[j].verified, expected[j].verified);
+        EXPECT_EQ(actual[j].distance.size(), expected[j].distance.size());
+        EXPECT_TRUE(std::equal(actual[j].distance.begin(), actual[j].distance.end(),
+                               expected[j].distance.begin()));
+      }
+    }
+  }
+}
+
+TEST(RoutingTableTests, ErasedPeersAreNotReturned)
+{
+  RoutingTable table;
+
+  std::vector<PeerInfoPtr> peers;
+  for (uint64_t i = 0; i < 10; ++i)
+  {
+    peers.push_back(CreatePeer(i, false));
+    table.Insert(3, peers.back());
+  }
+  EXPECT_EQ(table.size(3), 10);
+  EXPECT_EQ(table.active_buckets(), 1);
+
+  EXPECT_TRUE(table.Erase(3, peers[4]->address));
+  EXPECT_FALSE(table.Erase(3, peers[4]->address));
+  EXPECT_FALSE(table.Erase(2, peers[5]->address));
+  EXPECT_EQ(table.size(3), 9);
+
+  auto const found = table.FindNearest(peers[4]->kademlia_address, 3, 20, false, false);
+  ASSERT_EQ(found.size(), 9);
+  for (auto const &peer : found)
+  {
+    EXPECT_NE(peer.address, peers[4]->address);
+  }
+
+  EXPECT_TRUE(table.FindNearest(peers[0]->kademlia_address, 161, 20).empty());
+}
+
+TEST(RoutingTableTests, VerifiedPeersAreReturnedFirst)
+{
+  RoutingTable table;
+
+  auto const target = KademliaAddress::Create(CreateAddress(100));
+  for (uint64_t i = 0; i < 20; ++i)
+  {
+    table.Insert(7, CreatePeer(i, i >= 15));
+  }
+
+  auto const found = table.FindNearest(target, 7, 8, false, false);
+  ASSERT_EQ(found.size(), 8);
+  for (std::size_t i = 0; i < found.size(); ++i)
+  {
+    EXPECT_EQ(found[i].verified, i < 5);
+  }
+}
+
+TEST(RoutingTableTests, KademliaTableReturnsClosestPeers)
+{
+  KademliaTable table{CreateAddress(0), NetworkId{"TEST"}};
+  for (uint64_t i = 1; i <= 200; ++i)
+  {
+    table.ReportLiveliness(CreateAddress(i), CreateAddress(0));
+  }
+
+  // reporting a peer twice does not duplicate it
+  table.ReportLiveliness(CreateAddress(1), CreateAddress(0));
+
+  auto const found = table.FindPeer(CreateAddress(1));
+  ASSERT_EQ(found.size(), table.kademlia_max_peers_per_bucket());
+  EXPECT_EQ(found.front().address, CreateAddress(1));
+  EXPECT_TRUE(std::is_sorted(found.begin(), found.end()));
+
+  for (std::size_t i = 1; i < found.size(); ++i)
+  {
+    EXPECT_NE(found[i].address, found[i - 1].address);
+  }
+}
+
+}  // namespace
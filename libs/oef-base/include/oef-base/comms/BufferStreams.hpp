@@ -0,0 +1,73 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "oef-base/comms/CharArrayBuffer.hpp"
+#include "oef-base/comms/ConstCharArrayBuffer.hpp"
+
+#include <google/protobuf/io/zero_copy_stream.h>
+#include <google/protobuf/message_lite.h>
+
+#include <cstdint>
+
+// Protobuf input stream handing out the ring buffer segments behind a ConstCharArrayBuffer
+// directly, so that messages are parsed without going through std::istream one byte at a
+// time. Reading starts at the current position of the buffer and ends at its size limit.
+// The position of the buffer is advanced as data is consumed.
+class ConstCharArrayInputStream : public google::protobuf::io::ZeroCopyInputStream
+{
+public:
+  explicit ConstCharArrayInputStream(ConstCharArrayBuffer &chars);
+  ConstCharArrayInputStream(const ConstCharArrayInputStream &other) = delete;
+  ConstCharArrayInputStream &operator=(const ConstCharArrayInputStream &other) = delete;
+  ~ConstCharArrayInputStream() override                                          = default;
+
+  bool    Next(const void **data, int *size) override;
+  void    BackUp(int count) override;
+  bool    Skip(int count) override;
+  int64_t ByteCount() const override;
+
+private:
+  ConstCharArrayBuffer &chars_;
+  uint32_t              start_;
+};
+
+// Protobuf output stream writing straight into the free space segments behind a
+// CharArrayBuffer. The position of the buffer is advanced as data is produced.
+class CharArrayOutputStream : public google::protobuf::io::ZeroCopyOutputStream
+{
+public:
+  explicit CharArrayOutputStream(CharArrayBuffer &chars);
+  CharArrayOutputStream(const CharArrayOutputStream &other) = delete;
+  CharArrayOutputStream &operator=(const CharArrayOutputStream &other) = delete;
+  ~CharArrayOutputStream() override                                      = default;
+
+  bool    Next(void **data, int *size) override;
+  void    BackUp(int count) override;
+  int64_t ByteCount() const override;
+
+private:
+  CharArrayBuffer &chars_;
+  int              start_;
+};
+
+// Parse the whole of the remaining data in the buffer into the message.
+bool ParseFromBuffer(google::protobuf::MessageLite &message, ConstCharArrayBuffer &chars);
+
+// Serialise a message whose size has already been computed (ByteSizeLong) into the buffer.
+void SerializeToBuffer(google::protobuf::MessageLite const &message, CharArrayBuffer &chars);
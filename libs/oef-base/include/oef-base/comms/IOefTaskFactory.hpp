@@ -18,6 +18,7 @@
 //------------------------------------------------------------------------------
 
 #include "network/fetch_asio.hpp"
+#include "oef-base/comms/BufferStreams.hpp"
 #include "oef-base/comms/ConstCharArrayBuffer.hpp"
 #include "oef-base/utils/Uri.hpp"
 
@@ -63,10 +64,9 @@ protected:
   template <class PROTO>
   void read(PROTO &proto, ConstCharArrayBuffer &chars, std::size_t expected_size)
   {
-    std::istream is(&chars);
-    auto         current = chars.RemainingData();
-    auto         result  = proto.ParseFromIstream(&is);
-    auto         eaten   = static_cast<std::size_t>(current - chars.RemainingData());
+    auto current = chars.RemainingData();
+    auto result  = ParseFromBuffer(proto, chars);
+    auto eaten   = static_cast<std::size_t>(current - chars.RemainingData());
     if (!result)
     {
       throw std::invalid_argument("Failed proto deserialisation.");
@@ -92,8 +92,7 @@ protected:
   template <class PROTO>
   void read(PROTO &proto, ConstCharArrayBuffer &chars)
   {
-    std::istream is(&chars);
-    auto         result = proto.ParseFromIstream(&is);
+    auto result = ParseFromBuffer(proto, chars);
     if (!result)
     {
       throw std::invalid_argument("Failed proto deserialisation.");
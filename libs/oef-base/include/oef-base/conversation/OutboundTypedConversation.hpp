@@ -17,11 +17,11 @@
 //
 //------------------------------------------------------------------------------
 
+#include "oef-base/comms/BufferStreams.hpp"
 #include "oef-base/conversation/OutboundConversation.hpp"
 
 #include <google/protobuf/message.h>
 
-#include <istream>
 #include <memory>
 
 class OutboundConversationWorkerTask;
@@ -49,10 +49,9 @@ public:
 
   void HandleMessage(ConstCharArrayBuffer buffer) override
   {
-    status_code    = 0;
-    auto         r = std::make_shared<PROTOCLASS>();
-    std::istream is(&buffer);
-    if (!r->ParseFromIstream(&is))
+    status_code = 0;
+    auto r      = std::make_shared<PROTOCLASS>();
+    if (!ParseFromBuffer(*r, buffer))
     {
       status_code   = 91;
       error_message = "";
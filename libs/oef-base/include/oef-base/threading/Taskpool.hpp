@@ -20,19 +20,34 @@
 #include "oef-base/threading/ExitState.hpp"
 #include "oef-base/threading/Task.hpp"
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <iostream>
-#include <list>
-#include <map>
+#include <memory>
 #include <mutex>
 #include <queue>
-#include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace fetch {
 namespace oef {
 namespace base {
 
+/* Pool of tasks executed by a set of worker threads calling run().
+ *
+ * Runnable tasks are kept in one run queue per worker. Tasks submitted from a
+ * worker thread go to the queue of that worker, other submissions are spread
+ * round robin. A worker takes tasks from the front of its own queue and, once
+ * that is empty, steals from the front of the queues of the other workers. Each
+ * queue has its own lock, and suspended and future tasks are each kept behind
+ * a separate lock, so that the common submit/run cycle never contends on a
+ * lock shared by the whole pool.
+ *
+ * The default constructed pool has a single run queue shared by all workers.
+ * Pass the number of worker threads to get one queue per worker.
+ */
 class Taskpool : public std::enable_shared_from_this<Taskpool>
 {
 public:
@@ -42,16 +57,17 @@ public:
   using Lock  = std::unique_lock<Mutex>;
 
   using TaskP          = std::shared_ptr<Task>;
-  using Tasks          = std::list<TaskP>;
+  using Tasks          = std::deque<TaskP>;
   using TaskDone       = std::pair<ExitState, TaskP>;
-  using RunningTasks   = std::map<std::size_t, TaskP>;
-  using SuspendedTasks = std::set<TaskP>;
+  using RunningTasks   = std::unordered_map<std::size_t, TaskP>;
+  using SuspendedTasks = std::unordered_set<TaskP>;
 
   using Clock        = std::chrono::system_clock;
   using Timestamp    = Clock::time_point;
   using Milliseconds = std::chrono::milliseconds;
 
   Taskpool();
+  explicit Taskpool(std::size_t num_run_queues);
   virtual ~Taskpool() = default;
 
   virtual void submit(TaskP task);
@@ -86,15 +102,40 @@ public:
 
 protected:
 private:
-  Timestamp lockless_getNextWakeTime(const Timestamp &current_time, const Milliseconds &deflt);
-  TaskP     lockless_getNextFutureWork(const Timestamp &current_time);
+  struct RunQueue
+  {
+    mutable Mutex mutex;
+    Tasks         pending;
+    RunningTasks  running;
+  };
+
+  using RunQueuePtr = std::unique_ptr<RunQueue>;
+  using RunQueues   = std::vector<RunQueuePtr>;
+
+  void  Enqueue(TaskP task, bool at_front);
+  TaskP Dequeue(std::size_t queue_idx);
+  void  WaitForWork(Timestamp const &current_time);
+
+  std::size_t QueueIndexForThread(std::size_t thread_idx) const;
+  std::size_t QueueIndexForSubmission();
+
+  TaskP lockless_getNextFutureWork(const Timestamp &current_time);
+
+  std::atomic<bool> quit_;
+
+  // runnable tasks
+  RunQueues                run_queues_;
+  std::atomic<std::size_t> pending_count_{0};
+  std::atomic<std::size_t> next_queue_{0};
+
+  // idle workers
+  Mutex                    sleep_mutex_;
+  std::condition_variable  work_available_;
+  std::atomic<std::size_t> sleeping_{0};
 
-  mutable Mutex           mutex_;
-  std::atomic<bool>       quit_;
-  std::condition_variable work_available_;
-  Tasks                   pending_tasks_;
-  RunningTasks            running_tasks_;
-  SuspendedTasks          suspended_tasks_;
+  // suspended tasks
+  mutable Mutex  suspended_mutex_;
+  SuspendedTasks suspended_tasks_;
 
   struct FutureTask
   {
@@ -112,7 +153,11 @@ private:
 
   using FutureTasks = std::priority_queue<FutureTask, std::vector<FutureTask>, FutureTaskOrdering>;
 
-  FutureTasks future_tasks_;
+  // future tasks, the due time of the earliest one is mirrored so that the
+  // workers only take the lock when there is something to be done
+  mutable Mutex           future_mutex_;
+  FutureTasks             future_tasks_;
+  std::atomic<Clock::rep> next_future_due_;
 };
 }  // namespace base
 }  // namespace oef
@@ -0,0 +1,144 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "oef-base/comms/BufferStreams.hpp"
+
+#include <google/protobuf/io/coded_stream.h>
+
+#include <algorithm>
+
+namespace {
+
+// Locate the segment holding the byte at `pos` and return the number of contiguous bytes
+// available from there, not going past `limit`.
+template <class BUFFER, class POINTER>
+std::size_t Locate(std::vector<BUFFER> const &buffers, std::size_t pos, std::size_t limit,
+                   POINTER &data)
+{
+  std::size_t segment_start = 0;
+  for (auto const &b : buffers)
+  {
+    auto const segment_size = asio::buffer_size(b);
+    if (pos < segment_start + segment_size)
+    {
+      data = asio::buffer_cast<POINTER>(b) + (pos - segment_start);
+      return std::min(segment_start + segment_size, limit) - pos;
+    }
+    segment_start += segment_size;
+  }
+  return 0;
+}
+
+}  // namespace
+
+ConstCharArrayInputStream::ConstCharArrayInputStream(ConstCharArrayBuffer &chars)
+  : chars_(chars)
+  , start_(chars.current)
+{}
+
+bool ConstCharArrayInputStream::Next(const void **data, int *size)
+{
+  if (chars_.current >= chars_.size)
+  {
+    return false;
+  }
+
+  const unsigned char *segment = nullptr;
+  auto available = Locate(chars_.buffers, chars_.current, chars_.size, segment);
+  if (available == 0)
+  {
+    return false;
+  }
+
+  *data = segment;
+  *size = static_cast<int>(available);
+  chars_.advance(available);
+  return true;
+}
+
+void ConstCharArrayInputStream::BackUp(int count)
+{
+  chars_.current -= static_cast<uint32_t>(count);
+}
+
+bool ConstCharArrayInputStream::Skip(int count)
+{
+  if (static_cast<std::size_t>(count) > static_cast<std::size_t>(chars_.RemainingData()))
+  {
+    chars_.current = chars_.size;
+    return false;
+  }
+  chars_.advance(static_cast<std::size_t>(count));
+  return true;
+}
+
+int64_t ConstCharArrayInputStream::ByteCount() const
+{
+  return static_cast<int64_t>(chars_.current) - static_cast<int64_t>(start_);
+}
+
+CharArrayOutputStream::CharArrayOutputStream(CharArrayBuffer &chars)
+  : chars_(chars)
+  , start_(chars.current)
+{}
+
+bool CharArrayOutputStream::Next(void **data, int *size)
+{
+  if (chars_.current >= chars_.size)
+  {
+    return false;
+  }
+
+  unsigned char *segment   = nullptr;
+  auto           available = Locate(chars_.buffers, static_cast<std::size_t>(chars_.current),
+                          static_cast<std::size_t>(chars_.size), segment);
+  if (available == 0)
+  {
+    return false;
+  }
+
+  *data = segment;
+  *size = static_cast<int>(available);
+  chars_.current += static_cast<int>(available);
+  return true;
+}
+
+void CharArrayOutputStream::BackUp(int count)
+{
+  chars_.current -= count;
+}
+
+int64_t CharArrayOutputStream::ByteCount() const
+{
+  return static_cast<int64_t>(chars_.current - start_);
+}
+
+bool ParseFromBuffer(google::protobuf::MessageLite &message, ConstCharArrayBuffer &chars)
+{
+  ConstCharArrayInputStream input(chars);
+  return message.ParseFromZeroCopyStream(&input);
+}
+
+void SerializeToBuffer(google::protobuf::MessageLite const &message, CharArrayBuffer &chars)
+{
+  CharArrayOutputStream output(chars);
+
+  // the coded stream hands back the unused part of the last segment when it goes out of scope
+  google::protobuf::io::CodedOutputStream coded(&output);
+  message.SerializeWithCachedSizes(&coded);
+}
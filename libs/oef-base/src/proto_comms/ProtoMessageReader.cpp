@@ -28,13 +28,10 @@ ProtoMessageReader::consumed_needed_pair ProtoMessageReader::CheckForMessage(con
 {
   // std::cout << "ProtoMessageReader::CheckForMessage" << std::endl;
 
-  std::string s;
-
   uint32_t consumed = 0;
   uint32_t needed   = 1;
 
   ConstCharArrayBuffer chars(data);
-  std::istream         is(&chars);
 
   while (true)
   {
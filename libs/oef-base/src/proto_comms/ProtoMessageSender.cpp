@@ -16,6 +16,7 @@
 //
 //------------------------------------------------------------------------------
 
+#include "oef-base/comms/BufferStreams.hpp"
 #include "oef-base/proto_comms/ProtoMessageEndpoint.hpp"
 #include "oef-base/proto_comms/ProtoMessageSender.hpp"
 
@@ -25,7 +26,6 @@ ProtoMessageSender::consumed_needed_pair ProtoMessageSender::CheckForSpace(
     const mutable_buffers &data, IMessageWriter<TXType>::TXQ &txq)
 {
   CharArrayBuffer chars(data);
-  std::ostream    os(&chars);
 
   std::size_t consumed = 0;
   while (true)
@@ -79,7 +79,7 @@ ProtoMessageSender::consumed_needed_pair ProtoMessageSender::CheckForSpace(
         break;
       }
 
-      txq.front()->SerializeToOstream(&os);
+      SerializeToBuffer(*txq.front(), chars);
       txq.pop_front();
       // std::cout << "Ready for sending! bytes=" << mesg_size << std::endl;
       // chars.diagnostic();
@@ -16,6 +16,7 @@
 //
 //------------------------------------------------------------------------------
 
+#include "oef-base/comms/BufferStreams.hpp"
 #include "oef-base/comms/Endpoint.hpp"
 #include "oef-base/monitoring/Counter.hpp"
 #include "oef-base/proto_comms/ProtoMessageEndpoint.hpp"
@@ -38,13 +39,10 @@ ProtoPathMessageReader::consumed_needed_pair ProtoPathMessageReader::CheckForMes
 {
   FETCH_LOG_INFO(LOGGING_NAME, "CheckForMessage");
 
-  std::string s;
-
   std::size_t consumed = 0;
   std::size_t needed   = 1;
 
   ConstCharArrayBuffer chars(data);
-  std::istream         is(&chars);
 
   while (true)
   {
@@ -92,8 +90,7 @@ ProtoPathMessageReader::consumed_needed_pair ProtoPathMessageReader::CheckForMes
 
     auto header_chars =
         ConstCharArrayBuffer(chars, static_cast<uint32_t>(chars.current + leader_size));
-    std::istream h_is(&header_chars);
-    if (!leader.ParseFromIstream(&h_is))
+    if (!ParseFromBuffer(leader, header_chars))
     {
       FETCH_LOG_WARN(LOGGING_NAME, "Failed to parse header!");
       throw std::invalid_argument("Proto deserialization refuses incoming invalid leader message!");
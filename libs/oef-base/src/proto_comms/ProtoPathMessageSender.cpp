@@ -16,6 +16,7 @@
 //
 //------------------------------------------------------------------------------
 
+#include "oef-base/comms/BufferStreams.hpp"
 #include "oef-base/monitoring/Counter.hpp"
 #include "oef-base/proto_comms/ProtoMessageEndpoint.hpp"
 #include "oef-base/proto_comms/ProtoPathMessageSender.hpp"
@@ -31,7 +32,6 @@ ProtoPathMessageSender::consumed_needed_pair ProtoPathMessageSender::CheckForSpa
 {
   FETCH_LOG_INFO(LOGGING_NAME, "search message tx...");
   CharArrayBuffer chars(data);
-  std::ostream    os(&chars);
 
   std::size_t consumed = 0;
   while (true)
@@ -82,8 +82,8 @@ ProtoPathMessageSender::consumed_needed_pair ProtoPathMessageSender::CheckForSpa
 
       chars.write(leader_size);
       chars.write(payload_size);
-      leader.SerializeToOstream(&os);
-      txq.front().second->SerializeToOstream(&os);
+      SerializeToBuffer(leader, chars);
+      SerializeToBuffer(*txq.front().second, chars);
 
       bytes_produced_counter += 8;
       bytes_produced_counter += leader_size;
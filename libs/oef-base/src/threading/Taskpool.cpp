@@ -23,6 +23,8 @@
 #include "oef-base/threading/Taskpool.hpp"
 
 #include <algorithm>
+#include <list>
+#include <thread>
 
 namespace fetch {
 namespace oef {
@@ -35,16 +37,50 @@ static Gauge gauge_running("mt-core.taskpool.gauge.running_tasks");
 static Gauge gauge_suspended("mt-core.taskpool.gauge.sleeping_tasks");
 static Gauge gauge_future("mt-core.taskpool.gauge.future_tasks");
 
+// resolved once, rather than looking the name up in the monitoring register for every task
+static Counter popped_for_run("mt-core.tasks.popped-for-run");
+static Counter immediate_popped_for_run("mt-core.immediate-tasks.popped-for-run");
+static Counter future_popped_for_run("mt-core.future-tasks.popped-for-run");
+static Counter stolen_for_run("mt-core.tasks.stolen-for-run");
+static Counter run_std_exception("mt-core.tasks.run.std::exception");
+static Counter run_exception("mt-core.tasks.run.exception");
+static Counter run_deferred("mt-core.tasks.run.deferred");
+static Counter run_deferred_rerun("mt-core.tasks.run.deferred.rerun");
+static Counter run_errored("mt-core.tasks.run.errored");
+static Counter run_cancelled("mt-core.tasks.run.cancelled");
+static Counter run_completed("mt-core.tasks.run.completed");
+static Counter run_rerun("mt-core.tasks.run.rerun");
+static Counter removed_runnable("mt-core.tasks.removed.runnable");
+static Counter removed_sleeping("mt-core.tasks.removed.sleeping");
+static Counter removed_notfound("mt-core.tasks.removed.notfound");
+static Counter made_runnable("mt-core.tasks.made-runnable");
+static Counter made_runnable_failed("mt-core.tasks.made-runnable.failed");
+static Counter tasks_suspended("mt-core.tasks.suspended");
+static Counter moved_to_runnable("mt-core.tasks.moved-to-runnable");
+static Counter tasks_futured("mt-core.tasks.futured");
+
+// the pool and run queue served by the current worker thread, if any
+static thread_local Taskpool const *tl_worker_pool  = nullptr;
+static thread_local std::size_t     tl_worker_queue = 0;
+
+static constexpr Taskpool::Clock::rep NO_FUTURE_TASKS =
+    Taskpool::Timestamp::max().time_since_epoch().count();
+
 Taskpool::Taskpool()
+  : Taskpool(1)
+{}
+
+Taskpool::Taskpool(std::size_t num_run_queues)
   : quit_(false)
+  , next_future_due_{NO_FUTURE_TASKS}
 {
-  Counter("mt-core.tasks.popped-for-run");
-  Counter("mt-core.tasks.run.std::exception");
-  Counter("mt-core.tasks.run.exception");
-  Counter("mt-core.tasks.run.deferred");
-  Counter("mt-core.tasks.run.errored");
-  Counter("mt-core.tasks.run.cancelled");
-  Counter("mt-core.tasks.run.completed");
+  num_run_queues = std::max<std::size_t>(num_run_queues, 1);
+
+  run_queues_.reserve(num_run_queues);
+  for (std::size_t i = 0; i < num_run_queues; ++i)
+  {
+    run_queues_.emplace_back(std::make_unique<RunQueue>());
+  }
 }
 
 void Taskpool::SetDefault()
@@ -59,60 +95,40 @@ std::weak_ptr<Taskpool> Taskpool::GetDefaultTaskpool()
 
 void Taskpool::run(std::size_t thread_idx)
 {
-  while (true)
-  {
-    if (quit_)
-    {
-      return;
-    }
+  std::size_t const queue_idx = QueueIndexForThread(thread_idx);
+  RunQueue &        own_queue = *run_queues_[queue_idx];
 
-    Timestamp now = Clock::now();
-    {
-      Lock lock(mutex_);
-      if (pending_tasks_.empty())
-      {
-        work_available_.wait_until(lock, lockless_getNextWakeTime(now, Milliseconds(100)));
-      }
-    }
+  tl_worker_pool  = this;
+  tl_worker_queue = queue_idx;
 
-    if (quit_)
-    {
-      return;
-    }
-
-    TaskP mytask;
-
-    now = Clock::now();
+  while (!quit_)
+  {
+    TaskP     mytask;
+    Timestamp now = Clock::now();
 
+    if (now.time_since_epoch().count() >= next_future_due_)
     {
-      Lock lock(mutex_);
+      Lock lock(future_mutex_);
       mytask = lockless_getNextFutureWork(now);
     }
 
     if (!mytask)
     {
-      Lock lock(mutex_);
-      if (!pending_tasks_.empty())
-      {
-        mytask        = pending_tasks_.front();
-        mytask->pool_ = nullptr;
-        pending_tasks_.pop_front();
-        Counter("mt-core.tasks.popped-for-run")++;
-        Counter("mt-core.immediate-tasks.popped-for-run")++;
-      }
+      mytask = Dequeue(queue_idx);
     }
 
     if (!mytask)
     {
+      WaitForWork(now);
       continue;
     }
 
     ExitState status;
 
     {
-      Lock lock(mutex_);
+      Lock lock(own_queue.mutex);
       mytask->SetTaskState(Task::TaskState::NOT_PENDING);
-      running_tasks_[thread_idx] = mytask;
+      own_queue.running[thread_idx] = mytask;
     }
 
     try
@@ -128,20 +144,20 @@ void Taskpool::run(std::size_t thread_idx)
     }
     catch (std::exception const &ex)
     {
-      Counter("mt-core.tasks.run.std::exception")++;
+      run_std_exception++;
       FETCH_LOG_INFO(LOGGING_NAME, "Threadpool caught:", ex.what());
       status = ERRORED;
     }
     catch (...)
     {
-      Counter("mt-core.tasks.run.exception")++;
+      run_exception++;
       FETCH_LOG_INFO(LOGGING_NAME, "Threadpool caught: other exception");
       status = ERRORED;
     }
 
     {
-      Lock lock(mutex_);
-      running_tasks_.erase(thread_idx);
+      Lock lock(own_queue.mutex);
+      own_queue.running.erase(thread_idx);
     }
 
     switch (status)
@@ -150,108 +166,119 @@ void Taskpool::run(std::size_t thread_idx)
     {
       if (mytask->GetMadeRunnableCountAndClear() == 0)
       {
-        Counter("mt-core.tasks.run.deferred")++;
+        run_deferred++;
         suspend(mytask);
       }
       else
       {
-        Counter("mt-core.tasks.run.deferred.rerun")++;
+        run_deferred_rerun++;
         submit(mytask);
       }
       break;
     }
     case ERRORED:
     {
-      Counter("mt-core.tasks.run.errored")++;
-      Lock lock(mutex_);
+      run_errored++;
       mytask->SetTaskState(Task::TaskState::DONE);
       mytask.reset();
       break;
     }
     case CANCELLED:
     {
-      Counter("mt-core.tasks.run.cancelled")++;
-      Lock lock(mutex_);
+      run_cancelled++;
       mytask->SetTaskState(Task::TaskState::DONE);
       mytask.reset();
       break;
     }
     case COMPLETE:
     {
-      Counter("mt-core.tasks.run.completed")++;
-      Lock lock(mutex_);
+      run_completed++;
       mytask->SetTaskState(Task::TaskState::DONE);
       mytask.reset();
       break;
     }
     case RERUN:
     {
-      Counter("mt-core.tasks.run.rerun")++;
+      run_rerun++;
       submit(mytask);
       break;
     }
     }
   }
+
+  tl_worker_pool = nullptr;
 }
 
 void Taskpool::remove(TaskP task)
 {
-  Lock lock(mutex_);
   task->SetTaskState(Task::TaskState::DONE);
   bool did = false;
+
+  for (auto &queue : run_queues_)
   {
-    auto iter = pending_tasks_.begin();
-    while (iter != pending_tasks_.end())
+    Lock lock(queue->mutex);
+
+    auto const end  = queue->pending.end();
+    auto const iter = std::remove(queue->pending.begin(), end, task);
+    auto const n    = static_cast<std::size_t>(std::distance(iter, end));
+
+    if (n != 0)
     {
-      if (*iter == task)
-      {
-        iter = pending_tasks_.erase(iter);
-        Counter("mt-core.tasks.removed.runnable")++;
-        did = true;
-      }
-      else
-      {
-        ++iter;
-      }
+      queue->pending.erase(iter, end);
+      pending_count_ -= n;
+      removed_runnable += n;
+      did = true;
     }
   }
+
   {
-    auto iter = suspended_tasks_.find(task);
-    if (iter != suspended_tasks_.end())
+    Lock lock(suspended_mutex_);
+    if (suspended_tasks_.erase(task) != 0)
     {
-      suspended_tasks_.erase(iter);
       did = true;
-      Counter("mt-core.tasks.removed.sleeping")++;
+      removed_sleeping++;
     }
   }
+
   if (!did)
   {
-    Counter("mt-core.tasks.removed.notfound")++;
+    removed_notfound++;
   }
 }
 
 bool Taskpool::MakeRunnable(TaskP task)
 {
-  Lock lock(mutex_);
   bool status = false;
-  auto iter   = suspended_tasks_.find(task);
-  if (iter != suspended_tasks_.end())
+
   {
-    Counter("mt-core.tasks.made-runnable")++;
-    auto t = *iter;
-    t->SetTaskState(Task::TaskState::PENDING);
-    suspended_tasks_.erase(iter);
-    pending_tasks_.push_front(t);
-    work_available_.notify_one();
-    status = true;
+    Lock lock(suspended_mutex_);
+    auto iter = suspended_tasks_.find(task);
+    if (iter != suspended_tasks_.end())
+    {
+      // marked as pending before leaving the suspended set, so that a concurrent
+      // suspend() does not put the task back to sleep
+      task->SetTaskState(Task::TaskState::PENDING);
+      suspended_tasks_.erase(iter);
+      status = true;
+    }
   }
-  else
+
+  if (status)
   {
-    Counter("mt-core.tasks.made-runnable.failed")++;
-    bool in_pending =
-        std::find(pending_tasks_.begin(), pending_tasks_.end(), task) != pending_tasks_.end();
-    bool in_running = false;
-    for (const auto &e : running_tasks_)
+    made_runnable++;
+    Enqueue(std::move(task), true);
+    return status;
+  }
+
+  made_runnable_failed++;
+  bool in_pending = false;
+  bool in_running = false;
+  for (auto const &queue : run_queues_)
+  {
+    Lock lock(queue->mutex);
+    in_pending = in_pending || (std::find(queue->pending.begin(), queue->pending.end(), task) !=
+                                queue->pending.end());
+    for (const auto &e : queue->running)
     {
       if (e.second->GetTaskId() == task->GetTaskId())
       {
@@ -259,101 +286,232 @@ bool Taskpool::MakeRunnable(TaskP task)
         break;
       }
     }
-    FETCH_LOG_WARN(LOGGING_NAME, "Task ", task->GetTaskId(),
-                   " not in suspended_tasks list! in_pending=", in_pending,
-                   ", in_running=", in_running);
   }
+  FETCH_LOG_WARN(LOGGING_NAME, "Task ", task->GetTaskId(),
+                 " not in suspended_tasks list! in_pending=", in_pending,
+                 ", in_running=", in_running);
+
   return status;
 }
 
 void Taskpool::UpdateStatus() const
 {
-  Lock lock(mutex_);
-  gauge_pending   = pending_tasks_.size();
-  gauge_running   = running_tasks_.size();
-  gauge_suspended = suspended_tasks_.size();
-  gauge_future    = future_tasks_.size();
+  std::size_t running = 0;
+  for (auto const &queue : run_queues_)
+  {
+    Lock lock(queue->mutex);
+    running += queue->running.size();
+  }
+
+  gauge_pending = pending_count_.load();
+  gauge_running = running;
+
+  {
+    Lock lock(suspended_mutex_);
+    gauge_suspended = suspended_tasks_.size();
+  }
+
+  {
+    Lock lock(future_mutex_);
+    gauge_future = future_tasks_.size();
+  }
 }
 
 void Taskpool::stop()
 {
-  Lock lock(mutex_);
   quit_ = true;
 
-  for (auto const &t : pending_tasks_)
+  Tasks pending;
+  Tasks running;
+
+  for (auto &queue : run_queues_)
+  {
+    Lock lock(queue->mutex);
+
+    for (auto const &t : queue->pending)
+    {
+      t->SetTaskState(Task::TaskState::DONE);
+      pending.push_back(t);
+    }
+    pending_count_ -= queue->pending.size();
+    queue->pending.clear();
+
+    for (auto const &kv : queue->running)
+    {
+      if (kv.second)
+      {
+        running.push_back(kv.second);
+      }
+    }
+  }
+
+  // cancelling can call back into remove(), so no run queue lock may be held
+  for (auto const &t : pending)
   {
-    t->SetTaskState(Task::TaskState::DONE);
     t->cancel();
   }
-  pending_tasks_.clear();
 
-  for (auto const &kv : running_tasks_)
+  for (auto const &t : running)
   {
-    auto t = kv.second;
-    if (t)
-    {
-      t->cancel();
-    }
+    t->cancel();
   }
 
-  work_available_.notify_all();
-  work_available_.notify_all();
+  Lock lock(sleep_mutex_);
   work_available_.notify_all();
 }
 
 void Taskpool::suspend(TaskP task)
 {
-  Counter("mt-core.tasks.suspended")++;
-  Lock lock(mutex_);
+  tasks_suspended++;
+  Lock lock(suspended_mutex_);
   if (task->GetTaskState() == Task::TaskState::PENDING)
   {
     // somebody else moved task to pending list while we were waiting for the mutex
     FETCH_LOG_INFO(LOGGING_NAME, "Task ", task->GetTaskId(), " not suspended because is pending!");
     return;
   }
-  task->SetTaskState(Task::TaskState::SUSPENDED);
+  // the pool is set first, so that whoever sees the task suspended can make it runnable again
   task->pool_ = shared_from_this();
-  suspended_tasks_.insert(task);
+  task->SetTaskState(Task::TaskState::SUSPENDED);
+  suspended_tasks_.insert(std::move(task));
 }
 
 void Taskpool::submit(TaskP task)
 {
   if (task->IsRunnable())
   {
-    Lock lock(mutex_);
-    Counter("mt-core.tasks.moved-to-runnable")++;
-    task->SetTaskState(Task::TaskState::PENDING);
-    pending_tasks_.push_back(task);
-    work_available_.notify_one();
+    moved_to_runnable++;
+    Enqueue(std::move(task), false);
   }
   else
   {
-    suspend(task);
+    suspend(std::move(task));
   }
 }
 
 void Taskpool::after(TaskP task, const Milliseconds &delay)
 {
-  Lock lock(mutex_);
+  bool earliest = false;
 
-  FutureTask ft;
-  ft.task = task;
-  ft.due  = Clock::now() + delay;
+  {
+    Lock lock(future_mutex_);
+
+    FutureTask ft;
+    ft.task = task;
+    ft.due  = Clock::now() + delay;
+
+    task->SetTaskState(Task::TaskState::NOT_PENDING);
+    future_tasks_.push(ft);
+    tasks_futured++;
 
-  task->SetTaskState(Task::TaskState::NOT_PENDING);
-  future_tasks_.push(ft);
-  Counter("mt-core.tasks.futured")++;
+    auto const due = ft.due.time_since_epoch().count();
+    if (due < next_future_due_)
+    {
+      next_future_due_ = due;
+      earliest         = true;
+    }
+  }
+
+  // sleeping workers need to recompute their wake up time
+  if (earliest && (sleeping_ != 0))
+  {
+    Lock lock(sleep_mutex_);
+    work_available_.notify_all();
+  }
 }
 
-Taskpool::Timestamp Taskpool::lockless_getNextWakeTime(const Timestamp &   current_time,
-                                                       const Milliseconds &deflt)
+void Taskpool::Enqueue(TaskP task, bool at_front)
 {
-  Timestamp result = current_time + deflt;
-  if (!future_tasks_.empty())
   {
-    result = future_tasks_.top().due;
+    RunQueue &queue = *run_queues_[QueueIndexForSubmission()];
+    Lock      lock(queue.mutex);
+
+    task->SetTaskState(Task::TaskState::PENDING);
+    if (at_front)
+    {
+      queue.pending.push_front(std::move(task));
+    }
+    else
+    {
+      queue.pending.push_back(std::move(task));
+    }
+
+    ++pending_count_;
+  }
+
+  // Both counters are sequentially consistent: either the waiting worker sees the new
+  // pending task before going to sleep or we see the worker and wake it up.
+  if (sleeping_ != 0)
+  {
+    Lock lock(sleep_mutex_);
+    work_available_.notify_one();
   }
-  return result;
+}
+
+Taskpool::TaskP Taskpool::Dequeue(std::size_t queue_idx)
+{
+  std::size_t const num_queues = run_queues_.size();
+
+  for (std::size_t i = 0; (i < num_queues) && (pending_count_ != 0); ++i)
+  {
+    RunQueue &queue = *run_queues_[(queue_idx + i) % num_queues];
+    Lock      lock(queue.mutex);
+
+    if (queue.pending.empty())
+    {
+      continue;
+    }
+
+    // work is always taken from the front, so that stolen tasks still run in submission order
+    TaskP task = std::move(queue.pending.front());
+    queue.pending.pop_front();
+
+    if (i != 0)
+    {
+      stolen_for_run++;
+    }
+
+    --pending_count_;
+    task->pool_ = nullptr;
+
+    popped_for_run++;
+    immediate_popped_for_run++;
+
+    return task;
+  }
+
+  return nullptr;
+}
+
+void Taskpool::WaitForWork(Timestamp const &current_time)
+{
+  Lock lock(sleep_mutex_);
+  ++sleeping_;
+
+  if (!quit_ && (pending_count_ == 0))
+  {
+    Timestamp wake_time = current_time + Milliseconds(100);
+    Timestamp next_due{Clock::duration{next_future_due_.load()}};
+
+    work_available_.wait_until(lock, std::min(wake_time, next_due));
+  }
+
+  --sleeping_;
+}
+
+std::size_t Taskpool::QueueIndexForThread(std::size_t thread_idx) const
+{
+  return thread_idx % run_queues_.size();
+}
+
+std::size_t Taskpool::QueueIndexForSubmission()
+{
+  if (tl_worker_pool == this)
+  {
+    return tl_worker_queue;
+  }
+
+  return next_queue_++ % run_queues_.size();
 }
 
 Taskpool::TaskP Taskpool::lockless_getNextFutureWork(const Timestamp &current_time)
@@ -368,11 +526,15 @@ Taskpool::TaskP Taskpool::lockless_getNextFutureWork(const Timestamp &current_ti
     {
       result        = r;
       result->pool_ = nullptr;
-      Counter("mt-core.tasks.popped-for-run")++;
-      Counter("mt-core.future-tasks.popped-for-run")++;
+      popped_for_run++;
+      future_popped_for_run++;
       break;
     }
   }
+
+  next_future_due_ =
+      future_tasks_.empty() ? NO_FUTURE_TASKS : future_tasks_.top().due.time_since_epoch().count();
+
   return result;
 }
 
@@ -383,39 +545,42 @@ void Taskpool::CancelTaskGroup(std::size_t group_id)
 
   std::list<TaskP> tasks;
 
+  for (auto &queue : run_queues_)
   {
-    Lock lock(mutex_);
+    Lock lock(queue->mutex);
+
+    auto iter = queue->pending.begin();
+    while (iter != queue->pending.end())
     {
-      auto iter = pending_tasks_.begin();
-      while (iter != pending_tasks_.end())
+      if ((*iter)->group_id_ == group_id)
+      {
+        (*iter)->SetTaskState(Task::TaskState::DONE);
+        tasks.push_back(*iter);
+        iter = queue->pending.erase(iter);
+        --pending_count_;
+      }
+      else
       {
-        if ((*iter)->group_id_ == group_id)
-        {
-          (*iter)->SetTaskState(Task::TaskState::DONE);
-          tasks.push_back(*iter);
-          iter = pending_tasks_.erase(iter);
-        }
-        else
-        {
-          ++iter;
-        }
+        ++iter;
       }
     }
+  }
+
+  {
+    Lock lock(suspended_mutex_);
 
+    auto iter = suspended_tasks_.begin();
+    while (iter != suspended_tasks_.end())
     {
-      auto iter = suspended_tasks_.begin();
-      while (iter != suspended_tasks_.end())
+      if ((*iter)->group_id_ == group_id)
       {
-        if ((*iter)->group_id_ == group_id)
-        {
-          (*iter)->SetTaskState(Task::TaskState::DONE);
-          tasks.push_back(*iter);
-          iter = suspended_tasks_.erase(iter);
-        }
-        else
-        {
-          ++iter;
-        }
+        (*iter)->SetTaskState(Task::TaskState::DONE);
+        tasks.push_back(*iter);
+        iter = suspended_tasks_.erase(iter);
+      }
+      else
+      {
+        ++iter;
       }
     }
   }
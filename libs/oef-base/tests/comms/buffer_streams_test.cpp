@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "oef-base/comms/BufferStreams.hpp"
+
+#include "gtest/gtest.h"
+
+#include <google/protobuf/io/coded_stream.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+TEST(BufferStreamsTest, WriteAndReadAcrossSegments)
+{
+  // a wrapped ring buffer exposes its space as two segments
+  std::vector<char>                 storage(64, 0);
+  std::vector<asio::mutable_buffer> space{asio::mutable_buffer(storage.data() + 40, 24),
+                                          asio::mutable_buffer(storage.data(), 40)};
+
+  std::string const text(30, 'x');
+
+  CharArrayBuffer out_chars(space);
+  {
+    CharArrayOutputStream                   output(out_chars);
+    google::protobuf::io::CodedOutputStream coded(&output);
+    coded.WriteVarint32(300);
+    coded.WriteString(text);
+    coded.WriteVarint64(uint64_t{1} << 40u);
+  }
+  auto const written = out_chars.current;
+  EXPECT_EQ(written, 2 + 30 + 6);
+
+  std::vector<asio::const_buffer> data{asio::const_buffer(storage.data() + 40, 24),
+                                       asio::const_buffer(storage.data(), 40)};
+  ConstCharArrayBuffer            in_chars(data);
+  ConstCharArrayBuffer            limited(in_chars, static_cast<uint32_t>(written));
+
+  uint32_t    small = 0;
+  uint64_t    large = 0;
+  std::string read_text;
+  {
+    ConstCharArrayInputStream              input(limited);
+    google::protobuf::io::CodedInputStream coded(&input);
+    EXPECT_TRUE(coded.ReadVarint32(&small));
+    EXPECT_TRUE(coded.ReadString(&read_text, 30));
+    EXPECT_TRUE(coded.ReadVarint64(&large));
+
+    uint32_t past_the_end = 0;
+    EXPECT_FALSE(coded.ReadVarint32(&past_the_end));
+  }
+
+  EXPECT_EQ(small, 300);
+  EXPECT_EQ(read_text, text);
+  EXPECT_EQ(large, uint64_t{1} << 40u);
+  EXPECT_EQ(limited.RemainingData(), 0);
+}
+
+TEST(BufferStreamsTest, BackUpAndSkipTrackThePosition)
+{
+  std::vector<char>               storage(16, 'a');
+  std::vector<asio::const_buffer> data{asio::const_buffer(storage.data(), 10),
+                                       asio::const_buffer(storage.data() + 10, 6)};
+  ConstCharArrayBuffer            chars(data);
+  chars.advance(4);
+
+  ConstCharArrayInputStream input(chars);
+
+  void const *segment = nullptr;
+  int         size    = 0;
+  ASSERT_TRUE(input.Next(&segment, &size));
+  EXPECT_EQ(segment, storage.data() + 4);
+  EXPECT_EQ(size, 6);
+
+  input.BackUp(2);
+  EXPECT_EQ(input.ByteCount(), 4);
+  EXPECT_EQ(chars.RemainingData(), 8);
+
+  EXPECT_TRUE(input.Skip(3));
+  ASSERT_TRUE(input.Next(&segment, &size));
+  EXPECT_EQ(segment, storage.data() + 11);
+  EXPECT_EQ(size, 5);
+
+  EXPECT_FALSE(input.Next(&segment, &size));
+  EXPECT_FALSE(input.Skip(1));
+  EXPECT_EQ(input.ByteCount(), 12);
+}
+
+}  // namespace
@@ -22,6 +22,13 @@
 
 #include "gtest/gtest.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 class TasksTests : public testing::Test
 {
 public:
@@ -32,16 +39,18 @@ public:
   using Task        = fetch::oef::base::Task;
   using TaskP       = Taskpool::TaskP;
 
+  static constexpr std::size_t NUM_WORKERS = 5;
+
   TaskpoolP   taskpool_;
   ThreadpoolP tasks_runners_;
 
   TasksTests()
   {
-    taskpool_      = std::make_shared<Taskpool>();
+    taskpool_      = std::make_shared<Taskpool>(NUM_WORKERS);
     tasks_runners_ = std::make_shared<Threadpool>();
     std::function<void(std::size_t thread_number)> run_tasks =
         std::bind(&Taskpool::run, taskpool_.get(), std::placeholders::_1);
-    tasks_runners_->start(5, run_tasks);
+    tasks_runners_->start(NUM_WORKERS, run_tasks);
   }
   virtual ~TasksTests()
   {
@@ -81,6 +90,39 @@ public:
   bool        operator<(LambdaTask const &other)  = delete;
 };
 
+// Counts events signalled by the tasks, so that the tests wait for the work itself rather than
+// for a fixed amount of time
+class Completion
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  void Signal()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++count_;
+    condition_.notify_all();
+  }
+
+  bool WaitFor(std::size_t count)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return condition_.wait_for(lock, std::chrono::seconds(10),
+                               [this, count]() { return count_ >= count; });
+  }
+
+  std::size_t count() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return count_;
+  }
+
+private:
+  mutable std::mutex      mutex_;
+  std::condition_variable condition_;
+  std::size_t             count_{0};
+};
+
 TEST_F(TasksTests, task_execution)
 {
   unsigned int counter = 0;
@@ -108,3 +150,112 @@ TEST_F(TasksTests, task_execution)
 
   EXPECT_EQ(counter, 5);
 }
+
+TEST_F(TasksTests, many_tasks_from_many_threads)
+{
+  static constexpr std::size_t NUM_SUBMITTERS = 4;
+  static constexpr std::size_t NUM_TASKS      = 1000;
+
+  Completion completed;
+
+  LambdaTask::Function f = [&completed]() {
+    completed.Signal();
+    return LambdaTask::ExitState::COMPLETE;
+  };
+
+  std::vector<std::thread> submitters;
+  for (std::size_t i = 0; i < NUM_SUBMITTERS; ++i)
+  {
+    submitters.emplace_back([this, &f]() {
+      for (std::size_t j = 0; j < NUM_TASKS; ++j)
+      {
+        taskpool_->submit(std::make_shared<LambdaTask>(f));
+      }
+    });
+  }
+
+  for (auto &submitter : submitters)
+  {
+    submitter.join();
+  }
+
+  EXPECT_TRUE(completed.WaitFor(NUM_SUBMITTERS * NUM_TASKS));
+  EXPECT_EQ(completed.count(), NUM_SUBMITTERS * NUM_TASKS);
+}
+
+TEST_F(TasksTests, stolen_tasks_run_in_submission_order)
+{
+  static constexpr std::size_t NUM_TASKS = 10;
+
+  // two run queues but a single worker, which has to steal everything from the second queue
+  auto pool = std::make_shared<Taskpool>(2);
+
+  std::vector<std::size_t> order;
+  Completion               completed;
+
+  for (std::size_t i = 0; i < NUM_TASKS; ++i)
+  {
+    pool->submit(std::make_shared<LambdaTask>([i, &order, &completed]() {
+      order.push_back(i);
+      completed.Signal();
+      return LambdaTask::ExitState::COMPLETE;
+    }));
+  }
+
+  Threadpool                                     runner;
+  std::function<void(std::size_t thread_number)> run_tasks =
+      std::bind(&Taskpool::run, pool.get(), std::placeholders::_1);
+  runner.start(1, run_tasks);
+
+  EXPECT_TRUE(completed.WaitFor(NUM_TASKS));
+
+  pool->stop();
+  runner.stop();
+
+  // submissions alternate between the queues: the worker drains its own queue, then the other
+  EXPECT_EQ(order, (std::vector<std::size_t>{0, 2, 4, 6, 8, 1, 3, 5, 7, 9}));
+}
+
+TEST_F(TasksTests, delayed_and_resumed_tasks)
+{
+  using Clock = Completion::Clock;
+
+  Completion        delayed_runs;
+  Completion        deferred_runs;
+  Clock::time_point delayed_run_time;
+
+  auto delayed = std::make_shared<LambdaTask>([&delayed_runs, &delayed_run_time]() {
+    delayed_run_time = Clock::now();
+    delayed_runs.Signal();
+    return LambdaTask::ExitState::COMPLETE;
+  });
+
+  auto deferred = std::make_shared<LambdaTask>([&deferred_runs]() {
+    bool const first_run = (deferred_runs.count() == 0);
+    deferred_runs.Signal();
+    return first_run ? LambdaTask::ExitState::DEFER : LambdaTask::ExitState::COMPLETE;
+  });
+
+  auto const submitted = Clock::now();
+  taskpool_->after(delayed, std::chrono::milliseconds(20));
+  taskpool_->submit(deferred);
+
+  ASSERT_TRUE(deferred_runs.WaitFor(1));
+
+  // the deferred task sleeps until it is made runnable again
+  auto const deadline = Clock::now() + std::chrono::seconds(10);
+  while ((deferred->GetTaskState() != Task::TaskState::SUSPENDED) && (Clock::now() < deadline))
+  {
+    std::this_thread::yield();
+  }
+  ASSERT_EQ(deferred->GetTaskState(), Task::TaskState::SUSPENDED);
+  EXPECT_EQ(deferred_runs.count(), 1);
+
+  EXPECT_TRUE(deferred->MakeRunnable());
+  EXPECT_TRUE(deferred_runs.WaitFor(2));
+
+  // the delayed task is not run before it is due
+  ASSERT_TRUE(delayed_runs.WaitFor(1));
+  EXPECT_GE(delayed_run_time - submitted, std::chrono::milliseconds(20));
+  EXPECT_EQ(delayed_runs.count(), 1);
+}
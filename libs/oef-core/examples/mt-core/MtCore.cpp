@@ -124,10 +124,12 @@ int MtCore::run()
   FETCH_LOG_INFO(LOGGING_NAME, "comms_thread_count: ", config_.comms_thread_count());
   FETCH_LOG_INFO(LOGGING_NAME, "tasks_thread_count: ", config_.tasks_thread_count());
 
+  auto const tasks_thread_count = std::max(config_.tasks_thread_count(), minimum_thread_count);
+
   listeners =
       std::make_shared<OefListenerSet<IOefTaskFactory<OefAgentEndpoint>, OefAgentEndpoint>>();
   core       = std::make_shared<Core>();
-  auto tasks = std::make_shared<Taskpool>();
+  auto tasks = std::make_shared<Taskpool>(tasks_thread_count);
   tasks->SetDefault();
   outbounds = std::make_shared<OutboundConversations>();
 
@@ -136,7 +138,7 @@ int MtCore::run()
       std::bind(&Taskpool::run, tasks.get(), _1);
 
   comms_runners.start(std::max(config_.comms_thread_count(), minimum_thread_count), run_comms);
-  tasks_runners.start(std::max(config_.tasks_thread_count(), minimum_thread_count), run_tasks);
+  tasks_runners.start(tasks_thread_count, run_tasks);
 
   Uri core_uri(config_.core_uri());
   Uri search_uri(config_.search_uri());
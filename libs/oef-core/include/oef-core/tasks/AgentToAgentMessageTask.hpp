@@ -24,6 +24,8 @@
 #include "oef-core/comms/OefAgentEndpoint.hpp"
 #include "oef-core/tasks-base/IMtCoreTask.hpp"
 
+#include <utility>
+
 class OefEndpoint;
 
 template <class PROTOBUF>
@@ -59,8 +61,8 @@ public:
 
     source_key_ = sourceAgent->getPublicKey();
 
-    FETCH_LOG_INFO(LOGGING_NAME, "Message to ", agent_->getPublicKey(), " from ", source_key_, ": ",
-                   message_pb_->DebugString());
+    FETCH_LOG_INFO(LOGGING_NAME, "Message to ", agent_->getPublicKey(), " from ", source_key_);
+    FETCH_LOG_DEBUG(LOGGING_NAME, "Message content: ", message_pb_->DebugString());
   }
 
   ~AgentToAgentMessageTask() override = default;
@@ -70,8 +72,9 @@ public:
     message_pb_ = std::make_shared<Message>();
     int32_t did = pb_->dialogue_id();
     message_pb_->set_answer_id(message_id);
-    message_pb_->set_source_uri(pb_->source_uri());
-    message_pb_->set_target_uri(pb_->target_uri());
+    // the incoming message is dropped once relayed, so its fields are moved rather than copied
+    message_pb_->set_source_uri(std::move(*pb_->mutable_source_uri()));
+    message_pb_->set_target_uri(std::move(*pb_->mutable_target_uri()));
     if (message_pb_->target_uri().size() == 0)
     {
       message_pb_->set_target_uri(uri.ToString());
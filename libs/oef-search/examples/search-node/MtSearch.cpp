@@ -111,8 +111,10 @@ int MtSearch::run()
   FETCH_LOG_INFO(LOGGING_NAME, "comms_thread_count: ", config_.comms_thread_count());
   FETCH_LOG_INFO(LOGGING_NAME, "tasks_thread_count: ", config_.tasks_thread_count());
 
+  auto const tasks_thread_count = std::max(config_.tasks_thread_count(), minimum_thread_count);
+
   core       = std::make_shared<Core>();
-  auto tasks = std::make_shared<Taskpool>();
+  auto tasks = std::make_shared<Taskpool>(tasks_thread_count);
   tasks->SetDefault();
   outbounds = std::make_shared<OutboundConversations>();
   listeners = std::make_shared<OefListenerSet<SearchTaskFactory, OefSearchEndpoint>>();
@@ -132,7 +134,7 @@ int MtSearch::run()
       std::bind(&Taskpool::run, tasks.get(), _1);
 
   comms_runners.start(std::max(config_.comms_thread_count(), minimum_thread_count), run_comms);
-  tasks_runners.start(std::max(config_.tasks_thread_count(), minimum_thread_count), run_tasks);
+  tasks_runners.start(tasks_thread_count, run_tasks);
 
   startListeners();
 
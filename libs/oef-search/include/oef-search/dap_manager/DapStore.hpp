@@ -25,7 +25,9 @@
 
 #include <google/protobuf/repeated_field.h>
 
-#include <functional>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <regex>
 #include <string>
 #include <unordered_map>
@@ -39,7 +41,7 @@ public:
 
   DapStore()
   {
-    SetupFilters();
+    Publish();
   }
 
   virtual ~DapStore() = default;
@@ -110,7 +112,8 @@ public:
       dap_options_[dap_name].insert(option);
     }
     ++configured_daps_;
-    if (IsDap(dap_name, "geo"))
+    auto const &options = dap_options_[dap_name];
+    if (options.find("geo") != options.end())
     {
       if (geo_dap_.empty())
       {
@@ -134,16 +137,19 @@ public:
                      "All DAPs configured, but no geo dap is provided (dap with option 'geo')! ",
                      "Location based services might not work correctly!");
     }
+    Publish();
   }
 
   std::vector<std::string> GetDapsForAttributeType(const std::string &type) const
   {
-    auto                     it = target_query_type_to_tbandfield_name_.find(type);
+    auto const               routing = Routing();
     std::vector<std::string> daps{};
-    if (it != target_query_type_to_tbandfield_name_.end())
+
+    auto it = routing->target_query_type_to_tbandfield_name.find(type);
+    if (it != routing->target_query_type_to_tbandfield_name.end())
     {
-      auto it2 = attributes_to_dapnames_.find(it->second.second);
-      if (it2 != attributes_to_dapnames_.end())
+      auto it2 = routing->by_attribute.find(it->second.second);
+      if (it2 != routing->by_attribute.end())
       {
         daps = it2->second;
       }
@@ -153,35 +159,33 @@ public:
 
   std::unordered_set<std::string> GetDapsForAttributeName(const std::string &attributeName) const
   {
+    static std::string const THEM_PREFIX = "them.";
+
+    auto const                      routing = Routing();
     std::unordered_set<std::string> dap_names_tmp_{};
 
-    std::regex them_re("^them\\.");
-    auto       attr_name_no_them = std::regex_replace(attributeName, them_re, "");
+    auto const has_them_prefix = attributeName.compare(0, THEM_PREFIX.size(), THEM_PREFIX) == 0;
+    auto const attr_name_no_them =
+        has_them_prefix ? attributeName.substr(THEM_PREFIX.size()) : attributeName;
 
-    std::vector<std::pair<std::string, std::string>> attrs = {
-        {attr_name_no_them, "always_true"},
-        {attr_name_no_them + ".update", "always_true"},
-        {attributeName + ".update", "always_true"},
-        {"them." + attributeName, "not_lazy"},
-        {"them." + attr_name_no_them, "lazy_no_res"}};
+    std::pair<std::string, DapFilter> const attrs[] = {
+        {attr_name_no_them, DapFilter::ALWAYS_TRUE},
+        {attr_name_no_them + ".update", DapFilter::ALWAYS_TRUE},
+        {attributeName + ".update", DapFilter::ALWAYS_TRUE},
+        {THEM_PREFIX + attributeName, DapFilter::NOT_LAZY},
+        {THEM_PREFIX + attr_name_no_them, DapFilter::LAZY_NO_RES}};
 
     for (const auto &attr_pair : attrs)
     {
-      for (const auto &dap : attributes_to_dapnames_)
-      {
-        if (!MatchAttributeName(dap.first, attr_pair.first))
-        {
-          continue;
-        }
-        for (const auto &dapname : dap.second)
+      routing->ForEachMatch(attr_pair.first, [&](std::vector<std::string> const &dapnames) {
+        for (const auto &dapname : dapnames)
         {
-          auto it = dap_filters_.find(attr_pair.second);
-          if (it != dap_filters_.end() && it->second(dapname, dap_names_tmp_))
+          if (Accepts(*routing, attr_pair.second, dapname, dap_names_tmp_))
           {
             dap_names_tmp_.insert(dapname);
           }
         }
-      }
+      });
     }
 
     return dap_names_tmp_;
@@ -198,7 +202,7 @@ public:
     {
       return true;
     }
-    if (attribute_pattern.front() == '/' && attribute_pattern.back() == '/')
+    if (IsPattern(attribute_pattern))
     {
       std::regex re("^" + attribute_pattern.substr(1, attribute_pattern.length() - 2) + "$");
       return std::regex_search(attribute_name, re);
@@ -212,19 +216,14 @@ public:
 
   bool IsDap(const std::string &dap_name, const std::string &attribute) const
   {
-    bool value = false;
-    auto it    = dap_options_.find(dap_name);
-    if (it != dap_options_.end())
-    {
-      value = it->second.find(attribute) != it->second.end();
-    }
-    return value;
+    return Routing()->HasOption(dap_name, attribute);
   }
 
   std::vector<std::string> GetDapNamesByOptions(std::vector<std::string> const &attributes) const
   {
+    auto const               routing = Routing();
     std::vector<std::string> daps{};
-    for (const auto &e : dap_options_)
+    for (const auto &e : routing->dap_options)
     {
       for (const auto &attr : attributes)
       {
@@ -249,8 +248,10 @@ public:
 
   void UpdateTargetFieldAndTableNames(Leaf &leaf) const
   {
-    auto it = target_query_type_to_tbandfield_name_.find(leaf.GetQueryFieldType());
-    if (it != target_query_type_to_tbandfield_name_.end())
+    auto const routing = Routing();
+
+    auto it = routing->target_query_type_to_tbandfield_name.find(leaf.GetQueryFieldType());
+    if (it != routing->target_query_type_to_tbandfield_name.end())
     {
       leaf.SetTargetTableName(it->second.first);
       leaf.SetTargetFieldName(it->second.second);
@@ -259,8 +260,10 @@ public:
 
   void UpdateTargetFieldAndTableNames(ConstructQueryConstraintObjectRequest &c) const
   {
-    auto it = target_query_type_to_tbandfield_name_.find(c.query_field_type());
-    if (it != target_query_type_to_tbandfield_name_.end())
+    auto const routing = Routing();
+
+    auto it = routing->target_query_type_to_tbandfield_name.find(c.query_field_type());
+    if (it != routing->target_query_type_to_tbandfield_name.end())
     {
       c.set_target_table_name(it->second.first);
       c.set_target_field_name(it->second.second);
@@ -284,6 +287,73 @@ public:
   }
 
 protected:
+  using DapNames = std::vector<std::string>;
+
+  enum class DapFilter
+  {
+    ALWAYS_TRUE,
+    NOT_LAZY,
+    LAZY_NO_RES
+  };
+
+  /* Read-only view of the configuration used while planning queries.
+   *
+   * The index is rebuilt whenever a DAP is configured and swapped in atomically, such that
+   * lookups never need the store mutex. Attribute names are hashed, the names given as
+   * /regex/ are compiled once at build time and "*" is kept aside as it matches everything.
+   */
+  struct RoutingIndex
+  {
+    std::unordered_map<std::string, DapNames>                        by_attribute{};
+    std::vector<std::pair<std::regex, DapNames>>                     patterns{};
+    std::unordered_map<std::string, std::unordered_set<std::string>> dap_options{};
+    std::unordered_map<std::string, std::pair<std::string, std::string>>
+        target_query_type_to_tbandfield_name{};
+
+    bool HasOption(const std::string &dap_name, const std::string &option) const
+    {
+      auto it = dap_options.find(dap_name);
+      return (it != dap_options.end()) && (it->second.find(option) != it->second.end());
+    }
+
+    template <typename Visitor>
+    void ForEachMatch(const std::string &attribute_name, Visitor &&visitor) const
+    {
+      if (attribute_name == "*")
+      {
+        for (const auto &entry : by_attribute)
+        {
+          visitor(entry.second);
+        }
+        for (const auto &pattern : patterns)
+        {
+          visitor(pattern.second);
+        }
+        return;
+      }
+
+      auto it = by_attribute.find(attribute_name);
+      if (it != by_attribute.end())
+      {
+        visitor(it->second);
+      }
+      it = by_attribute.find("*");
+      if (it != by_attribute.end())
+      {
+        visitor(it->second);
+      }
+      for (const auto &pattern : patterns)
+      {
+        if (std::regex_search(attribute_name, pattern.first))
+        {
+          visitor(pattern.second);
+        }
+      }
+    }
+  };
+
+  using RoutingIndexPtr = std::shared_ptr<RoutingIndex const>;
+
   std::unordered_map<std::string, std::vector<std::string>>        attributes_to_dapnames_{};
   std::unordered_map<std::string, std::unordered_set<std::string>> dap_options_{};
   std::vector<std::string>                                         daps_{};
@@ -297,22 +367,65 @@ protected:
                      std::shared_ptr<std::pair<std::string, DapDescription_DapFieldDescription>>>
       plane_descriptions_;
 
-  std::unordered_map<std::string, std::function<bool(const std::string &,
-                                                     const std::unordered_set<std::string> &)>>
-      dap_filters_;
+  RoutingIndexPtr routing_{};
+
+  static bool IsPattern(const std::string &attribute_pattern)
+  {
+    return (attribute_pattern.size() >= 2) && (attribute_pattern.front() == '/') &&
+           (attribute_pattern.back() == '/');
+  }
+
+  static bool Accepts(RoutingIndex const &routing, DapFilter filter, const std::string &dap,
+                      const std::unordered_set<std::string> &daps)
+  {
+    switch (filter)
+    {
+    case DapFilter::ALWAYS_TRUE:
+      return true;
+    case DapFilter::NOT_LAZY:
+      return !routing.HasOption(dap, "lazy");
+    case DapFilter::LAZY_NO_RES:
+      return daps.empty() && routing.HasOption(dap, "lazy");
+    }
+    return false;
+  }
 
-  void SetupFilters()
+  RoutingIndexPtr Routing() const
   {
-    dap_filters_["always_true"] =
-        [](const std::string &, const std::unordered_set<std::string> &) -> bool { return true; };
-    dap_filters_["not_lazy"] = [this](const std::string &dap,
-                                      const std::unordered_set<std::string> &) -> bool {
-      return !IsDap(dap, "lazy");
-    };
-    dap_filters_["lazy_no_res"] = [this](const std::string &                    dap,
-                                         const std::unordered_set<std::string> &daps) -> bool {
-      return daps.empty() && IsDap(dap, "lazy");
-    };
+    return std::atomic_load(&routing_);
+  }
+
+  // Rebuild the routing index from the current configuration, must be called with mutex_ held
+  void Publish()
+  {
+    auto routing = std::make_shared<RoutingIndex>();
+
+    for (const auto &entry : attributes_to_dapnames_)
+    {
+      if (!IsPattern(entry.first))
+      {
+        routing->by_attribute.emplace(entry);
+        continue;
+      }
+
+      try
+      {
+        routing->patterns.emplace_back(
+            std::regex("^" + entry.first.substr(1, entry.first.length() - 2) + "$",
+                       std::regex::optimize),
+            entry.second);
+      }
+      catch (std::regex_error const &ex)
+      {
+        FETCH_LOG_WARN(LOGGING_NAME, "Ignoring invalid attribute pattern ", entry.first, ": ",
+                       ex.what());
+      }
+    }
+
+    routing->dap_options                          = dap_options_;
+    routing->target_query_type_to_tbandfield_name = target_query_type_to_tbandfield_name_;
+
+    std::atomic_store(&routing_, RoutingIndexPtr{std::move(routing)});
   }
 
 private:
@@ -23,6 +23,7 @@
 #include <crypto/identity.hpp>
 
 #include <memory>
+#include <set>
 #include <string>
 
 namespace fetch {
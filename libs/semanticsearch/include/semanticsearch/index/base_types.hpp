@@ -17,8 +17,9 @@
 //
 //------------------------------------------------------------------------------
 
+#include "semanticsearch/index/compressed_index_set.hpp"
+
 #include <memory>
-#include <set>
 #include <vector>
 
 namespace fetch {
@@ -30,7 +31,7 @@ using SemanticCoordinateType = uint64_t;  ///< Base coordinate type semantic pos
 
 using SemanticPosition = std::vector<SemanticCoordinateType>;  ///< Position in semantic space.
 
-using DBIndexSet    = std::set<DBIndexType>;  ///< Set of indices used to return search results.
+using DBIndexSet    = CompressedIndexSet;  ///< Set of indices used to return search results.
 using DBIndexSetPtr = std::shared_ptr<DBIndexSet>;
 
 }  // namespace semanticsearch
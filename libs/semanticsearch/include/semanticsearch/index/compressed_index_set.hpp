@@ -0,0 +1,159 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/platform.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace fetch {
+namespace semanticsearch {
+
+/* Compressed set of 64 bit database indices.
+ *
+ * The set follows the layout of a Roaring bitmap: the index space is split
+ * into chunks of 2^16 consecutive values, keyed by the upper 48 bits of the
+ * index. Each chunk is stored in one of two containers depending on its
+ * density:
+ *
+ *   - sparse chunks (at most ARRAY_MAX_SIZE entries) are stored as a sorted
+ *     array of the lower 16 bits.
+ *   - dense chunks are stored as a fixed size bitmap of 2^16 bits.
+ *
+ * Containers are always kept in their canonical form, which makes equality
+ * checks a straight comparison and keeps set operations between dense chunks
+ * as simple word wise loops that the compiler is able to vectorise.
+ */
+class CompressedIndexSet
+{
+public:
+  using ValueType = uint64_t;
+
+  static constexpr std::size_t ARRAY_MAX_SIZE = 4096;
+  static constexpr std::size_t BITMAP_WORDS   = (1u << 16u) / 64u;
+
+  // Construction / Destruction
+  CompressedIndexSet() = default;
+  CompressedIndexSet(std::initializer_list<ValueType> values);
+  CompressedIndexSet(CompressedIndexSet const &other) = default;
+  CompressedIndexSet(CompressedIndexSet &&other)      = default;
+  ~CompressedIndexSet()                               = default;
+
+  /// @name Modification
+  /// @{
+  bool insert(ValueType value);
+  bool erase(ValueType value);
+  void clear();
+  /// @}
+
+  /// @name Queries
+  /// @{
+  bool        contains(ValueType value) const;
+  std::size_t size() const;
+  bool        empty() const;
+
+  template <typename Visitor>
+  void ForEach(Visitor &&visitor) const;
+
+  std::vector<ValueType> ToVector() const;
+  /// @}
+
+  /// @name Set operations
+  /// @{
+  CompressedIndexSet &operator&=(CompressedIndexSet const &other);
+  CompressedIndexSet &operator|=(CompressedIndexSet const &other);
+
+  CompressedIndexSet operator&(CompressedIndexSet const &other) const;
+  CompressedIndexSet operator|(CompressedIndexSet const &other) const;
+  /// @}
+
+  // Operators
+  CompressedIndexSet &operator=(CompressedIndexSet const &other) = default;
+  CompressedIndexSet &operator=(CompressedIndexSet &&other) = default;
+
+  bool operator==(CompressedIndexSet const &other) const;
+  bool operator!=(CompressedIndexSet const &other) const;
+
+private:
+  struct Container
+  {
+    uint64_t              key{0};          ///< Upper 48 bits of the indices in this chunk
+    uint32_t              cardinality{0};  ///< Number of indices in the chunk
+    std::vector<uint16_t> array{};         ///< Sorted lower bits (sparse form)
+    std::vector<uint64_t> bitmap{};        ///< Bit per lower value (dense form)
+
+    bool IsBitmap() const
+    {
+      return !bitmap.empty();
+    }
+
+    bool Contains(uint16_t low) const;
+    bool Insert(uint16_t low);
+    bool Erase(uint16_t low);
+    void Normalise();
+
+    bool operator==(Container const &other) const;
+  };
+
+  using Containers = std::vector<Container>;
+
+  static Container Intersect(Container const &a, Container const &b);
+  static Container Union(Container const &a, Container const &b);
+
+  Containers::iterator       LowerBound(uint64_t key);
+  Containers::const_iterator LowerBound(uint64_t key) const;
+
+  Containers  containers_{};
+  std::size_t size_{0};
+};
+
+template <typename Visitor>
+void CompressedIndexSet::ForEach(Visitor &&visitor) const
+{
+  for (auto const &container : containers_)
+  {
+    ValueType const base = container.key << 16u;
+
+    if (container.IsBitmap())
+    {
+      for (std::size_t i = 0; i < BITMAP_WORDS; ++i)
+      {
+        uint64_t word = container.bitmap[i];
+        while (word != 0)
+        {
+          auto const bit = platform::CountTrailingZeroes64(word);
+          visitor(base | static_cast<ValueType>((i << 6u) + bit));
+          word &= word - 1;
+        }
+      }
+    }
+    else
+    {
+      for (auto const &low : container.array)
+      {
+        visitor(base | low);
+      }
+    }
+  }
+}
+
+}  // namespace semanticsearch
+}  // namespace fetch
@@ -22,7 +22,7 @@
 #include "semanticsearch/index/semantic_subscription.hpp"
 #include "semanticsearch/index/subscription_group.hpp"
 
-#include <map>
+#include <unordered_map>
 
 namespace fetch {
 namespace semanticsearch {
@@ -92,7 +92,10 @@ namespace semanticsearch {
  *  ╱             ╱              ╱             ╱              ╱
  * ───────────────────────────────────────────────────────────   depth = 2
  *
- * The index keeps track of these subscription groups
+ * The index keeps track of these subscription groups. Groups are kept in a
+ * hash table keyed on the packed (depth, Morton code) of the group and the
+ * members of each group are stored as a compressed bitmap, such that results
+ * from several groups can be combined with set operations.
  */
 
 class InMemoryDBIndex : public DatabaseIndexInterface
@@ -104,10 +107,12 @@ public:
   std::size_t   rank() const override;
 
 private:
-  std::map<SubscriptionGroup, DBIndexSetPtr> group_content_{};
-  SemanticCoordinateType                     param_depth_start_ = 0;
-  SemanticCoordinateType                     param_depth_end_   = 20;
-  std::size_t                                rank_{0};
+  using GroupContent = std::unordered_map<SubscriptionGroup, DBIndexSetPtr>;
+
+  GroupContent           group_content_{};
+  SemanticCoordinateType param_depth_start_ = 0;
+  SemanticCoordinateType param_depth_end_   = 20;
+  std::size_t            rank_{0};
 };
 
 }  // namespace semanticsearch
@@ -19,6 +19,10 @@
 
 #include "semanticsearch/index/base_types.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
 namespace fetch {
 namespace semanticsearch {
 /*
@@ -73,6 +77,15 @@ struct SubscriptionGroup
     return SemanticCoordinateType(-1) >> depth;
   }
 
+  /*
+   * @brief packs the depth and the Morton code of the group indices into a single integer
+   *
+   * The packing is exact as long as rank * (depth + 1) <= 58. Beyond that the
+   * higher order bits of the Morton code are dropped and the key only serves
+   * as a hash.
+   */
+  uint64_t PackedKey() const;
+
   SemanticPosition       indices;
   SemanticCoordinateType depth;  ///< Parameter that determines the depth of the subscription
 
@@ -82,3 +95,20 @@ struct SubscriptionGroup
 
 }  // namespace semanticsearch
 }  // namespace fetch
+
+namespace std {
+
+template <>
+struct hash<fetch::semanticsearch::SubscriptionGroup>
+{
+  std::size_t operator()(fetch::semanticsearch::SubscriptionGroup const &group) const noexcept
+  {
+    // finalising mix from splitmix64 to spread the Morton code across the buckets
+    uint64_t x = group.PackedKey();
+    x          = (x ^ (x >> 30u)) * 0xbf58476d1ce4e5b9ull;
+    x          = (x ^ (x >> 27u)) * 0x94d049bb133111ebull;
+    return static_cast<std::size_t>(x ^ (x >> 31u));
+  }
+};
+
+}  // namespace std
@@ -171,6 +171,12 @@ public:
     return functions_.find(name) != functions_.end();
   }
 
+  BuiltinQueryFunction *FindFunction(std::string const &name)
+  {
+    auto it = functions_.find(name);
+    return (it == functions_.end()) ? nullptr : it->second.get();
+  }
+
   SharedAdvertisementRegister advertisement_register() const
   {
     return advertisement_register_;
@@ -33,7 +33,7 @@ public:
   using Index            = uint64_t;
   using VocabularySchema = std::shared_ptr<PropertiesToSubspace>;
   using AgentId          = uint64_t;
-  using AgentIdSet       = std::shared_ptr<std::set<AgentId>>;
+  using AgentIdSet       = DBIndexSetPtr;
 
   explicit VocabularyAdvertisement(VocabularySchema vocabulary_schema)
     : vocabulary_schema_(std::move(vocabulary_schema))
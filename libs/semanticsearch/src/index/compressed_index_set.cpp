@@ -0,0 +1,453 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "semanticsearch/index/compressed_index_set.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace fetch {
+namespace semanticsearch {
+namespace {
+
+constexpr uint64_t HighBits(uint64_t value)
+{
+  return value >> 16u;
+}
+
+constexpr uint16_t LowBits(uint64_t value)
+{
+  return static_cast<uint16_t>(value & 0xFFFFu);
+}
+
+uint32_t CountBits(std::vector<uint64_t> const &bitmap)
+{
+  uint64_t count = 0;
+  for (auto const &word : bitmap)
+  {
+    count += platform::CountSetBits(word);
+  }
+
+  return static_cast<uint32_t>(count);
+}
+
+}  // namespace
+
+constexpr std::size_t CompressedIndexSet::ARRAY_MAX_SIZE;
+constexpr std::size_t CompressedIndexSet::BITMAP_WORDS;
+
+CompressedIndexSet::CompressedIndexSet(std::initializer_list<ValueType> values)
+{
+  for (auto const &value : values)
+  {
+    insert(value);
+  }
+}
+
+bool CompressedIndexSet::Container::Contains(uint16_t low) const
+{
+  if (IsBitmap())
+  {
+    return ((bitmap[low >> 6u] >> (low & 63u)) & 1u) != 0;
+  }
+
+  return std::binary_search(array.begin(), array.end(), low);
+}
+
+bool CompressedIndexSet::Container::Insert(uint16_t low)
+{
+  if (IsBitmap())
+  {
+    uint64_t &     word = bitmap[low >> 6u];
+    uint64_t const mask = uint64_t{1} << (low & 63u);
+
+    if ((word & mask) != 0)
+    {
+      return false;
+    }
+
+    word |= mask;
+    ++cardinality;
+    return true;
+  }
+
+  auto it = std::lower_bound(array.begin(), array.end(), low);
+  if ((it != array.end()) && (*it == low))
+  {
+    return false;
+  }
+
+  array.insert(it, low);
+  ++cardinality;
+  Normalise();
+
+  return true;
+}
+
+bool CompressedIndexSet::Container::Erase(uint16_t low)
+{
+  if (IsBitmap())
+  {
+    uint64_t &     word = bitmap[low >> 6u];
+    uint64_t const mask = uint64_t{1} << (low & 63u);
+
+    if ((word & mask) == 0)
+    {
+      return false;
+    }
+
+    word &= ~mask;
+    --cardinality;
+    Normalise();
+    return true;
+  }
+
+  auto it = std::lower_bound(array.begin(), array.end(), low);
+  if ((it == array.end()) || (*it != low))
+  {
+    return false;
+  }
+
+  array.erase(it);
+  --cardinality;
+
+  return true;
+}
+
+/**
+ * Converts the container into its canonical representation: an array when
+ * the chunk holds at most ARRAY_MAX_SIZE entries, a bitmap otherwise.
+ */
+void CompressedIndexSet::Container::Normalise()
+{
+  if (IsBitmap() && (cardinality <= ARRAY_MAX_SIZE))
+  {
+    array.clear();
+    array.reserve(cardinality);
+
+    for (std::size_t i = 0; i < BITMAP_WORDS; ++i)
+    {
+      uint64_t word = bitmap[i];
+      while (word != 0)
+      {
+        auto const bit = platform::CountTrailingZeroes64(word);
+        array.push_back(static_cast<uint16_t>((i << 6u) + bit));
+        word &= word - 1;
+      }
+    }
+
+    std::vector<uint64_t>{}.swap(bitmap);
+  }
+  else if (!IsBitmap() && (cardinality > ARRAY_MAX_SIZE))
+  {
+    bitmap.assign(BITMAP_WORDS, 0);
+
+    for (auto const &low : array)
+    {
+      bitmap[low >> 6u] |= uint64_t{1} << (low & 63u);
+    }
+
+    std::vector<uint16_t>{}.swap(array);
+  }
+}
+
+bool CompressedIndexSet::Container::operator==(Container const &other) const
+{
+  return (key == other.key) && (cardinality == other.cardinality) && (array == other.array) &&
+         (bitmap == other.bitmap);
+}
+
+CompressedIndexSet::Container CompressedIndexSet::Intersect(Container const &a, Container const &b)
+{
+  Container result;
+  result.key = a.key;
+
+  if (a.IsBitmap() && b.IsBitmap())
+  {
+    result.bitmap.resize(BITMAP_WORDS);
+
+    uint64_t const *x   = a.bitmap.data();
+    uint64_t const *y   = b.bitmap.data();
+    uint64_t *      out = result.bitmap.data();
+
+    for (std::size_t i = 0; i < BITMAP_WORDS; ++i)
+    {
+      out[i] = x[i] & y[i];
+    }
+
+    result.cardinality = CountBits(result.bitmap);
+  }
+  else if (a.IsBitmap() || b.IsBitmap())
+  {
+    Container const &sparse = a.IsBitmap() ? b : a;
+    Container const &dense  = a.IsBitmap() ? a : b;
+
+    result.array.reserve(sparse.array.size());
+    std::copy_if(sparse.array.begin(), sparse.array.end(), std::back_inserter(result.array),
+                 [&dense](uint16_t low) { return dense.Contains(low); });
+
+    result.cardinality = static_cast<uint32_t>(result.array.size());
+  }
+  else
+  {
+    result.array.reserve(std::min(a.array.size(), b.array.size()));
+    std::set_intersection(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(),
+                          std::back_inserter(result.array));
+
+    result.cardinality = static_cast<uint32_t>(result.array.size());
+  }
+
+  result.Normalise();
+
+  return result;
+}
+
+CompressedIndexSet::Container CompressedIndexSet::Union(Container const &a, Container const &b)
+{
+  Container result;
+  result.key = a.key;
+
+  if (a.IsBitmap() && b.IsBitmap())
+  {
+    result.bitmap.resize(BITMAP_WORDS);
+
+    uint64_t const *x   = a.bitmap.data();
+    uint64_t const *y   = b.bitmap.data();
+    uint64_t *      out = result.bitmap.data();
+
+    for (std::size_t i = 0; i < BITMAP_WORDS; ++i)
+    {
+      out[i] = x[i] | y[i];
+    }
+
+    result.cardinality = CountBits(result.bitmap);
+  }
+  else if (a.IsBitmap() || b.IsBitmap())
+  {
+    Container const &sparse = a.IsBitmap() ? b : a;
+    Container const &dense  = a.IsBitmap() ? a : b;
+
+    result.bitmap = dense.bitmap;
+    for (auto const &low : sparse.array)
+    {
+      result.bitmap[low >> 6u] |= uint64_t{1} << (low & 63u);
+    }
+
+    result.cardinality = CountBits(result.bitmap);
+  }
+  else
+  {
+    result.array.reserve(a.array.size() + b.array.size());
+    std::set_union(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(),
+                   std::back_inserter(result.array));
+
+    result.cardinality = static_cast<uint32_t>(result.array.size());
+  }
+
+  result.Normalise();
+
+  return result;
+}
+
+CompressedIndexSet::Containers::iterator CompressedIndexSet::LowerBound(uint64_t key)
+{
+  return std::lower_bound(containers_.begin(), containers_.end(), key,
+                          [](Container const &c, uint64_t k) { return c.key < k; });
+}
+
+CompressedIndexSet::Containers::const_iterator CompressedIndexSet::LowerBound(uint64_t key) const
+{
+  return std::lower_bound(containers_.begin(), containers_.end(), key,
+                          [](Container const &c, uint64_t k) { return c.key < k; });
+}
+
+bool CompressedIndexSet::insert(ValueType value)
+{
+  uint64_t const key = HighBits(value);
+
+  auto it = LowerBound(key);
+  if ((it == containers_.end()) || (it->key != key))
+  {
+    Container container;
+    container.key = key;
+    it            = containers_.insert(it, std::move(container));
+  }
+
+  bool const inserted = it->Insert(LowBits(value));
+  if (inserted)
+  {
+    ++size_;
+  }
+
+  return inserted;
+}
+
+bool CompressedIndexSet::erase(ValueType value)
+{
+  uint64_t const key = HighBits(value);
+
+  auto it = LowerBound(key);
+  if ((it == containers_.end()) || (it->key != key))
+  {
+    return false;
+  }
+
+  bool const erased = it->Erase(LowBits(value));
+  if (erased)
+  {
+    --size_;
+
+    if (it->cardinality == 0)
+    {
+      containers_.erase(it);
+    }
+  }
+
+  return erased;
+}
+
+void CompressedIndexSet::clear()
+{
+  containers_.clear();
+  size_ = 0;
+}
+
+bool CompressedIndexSet::contains(ValueType value) const
+{
+  uint64_t const key = HighBits(value);
+
+  auto it = LowerBound(key);
+  if ((it == containers_.end()) || (it->key != key))
+  {
+    return false;
+  }
+
+  return it->Contains(LowBits(value));
+}
+
+std::size_t CompressedIndexSet::size() const
+{
+  return size_;
+}
+
+bool CompressedIndexSet::empty() const
+{
+  return size_ == 0;
+}
+
+std::vector<CompressedIndexSet::ValueType> CompressedIndexSet::ToVector() const
+{
+  std::vector<ValueType> values;
+  values.reserve(size_);
+
+  ForEach([&values](ValueType value) { values.push_back(value); });
+
+  return values;
+}
+
+CompressedIndexSet &CompressedIndexSet::operator&=(CompressedIndexSet const &other)
+{
+  *this = *this & other;
+  return *this;
+}
+
+CompressedIndexSet &CompressedIndexSet::operator|=(CompressedIndexSet const &other)
+{
+  *this = *this | other;
+  return *this;
+}
+
+CompressedIndexSet CompressedIndexSet::operator&(CompressedIndexSet const &other) const
+{
+  CompressedIndexSet result;
+
+  auto a = containers_.begin();
+  auto b = other.containers_.begin();
+
+  while ((a != containers_.end()) && (b != other.containers_.end()))
+  {
+    if (a->key < b->key)
+    {
+      ++a;
+    }
+    else if (b->key < a->key)
+    {
+      ++b;
+    }
+    else
+    {
+      auto container = Intersect(*a, *b);
+      if (container.cardinality != 0)
+      {
+        result.size_ += container.cardinality;
+        result.containers_.push_back(std::move(container));
+      }
+
+      ++a;
+      ++b;
+    }
+  }
+
+  return result;
+}
+
+CompressedIndexSet CompressedIndexSet::operator|(CompressedIndexSet const &other) const
+{
+  CompressedIndexSet result;
+  result.containers_.reserve(containers_.size() + other.containers_.size());
+
+  auto a = containers_.begin();
+  auto b = other.containers_.begin();
+
+  while ((a != containers_.end()) || (b != other.containers_.end()))
+  {
+    if ((b == other.containers_.end()) || ((a != containers_.end()) && (a->key < b->key)))
+    {
+      result.containers_.push_back(*a);
+      ++a;
+    }
+    else if ((a == containers_.end()) || (b->key < a->key))
+    {
+      result.containers_.push_back(*b);
+      ++b;
+    }
+    else
+    {
+      result.containers_.push_back(Union(*a, *b));
+      ++a;
+      ++b;
+    }
+
+    result.size_ += result.containers_.back().cardinality;
+  }
+
+  return result;
+}
+
+bool CompressedIndexSet::operator==(CompressedIndexSet const &other) const
+{
+  return (size_ == other.size_) && (containers_ == other.containers_);
+}
+
+bool CompressedIndexSet::operator!=(CompressedIndexSet const &other) const
+{
+  return !(*this == other);
+}
+
+}  // namespace semanticsearch
+}  // namespace fetch
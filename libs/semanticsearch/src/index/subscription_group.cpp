@@ -33,6 +33,27 @@ SubscriptionGroup::SubscriptionGroup(SemanticCoordinateType d, SemanticPosition
   }
 }
 
+uint64_t SubscriptionGroup::PackedKey() const
+{
+  static constexpr uint64_t DEPTH_BITS  = 6;
+  static constexpr uint64_t MORTON_BITS = 64 - DEPTH_BITS;
+
+  uint64_t morton = 0;
+  uint64_t offset = 0;
+
+  // Interleaving the bits of each of the indices, starting from the least
+  // significant bits as these are the ones that distinguish neighbouring groups.
+  for (uint64_t bit = 0; (bit <= depth) && (bit < 64) && (offset < MORTON_BITS); ++bit)
+  {
+    for (std::size_t i = 0; (i < indices.size()) && (offset < MORTON_BITS); ++i, ++offset)
+    {
+      morton |= ((indices[i] >> bit) & 1u) << offset;
+    }
+  }
+
+  return (morton << DEPTH_BITS) | (depth & ((1u << DEPTH_BITS) - 1u));
+}
+
 bool SubscriptionGroup::operator<(SubscriptionGroup const &other) const
 {
   if (indices.size() != other.indices.size())
@@ -471,14 +471,15 @@ void QueryExecutor::ExecuteDefine(CompiledStatement const &stmt)
       }
       auto function_name = static_cast<std::string>(stack_[n]->As<Token>());
 
-      if (!semantic_search_module_->HasFunction(function_name))
+      auto *function_ptr = semantic_search_module_->FindFunction(function_name);
+      if (function_ptr == nullptr)
       {
         error_tracker_.RaiseRuntimeError("Function '" + function_name + "' does not exist.",
                                          stack_[n]->token());
         return;
       }
 
-      auto &          function = (*semantic_search_module_)[function_name];
+      auto &          function = *function_ptr;
       std::type_index ret_type = function.return_type();
 
       if (!function.ValidateSignature(ret_type, arg_signature))
@@ -0,0 +1,138 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "semanticsearch/index/compressed_index_set.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace fetch::semanticsearch;
+
+namespace {
+
+using Values = std::vector<CompressedIndexSet::ValueType>;
+
+Values ToValues(std::set<CompressedIndexSet::ValueType> const &values)
+{
+  return Values(values.begin(), values.end());
+}
+
+TEST(CompressedIndexSetTests, InsertEraseAndContains)
+{
+  CompressedIndexSet set;
+  EXPECT_TRUE(set.empty());
+
+  EXPECT_TRUE(set.insert(3));
+  EXPECT_TRUE(set.insert(1));
+  EXPECT_TRUE(set.insert(uint64_t{1} << 40u));
+  EXPECT_FALSE(set.insert(3));
+
+  EXPECT_EQ(set.size(), 3);
+  EXPECT_TRUE(set.contains(1));
+  EXPECT_TRUE(set.contains(uint64_t{1} << 40u));
+  EXPECT_FALSE(set.contains(2));
+  EXPECT_EQ(set.ToVector(), Values({1, 3, uint64_t{1} << 40u}));
+
+  EXPECT_TRUE(set.erase(1));
+  EXPECT_FALSE(set.erase(1));
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_EQ(set, CompressedIndexSet({3, uint64_t{1} << 40u}));
+}
+
+TEST(CompressedIndexSetTests, DenseChunksRoundTrip)
+{
+  CompressedIndexSet set;
+
+  // fill a chunk past the array limit so that it is converted into a bitmap
+  for (uint64_t i = 0; i < 10000; ++i)
+  {
+    set.insert(i * 3);
+  }
+
+  EXPECT_EQ(set.size(), 10000);
+  EXPECT_TRUE(set.contains(2997));
+  EXPECT_FALSE(set.contains(2998));
+
+  // and back into an array again
+  for (uint64_t i = 0; i < 10000; ++i)
+  {
+    if (i % 4 != 0)
+    {
+      set.erase(i * 3);
+    }
+  }
+
+  CompressedIndexSet expected;
+  for (uint64_t i = 0; i < 10000; i += 4)
+  {
+    expected.insert(i * 3);
+  }
+
+  EXPECT_EQ(set.size(), 2500);
+  EXPECT_EQ(set, expected);
+}
+
+TEST(CompressedIndexSetTests, SetOperationsMatchStdSet)
+{
+  std::mt19937_64 rng{42};
+
+  // mix of sparse and dense chunks on both sides
+  for (uint64_t density : {64u, 6000u, 30000u})
+  {
+    std::set<uint64_t> a_ref;
+    std::set<uint64_t> b_ref;
+    CompressedIndexSet a;
+    CompressedIndexSet b;
+
+    for (uint64_t i = 0; i < density; ++i)
+    {
+      uint64_t const x = rng() % (3u << 16u);
+      uint64_t const y = rng() % (3u << 16u);
+
+      a_ref.insert(x);
+      b_ref.insert(y);
+      a.insert(x);
+      b.insert(y);
+    }
+
+    std::set<uint64_t> intersection;
+    std::set<uint64_t> join;
+    std::set_intersection(a_ref.begin(), a_ref.end(), b_ref.begin(), b_ref.end(),
+                          std::inserter(intersection, intersection.begin()));
+    std::set_union(a_ref.begin(), a_ref.end(), b_ref.begin(), b_ref.end(),
+                   std::inserter(join, join.begin()));
+
+    auto const a_and_b = a & b;
+    auto const a_or_b  = a | b;
+
+    EXPECT_EQ(a_and_b.size(), intersection.size());
+    EXPECT_EQ(a_and_b.ToVector(), ToValues(intersection));
+    EXPECT_EQ(a_or_b.size(), join.size());
+    EXPECT_EQ(a_or_b.ToVector(), ToValues(join));
+
+    a &= b;
+    EXPECT_EQ(a, a_and_b);
+  }
+}
+
+}  // namespace
@@ -41,32 +41,32 @@ TEST(SemanticSearchIndex, BasicOperations1D)
   auto group1 = database_index.Find(1, {width * 4});
   EXPECT_NE(group1, nullptr);
   EXPECT_EQ(group1->size(), 8);
-  EXPECT_EQ(*group1, std::set<DBIndexType>({0, 1, 2, 3, 4, 5, 6, 7}));
+  EXPECT_EQ(*group1, DBIndexSet({0, 1, 2, 3, 4, 5, 6, 7}));
 
   auto group2 = database_index.Find(1, {width * 12});
   EXPECT_NE(group2, nullptr);
   EXPECT_EQ(group2->size(), 8);
-  EXPECT_EQ(*group2, std::set<DBIndexType>({8, 9, 10, 11, 12, 13, 14, 15}));
+  EXPECT_EQ(*group2, DBIndexSet({8, 9, 10, 11, 12, 13, 14, 15}));
 
   auto group11 = database_index.Find(2, {width * 2});
   EXPECT_NE(group11, nullptr);
   EXPECT_EQ(group11->size(), 4);
-  EXPECT_EQ(*group11, std::set<DBIndexType>({0, 1, 2, 3}));
+  EXPECT_EQ(*group11, DBIndexSet({0, 1, 2, 3}));
 
   auto group12 = database_index.Find(2, {width * 6});
   EXPECT_NE(group12, nullptr);
   EXPECT_EQ(group12->size(), 4);
-  EXPECT_EQ(*group12, std::set<DBIndexType>({4, 5, 6, 7}));
+  EXPECT_EQ(*group12, DBIndexSet({4, 5, 6, 7}));
 
   auto group21 = database_index.Find(2, {width * 10});
   EXPECT_NE(group21, nullptr);
   EXPECT_EQ(group21->size(), 4);
-  EXPECT_EQ(*group21, std::set<DBIndexType>({8, 9, 10, 11}));
+  EXPECT_EQ(*group21, DBIndexSet({8, 9, 10, 11}));
 
   auto group22 = database_index.Find(2, {width * 14});
   EXPECT_NE(group22, nullptr);
   EXPECT_EQ(group22->size(), 4);
-  EXPECT_EQ(*group22, std::set<DBIndexType>({12, 13, 14, 15}));
+  EXPECT_EQ(*group22, DBIndexSet({12, 13, 14, 15}));
 }
 
 TEST(SemanticSearchIndex, BasicOperations2D)
@@ -101,25 +101,25 @@ TEST(SemanticSearchIndex, BasicOperations2D)
   auto group0 = database_index.Find(0, {width * 2, width * 2});
   EXPECT_NE(group0, nullptr);
   EXPECT_EQ(group0->size(), 16);
-  EXPECT_EQ(*group0, std::set<DBIndexType>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}));
+  EXPECT_EQ(*group0, DBIndexSet({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}));
 
   auto group1 = database_index.Find(1, {width, width});
   EXPECT_NE(group1, nullptr);
   EXPECT_EQ(group1->size(), 4);
-  EXPECT_EQ(*group1, std::set<DBIndexType>({0, 1, 4, 5}));
+  EXPECT_EQ(*group1, DBIndexSet({0, 1, 4, 5}));
 
   auto group2 = database_index.Find(1, {width, 3 * width});
   EXPECT_NE(group2, nullptr);
   EXPECT_EQ(group2->size(), 4);
-  EXPECT_EQ(*group2, std::set<DBIndexType>({2, 3, 6, 7}));
+  EXPECT_EQ(*group2, DBIndexSet({2, 3, 6, 7}));
 
   auto group3 = database_index.Find(1, {3 * width, width});
   EXPECT_NE(group3, nullptr);
   EXPECT_EQ(group3->size(), 4);
-  EXPECT_EQ(*group3, std::set<DBIndexType>({8, 9, 12, 13}));
+  EXPECT_EQ(*group3, DBIndexSet({8, 9, 12, 13}));
 
   auto group4 = database_index.Find(1, {3 * width, 3 * width});
   EXPECT_NE(group4, nullptr);
   EXPECT_EQ(group4->size(), 4);
-  EXPECT_EQ(*group4, std::set<DBIndexType>({10, 11, 14, 15}));
+  EXPECT_EQ(*group4, DBIndexSet({10, 11, 14, 15}));
 }
@@ -19,15 +19,20 @@
 
 #include "core/byte_array/byte_array.hpp"
 #include "core/mutex.hpp"
+#include "crypto/hash.hpp"
 #include "network/service/protocol.hpp"
 #include "storage/document.hpp"
 #include "storage/file_object.hpp"
 #include "storage/key_value_index.hpp"
 #include "storage/resource_mapper.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 #include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace fetch {
 namespace storage {
@@ -60,8 +65,13 @@ public:
 
   using ByteArray = byte_array::ByteArray;
 
+  using WriteBatch = std::vector<std::pair<ResourceID, byte_array::ConstByteArray>>;
+
   static constexpr char const *LOGGING_NAME = "DocumentStore";
 
+  /// The minimum number of documents given to each thread when hashing a write batch
+  static constexpr std::size_t MIN_DOCUMENTS_PER_HASH_THREAD = 256;
+
   DocumentStore()                         = default;
   DocumentStore(DocumentStore const &rhs) = delete;
   DocumentStore(DocumentStore &&rhs)      = delete;
@@ -157,6 +167,50 @@ public:
     key_index_.Flush();
   }
 
+  /**
+   * Apply a batch of updates with a single flush of the documents and the key index
+   *
+   * Updates are applied in order, so the last value given for a key is the one stored.
+   *
+   * @param batch The key value pairs to be written
+   */
+  void SetBatch(WriteBatch const &batch)
+  {
+    if (batch.empty())
+    {
+      return;
+    }
+
+    // the hash of a document is the hash of its contents, so it can be computed up front
+    auto const hashes = HashDocuments(batch);
+
+    FETCH_LOCK(mutex_);
+
+    for (std::size_t i = 0; i < batch.size(); ++i)
+    {
+      byte_array::ConstByteArray const &address = batch[i].first.id();
+      byte_array::ConstByteArray const &value   = batch[i].second;
+      IndexType                         index   = 0;
+
+      if (key_index_.GetIfExists(address, index))
+      {
+        file_object_.SeekFile(index);
+      }
+      else
+      {
+        file_object_.CreateNewFile(value.size());
+      }
+
+      file_object_.Resize(value.size());
+      file_object_.Write(value);
+
+      key_index_.Set(address, file_object_.id(), hashes[i]);
+    }
+
+    file_object_.Flush();
+    key_index_.Flush();
+  }
+
   void Erase(ResourceID const &rid)
   {
     byte_array::ConstByteArray const &address = rid.id();
@@ -340,6 +394,48 @@ public:
   }
 
 protected:
+  static std::vector<HashType> HashDocuments(WriteBatch const &batch)
+  {
+    using Hasher = typename FileObjectType::HasherType;
+
+    std::vector<HashType> hashes(batch.size());
+
+    auto const hash_range = [&batch, &hashes](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        hashes[i] = crypto::Hash<Hasher>(batch[i].second);
+      }
+    };
+
+    std::size_t const num_threads =
+        std::min<std::size_t>(std::thread::hardware_concurrency(),
+                              batch.size() / MIN_DOCUMENTS_PER_HASH_THREAD);
+
+    if (num_threads <= 1)
+    {
+      hash_range(0, batch.size());
+      return hashes;
+    }
+
+    std::size_t const chunk = (batch.size() + num_threads - 1) / num_threads;
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads - 1);
+    for (std::size_t begin = chunk; begin < batch.size(); begin += chunk)
+    {
+      threads.emplace_back(hash_range, begin, std::min(begin + chunk, batch.size()));
+    }
+
+    hash_range(0, chunk);
+
+    for (auto &thread : threads)
+    {
+      thread.join();
+    }
+
+    return hashes;
+  }
+
   Mutex             mutex_;
   KeyValueIndexType key_index_;
   FileObjectType    file_object_;
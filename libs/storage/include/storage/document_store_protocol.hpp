@@ -57,6 +57,7 @@ public:
     CURRENT_HASH,
     HASH_EXISTS,
     RESET,
+    SET_BATCH,
 
     LOCK = 20,
     UNLOCK,
@@ -69,6 +70,8 @@ public:
     , get_create_count_(
           CreateCounter(lane, "ledger_statedb_get_create_total", "The total no. get/create ops"))
     , set_count_(CreateCounter(lane, "ledger_statedb_set_total", "The total no. set ops"))
+    , set_batch_count_(
+          CreateCounter(lane, "ledger_statedb_set_batch_total", "The total no. set batch ops"))
     , commit_count_(CreateCounter(lane, "ledger_statedb_commit_total", "The total no. commit ops"))
     , revert_count_(CreateCounter(lane, "ledger_statedb_revert_total", "The total no. revert ops"))
     , current_hash_count_(CreateCounter(lane, "ledger_statedb_current_hash_total",
@@ -84,6 +87,8 @@ public:
                                      "The histogram of get request durations"))
     , set_durations_(CreateHistogram(lane, "ledger_statedb_set_request_seconds",
                                      "The histogram of set request durations"))
+    , set_batch_durations_(CreateHistogram(lane, "ledger_statedb_set_batch_request_seconds",
+                                           "The histogram of set batch request durations"))
     , lock_durations_(CreateHistogram(lane, "ledger_statedb_lock_request_seconds",
                                       "The histogram of lock request durations"))
     , unlock_durations_(CreateHistogram(lane, "ledger_statedb_unlock_request_seconds",
@@ -92,6 +97,7 @@ public:
     this->Expose(GET, this, &RevertibleDocumentStoreProtocol::Get);
     this->Expose(GET_OR_CREATE, this, &RevertibleDocumentStoreProtocol::GetOrCreate);
     this->Expose(SET, this, &RevertibleDocumentStoreProtocol::Set);
+    this->Expose(SET_BATCH, this, &RevertibleDocumentStoreProtocol::SetBatch);
 
     // Functionality for hashing/state
     this->Expose(COMMIT, this, &RevertibleDocumentStoreProtocol::Commit);
@@ -247,6 +253,15 @@ private:
     set_count_->increment();
   }
 
+  void SetBatch(NewRevertibleDocumentStore::WriteBatch const &batch)
+  {
+    telemetry::FunctionTimer const timer{*set_batch_durations_};
+
+    doc_store_->SetBatch(batch);
+    set_batch_count_->increment();
+    set_count_->add(batch.size());
+  }
+
   NewRevertibleDocumentStore::Hash Commit()
   {
     auto const hash = doc_store_->Commit();
@@ -301,6 +316,7 @@ private:
   telemetry::CounterPtr   get_count_;
   telemetry::CounterPtr   get_create_count_;
   telemetry::CounterPtr   set_count_;
+  telemetry::CounterPtr   set_batch_count_;
   telemetry::CounterPtr   commit_count_;
   telemetry::CounterPtr   revert_count_;
   telemetry::CounterPtr   current_hash_count_;
@@ -311,6 +327,7 @@ private:
   telemetry::CounterPtr   has_lock_count_;
   telemetry::HistogramPtr get_durations_;
   telemetry::HistogramPtr set_durations_;
+  telemetry::HistogramPtr set_batch_durations_;
   telemetry::HistogramPtr lock_durations_;
   telemetry::HistogramPtr unlock_durations_;
 };
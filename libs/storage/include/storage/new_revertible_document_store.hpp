@@ -22,6 +22,8 @@
 
 #include <cstddef>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace fetch {
 namespace storage {
@@ -35,6 +37,7 @@ public:
   using ByteArray      = byte_array::ConstByteArray;
   using UnderlyingType = storage::Document;
   using Keys           = std::vector<ResourceID>;
+  using WriteBatch     = std::vector<std::pair<ResourceID, ByteArray>>;
 
   bool New(std::string const &state, std::string const &state_history, std::string const &index,
            std::string const &index_history, bool create_if_not_exist);
@@ -44,6 +47,7 @@ public:
   UnderlyingType Get(ResourceID const &rid);
   UnderlyingType GetOrCreate(ResourceID const &rid);
   void           Set(ResourceID const &rid, ByteArray const &value);
+  void           SetBatch(WriteBatch const &batch);
   void           Erase(ResourceID const &rid);
 
   Hash Commit();
@@ -98,6 +98,11 @@ void NewRevertibleDocumentStore::Set(ResourceID const &rid, ByteArray const &val
   return storage_.Set(rid, value);
 }
 
+void NewRevertibleDocumentStore::SetBatch(WriteBatch const &batch)
+{
+  storage_.SetBatch(batch);
+}
+
 void NewRevertibleDocumentStore::Erase(ResourceID const &rid)
 {
   return storage_.Erase(rid);
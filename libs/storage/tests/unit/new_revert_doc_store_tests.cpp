@@ -387,6 +387,48 @@ TEST(new_revertible_store_test, commit_and_erase)
   }
 }
 
+TEST(new_revertible_store_test, set_batch_matches_individual_sets)
+{
+  NewRevertibleDocumentStore individual;
+  NewRevertibleDocumentStore batched;
+  individual.New("a_batch_1.db", "b_batch_1.db", "c_batch_1.db", "d_batch_1.db", true);
+  batched.New("a_batch_2.db", "b_batch_2.db", "c_batch_2.db", "d_batch_2.db", true);
+
+  LinearCongruentialGenerator           rng;
+  NewRevertibleDocumentStore::WriteBatch batch;
+
+  // large enough for the documents to be hashed on several threads
+  for (std::size_t i = 0; i < 2000; ++i)
+  {
+    std::string const key{std::to_string(i % 1500)};
+    std::string const value{GetStringForTesting(rng)};
+
+    individual.Set(storage::ResourceAddress(key), value);
+    batch.emplace_back(storage::ResourceAddress(key), value);
+  }
+
+  batched.SetBatch(batch);
+
+  ASSERT_EQ(batched.size(), 1500);
+  EXPECT_EQ(batched.CurrentHash(), individual.CurrentHash());
+
+  for (std::size_t i = 0; i < 1500; ++i)
+  {
+    storage::ResourceAddress const address{std::to_string(i)};
+    auto const                     document = batched.Get(address);
+
+    EXPECT_FALSE(document.failed);
+    EXPECT_EQ(ConstByteArray(document), ConstByteArray(individual.Get(address)));
+  }
+
+  // batched updates can be committed and reverted like any other
+  auto const hash = batched.Commit();
+  batched.SetBatch({{storage::ResourceAddress("0"), ConstByteArray{"updated"}}});
+  EXPECT_EQ(ConstByteArray(batched.Get(storage::ResourceAddress("0"))), ConstByteArray{"updated"});
+  EXPECT_TRUE(batched.RevertToHash(hash));
+  EXPECT_EQ(batched.CurrentHash(), individual.CurrentHash());
+}
+
 // note: disabled because the storage does not hash the same way as the merkle tree
 TEST(new_revertible_store_test, DISABLED_hashing_correct_basic)
 {
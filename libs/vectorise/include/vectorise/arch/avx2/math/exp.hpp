@@ -41,9 +41,6 @@ static const VectorRegister<fixed_point::fp32_t, 128> FP32_128_INTEGER_MASK(
     static_cast<fixed_point::fp32_t>(integer_mask));
 static const VectorRegister<fixed_point::fp32_t, 256> FP32_256_INTEGER_MASK(
     static_cast<fixed_point::fp32_t>(integer_mask));
-// TODO (ML-522) ; implement fp64 exp vectorisation
-// static const VectorRegister<fixed_point::fp64_t, 128> FP64_128_INTEGER_MASK{integer_mask};
-// static const VectorRegister<fixed_point::fp64_t, 256> FP64_256_INTEGER_MASK{integer_mask};
 
 static const VectorRegister<fixed_point::fp32_t, 128> FP32_128_CONST_LN2(
     fixed_point::fp32_t::CONST_LN2);
@@ -223,30 +220,106 @@ inline VectorRegister<fixed_point::fp32_t, 256> Exp(
   return e;
 }
 
-inline VectorRegister<fixed_point::fp64_t, 128> Exp(
-    VectorRegister<fixed_point::fp64_t, 128> const &x)
+/**
+ * Calculate e^x on fp64 lanes, bit for bit as fixed_point::fp64_t::Exp does.
+ *
+ * The scalar range reduction x = k * ln2 + r and the Pade approximant of e^r are evaluated on raw
+ * integers. With r in [0, ln2) every product has operands below 1 and is a single 32x32-bit
+ * multiply, and the quotients are computed exactly by details::DivideFraction. A negative x gives
+ * 1 / (2^k * e^r), which is floor(2^(64 - k) / e^r) in raw form. Lanes whose scalar result sets the
+ * fixed point state (NaN, overflow and x == MIN_EXP) are evaluated by the scalar definition.
+ */
+inline VectorRegister<fixed_point::fp64_t, 256> Exp(
+    VectorRegister<fixed_point::fp64_t, 256> const &x)
 {
-  constexpr std::size_t           size = VectorRegister<fixed_point::fp64_t, 128>::E_BLOCK_COUNT;
-  alignas(16) fixed_point::fp64_t A[size];
-  x.Store(A);
-  for (auto &val : A)
+  using fixed_point::fp64_t;
+
+  __m256i const zero    = _mm256_setzero_si256();
+  __m256i const one     = _mm256_set1_epi64x(fp64_t::_1.Data());
+  __m256i const ln2     = _mm256_set1_epi64x(fp64_t::CONST_LN2.Data());
+  __m256i const max_exp = _mm256_set1_epi64x(fp64_t::MAX_EXP.Data());
+  __m256i const min_exp = _mm256_set1_epi64x(fp64_t::MIN_EXP.Data());
+  __m256i const one_raw = _mm256_set1_epi64x(1);
+
+  __m256i mask_nan     = VectorRegister<fp64_t, 256>::MaskNaN(x).data();
+  __m256i mask_max_exp = _mm256_cmpgt_epi64(x.data(), _mm256_sub_epi64(max_exp, one_raw));
+  __m256i mask_scalar  = _mm256_or_si256(_mm256_or_si256(mask_nan, mask_max_exp),
+                                        _mm256_cmpeq_epi64(x.data(), min_exp));
+  // -inf and x < MIN_EXP give 0, x == 0 gives 1
+  __m256i mask_zero = _mm256_andnot_si256(mask_nan, _mm256_cmpgt_epi64(min_exp, x.data()));
+  __m256i mask_one  = _mm256_cmpeq_epi64(x.data(), zero);
+  __m256i mask_neg  = _mm256_cmpgt_epi64(zero, x.data());
+  __m256i ax        = _mm256_blendv_epi8(x.data(), _mm256_sub_epi64(zero, x.data()), mask_neg);
+
+  // k = Floor(x / CONST_LN2) is the integer quotient of the raw values. Rounding the double
+  // quotient can only overshoot it, which shows as a negative r.
+  __m256d const k_estimate = _mm256_floor_pd(_mm256_div_pd(
+      details::ToDouble(ax), _mm256_set1_pd(static_cast<double>(fp64_t::CONST_LN2.Data()))));
+
+  __m256i k     = details::ToInteger(k_estimate);
+  __m256i r     = _mm256_sub_epi64(ax, _mm256_mul_epu32(k, ln2));
+  __m256i r_neg = _mm256_cmpgt_epi64(zero, r);
+  k             = _mm256_add_epi64(k, r_neg);
+  r             = _mm256_add_epi64(r, _mm256_and_si256(r_neg, ln2));
+
+  auto multiply = [](__m256i const &a, __m256i const &b) {
+    return _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+  };
+
+  __m256i r2 = multiply(r, r);
+  __m256i r3 = multiply(r2, r);
+  __m256i r4 = multiply(r3, r);
+  __m256i r5 = multiply(r4, r);
+
+  // Multiply the coefficients as they are the same in both numerator and denominator
+  r  = multiply(r, _mm256_set1_epi64x(static_cast<fp64_t>(fixed_point::Exp_P01).Data()));
+  r2 = multiply(r2, _mm256_set1_epi64x(static_cast<fp64_t>(fixed_point::Exp_P02).Data()));
+  r3 = multiply(r3, _mm256_set1_epi64x(static_cast<fp64_t>(fixed_point::Exp_P03).Data()));
+  r4 = multiply(r4, _mm256_set1_epi64x(static_cast<fp64_t>(fixed_point::Exp_P04).Data()));
+  r5 = multiply(r5, _mm256_set1_epi64x(static_cast<fp64_t>(fixed_point::Exp_P05).Data()));
+
+  __m256i even = _mm256_add_epi64(_mm256_add_epi64(one, r2), r4);
+  __m256i odd  = _mm256_add_epi64(_mm256_add_epi64(r, r3), r5);
+  __m256i e2   = details::DivideFraction(_mm256_add_epi64(even, odd), _mm256_sub_epi64(even, odd));
+
+  // e^1 is the constant E
+  __m256i mask_e = _mm256_cmpeq_epi64(ax, one);
+  e2             = _mm256_blendv_epi8(e2, _mm256_set1_epi64x(fp64_t::CONST_E.Data()), mask_e);
+  k              = _mm256_blendv_epi8(k, zero, mask_e);
+
+  // 2^k * e^r saturates when it exceeds FP_MAX
+  __m256i e = _mm256_sllv_epi64(e2, k);
+  __m256i mask_overflow =
+      _mm256_cmpgt_epi64(e2, _mm256_srlv_epi64(_mm256_set1_epi64x(fp64_t::MAX), k));
+  mask_scalar = _mm256_or_si256(mask_scalar, _mm256_andnot_si256(mask_zero, mask_overflow));
+
+  __m256i reciprocal = details::DivideFraction(
+      _mm256_sllv_epi64(one_raw, _mm256_sub_epi64(_mm256_set1_epi64x(32), k)), e2);
+  e = _mm256_blendv_epi8(e, reciprocal, mask_neg);
+  e = _mm256_blendv_epi8(e, zero, mask_zero);
+  e = _mm256_blendv_epi8(e, one, mask_one);
+
+  VectorRegister<fp64_t, 256> ret(e);
+  if (_mm256_testz_si256(mask_scalar, mask_scalar) == 0)
   {
-    val = fixed_point::fp64_t::Exp(val);
+    alignas(VectorRegister<fp64_t, 256>::E_REGISTER_SIZE) fp64_t A[4];
+    alignas(VectorRegister<fp64_t, 256>::E_REGISTER_SIZE) fp64_t E[4];
+    x.Store(A);
+    ret.Store(E);
+    details::ForEachLane(mask_scalar, [&](std::size_t i) { E[i] = fp64_t::Exp(A[i]); });
+    ret = VectorRegister<fp64_t, 256>(E);
   }
-  return {A};
+
+  return ret;
 }
 
-inline VectorRegister<fixed_point::fp64_t, 256> Exp(
-    VectorRegister<fixed_point::fp64_t, 256> const &x)
+inline VectorRegister<fixed_point::fp64_t, 128> Exp(
+    VectorRegister<fixed_point::fp64_t, 128> const &x)
 {
-  constexpr std::size_t           size = VectorRegister<fixed_point::fp64_t, 256>::E_BLOCK_COUNT;
-  alignas(32) fixed_point::fp64_t A[size];
-  x.Store(A);
-  for (auto &val : A)
-  {
-    val = fixed_point::fp64_t::Exp(val);
-  }
-  return {A};
+  // Evaluate in the lower half of a 256-bit register, the upper half repeats the same lanes
+  VectorRegister<fixed_point::fp64_t, 256> wide(_mm256_set_m128i(x.data(), x.data()));
+
+  return {_mm256_extractf128_si256(Exp(wide).data(), 0)};
 }
 
 inline VectorRegister<float, 256> Exp(VectorRegister<float, 256> const &x)
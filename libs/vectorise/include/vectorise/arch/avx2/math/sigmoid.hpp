@@ -0,0 +1,94 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/arch/avx2/math/exp.hpp"
+#include "vectorise/fixed_point/fixed_point.hpp"
+
+#include <immintrin.h>
+
+#include <cstddef>
+
+namespace fetch {
+namespace vectorise {
+
+/**
+ * Calculate the logistic function 1 / (1 + e^-x) on fp64 lanes, bit for bit as math::Sigmoid
+ * evaluates each element.
+ *
+ * Both branches of the numerically stable definition divide by 1 + e^-|x|, which lies in [1, 2],
+ * so they are the Exp kernel followed by a single exact quotient. NaN and the infinities are
+ * evaluated by the scalar definition.
+ */
+inline VectorRegister<fixed_point::fp64_t, 256> Sigmoid(
+    VectorRegister<fixed_point::fp64_t, 256> const &x)
+{
+  using fixed_point::fp64_t;
+
+  __m256i const zero = _mm256_setzero_si256();
+  __m256i const one  = _mm256_set1_epi64x(fp64_t::_1.Data());
+
+  __m256i mask_scalar = _mm256_or_si256(
+      VectorRegister<fp64_t, 256>::MaskNaN(x).data(),
+      _mm256_or_si256((x == VectorRegister<fp64_t, 256>::MaskPosInf()).data(),
+                      (x == VectorRegister<fp64_t, 256>::MaskNegInf()).data()));
+
+  // The scalar lanes are evaluated from 0, which sets no state
+  __m256i finite   = _mm256_andnot_si256(mask_scalar, x.data());
+  __m256i mask_neg = _mm256_cmpgt_epi64(zero, finite);
+  __m256i neg_abs  = _mm256_blendv_epi8(_mm256_sub_epi64(zero, finite), finite, mask_neg);
+  __m256i e        = Exp(VectorRegister<fp64_t, 256>(neg_abs)).data();
+
+  // x >= 0 gives 1 / (1 + e^-x) and x < 0 gives e^x / (e^x + 1)
+  __m256i numerator = _mm256_blendv_epi8(one, e, mask_neg);
+  VectorRegister<fp64_t, 256> ret(details::DivideFraction(numerator, _mm256_add_epi64(one, e)));
+
+  if (_mm256_testz_si256(mask_scalar, mask_scalar) == 0)
+  {
+    alignas(VectorRegister<fp64_t, 256>::E_REGISTER_SIZE) fp64_t A[4];
+    alignas(VectorRegister<fp64_t, 256>::E_REGISTER_SIZE) fp64_t S[4];
+    x.Store(A);
+    ret.Store(S);
+    details::ForEachLane(mask_scalar, [&](std::size_t i) {
+      if (A[i] >= fp64_t::_0)
+      {
+        S[i] = fp64_t::_1 / (fp64_t::_1 + fp64_t::Exp(-A[i]));
+      }
+      else
+      {
+        fp64_t const e_x = fp64_t::Exp(A[i]);
+        S[i]             = e_x / (e_x + fp64_t::_1);
+      }
+    });
+    ret = VectorRegister<fp64_t, 256>(S);
+  }
+
+  return ret;
+}
+
+inline VectorRegister<fixed_point::fp64_t, 128> Sigmoid(
+    VectorRegister<fixed_point::fp64_t, 128> const &x)
+{
+  // Evaluate in the lower half of a 256-bit register, the upper half repeats the same lanes
+  VectorRegister<fixed_point::fp64_t, 256> wide(_mm256_set_m128i(x.data(), x.data()));
+
+  return {_mm256_extractf128_si256(Sigmoid(wide).data(), 0)};
+}
+
+}  // namespace vectorise
+}  // namespace fetch
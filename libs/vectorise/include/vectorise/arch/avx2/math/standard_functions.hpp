@@ -22,4 +22,6 @@
 #include "vectorise/arch/avx2/math/approx_log.hpp"
 #include "vectorise/arch/avx2/math/exp.hpp"
 #include "vectorise/arch/avx2/math/pow.hpp"
+#include "vectorise/arch/avx2/math/sigmoid.hpp"
 #include "vectorise/arch/avx2/math/sqrt.hpp"
+#include "vectorise/arch/avx2/math/tanh.hpp"
@@ -0,0 +1,88 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/arch/avx2/math/exp.hpp"
+#include "vectorise/fixed_point/fixed_point.hpp"
+
+#include <immintrin.h>
+
+#include <cstddef>
+
+namespace fetch {
+namespace vectorise {
+
+/**
+ * Calculate tanh(x) on fp64 lanes, bit for bit as fixed_point::fp64_t::TanH does.
+ *
+ * For |x| < 21 both e^x and e^-x come from the Exp kernel, and neither their sum nor their
+ * difference leaves the fp64 range, so (e^x - e^-x) / (e^x + e^-x) is a single exact quotient.
+ * NaN, the infinities and larger |x|, where the scalar sum saturates, are evaluated by the scalar
+ * definition.
+ */
+inline VectorRegister<fixed_point::fp64_t, 256> TanH(
+    VectorRegister<fixed_point::fp64_t, 256> const &x)
+{
+  using fixed_point::fp64_t;
+
+  __m256i const zero  = _mm256_setzero_si256();
+  __m256i const limit = _mm256_set1_epi64x(fp64_t{21}.Data());
+
+  // NaN and the infinities have magnitudes above the limit, except for the raw value -2^63
+  __m256i mask_neg    = _mm256_cmpgt_epi64(zero, x.data());
+  __m256i ax          = _mm256_blendv_epi8(x.data(), _mm256_sub_epi64(zero, x.data()), mask_neg);
+  __m256i mask_vector = _mm256_and_si256(_mm256_cmpgt_epi64(limit, ax),
+                                         _mm256_cmpgt_epi64(ax, _mm256_set1_epi64x(-1)));
+  __m256i mask_scalar = _mm256_andnot_si256(mask_vector, _mm256_set1_epi64x(-1));
+
+  // The scalar lanes are evaluated from 0, which sets no state
+  __m256i v  = _mm256_and_si256(x.data(), mask_vector);
+  __m256i e1 = Exp(VectorRegister<fp64_t, 256>(v)).data();
+  __m256i e2 = Exp(VectorRegister<fp64_t, 256>(_mm256_sub_epi64(zero, v))).data();
+
+  // e^x - e^-x has the sign of x, the quotient of the magnitudes is rounded towards zero
+  __m256i difference = _mm256_sub_epi64(e1, e2);
+  difference = _mm256_blendv_epi8(difference, _mm256_sub_epi64(zero, difference), mask_neg);
+  __m256i quotient = details::DivideFraction(difference, _mm256_add_epi64(e1, e2));
+  quotient         = _mm256_blendv_epi8(quotient, _mm256_sub_epi64(zero, quotient), mask_neg);
+
+  VectorRegister<fp64_t, 256> ret(quotient);
+  if (_mm256_testz_si256(mask_scalar, mask_scalar) == 0)
+  {
+    alignas(VectorRegister<fp64_t, 256>::E_REGISTER_SIZE) fp64_t A[4];
+    alignas(VectorRegister<fp64_t, 256>::E_REGISTER_SIZE) fp64_t T[4];
+    x.Store(A);
+    ret.Store(T);
+    details::ForEachLane(mask_scalar, [&](std::size_t i) { T[i] = fp64_t::TanH(A[i]); });
+    ret = VectorRegister<fp64_t, 256>(T);
+  }
+
+  return ret;
+}
+
+inline VectorRegister<fixed_point::fp64_t, 128> TanH(
+    VectorRegister<fixed_point::fp64_t, 128> const &x)
+{
+  // Evaluate in the lower half of a 256-bit register, the upper half repeats the same lanes
+  VectorRegister<fixed_point::fp64_t, 256> wide(_mm256_set_m128i(x.data(), x.data()));
+
+  return {_mm256_extractf128_si256(TanH(wide).data(), 0)};
+}
+
+}  // namespace vectorise
+}  // namespace fetch
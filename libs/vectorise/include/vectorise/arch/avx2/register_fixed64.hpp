@@ -725,44 +725,140 @@ inline VectorRegister<fixed_point::fp64_t, 256> operator*(
   return prod;
 }
 
-inline VectorRegister<fixed_point::fp64_t, 128> operator/(
-    VectorRegister<fixed_point::fp64_t, 128> const &a,
-    VectorRegister<fixed_point::fp64_t, 128> const &b)
+namespace details {
+
+/**
+ * Convert non-negative 64-bit integers below 2^63 to the nearest doubles
+ */
+inline __m256d ToDouble(__m256i const &x)
+{
+  // The halves are converted exactly by placing them in the mantissa of 2^52
+  __m256d const magic   = _mm256_set1_pd(4503599627370496.0);
+  __m256i const bits    = _mm256_castpd_si256(magic);
+  __m256i const low     = _mm256_set1_epi64x(0xffffffff);
+  __m256i const hi_bits = _mm256_or_si256(_mm256_srli_epi64(x, 32), bits);
+  __m256i const lo_bits = _mm256_or_si256(_mm256_and_si256(x, low), bits);
+  __m256d const hi      = _mm256_sub_pd(_mm256_castsi256_pd(hi_bits), magic);
+  __m256d const lo      = _mm256_sub_pd(_mm256_castsi256_pd(lo_bits), magic);
+
+  return _mm256_add_pd(_mm256_mul_pd(hi, _mm256_set1_pd(4294967296.0)), lo);
+}
+
+/**
+ * Convert non-negative integral doubles below 2^52 to 64-bit integers
+ */
+inline __m256i ToInteger(__m256d const &x)
 {
-  // TODO(private 440): AVX implementation required
-  alignas(VectorRegister<fixed_point::fp64_t, 128>::E_REGISTER_SIZE) fixed_point::fp64_t d1[2];
-  a.Store(d1);
+  __m256d const magic = _mm256_set1_pd(4503599627370496.0);
+  return _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(x, magic)),
+                          _mm256_castpd_si256(magic));
+}
+
+/**
+ * The low 64 bits of the products of 64-bit integers
+ */
+inline __m256i MultiplyLow(__m256i const &a, __m256i const &b)
+{
+  __m256i const cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                                         _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
 
-  alignas(VectorRegister<fixed_point::fp64_t, 128>::E_REGISTER_SIZE) fixed_point::fp64_t d2[2];
-  b.Store(d2);
+  return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32));
+}
 
-  alignas(VectorRegister<fixed_point::fp64_t, 128>::E_REGISTER_SIZE) fixed_point::fp64_t ret[2];
+/**
+ * Compute floor((a << 32) / b), i.e. the raw fp64 quotient of a and b, exactly.
+ *
+ * Requires 0 <= a < 2^62, 0 < b < 2^62 and a quotient below 2^50. The quotient is estimated in
+ * double precision, which is then within one of the exact result, and corrected from the sign and
+ * size of the remainder. The remainder lies in [-b, 2b) and so is exact in wrapping arithmetic.
+ */
+inline __m256i DivideFraction(__m256i const &a, __m256i const &b)
+{
+  __m256d const numerator = _mm256_mul_pd(ToDouble(a), _mm256_set1_pd(4294967296.0));
+  __m256i       quotient  = ToInteger(_mm256_floor_pd(_mm256_div_pd(numerator, ToDouble(b))));
+  __m256i const remainder = _mm256_sub_epi64(_mm256_slli_epi64(a, 32), MultiplyLow(quotient, b));
 
-  ret[0] = d1[0] / d2[0];
-  ret[1] = d1[1] / d2[1];
+  // Masks are all ones, so adding a mask decrements and subtracting it increments
+  __m256i const b_minus_1 = _mm256_sub_epi64(b, _mm256_set1_epi64x(1));
+  __m256i const too_large = _mm256_cmpgt_epi64(_mm256_setzero_si256(), remainder);
+  __m256i const too_small = _mm256_cmpgt_epi64(remainder, b_minus_1);
+  quotient                = _mm256_add_epi64(quotient, too_large);
 
-  return {ret};
+  return _mm256_sub_epi64(quotient, too_small);
 }
 
+/**
+ * Call function with the index of every lane that is set in mask
+ */
+template <typename Function>
+inline void ForEachLane(__m256i const &mask, Function &&function)
+{
+  int const lanes = _mm256_movemask_pd(_mm256_castsi256_pd(mask));
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    if ((lanes & (1 << i)) != 0)
+    {
+      function(i);
+    }
+  }
+}
+
+}  // namespace details
+
 inline VectorRegister<fixed_point::fp64_t, 256> operator/(
     VectorRegister<fixed_point::fp64_t, 256> const &a,
     VectorRegister<fixed_point::fp64_t, 256> const &b)
 {
-  // TODO(private 440): SSE implementation required
-  alignas(VectorRegister<fixed_point::fp64_t, 256>::E_REGISTER_SIZE) fixed_point::fp64_t d1[4];
-  a.Store(d1);
+  __m256i const zero  = _mm256_setzero_si256();
+  __m256i const limit = _mm256_set1_epi64x(int64_t{1} << 62);
+
+  __m256i a_neg = _mm256_cmpgt_epi64(zero, a.data());
+  __m256i b_neg = _mm256_cmpgt_epi64(zero, b.data());
+  __m256i abs_a = _mm256_blendv_epi8(a.data(), _mm256_sub_epi64(zero, a.data()), a_neg);
+  __m256i abs_b = _mm256_blendv_epi8(b.data(), _mm256_sub_epi64(zero, b.data()), b_neg);
 
-  alignas(VectorRegister<fixed_point::fp64_t, 256>::E_REGISTER_SIZE) fixed_point::fp64_t d2[4];
-  b.Store(d2);
+  // The exact quotient is computed for finite operands with |a| < 2^62, 0 < |b| < 2^62 and
+  // |a| < |b| * 2^18, which bounds the quotient by 2^50. This leaves out NaN, the infinities and
+  // division by zero. All other lanes are divided by the scalar definition.
+  __m256i a_in_range  = _mm256_and_si256(_mm256_cmpgt_epi64(limit, abs_a),
+                                         _mm256_cmpgt_epi64(abs_a, _mm256_set1_epi64x(-1)));
+  __m256i b_in_range  = _mm256_and_si256(_mm256_cmpgt_epi64(limit, abs_b),
+                                         _mm256_cmpgt_epi64(abs_b, zero));
+  __m256i q_in_range  = _mm256_cmpgt_epi64(abs_b, _mm256_srli_epi64(abs_a, 18));
+  __m256i mask_vector = _mm256_and_si256(_mm256_and_si256(a_in_range, b_in_range), q_in_range);
 
-  alignas(VectorRegister<fixed_point::fp64_t, 256>::E_REGISTER_SIZE) fixed_point::fp64_t ret[4];
+  // Keep the divisor of the other lanes positive, their quotients are replaced below
+  abs_b            = _mm256_blendv_epi8(_mm256_set1_epi64x(1), abs_b, mask_vector);
+  __m256i quotient = details::DivideFraction(_mm256_and_si256(abs_a, mask_vector), abs_b);
+  quotient         = _mm256_blendv_epi8(quotient, _mm256_sub_epi64(zero, quotient),
+                                        _mm256_xor_si256(a_neg, b_neg));
 
-  ret[0] = d1[0] / d2[0];
-  ret[1] = d1[1] / d2[1];
-  ret[2] = d1[2] / d2[2];
-  ret[3] = d1[3] / d2[3];
+  VectorRegister<fixed_point::fp64_t, 256> ret(quotient);
+  __m256i mask_scalar = _mm256_andnot_si256(mask_vector, _mm256_set1_epi64x(-1));
+  if (_mm256_testz_si256(mask_scalar, mask_scalar) == 0)
+  {
+    alignas(VectorRegister<fixed_point::fp64_t, 256>::E_REGISTER_SIZE) fixed_point::fp64_t d1[4];
+    alignas(VectorRegister<fixed_point::fp64_t, 256>::E_REGISTER_SIZE) fixed_point::fp64_t d2[4];
+    alignas(VectorRegister<fixed_point::fp64_t, 256>::E_REGISTER_SIZE) fixed_point::fp64_t q[4];
+    a.Store(d1);
+    b.Store(d2);
+    ret.Store(q);
+    details::ForEachLane(mask_scalar, [&](std::size_t i) { q[i] = d1[i] / d2[i]; });
+    ret = VectorRegister<fixed_point::fp64_t, 256>(q);
+  }
+
+  return ret;
+}
+
+inline VectorRegister<fixed_point::fp64_t, 128> operator/(
+    VectorRegister<fixed_point::fp64_t, 128> const &a,
+    VectorRegister<fixed_point::fp64_t, 128> const &b)
+{
+  // Divide in the lower half of a 256-bit register, the upper half repeats the same lanes
+  VectorRegister<fixed_point::fp64_t, 256> wide_a(_mm256_set_m128i(a.data(), a.data()));
+  VectorRegister<fixed_point::fp64_t, 256> wide_b(_mm256_set_m128i(b.data(), b.data()));
 
-  return {ret};
+  return {_mm256_extractf128_si256((wide_a / wide_b).data(), 0)};
 }
 
 inline VectorRegister<fixed_point::fp64_t, 128> vector_zero_below_element(
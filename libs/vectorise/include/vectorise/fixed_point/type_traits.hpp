@@ -100,6 +100,18 @@ constexpr bool IsPodOrFixedPoint = fetch::meta::IsPOD<T> || IsFixedPoint<T>;
 template <typename T, typename R = void>
 using IfIsPodOrFixedPoint = fetch::meta::EnableIf<IsPodOrFixedPoint<T>, R>;
 
+template <typename T>
+constexpr bool IsFixedPoint64 = std::is_same<T, fixed_point::FixedPoint<32, 32>>::value;
+
+template <typename T>
+constexpr bool IsNotFixedPoint64 = !IsFixedPoint64<T>;
+
+template <typename DataType, typename ReturnType = void>
+using IfIsFixedPoint64 = fetch::meta::EnableIf<IsFixedPoint64<DataType>, ReturnType>;
+
+template <typename DataType, typename ReturnType = void>
+using IfIsNotFixedPoint64 = fetch::meta::EnableIf<IsNotFixedPoint64<DataType>, ReturnType>;
+
 template <typename T>
 constexpr bool IsFixedPoint128 = std::is_same<T, fixed_point::FixedPoint<64, 64>>::value;
 
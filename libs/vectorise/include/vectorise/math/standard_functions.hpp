@@ -44,6 +44,27 @@ inline math::meta::IfIsFixedPoint<T, VectorRegister<T, 8 * sizeof(T)>> Exp(
   return VectorRegister<T, 8 * sizeof(T)>(T::Exp(x.data()));
 }
 
+template <typename T>
+inline math::meta::IfIsFixedPoint<T, VectorRegister<T, 8 * sizeof(T)>> Sigmoid(
+    VectorRegister<T, 8 * sizeof(T)> const &x)
+{
+  T const &value = x.data();
+  if (value >= T{0})
+  {
+    return VectorRegister<T, 8 * sizeof(T)>(T{1} / (T{1} + T::Exp(-value)));
+  }
+
+  T const e = T::Exp(value);
+  return VectorRegister<T, 8 * sizeof(T)>(e / (e + T{1}));
+}
+
+template <typename T>
+inline math::meta::IfIsFixedPoint<T, VectorRegister<T, 8 * sizeof(T)>> TanH(
+    VectorRegister<T, 8 * sizeof(T)> const &x)
+{
+  return VectorRegister<T, 8 * sizeof(T)>(T::TanH(x.data()));
+}
+
 template <typename T, std::size_t S>
 VectorRegister<T, S> exp(VectorRegister<T, S> x, T const &precision = 0.00001)
 {
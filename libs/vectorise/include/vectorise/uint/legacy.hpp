@@ -0,0 +1,169 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/uint/uint.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+namespace fetch {
+namespace vectorise {
+
+/* The original UInt<256> arithmetic kernels.
+ *
+ * Addition and subtraction only carry or borrow into the next limb when the limb itself
+ * overflows, and the product and quotient are built on top of them. Results therefore differ from
+ * the UInt operators for some inputs. Contracts executed for blocks before the corrected
+ * arithmetic is activated have to keep using these kernels, so that their results do not change.
+ */
+namespace legacy {
+
+using UInt256 = UInt<256>;
+
+/**
+ * @return a + b, as computed by the original UInt<256>::operator+=
+ */
+inline UInt256 Add(UInt256 a, UInt256 const &b)
+{
+  UInt256::WideType carry = 0, new_carry = 0;
+  for (std::size_t i = 0; i < UInt256::WIDE_ELEMENTS; ++i)
+  {
+    new_carry = (a.ElementAt(i) + b.ElementAt(i) + carry < a.ElementAt(i)) ? 1 : 0;
+    a.ElementAt(i) += b.ElementAt(i) + carry;
+    carry = new_carry;
+  }
+  return a;
+}
+
+/**
+ * @return a - b, as computed by the original UInt<256>::operator-=
+ */
+inline UInt256 Subtract(UInt256 a, UInt256 const &b)
+{
+  if (a < b)
+  {
+    a = UInt256::_0;
+  }
+  UInt256::WideType carry = 0, new_carry = 0;
+  for (std::size_t i = 0; i < UInt256::WIDE_ELEMENTS; ++i)
+  {
+    new_carry = (a.ElementAt(i) - b.ElementAt(i) - carry > a.ElementAt(i)) ? 1 : 0;
+    a.ElementAt(i) -= b.ElementAt(i) + carry;
+    carry = new_carry;
+  }
+  return a;
+}
+
+/**
+ * @return a * b, as computed by the original UInt<256>::operator*=
+ */
+inline UInt256 Multiply(UInt256 const &a, UInt256 const &b)
+{
+  constexpr std::size_t ELEMENTS = UInt256::WIDE_ELEMENTS;
+  constexpr std::size_t SHIFT    = UInt256::WIDE_ELEMENT_SIZE;
+
+  __uint128_t products[ELEMENTS][ELEMENTS] = {};
+  for (std::size_t i = 0; i < ELEMENTS; ++i)
+  {
+    for (std::size_t j = 0; j < ELEMENTS; ++j)
+    {
+      products[i][j] = static_cast<__uint128_t>(a.ElementAt(i)) * b.ElementAt(j);
+    }
+  }
+
+  // each column is summed as a 128-bit quantity, but only its low 64 bits are carried on
+  __uint128_t carry = 0, terms[ELEMENTS] = {};
+  terms[0] = products[0][0];
+  carry    = static_cast<UInt256::WideType>(terms[0] >> SHIFT);
+  terms[1] = products[0][1] + products[1][0] + carry;
+  carry    = static_cast<UInt256::WideType>(terms[1] >> SHIFT);
+  terms[2] = products[0][2] + products[1][1] + products[2][0] + carry;
+  carry    = static_cast<UInt256::WideType>(terms[2] >> SHIFT);
+  terms[3] = products[0][3] + products[1][2] + products[2][1] + products[3][0] + carry;
+
+  UInt256 ret;
+  for (std::size_t i = 0; i < ELEMENTS; ++i)
+  {
+    ret.ElementAt(i) = static_cast<UInt256::WideType>(terms[i]);
+  }
+  return ret;
+}
+
+/**
+ * @return a / b, as computed by the original UInt<256>::operator/=
+ * @throws std::runtime_error if b is zero
+ */
+inline UInt256 Divide(UInt256 const &a, UInt256 const &b)
+{
+  if (b == UInt256::_0)
+  {
+    throw std::runtime_error("division by zero!");
+  }
+  if (b == UInt256::_1)
+  {
+    return a;
+  }
+  if (a == b)
+  {
+    return UInt256::_1;
+  }
+  if ((a == UInt256::_0) || (a < b))
+  {
+    return UInt256::_0;
+  }
+
+  // shift-and-subtract on the dividend and divisor with their common trailing zeros removed
+  UInt256           N{a}, D{b};
+  std::size_t const lsb = std::min(N.lsb(), D.lsb());
+  N >>= lsb;
+  D >>= lsb;
+
+  UInt256    multiple(1u);
+  auto const leading_zero_bits{D.UINT_SIZE - D.msb() - 1};
+  D <<= leading_zero_bits;
+  multiple <<= leading_zero_bits;
+
+  UInt256 Q = UInt256::_0, R = N;
+  do
+  {
+    if (R >= D)
+    {
+      R = Subtract(R, D);
+      Q = Add(Q, multiple);
+    }
+    D >>= 1;
+    multiple >>= 1;
+  } while (multiple != UInt256::_0);
+
+  return Q;
+}
+
+/**
+ * @return a % b, as computed by the original UInt<256>::operator%=
+ * @throws std::runtime_error if b is zero
+ */
+inline UInt256 Modulo(UInt256 const &a, UInt256 const &b)
+{
+  return Subtract(a, Multiply(Divide(a, b), b));
+}
+
+}  // namespace legacy
+}  // namespace vectorise
+}  // namespace fetch
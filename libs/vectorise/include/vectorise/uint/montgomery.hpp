@@ -0,0 +1,318 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/uint/uint.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace fetch {
+namespace vectorise {
+
+/* Modular arithmetic in Montgomery form.
+ *
+ * For an odd modulus m of k limbs and R = 2^(64 * k), a residue x is represented by
+ * x * R mod m. The product of two representations is reduced with REDC, which replaces the
+ * division by m with limb multiplications and shifts, so that a modular exponentiation only
+ * needs a division to convert its base into Montgomery form.
+ */
+template <uint16_t S>
+class Montgomery
+{
+public:
+  using UIntType = UInt<S>;
+
+  explicit Montgomery(UIntType const &modulus);
+
+  UIntType const &modulus() const;
+
+  UIntType ToMontgomery(UIntType const &x) const;
+  UIntType FromMontgomery(UIntType const &x) const;
+  UIntType Multiply(UIntType const &a, UIntType const &b) const;
+  UIntType Pow(UIntType const &base, UIntType const &exponent) const;
+
+private:
+  using Limb     = details::Limb;
+  using WideLimb = details::WideLimb;
+
+  static constexpr std::size_t LIMBS     = UIntType::WIDE_ELEMENTS;
+  static constexpr std::size_t LIMB_SIZE = details::LIMB_SIZE;
+
+  UIntType    modulus_;
+  std::size_t size_{0};     ///< The number of limbs of the modulus
+  Limb        inverse_{0};  ///< -modulus^-1 mod 2^64
+  UIntType    one_;         ///< R mod modulus
+};
+
+template <uint16_t S>
+Montgomery<S>::Montgomery(UIntType const &modulus)
+  : modulus_{modulus & UIntType::max}
+  , size_{modulus_.TrimmedWideSize()}
+{
+  if ((modulus_.ElementAt(0) & 1u) == 0)
+  {
+    throw std::runtime_error("Montgomery form requires an odd modulus");
+  }
+
+  // Newton iteration, each step doubles the number of correct low bits of the inverse
+  Limb const m0 = modulus_.ElementAt(0);
+  Limb       inverse{m0};
+  for (std::size_t i = 0; i < 5; ++i)
+  {
+    inverse *= 2 - m0 * inverse;
+  }
+  inverse_ = ~inverse + 1;
+
+  one_ = ToMontgomery(UIntType::_1);
+}
+
+template <uint16_t S>
+typename Montgomery<S>::UIntType const &Montgomery<S>::modulus() const
+{
+  return modulus_;
+}
+
+/**
+ * Convert a number into Montgomery form
+ *
+ * @param x The number, which does not need to be reduced
+ * @return x * R mod modulus
+ */
+template <uint16_t S>
+typename Montgomery<S>::UIntType Montgomery<S>::ToMontgomery(UIntType const &x) const
+{
+  UIntType const value{x & UIntType::max};
+  auto const     value_size = value.TrimmedWideSize();
+  if (value_size == 0)
+  {
+    return UIntType::_0;
+  }
+
+  Limb shifted[2 * LIMBS] = {};
+  for (std::size_t i = 0; i < value_size; ++i)
+  {
+    shifted[size_ + i] = value.ElementAt(i);
+  }
+
+  Limb     quotient[2 * LIMBS];
+  UIntType divisor{modulus_};
+  UIntType ret{UIntType::_0};
+  details::DivideLimbs<2 * LIMBS>(shifted, size_ + value_size, &divisor.ElementAt(0), size_,
+                                  quotient, &ret.ElementAt(0));
+
+  return ret;
+}
+
+/**
+ * Convert a number out of Montgomery form
+ *
+ * @param x The Montgomery form of a number, less than the modulus
+ * @return x * R^-1 mod modulus
+ */
+template <uint16_t S>
+typename Montgomery<S>::UIntType Montgomery<S>::FromMontgomery(UIntType const &x) const
+{
+  return Multiply(x, UIntType::_1);
+}
+
+/**
+ * Multiply two numbers in Montgomery form, interleaving the product with its reduction
+ *
+ * @param a The first factor, less than the modulus
+ * @param b The second factor, less than the modulus
+ * @return a * b * R^-1 mod modulus
+ */
+template <uint16_t S>
+typename Montgomery<S>::UIntType Montgomery<S>::Multiply(UIntType const &a,
+                                                         UIntType const &b) const
+{
+  Limb t[LIMBS + 2] = {};
+  for (std::size_t i = 0; i < size_; ++i)
+  {
+    // t += a * b[i]
+    WideLimb carry{0};
+    for (std::size_t j = 0; j < size_; ++j)
+    {
+      WideLimb const sum = static_cast<WideLimb>(a.ElementAt(j)) * b.ElementAt(i) + t[j] + carry;
+      t[j]               = static_cast<Limb>(sum);
+      carry              = sum >> LIMB_SIZE;
+    }
+    WideLimb top = static_cast<WideLimb>(t[size_]) + carry;
+    t[size_]     = static_cast<Limb>(top);
+    t[size_ + 1] = static_cast<Limb>(top >> LIMB_SIZE);
+
+    // t = (t + q * modulus) / 2^64, where q is chosen to clear the lowest limb
+    Limb const     q      = t[0] * inverse_;
+    WideLimb const lowest = static_cast<WideLimb>(q) * modulus_.ElementAt(0) + t[0];
+    carry                 = lowest >> LIMB_SIZE;
+    for (std::size_t j = 1; j < size_; ++j)
+    {
+      WideLimb const sum = static_cast<WideLimb>(q) * modulus_.ElementAt(j) + t[j] + carry;
+      t[j - 1]           = static_cast<Limb>(sum);
+      carry              = sum >> LIMB_SIZE;
+    }
+    top          = static_cast<WideLimb>(t[size_]) + carry;
+    t[size_ - 1] = static_cast<Limb>(top);
+    t[size_]     = t[size_ + 1] + static_cast<Limb>(top >> LIMB_SIZE);
+  }
+
+  // t < 2 * modulus, so a single subtraction brings it into range
+  bool subtract{true};
+  if (t[size_] == 0)
+  {
+    for (std::size_t i = size_; i-- > 0;)
+    {
+      if (t[i] != modulus_.ElementAt(i))
+      {
+        subtract = t[i] > modulus_.ElementAt(i);
+        break;
+      }
+    }
+  }
+
+  UIntType ret{UIntType::_0};
+  Limb     borrow{0};
+  for (std::size_t i = 0; i < size_; ++i)
+  {
+    Limb const subtrahend = subtract ? modulus_.ElementAt(i) : Limb{0};
+    Limb const difference = t[i] - subtrahend;
+    Limb const next       = ((t[i] < subtrahend) || (difference < borrow)) ? 1 : 0;
+    ret.ElementAt(i)      = difference - borrow;
+    borrow                = next;
+  }
+
+  return ret;
+}
+
+/**
+ * Modular exponentiation by left-to-right square-and-multiply in Montgomery form
+ *
+ * @param base The base, which does not need to be reduced
+ * @param exponent The exponent
+ * @return base^exponent mod modulus
+ */
+template <uint16_t S>
+typename Montgomery<S>::UIntType Montgomery<S>::Pow(UIntType const &base,
+                                                    UIntType const &exponent) const
+{
+  UIntType const power{exponent & UIntType::max};
+  UIntType       ret{one_};
+  if (power == UIntType::_0)
+  {
+    return FromMontgomery(ret);
+  }
+
+  UIntType const x{ToMontgomery(base)};
+  for (std::size_t bit = power.msb() + 1; bit-- > 0;)
+  {
+    ret = Multiply(ret, ret);
+    if (((power.ElementAt(bit / LIMB_SIZE) >> (bit % LIMB_SIZE)) & 1u) != 0)
+    {
+      ret = Multiply(ret, x);
+    }
+  }
+
+  return FromMontgomery(ret);
+}
+
+/**
+ * Modular multiplication, for any non-zero modulus
+ *
+ * @return a * b mod modulus
+ * @throws std::runtime_error if the modulus is zero
+ */
+template <uint16_t S>
+UInt<S> MulMod(UInt<S> const &a, UInt<S> const &b, UInt<S> const &modulus)
+{
+  constexpr std::size_t LIMBS = UInt<S>::WIDE_ELEMENTS;
+
+  UInt<S> lhs{a & UInt<S>::max};
+  UInt<S> rhs{b & UInt<S>::max};
+  UInt<S> m{modulus & UInt<S>::max};
+
+  auto const n = m.TrimmedWideSize();
+  if (n == 0)
+  {
+    throw std::runtime_error("division by zero!");
+  }
+
+  details::Limb product[2 * LIMBS];
+  details::MultiplyLimbs(&lhs.ElementAt(0), LIMBS, &rhs.ElementAt(0), LIMBS, product, 2 * LIMBS);
+
+  std::size_t size = 2 * LIMBS;
+  while ((size > 0) && (product[size - 1] == 0))
+  {
+    --size;
+  }
+
+  UInt<S> ret{UInt<S>::_0};
+  if (size < n)
+  {
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      ret.ElementAt(i) = product[i];
+    }
+    return ret;
+  }
+
+  details::Limb quotient[2 * LIMBS];
+  details::DivideLimbs<2 * LIMBS>(product, size, &m.ElementAt(0), n, quotient,
+                                  &ret.ElementAt(0));
+
+  return ret;
+}
+
+/**
+ * Modular exponentiation, in Montgomery form for an odd modulus and by square-and-multiply with
+ * full divisions otherwise
+ *
+ * @return base^exponent mod modulus
+ * @throws std::runtime_error if the modulus is zero
+ */
+template <uint16_t S>
+UInt<S> ModPow(UInt<S> const &base, UInt<S> const &exponent, UInt<S> const &modulus)
+{
+  if ((modulus.ElementAt(0) & 1u) != 0)
+  {
+    return Montgomery<S>{modulus}.Pow(base, exponent);
+  }
+
+  UInt<S> const power{exponent & UInt<S>::max};
+  UInt<S> const x{base % modulus};
+  UInt<S>       ret{UInt<S>::_1 % modulus};
+  if (power == UInt<S>::_0)
+  {
+    return ret;
+  }
+
+  for (std::size_t bit = power.msb() + 1; bit-- > 0;)
+  {
+    ret = MulMod(ret, ret, modulus);
+    if (((power.ElementAt(bit / details::LIMB_SIZE) >> (bit % details::LIMB_SIZE)) & 1u) != 0)
+    {
+      ret = MulMod(ret, x, modulus);
+    }
+  }
+
+  return ret;
+}
+
+}  // namespace vectorise
+}  // namespace fetch
@@ -28,11 +28,156 @@
 #include <cstdint>
 #include <iomanip>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 namespace fetch {
 namespace vectorise {
+namespace details {
+
+using Limb     = uint64_t;
+using WideLimb = __uint128_t;
+
+constexpr std::size_t LIMB_SIZE = sizeof(Limb) * 8;
+
+/**
+ * Schoolbook product of two little-endian limb arrays, truncated to the width of the output
+ *
+ * @param a The first factor, of `na` limbs
+ * @param b The second factor, of `nb` limbs
+ * @param[out] product The lowest `np` limbs of a * b
+ */
+inline void MultiplyLimbs(Limb const *a, std::size_t na, Limb const *b, std::size_t nb,
+                          Limb *product, std::size_t np)
+{
+  std::fill(product, product + np, Limb{0});
+
+  for (std::size_t i = 0; i < std::min(na, np); ++i)
+  {
+    WideLimb          carry{0};
+    std::size_t const columns = std::min(nb, np - i);
+    for (std::size_t j = 0; j < columns; ++j)
+    {
+      WideLimb const t = static_cast<WideLimb>(a[i]) * b[j] + product[i + j] + carry;
+      product[i + j]   = static_cast<Limb>(t);
+      carry            = t >> LIMB_SIZE;
+    }
+
+    if (i + columns < np)
+    {
+      product[i + columns] = static_cast<Limb>(carry);
+    }
+  }
+}
+
+/**
+ * Knuth's algorithm D (TAOCP vol. 2, 4.3.1) on 64-bit limbs
+ *
+ * Each step estimates a whole quotient limb from the top two limbs of the running remainder and
+ * the top limb of the normalised divisor, which is off by at most two and is corrected in place.
+ *
+ * @tparam CAPACITY Upper bound on the number of limbs of the dividend
+ * @param u The dividend, of `m` limbs
+ * @param v The divisor, of `n` limbs, where 0 < n <= m and the top limb is not zero
+ * @param[out] q The `m - n + 1` limbs of the quotient
+ * @param[out] r The `n` limbs of the remainder
+ */
+template <std::size_t CAPACITY>
+void DivideLimbs(Limb const *u, std::size_t m, Limb const *v, std::size_t n, Limb *q, Limb *r)
+{
+  if (n == 1)
+  {
+    WideLimb remainder{0};
+    for (std::size_t j = m; j-- > 0;)
+    {
+      WideLimb const numerator = (remainder << LIMB_SIZE) | u[j];
+      q[j]                     = static_cast<Limb>(numerator / v[0]);
+      remainder                = numerator % v[0];
+    }
+    r[0] = static_cast<Limb>(remainder);
+    return;
+  }
+
+  // normalise so that the top bit of the divisor is set
+  auto const shift = static_cast<unsigned>(__builtin_clzll(v[n - 1]));
+
+  Limb un[CAPACITY + 1];
+  Limb vn[CAPACITY];
+  for (std::size_t i = n - 1; i > 0; --i)
+  {
+    vn[i] = (shift == 0) ? v[i] : (v[i] << shift) | (v[i - 1] >> (LIMB_SIZE - shift));
+  }
+  vn[0] = v[0] << shift;
+
+  un[m] = (shift == 0) ? 0 : u[m - 1] >> (LIMB_SIZE - shift);
+  for (std::size_t i = m - 1; i > 0; --i)
+  {
+    un[i] = (shift == 0) ? u[i] : (u[i] << shift) | (u[i - 1] >> (LIMB_SIZE - shift));
+  }
+  un[0] = u[0] << shift;
+
+  WideLimb const base{WideLimb{1} << LIMB_SIZE};
+  for (std::size_t j = m - n + 1; j-- > 0;)
+  {
+    // estimate the quotient limb and refine it with the second limb of the divisor
+    WideLimb const numerator = (static_cast<WideLimb>(un[j + n]) << LIMB_SIZE) | un[j + n - 1];
+    WideLimb       qhat      = numerator / vn[n - 1];
+    WideLimb       rhat      = numerator % vn[n - 1];
+    while ((qhat >= base) || (qhat * vn[n - 2] > ((rhat << LIMB_SIZE) | un[j + n - 2])))
+    {
+      --qhat;
+      rhat += vn[n - 1];
+      if (rhat >= base)
+      {
+        break;
+      }
+    }
+
+    // multiply and subtract
+    WideLimb carry{0};
+    Limb     borrow{0};
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      WideLimb const product = qhat * vn[i] + carry;
+      auto const     low     = static_cast<Limb>(product);
+      carry                  = product >> LIMB_SIZE;
+
+      Limb const difference = un[i + j] - low;
+      Limb const next       = ((un[i + j] < low) || (difference < borrow)) ? 1 : 0;
+      un[i + j]             = difference - borrow;
+      borrow                = next;
+    }
+    auto const top        = static_cast<Limb>(carry);
+    Limb const difference = un[j + n] - top;
+    bool const negative   = (un[j + n] < top) || (difference < borrow);
+    un[j + n]             = difference - borrow;
+
+    q[j] = static_cast<Limb>(qhat);
+
+    // the estimate was one too large, add the divisor back
+    if (negative)
+    {
+      --q[j];
+      WideLimb sum_carry{0};
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        WideLimb const sum = static_cast<WideLimb>(un[i + j]) + vn[i] + sum_carry;
+        un[i + j]          = static_cast<Limb>(sum);
+        sum_carry          = sum >> LIMB_SIZE;
+      }
+      un[j + n] += static_cast<Limb>(sum_carry);
+    }
+  }
+
+  // denormalise the remainder
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    r[i] = (shift == 0) ? un[i] : (un[i] >> shift) | (un[i + 1] << (LIMB_SIZE - shift));
+  }
+}
+
+}  // namespace details
 
 /* Implements a subset of big number functionality.
  *
@@ -207,6 +352,9 @@ public:
   constexpr UInt &operator<<=(std::size_t bits);
   constexpr UInt &operator>>=(std::size_t bits);
 
+  static constexpr void Divide(UInt const &dividend, UInt const &divisor, UInt &quotient,
+                               UInt &remainder);
+
   constexpr std::size_t msb() const;
   constexpr std::size_t lsb() const;
 
@@ -636,13 +784,14 @@ constexpr UInt<S> UInt<S>::operator^(UInt const &n) const
 template <uint16_t S>
 constexpr UInt<S> &UInt<S>::operator+=(UInt const &n)
 {
-  UInt::WideType carry = 0, new_carry = 0;
+  UInt::WideType carry = 0;
   for (std::size_t i = 0; i < WIDE_ELEMENTS; ++i)
   {
     // if sum of elements is smaller than the element itself, then we have overflow and carry
-    new_carry = (wide_[i] + n.ElementAt(i) + carry < wide_[i]) ? 1 : 0;
-    wide_[i] += n.ElementAt(i) + carry;
-    carry = new_carry;
+    UInt::WideType const sum = wide_[i] + n.ElementAt(i);
+    UInt::WideType const new_carry{((sum < wide_[i]) || (sum + carry < sum)) ? 1u : 0u};
+    wide_[i] = sum + carry;
+    carry    = new_carry;
   }
   return *this;
 }
@@ -654,134 +803,89 @@ constexpr UInt<S> &UInt<S>::operator-=(UInt const &n)
   {
     *this = _0;
   }
-  UInt::WideType carry = 0, new_carry = 0;
+  UInt::WideType carry = 0;
   for (std::size_t i = 0; i < WIDE_ELEMENTS; ++i)
   {
     // if diff of the elements is larger than the element itself, then we have underflow and carry
-    new_carry = (wide_[i] - n.ElementAt(i) - carry > wide_[i]) ? 1 : 0;
-    wide_[i] -= n.ElementAt(i) + carry;
-    carry = new_carry;
+    UInt::WideType const diff = wide_[i] - n.ElementAt(i);
+    UInt::WideType const new_carry{((diff > wide_[i]) || (diff < carry)) ? 1u : 0u};
+    wide_[i] = diff - carry;
+    carry    = new_carry;
   }
   return *this;
 }
 
-// Implementation for 256-bits only
-template <>
-constexpr UInt<256> &UInt<256>::operator*=(UInt<256> const &n)
+template <uint16_t S>
+constexpr UInt<S> &UInt<S>::operator*=(UInt const &n)
 {
-  // Calculate all products between each uint64_t element in the UInts
-  // Use int128_t type to hold the actual product.
-  __uint128_t products[WIDE_ELEMENTS][WIDE_ELEMENTS] = {};
+  // Only the limbs below the width of the number are computed, any bits of the product in the
+  // residual part of the top limb are discarded
+  WideContainerType product;
+  details::MultiplyLimbs(wide_.data(), WIDE_ELEMENTS, n.wide_.data(), WIDE_ELEMENTS,
+                         product.data(), WIDE_ELEMENTS);
+  wide_ = product;
+  mask_residual_bits();
 
-  for (std::size_t i = 0; i < WIDE_ELEMENTS; ++i)
-  {
-    for (std::size_t j = 0; j < WIDE_ELEMENTS; ++j)
-    {
-      // Note: C++14 does not have constexpr std::array, we need to cast the array
-      products[i][j] =
-          static_cast<__uint128_t>(wide_[i]) * static_cast<__uint128_t>(n.ElementAt(j));
-    }
-  }
+  return *this;
+}
+
+template <uint16_t S>
+constexpr UInt<S> &UInt<S>::operator/=(UInt const &n)
+{
+  UInt remainder;
+  Divide(*this, n, *this, remainder);
 
-  /* If a, b, two UInt<256> numbers, with the following elements (little endian order):
-   * |  a[3]  |  a[2]  |  a[1]  |  a[0]  |
-   * |  b[3]  |  b[2]  |  b[1]  |  b[0]  |
-   * Then both can be written in the following form:
-   * a = a[0] + (a[1] << 64) + (a[2] << 128) + (a[3] << 192)
-   * b = b[0] + (b[1] << 64) + (b[2] << 128) + (b[3] << 192)
-   *
-   * Then a * b is the following, truncating terms left shifted over 192 bits:
-   * a * b =  a[0] * b[0]
-   *       + (a[0] * b[1] + a[1] * b[0]) << 64
-   *       + (a[0] * b[2] + a[1] * b[1] + a[2] * b[0]) << 128
-   *       + (a[0] * b[3] + a[1] * b[2] + a[2] * b[1] + a[3] * b[0]) << 192
-   * In order to be accurate, we calculate these terms as 128-bit quantities and we add the
-   * high-64-bits as carry to the next term
-   */
-
-  __uint128_t carry = 0, terms[WIDE_ELEMENTS] = {};
-  terms[0] = products[0][0];
-  carry    = static_cast<WideType>(terms[0] >> WIDE_ELEMENT_SIZE);
-  terms[1] = products[0][1] + products[1][0] + carry;
-  carry    = static_cast<WideType>(terms[1] >> WIDE_ELEMENT_SIZE);
-  terms[2] = products[0][2] + products[1][1] + products[2][0] + carry;
-  carry    = static_cast<WideType>(terms[2] >> WIDE_ELEMENT_SIZE);
-  terms[3] = products[0][3] + products[1][2] + products[2][1] + products[3][0] + carry;
+  return *this;
+}
 
-  for (std::size_t i = 0; i < WIDE_ELEMENTS; ++i)
-  {
-    wide_[i] = static_cast<WideType>(terms[i]);
-  }
+template <uint16_t S>
+constexpr UInt<S> &UInt<S>::operator%=(UInt const &n)
+{
+  UInt quotient;
+  Divide(*this, n, quotient, *this);
 
   return *this;
 }
 
+/**
+ * Integer division with remainder
+ *
+ * Both outputs may alias either of the inputs.
+ *
+ * @param dividend The number to be divided
+ * @param divisor The number to divide by
+ * @param[out] quotient The quotient, rounded towards zero
+ * @param[out] remainder The remainder, dividend - quotient * divisor
+ * @throws std::runtime_error if the divisor is zero
+ */
 template <uint16_t S>
-constexpr UInt<S> &UInt<S>::operator/=(UInt<S> const &n)
+constexpr void UInt<S>::Divide(UInt const &dividend, UInt const &divisor, UInt &quotient,
+                               UInt &remainder)
 {
-  if (n == _0)
+  UInt u{dividend};
+  UInt v{divisor};
+  u.mask_residual_bits();
+  v.mask_residual_bits();
+
+  auto const m = u.TrimmedWideSize();
+  auto const n = v.TrimmedWideSize();
+  if (n == 0)
   {
     throw std::runtime_error("division by zero!");
   }
-  if (n == _1)
-  {
-    return *this;
-  }
-  if (*this == n)
-  {
-    *this = _1;
-    return *this;
-  }
-  if (*this == _0)
-  {
-    return *this;
-  }
-  // No fractions supported, if *this < n return 0
-  if (*this < n)
-  {
-    *this = _0;
-    return *this;
-  }
 
-  // Actual integer division algorithm
-  // First simplify dividend/divisor by shifting right by min LSB bit
-  // Essentially divide both by 2 as long as the LSB is zero
-  UInt        N{*this}, D{n};
-  std::size_t lsb = std::min(N.lsb(), D.lsb());
-  N >>= lsb;
-  D >>= lsb;
-  UInt multiple(1u);
-
-  auto const D_leading_zero_bits{D.UINT_SIZE - D.msb() - 1};
-  // Find smallest multiple of divisor (D) that is larger than the dividend (N)
-  D <<= D_leading_zero_bits;
-  multiple <<= D_leading_zero_bits;
-
-  // Calculate Quotient in a loop, essentially divide divisor by 2 and subtract from Remainder
-  // Add multiple to Quotient
-  UInt Q = _0, R = N;
-  do
-  {
-    if (R >= D)
-    {
-      R -= D;
-      Q += multiple;
-    }
-    D >>= 1;  // Divide by two.
-    multiple >>= 1;
-  } while (multiple != UInt::_0);
-  // Return the Quotient
-  *this = Q;
+  quotient.wide_.fill(0);
+  remainder.wide_.fill(0);
 
-  return *this;
-}
+  // No fractions supported, if dividend < divisor the quotient is 0
+  if (m < n)
+  {
+    remainder = u;
+    return;
+  }
 
-template <uint16_t S>
-constexpr UInt<S> &UInt<S>::operator%=(UInt const &n)
-{
-  UInt q = *this / n;
-  *this -= q * n;
-  return *this;
+  details::DivideLimbs<WIDE_ELEMENTS>(u.wide_.data(), m, v.wide_.data(), n,
+                                      quotient.wide_.data(), remainder.wide_.data());
 }
 
 template <uint16_t S>
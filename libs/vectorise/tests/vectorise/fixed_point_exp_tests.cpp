@@ -0,0 +1,234 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/fixed_point/fixed_point.hpp"
+#include "vectorise/math/standard_functions.hpp"
+#include "vectorise/vectorise.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+using fetch::fixed_point::fp64_t;
+
+template <std::size_t S>
+using Register = fetch::vectorise::VectorRegister<fp64_t, S>;
+
+// Values around which the kernels switch between cases, in raw representation
+std::vector<int64_t> EdgeValues()
+{
+  std::vector<int64_t> values{0,
+                              1,
+                              -1,
+                              fp64_t::_1.Data(),
+                              -fp64_t::_1.Data(),
+                              fp64_t::_half.Data(),
+                              fp64_t::MAX_EXP.Data(),
+                              fp64_t::MAX_EXP.Data() - 1,
+                              fp64_t::MIN_EXP.Data(),
+                              fp64_t::MIN_EXP.Data() + 1,
+                              fp64_t::MIN_EXP.Data() - 1,
+                              fp64_t::NaN.Data(),
+                              fp64_t::POSITIVE_INFINITY.Data(),
+                              fp64_t::NEGATIVE_INFINITY.Data(),
+                              fp64_t::MAX,
+                              fp64_t::MIN,
+                              INT64_MIN,
+                              int64_t{1} << 62,
+                              -(int64_t{1} << 62),
+                              (int64_t{1} << 62) - 1};
+
+  // Multiples of ln2, where the range reduction changes k
+  for (int64_t k = -32; k <= 32; ++k)
+  {
+    int64_t const multiple = k * fp64_t::CONST_LN2.Data();
+    values.push_back(multiple - 1);
+    values.push_back(multiple);
+    values.push_back(multiple + 1);
+  }
+
+  return values;
+}
+
+std::vector<int64_t> RandomValues(std::size_t count, uint64_t seed)
+{
+  std::mt19937_64                         rng(seed);
+  std::uniform_int_distribution<int64_t>  exp_range(fp64_t::MIN_EXP.Data() - (int64_t{1} << 32),
+                                                   fp64_t::MAX_EXP.Data() + (int64_t{1} << 32));
+  std::uniform_int_distribution<uint32_t> shift(0, 63);
+
+  std::vector<int64_t> values;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    values.push_back(exp_range(rng));
+    // Magnitudes spread over the whole raw range
+    values.push_back(static_cast<int64_t>(rng()) >> shift(rng));
+  }
+
+  return values;
+}
+
+template <std::size_t S, typename VectorFunction, typename ScalarFunction>
+void ExpectIdenticalToScalar(std::vector<int64_t> const &a, std::vector<int64_t> const &b,
+                             VectorFunction const &vector_function,
+                             ScalarFunction const &scalar_function)
+{
+  constexpr std::size_t N = Register<S>::E_BLOCK_COUNT;
+
+  for (std::size_t start = 0; start + N <= a.size(); start += N)
+  {
+    alignas(32) fp64_t x[N], y[N], expected[N], actual[N];
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      x[i] = fp64_t::FromBase(a[start + i]);
+      y[i] = fp64_t::FromBase(b[(start + i) % b.size()]);
+    }
+
+    fp64_t::StateClear();
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      expected[i] = scalar_function(x[i], y[i]);
+    }
+    auto const expected_state = fp64_t::fp_state;
+
+    fp64_t::StateClear();
+    vector_function(Register<S>(x), Register<S>(y)).Store(actual);
+    auto const actual_state = fp64_t::fp_state;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      ASSERT_EQ(expected[i].Data(), actual[i].Data())
+          << "x: " << x[i].Data() << " y: " << y[i].Data();
+    }
+    ASSERT_EQ(expected_state, actual_state);
+  }
+  fp64_t::StateClear();
+}
+
+template <std::size_t S>
+void CheckExp(std::vector<int64_t> const &values)
+{
+  ExpectIdenticalToScalar<S>(
+      values, values,
+      [](Register<S> const &x, Register<S> const &) { return fetch::vectorise::Exp(x); },
+      [](fp64_t const &x, fp64_t const &) { return fp64_t::Exp(x); });
+}
+
+template <std::size_t S>
+void CheckDivision(std::vector<int64_t> const &a, std::vector<int64_t> const &b)
+{
+  ExpectIdenticalToScalar<S>(
+      a, b, [](Register<S> const &x, Register<S> const &y) { return x / y; },
+      [](fp64_t const &x, fp64_t const &y) { return x / y; });
+}
+
+template <std::size_t S>
+void CheckSigmoid(std::vector<int64_t> const &values)
+{
+  ExpectIdenticalToScalar<S>(
+      values, values,
+      [](Register<S> const &x, Register<S> const &) { return fetch::vectorise::Sigmoid(x); },
+      [](fp64_t const &x, fp64_t const &) {
+        // The element wise definition of math::Sigmoid
+        if (x >= fp64_t::_0)
+        {
+          return fp64_t::_1 / (fp64_t::_1 + fp64_t::Exp(-x));
+        }
+        fp64_t const e = fp64_t::Exp(x);
+        return e / (e + fp64_t::_1);
+      });
+}
+
+template <std::size_t S>
+void CheckTanH(std::vector<int64_t> const &values)
+{
+  ExpectIdenticalToScalar<S>(
+      values, values,
+      [](Register<S> const &x, Register<S> const &) { return fetch::vectorise::TanH(x); },
+      [](fp64_t const &x, fp64_t const &) { return fp64_t::TanH(x); });
+}
+
+TEST(vectorise_fixed_point_exp_gtest, exp_is_identical_to_scalar)
+{
+  CheckExp<256>(EdgeValues());
+  CheckExp<128>(EdgeValues());
+  CheckExp<256>(RandomValues(100000, 42));
+  CheckExp<128>(RandomValues(10000, 43));
+}
+
+TEST(vectorise_fixed_point_exp_gtest, exp_of_consecutive_raw_values_is_identical_to_scalar)
+{
+  // Step through a dense run of raw values on both sides of every k
+  std::vector<int64_t> values;
+  for (int64_t k = -31; k <= 31; ++k)
+  {
+    for (int64_t offset = -64; offset < 64; ++offset)
+    {
+      values.push_back(k * fp64_t::CONST_LN2.Data() + offset);
+    }
+  }
+
+  CheckExp<256>(values);
+}
+
+TEST(vectorise_fixed_point_exp_gtest, division_is_identical_to_scalar)
+{
+  auto const edges = EdgeValues();
+  for (std::size_t rotation = 0; rotation < edges.size(); ++rotation)
+  {
+    std::vector<int64_t> divisors(edges.begin() + static_cast<std::ptrdiff_t>(rotation),
+                                  edges.end());
+    divisors.insert(divisors.end(), edges.begin(),
+                    edges.begin() + static_cast<std::ptrdiff_t>(rotation));
+    CheckDivision<256>(edges, divisors);
+    CheckDivision<128>(edges, divisors);
+  }
+
+  CheckDivision<256>(RandomValues(100000, 44), RandomValues(100000, 45));
+  CheckDivision<128>(RandomValues(10000, 46), RandomValues(10000, 47));
+}
+
+TEST(vectorise_fixed_point_exp_gtest, sigmoid_is_identical_to_scalar)
+{
+  CheckSigmoid<256>(EdgeValues());
+  CheckSigmoid<128>(EdgeValues());
+  CheckSigmoid<256>(RandomValues(100000, 48));
+  CheckSigmoid<128>(RandomValues(10000, 49));
+}
+
+TEST(vectorise_fixed_point_exp_gtest, tanh_is_identical_to_scalar)
+{
+  auto values = EdgeValues();
+  for (int64_t offset = -2; offset <= 2; ++offset)
+  {
+    values.push_back(fp64_t{21}.Data() + offset);
+    values.push_back(-fp64_t{21}.Data() + offset);
+  }
+
+  CheckTanH<256>(values);
+  CheckTanH<128>(values);
+  CheckTanH<256>(RandomValues(100000, 50));
+  CheckTanH<128>(RandomValues(10000, 51));
+}
+
+}  // namespace
@@ -18,6 +18,7 @@
 
 #include "core/byte_array/decoders.hpp"
 #include "core/byte_array/encoders.hpp"
+#include "vectorise/uint/legacy.hpp"
 #include "vectorise/uint/uint.hpp"
 #include "vm/module.hpp"
 #include "vm_modules/core/byte_array_wrapper.hpp"
@@ -35,6 +36,8 @@ using namespace fetch::vm;
 
 namespace {
 
+using UInt256 = UInt256Wrapper::UInt256;
+
 Ptr<String> ToString(VM *vm, Ptr<UInt256Wrapper> const &n)
 {
   return Ptr<String>{new String{vm, static_cast<std::string>(n->number())}};
@@ -61,6 +64,32 @@ Ptr<UInt256Wrapper> ConstructorFromBytesBigEndian(VM *vm, TypeId type_id,
   return {};
 }
 
+// Contracts executed for blocks before the arithmetic was corrected use the original kernels
+bool IsLegacyArithmetic(VM const *vm)
+{
+  return (vm != nullptr) && vm->legacy_uint256_arithmetic();
+}
+
+UInt256 Sum(VM const *vm, UInt256 const &a, UInt256 const &b)
+{
+  return IsLegacyArithmetic(vm) ? vectorise::legacy::Add(a, b) : a + b;
+}
+
+UInt256 Difference(VM const *vm, UInt256 const &a, UInt256 const &b)
+{
+  return IsLegacyArithmetic(vm) ? vectorise::legacy::Subtract(a, b) : a - b;
+}
+
+UInt256 Product(VM const *vm, UInt256 const &a, UInt256 const &b)
+{
+  return IsLegacyArithmetic(vm) ? vectorise::legacy::Multiply(a, b) : a * b;
+}
+
+UInt256 Quotient(VM const *vm, UInt256 const &a, UInt256 const &b)
+{
+  return IsLegacyArithmetic(vm) ? vectorise::legacy::Divide(a, b) : a / b;
+}
+
 }  // namespace
 
 void UInt256Wrapper::Bind(Module &module)
@@ -236,17 +265,17 @@ void UInt256Wrapper::Add(Ptr<Object> &lhso, Ptr<Object> &rhso)
   auto &rhs = static_cast<Ptr<UInt256Wrapper> const &>(rhso);
   if (lhs->IsTemporary())
   {
-    lhs->number_ += rhs->number_;
+    lhs->number_ = Sum(vm_, lhs->number_, rhs->number_);
     return;
   }
   if (rhs->IsTemporary())
   {
-    rhs->number_ += lhs->number_;
+    rhs->number_ = Sum(vm_, rhs->number_, lhs->number_);
     lhso = rhs;
     return;
   }
 
-  Ptr<UInt256Wrapper> n{new UInt256Wrapper{vm_, GetTypeId(), lhs->number_ + rhs->number_}};
+  Ptr<UInt256Wrapper> n{new UInt256Wrapper{vm_, GetTypeId(), Sum(vm_, lhs->number_, rhs->number_)}};
   lhso = std::move(n);
 }
 
@@ -256,11 +285,11 @@ void UInt256Wrapper::Subtract(Ptr<Object> &lhso, Ptr<Object> &rhso)
   auto &rhs = static_cast<Ptr<UInt256Wrapper> const &>(rhso);
   if (lhs->IsTemporary())
   {
-    lhs->number_ -= rhs->number_;
+    lhs->number_ = Difference(vm_, lhs->number_, rhs->number_);
     return;
   }
 
-  Ptr<UInt256Wrapper> n(new UInt256Wrapper(vm_, lhs->number_ - rhs->number_));
+  Ptr<UInt256Wrapper> n(new UInt256Wrapper(vm_, Difference(vm_, lhs->number_, rhs->number_)));
   lhso = std::move(n);
 }
 
@@ -268,14 +297,14 @@ void UInt256Wrapper::InplaceAdd(Ptr<Object> const &lhso, Ptr<Object> const &rhso
 {
   auto &lhs = static_cast<Ptr<UInt256Wrapper> const &>(lhso);
   auto &rhs = static_cast<Ptr<UInt256Wrapper> const &>(rhso);
-  lhs->number_ += rhs->number_;
+  lhs->number_ = Sum(vm_, lhs->number_, rhs->number_);
 }
 
 void UInt256Wrapper::InplaceSubtract(Ptr<Object> const &lhso, Ptr<Object> const &rhso)
 {
   auto &lhs = static_cast<Ptr<UInt256Wrapper> const &>(lhso);
   auto &rhs = static_cast<Ptr<UInt256Wrapper> const &>(rhso);
-  lhs->number_ -= rhs->number_;
+  lhs->number_ = Difference(vm_, lhs->number_, rhs->number_);
 }
 
 void UInt256Wrapper::Multiply(Ptr<Object> &lhso, Ptr<Object> &rhso)
@@ -284,16 +313,16 @@ void UInt256Wrapper::Multiply(Ptr<Object> &lhso, Ptr<Object> &rhso)
   auto &rhs = static_cast<Ptr<UInt256Wrapper> const &>(rhso);
   if (lhs->IsTemporary())
   {
-    lhs->number_ *= rhs->number_;
+    lhs->number_ = Product(vm_, lhs->number_, rhs->number_);
     return;
   }
   if (rhs->IsTemporary())
   {
-    rhs->number_ *= lhs->number_;
+    rhs->number_ = Product(vm_, rhs->number_, lhs->number_);
     lhso = rhs;
     return;
   }
-  Ptr<UInt256Wrapper> n(new UInt256Wrapper(vm_, lhs->number_ * rhs->number_));
+  Ptr<UInt256Wrapper> n(new UInt256Wrapper(vm_, Product(vm_, lhs->number_, rhs->number_)));
   lhso = std::move(n);
 }
 
@@ -301,7 +330,7 @@ void UInt256Wrapper::InplaceMultiply(Ptr<Object> const &lhso, Ptr<Object> const
 {
   auto &lhs = static_cast<Ptr<UInt256Wrapper> const &>(lhso);
   auto &rhs = static_cast<Ptr<UInt256Wrapper> const &>(rhso);
-  lhs->number_ *= rhs->number_;
+  lhs->number_ = Product(vm_, lhs->number_, rhs->number_);
 }
 
 void UInt256Wrapper::Divide(Ptr<Object> &lhso, Ptr<Object> &rhso)
@@ -315,11 +344,11 @@ void UInt256Wrapper::Divide(Ptr<Object> &lhso, Ptr<Object> &rhso)
   }
   if (lhs->IsTemporary())
   {
-    lhs->number_ /= rhs->number_;
+    lhs->number_ = Quotient(vm_, lhs->number_, rhs->number_);
     return;
   }
 
-  Ptr<UInt256Wrapper> n(new UInt256Wrapper(vm_, lhs->number_ / rhs->number_));
+  Ptr<UInt256Wrapper> n(new UInt256Wrapper(vm_, Quotient(vm_, lhs->number_, rhs->number_)));
   lhso = std::move(n);
 }
 
@@ -329,7 +358,7 @@ void UInt256Wrapper::InplaceDivide(Ptr<Object> const &lhso, Ptr<Object> const &r
   auto &rhs = static_cast<Ptr<UInt256Wrapper> const &>(rhso);
   try
   {
-    lhs->number_ /= rhs->number_;
+    lhs->number_ = Quotient(vm_, lhs->number_, rhs->number_);
   }
   catch (std::exception const &ex)
   {
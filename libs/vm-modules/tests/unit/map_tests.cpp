@@ -0,0 +1,262 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm/map.hpp"
+#include "vm_modules/test_utilities/vm_test_toolkit.hpp"
+
+#include "gmock/gmock.h"
+
+#include <sstream>
+#include <string>
+
+using namespace fetch::vm;
+
+namespace {
+
+class MapTests : public ::testing::Test
+{
+public:
+  std::stringstream stdout;
+  VmTestToolkit     toolkit{&stdout};
+
+  // Serialised form of the map returned by the main function of the source
+  std::string SerialiseMap(char const *text)
+  {
+    Variant result;
+    if (!toolkit.Compile(text) || !toolkit.Run(&result))
+    {
+      return {};
+    }
+
+    MsgPackSerializer buffer;
+    if (!result.Get<Ptr<IMap>>()->SerializeTo(buffer))
+    {
+      return {};
+    }
+
+    return std::string{buffer.data()};
+  }
+};
+
+TEST_F(MapTests, int32_keys_can_be_stored_and_updated)
+{
+  static char const *TEXT = R"(
+    function main()
+      var data = Map<Int32, Int64>();
+      for (i in 0:1000)
+        data[i * 7] = toInt64(i);
+      endfor
+
+      for (i in 0:1000)
+        data[i * 7] = data[i * 7] + 1i64;
+      endfor
+
+      var sum = 0i64;
+      for (i in 0:1000)
+        sum = sum + data[i * 7];
+      endfor
+
+      print(data.count());
+      print(',');
+      print(sum);
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run());
+
+  ASSERT_EQ(stdout.str(), "1000,500500");
+}
+
+TEST_F(MapTests, string_keys_can_be_stored_and_updated)
+{
+  static char const *TEXT = R"(
+    function main()
+      var data = Map<String, Int32>();
+      data["alpha"] = 1;
+      data["beta"] = 2;
+      data["alpha"] = 3;
+      data["al" + "pha"] = data["alpha"] + 1;
+
+      print(data.count());
+      print(',');
+      print(data["alpha"]);
+      print(',');
+      print(data["beta"]);
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run());
+
+  ASSERT_EQ(stdout.str(), "2,4,2");
+}
+
+TEST_F(MapTests, address_keys_can_be_stored_and_updated)
+{
+  static char const *TEXT = R"(
+    function main()
+      var data = Map<Address, UInt64>();
+      data[Address("MnrRHdvCkdZodEwM855vemS5V3p2hiWmcSQ8JEzD4ZjPdsYtB")] = 100u64;
+      data[Address("2ifr5dSFRAnXexBMC3HYEVp3JHSuz7KBPXWDRBV4xdFrqGy6R9")] = 20u64;
+      data[Address("MnrRHdvCkdZodEwM855vemS5V3p2hiWmcSQ8JEzD4ZjPdsYtB")] = 50u64;
+
+      print(data.count());
+      print(',');
+      print(data[Address("MnrRHdvCkdZodEwM855vemS5V3p2hiWmcSQ8JEzD4ZjPdsYtB")]);
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run());
+
+  ASSERT_EQ(stdout.str(), "2,50");
+}
+
+TEST_F(MapTests, missing_key_is_a_runtime_error)
+{
+  static char const *TEXT = R"(
+    function main()
+      var data = Map<String, Int32>();
+      data["present"] = 1;
+      print(data["missing"]);
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_FALSE(toolkit.Run());
+}
+
+TEST_F(MapTests, serialisation_does_not_depend_on_insertion_order)
+{
+  static char const *FORWARD = R"(
+    function main() : Map<String, Int32>
+      var data = Map<String, Int32>();
+      data["a"] = 1;
+      data["m"] = 2;
+      data["x"] = 3;
+      return data;
+    endfunction
+  )";
+
+  static char const *BACKWARD = R"(
+    function main() : Map<String, Int32>
+      var data = Map<String, Int32>();
+      data["x"] = 3;
+      data["m"] = 2;
+      data["a"] = 1;
+      return data;
+    endfunction
+  )";
+
+  auto const forward = SerialiseMap(FORWARD);
+  ASSERT_FALSE(forward.empty());
+  EXPECT_EQ(forward, SerialiseMap(BACKWARD));
+}
+
+TEST_F(MapTests, nan_and_signed_zero_fixed_point_keys_are_each_a_single_key)
+{
+  static char const *TEXT = R"(
+    function main()
+      var fp32 = Map<Fixed32, Int32>();
+      fp32[sqrt(-1.0fp32)] = 1;
+      fp32[sqrt(-2.0fp32)] = 2;
+      fp32[0.0fp32] = 3;
+      fp32[-0.0fp32] = 4;
+
+      var fp64 = Map<Fixed64, Int32>();
+      fp64[sqrt(-1.0fp64)] = 1;
+      fp64[sqrt(-2.0fp64)] = 2;
+      fp64[0.0fp64] = 3;
+      fp64[-0.0fp64] = 4;
+
+      var fp128 = Map<Fixed128, Int32>();
+      fp128[sqrt(-1.0fp128)] = 1;
+      fp128[sqrt(-2.0fp128)] = 2;
+      fp128[0.0fp128] = 3;
+      fp128[-0.0fp128] = 4;
+
+      print(fp32.count());
+      print(fp32[sqrt(-3.0fp32)]);
+      print(fp32[0.0fp32]);
+      print(',');
+      print(fp64.count());
+      print(fp64[sqrt(-3.0fp64)]);
+      print(fp64[0.0fp64]);
+      print(',');
+      print(fp128.count());
+      print(fp128[sqrt(-3.0fp128)]);
+      print(fp128[0.0fp128]);
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run());
+
+  ASSERT_EQ(stdout.str(), "224,224,224");
+}
+
+TEST_F(MapTests, serialisation_of_nan_fixed_point_keys_does_not_depend_on_insertion_order)
+{
+  static char const *FORWARD = R"(
+    function main() : Map<Fixed64, Int32>
+      var data = Map<Fixed64, Int32>();
+      data[-1.5fp64] = 1;
+      data[sqrt(-1.0fp64)] = 2;
+      data[0.0fp64] = 3;
+      data[2.5fp64] = 4;
+      return data;
+    endfunction
+  )";
+
+  static char const *BACKWARD = R"(
+    function main() : Map<Fixed64, Int32>
+      var data = Map<Fixed64, Int32>();
+      data[2.5fp64] = 4;
+      data[0.0fp64] = 3;
+      data[sqrt(-1.0fp64)] = 2;
+      data[-1.5fp64] = 1;
+      return data;
+    endfunction
+  )";
+
+  auto const forward = SerialiseMap(FORWARD);
+  ASSERT_FALSE(forward.empty());
+  EXPECT_EQ(forward, SerialiseMap(BACKWARD));
+}
+
+TEST_F(MapTests, first_of_duplicated_keys_is_kept_when_deserialising)
+{
+  static char const *TEXT = R"(
+    function main() : Int32
+      var data = State<Map<Int32, Int32>>("data").get(Map<Int32, Int32>());
+      assert(data.count() == 1);
+      return data[1];
+    endfunction
+  )";
+
+  // a serialised map of two elements with the same key, {1: 10} followed by {1: 20}
+  toolkit.AddState("data", "82010a0114");
+
+  Variant result;
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run(&result));
+  EXPECT_EQ(10, result.Get<int32_t>());
+}
+
+}  // namespace
@@ -620,6 +620,28 @@ TEST_F(UInt256Tests, uint256_division_by_zero)
   EXPECT_FALSE(toolkit.Run());
 }
 
+TEST_F(UInt256Tests, uint256_legacy_arithmetic_is_selected_by_the_vm)
+{
+  // 1 + (2^128 - 1), where the original addition loses the carry out of the first limb
+  static constexpr char const *TEXT = R"(
+      function main() : Bool
+        var m = UInt256(18446744073709551615u64);
+        var x = m * m + m + m;
+        return (UInt256(1u64) + x) == (x + UInt256(1u64));
+      endfunction
+    )";
+
+  Variant res;
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run(&res));
+  EXPECT_TRUE(res.Get<bool>());
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  toolkit.vm().SetLegacyUInt256Arithmetic(true);
+  ASSERT_TRUE(toolkit.Run(&res));
+  EXPECT_FALSE(res.Get<bool>());
+}
+
 TEST_F(UInt256Tests, uint256_size)
 {
   static constexpr char const *TEXT = R"(
@@ -0,0 +1,203 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace fetch {
+namespace vm {
+
+class Arena;
+using ArenaPtr = std::shared_ptr<Arena>;
+
+/**
+ * Monotonic (bump pointer) allocator backing the objects created during a single compilation.
+ *
+ * Memory is carved out of chunks of doubling size and is never handed back individually: it is
+ * released all at once when the arena is destroyed. Allocation is not thread safe, but the arena
+ * counts the blocks it has handed out and is only destroyed once its owners have released it and
+ * every block has been returned, whichever thread that happens on.
+ */
+class Arena
+{
+public:
+  static constexpr std::size_t INITIAL_CHUNK_SIZE = 4 * 1024;
+  static constexpr std::size_t MAX_CHUNK_SIZE     = 256 * 1024;
+
+  static ArenaPtr Create(std::size_t initial_chunk_size = INITIAL_CHUNK_SIZE);
+
+  // Construction / Destruction
+  Arena(Arena const &) = delete;
+  Arena(Arena &&)      = delete;
+  ~Arena()             = default;
+
+  void *Allocate(std::size_t size, std::size_t alignment);
+  void  Acquire() noexcept;
+  void  Release() noexcept;
+
+  std::size_t allocated() const;
+  std::size_t reserved() const;
+
+  // Operators
+  Arena &operator=(Arena const &) = delete;
+  Arena &operator=(Arena &&) = delete;
+
+private:
+  using Chunk = std::unique_ptr<uint8_t[]>;
+
+  explicit Arena(std::size_t initial_chunk_size);
+
+  void *AllocateFromNewChunk(std::size_t size, std::size_t alignment);
+
+  std::size_t              next_chunk_size_;
+  std::vector<Chunk>       chunks_;
+  uint8_t *                head_{nullptr};
+  uint8_t *                tail_{nullptr};
+  std::size_t              allocated_{0};
+  std::size_t              reserved_{0};
+  std::atomic<std::size_t> references_{1};
+};
+
+inline void *Arena::Allocate(std::size_t size, std::size_t alignment)
+{
+  auto const head    = reinterpret_cast<std::uintptr_t>(head_);
+  auto const aligned = (head + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+
+  if ((head_ != nullptr) && (aligned + size <= reinterpret_cast<std::uintptr_t>(tail_)))
+  {
+    head_ = reinterpret_cast<uint8_t *>(aligned + size);
+    allocated_ += size;
+
+    return reinterpret_cast<void *>(aligned);
+  }
+
+  return AllocateFromNewChunk(size, alignment);
+}
+
+inline void Arena::Acquire() noexcept
+{
+  references_.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void Arena::Release() noexcept
+{
+  if (references_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+  {
+    delete this;
+  }
+}
+
+/**
+ * Standard allocator handing out memory from an arena. Every block it allocates holds a reference
+ * on the arena, so objects created through std::allocate_shared keep it alive for as long as they
+ * are referenced. Returning a block only drops that reference.
+ */
+template <typename T>
+class ArenaAllocator
+{
+public:
+  using value_type = T;
+
+  explicit ArenaAllocator(Arena &arena) noexcept
+    : arena_{&arena}
+  {}
+
+  template <typename U>
+  ArenaAllocator(ArenaAllocator<U> const &other) noexcept  // NOLINT
+    : arena_{&other.arena()}
+  {}
+
+  T *allocate(std::size_t n)
+  {
+    void *block = arena_->Allocate(n * sizeof(T), alignof(T));
+    arena_->Acquire();
+
+    return static_cast<T *>(block);
+  }
+
+  void deallocate(T * /*block*/, std::size_t /*n*/) noexcept
+  {
+    arena_->Release();
+  }
+
+  Arena &arena() const noexcept
+  {
+    return *arena_;
+  }
+
+private:
+  Arena *arena_;
+};
+
+template <typename T, typename U>
+bool operator==(ArenaAllocator<T> const &a, ArenaAllocator<U> const &b) noexcept
+{
+  return &a.arena() == &b.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(ArenaAllocator<T> const &a, ArenaAllocator<U> const &b) noexcept
+{
+  return !(a == b);
+}
+
+/**
+ * Makes an arena the target of AllocateShared on the calling thread for the lifetime of the
+ * scope. Scopes nest: the previously active arena is restored on destruction.
+ */
+class ArenaScope
+{
+public:
+  // Construction / Destruction
+  explicit ArenaScope(ArenaPtr arena);
+  ArenaScope(ArenaScope const &) = delete;
+  ArenaScope(ArenaScope &&)      = delete;
+  ~ArenaScope();
+
+  static ArenaPtr const &Current();
+
+  // Operators
+  ArenaScope &operator=(ArenaScope const &) = delete;
+  ArenaScope &operator=(ArenaScope &&) = delete;
+
+private:
+  ArenaPtr previous_;
+};
+
+/**
+ * Create a shared object in the arena of the active scope, or on the heap when there is none
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> AllocateShared(Args &&... args)
+{
+  ArenaPtr const &arena = ArenaScope::Current();
+  if (arena)
+  {
+    return std::allocate_shared<T>(ArenaAllocator<T>{*arena}, std::forward<Args>(args)...);
+  }
+
+  return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+}  // namespace vm
+}  // namespace fetch
@@ -17,6 +17,7 @@
 //
 //------------------------------------------------------------------------------
 
+#include "vm/arena.hpp"
 #include "vm/common.hpp"
 #include "vm/opcodes.hpp"
 
@@ -101,7 +102,7 @@ struct IRType
 
 inline IRTypePtr CreateIRType(TypeKind type_kind, std::string name)
 {
-  return std::make_shared<IRType>(type_kind, std::move(name));
+  return AllocateShared<IRType>(type_kind, std::move(name));
 }
 
 struct IRVariable
@@ -128,7 +129,7 @@ struct IRVariable
 
 inline IRVariablePtr CreateIRVariable(VariableKind variable_kind, std::string name, bool referenced)
 {
-  return std::make_shared<IRVariable>(variable_kind, std::move(name), referenced);
+  return AllocateShared<IRVariable>(variable_kind, std::move(name), referenced);
 }
 
 struct IRFunction
@@ -157,7 +158,7 @@ struct IRFunction
 inline IRFunctionPtr CreateIRFunction(FunctionKind function_kind, std::string name,
                                       std::string unique_name)
 {
-  return std::make_shared<IRFunction>(function_kind, std::move(name), std::move(unique_name));
+  return AllocateShared<IRFunction>(function_kind, std::move(name), std::move(unique_name));
 }
 
 struct IRNode;
@@ -209,8 +210,8 @@ struct IRNode
 inline IRNodePtr CreateIRBasicNode(NodeKind node_kind, std::string text, uint16_t line,
                                    IRNodePtrArray children)
 {
-  return std::make_shared<IRNode>(NodeCategory::Basic, node_kind, std::move(text), line,
-                                  std::move(children));
+  return AllocateShared<IRNode>(NodeCategory::Basic, node_kind, std::move(text), line,
+                                std::move(children));
 }
 
 struct IRBlockNode : public IRNode
@@ -246,9 +247,9 @@ inline IRBlockNodePtr CreateIRBlockNode(NodeKind node_kind, std::string text, ui
                                         std::string block_terminator_text,
                                         uint16_t    block_terminator_line)
 {
-  return std::make_shared<IRBlockNode>(node_kind, std::move(text), line, std::move(children),
-                                       std::move(block_children), std::move(block_terminator_text),
-                                       block_terminator_line);
+  return AllocateShared<IRBlockNode>(node_kind, std::move(text), line, std::move(children),
+                                     std::move(block_children), std::move(block_terminator_text),
+                                     block_terminator_line);
 }
 
 struct IRExpressionNode : public IRNode
@@ -310,9 +311,9 @@ inline IRExpressionNodePtr CreateIRExpressionNode(NodeKind node_kind, std::strin
                                                   IRVariablePtr variable, IRFunctionPtr function,
                                                   IRTypePtr owner)
 {
-  return std::make_shared<IRExpressionNode>(node_kind, std::move(text), line, std::move(children),
-                                            expression_kind, std::move(type), std::move(variable),
-                                            std::move(function), std::move(owner));
+  return AllocateShared<IRExpressionNode>(node_kind, std::move(text), line, std::move(children),
+                                          expression_kind, std::move(type), std::move(variable),
+                                          std::move(function), std::move(owner));
 }
 
 inline IRBlockNodePtr ConvertToIRBlockNodePtr(IRNodePtr const &node)
@@ -17,12 +17,22 @@
 //
 //------------------------------------------------------------------------------
 
+#include "crypto/sip_hash.hpp"
 #include "vectorise/fixed_point/fixed_point.hpp"
+#include "vm/address.hpp"
+#include "vm/fixed.hpp"
+#include "vm/string.hpp"
 #include "vm/vm.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <map>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 namespace fetch {
 namespace vm {
@@ -48,6 +58,24 @@ protected:
   {}
 };
 
+/**
+ * The value by which keys are compared. Fixed point keys are compared by their raw representation,
+ * which unlike their numeric comparisons is a total order (NaN is equal to itself) and agrees with
+ * them for every other value
+ */
+template <typename T>
+T MapKeyValue(T const &value)
+{
+  return value;
+}
+
+template <uint16_t I, uint16_t F>
+typename fixed_point::FixedPoint<I, F>::Type MapKeyValue(
+    fixed_point::FixedPoint<I, F> const &value)
+{
+  return value.Data();
+}
+
 template <typename T, typename = void>
 struct MapComparator;
 
@@ -57,7 +85,7 @@ struct MapComparator<T, IfIsPrimitive<T>>
   constexpr bool operator()(fetch::vm::TemplateParameter1 const &lhs,
                             fetch::vm::TemplateParameter1 const &rhs) const
   {
-    return lhs.primitive.Get<T>() < rhs.primitive.Get<T>();
+    return MapKeyValue(lhs.primitive.Get<T>()) < MapKeyValue(rhs.primitive.Get<T>());
   }
 };
 
@@ -71,6 +99,289 @@ struct MapComparator<T, IfIsPtr<T>>
   }
 };
 
+template <>
+struct MapComparator<Ptr<Fixed128>>
+{
+  bool operator()(fetch::vm::TemplateParameter1 const &lhs,
+                  fetch::vm::TemplateParameter1 const &rhs) const
+  {
+    return MapKeyValue(static_cast<Fixed128 const &>(*lhs.object).data_) <
+           MapKeyValue(static_cast<Fixed128 const &>(*rhs.object).data_);
+  }
+};
+
+/**
+ * Keys which can be hashed by value: primitives, strings and addresses. Maps with these keys are
+ * hashed, any other object keys are kept ordered with the MapComparator
+ */
+template <typename T>
+static constexpr bool IsHashableMapKey =
+    IsPrimitive<T> || std::is_same<T, Ptr<String>>::value || std::is_same<T, Ptr<Address>>::value;
+
+/**
+ * The keyed hash of map keys. Its key is drawn once per process, so keys which collide can not be
+ * chosen in advance by the author of a contract
+ */
+inline crypto::SipHash const &MapKeyHash()
+{
+  static crypto::SipHash const hash{crypto::SipHash::RandomKey()};
+  return hash;
+}
+
+template <typename T, typename = void>
+struct MapKeyHasher;
+
+template <typename T>
+struct MapKeyHasher<T, IfIsPrimitive<T>>
+{
+  std::size_t operator()(TemplateParameter1 const &key) const
+  {
+    T const  value = key.primitive.Get<T>();
+    uint64_t bits{0};
+    std::memcpy(&bits, &value, sizeof(value));
+    return static_cast<std::size_t>(MapKeyHash()(bits));
+  }
+
+  bool Equal(TemplateParameter1 const &lhs, TemplateParameter1 const &rhs) const
+  {
+    return MapKeyValue(lhs.primitive.Get<T>()) == MapKeyValue(rhs.primitive.Get<T>());
+  }
+};
+
+template <>
+struct MapKeyHasher<Ptr<String>>
+{
+  static std::string const &Value(TemplateParameter1 const &key)
+  {
+    return static_cast<String const &>(*key.object).string();
+  }
+
+  std::size_t operator()(TemplateParameter1 const &key) const
+  {
+    std::string const &value = Value(key);
+    return static_cast<std::size_t>(MapKeyHash()(value.data(), value.size()));
+  }
+
+  bool Equal(TemplateParameter1 const &lhs, TemplateParameter1 const &rhs) const
+  {
+    return Value(lhs) == Value(rhs);
+  }
+};
+
+template <>
+struct MapKeyHasher<Ptr<Address>>
+{
+  static chain::Address const &Value(TemplateParameter1 const &key)
+  {
+    return static_cast<Address const &>(*key.object).address();
+  }
+
+  std::size_t operator()(TemplateParameter1 const &key) const
+  {
+    auto const &value = Value(key).address();
+    return static_cast<std::size_t>(MapKeyHash()(value.pointer(), value.size()));
+  }
+
+  bool Equal(TemplateParameter1 const &lhs, TemplateParameter1 const &rhs) const
+  {
+    return Value(lhs) == Value(rhs);
+  }
+};
+
+/**
+ * Storage of the elements of a map with keys which can not be hashed, in key order
+ */
+template <typename Key, typename = void>
+class MapStorage
+{
+public:
+  std::size_t size() const
+  {
+    return elements_.size();
+  }
+
+  TemplateParameter2 *Find(TemplateParameter1 const &key)
+  {
+    auto it = elements_.find(key);
+    return (it != elements_.end()) ? &it->second : nullptr;
+  }
+
+  void Set(TemplateParameter1 const &key, TemplateParameter2 const &value)
+  {
+    elements_[key] = value;
+  }
+
+  // Adds the element unless the key is already present, in which case the map is unchanged
+  void Insert(TemplateParameter1 const &key, TemplateParameter2 const &value)
+  {
+    elements_.emplace(key, value);
+  }
+
+  template <typename Visitor>
+  bool VisitInKeyOrder(Visitor &&visitor) const
+  {
+    for (auto const &element : elements_)
+    {
+      if (!visitor(element.first, element.second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+private:
+  std::map<TemplateParameter1, TemplateParameter2, MapComparator<Key>> elements_;
+};
+
+/**
+ * Storage of the elements of a map with hashable keys. Elements are kept in insertion order and
+ * found through an open addressed (linear probing) table of their indices, so lookups are O(1) and
+ * iteration is deterministic
+ */
+template <typename Key>
+class MapStorage<Key, std::enable_if_t<IsHashableMapKey<Key>>>
+{
+public:
+  std::size_t size() const
+  {
+    return elements_.size();
+  }
+
+  TemplateParameter2 *Find(TemplateParameter1 const &key)
+  {
+    if (elements_.empty())
+    {
+      return nullptr;
+    }
+
+    uint32_t const index = slots_[Probe(key, hasher_(key))];
+    return (index != EMPTY_SLOT) ? &elements_[index].value : nullptr;
+  }
+
+  void Set(TemplateParameter1 const &key, TemplateParameter2 const &value)
+  {
+    Emplace(key, value, true);
+  }
+
+  // Adds the element unless the key is already present, in which case the map is unchanged
+  void Insert(TemplateParameter1 const &key, TemplateParameter2 const &value)
+  {
+    Emplace(key, value, false);
+  }
+
+  template <typename Visitor>
+  bool VisitInKeyOrder(Visitor &&visitor) const
+  {
+    std::vector<Element const *> ordered;
+    ordered.reserve(elements_.size());
+    for (auto const &element : elements_)
+    {
+      ordered.push_back(&element);
+    }
+
+    MapComparator<Key> const compare{};
+    std::sort(ordered.begin(), ordered.end(), [&compare](Element const *lhs, Element const *rhs) {
+      return compare(lhs->key, rhs->key);
+    });
+
+    for (auto const *element : ordered)
+    {
+      if (!visitor(element->key, element->value))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+private:
+  struct Element
+  {
+    TemplateParameter1 key;
+    TemplateParameter2 value;
+    std::size_t        hash;
+  };
+
+  static constexpr uint32_t    EMPTY_SLOT = std::numeric_limits<uint32_t>::max();
+  static constexpr std::size_t MIN_SLOTS  = 16;
+
+  void Emplace(TemplateParameter1 const &key, TemplateParameter2 const &value, bool replace)
+  {
+    // keep the table at most half full
+    if (((elements_.size() + 1) * 2) > slots_.size())
+    {
+      Rehash(slots_.empty() ? MIN_SLOTS : slots_.size() * 2);
+    }
+
+    std::size_t const hash  = hasher_(key);
+    uint32_t &        index = slots_[Probe(key, hash)];
+
+    if (index != EMPTY_SLOT)
+    {
+      if (replace)
+      {
+        elements_[index].value = value;
+      }
+      return;
+    }
+
+    index = static_cast<uint32_t>(elements_.size());
+    elements_.push_back({key, value, hash});
+  }
+
+  // The bits of the keyed hash are uniform, so the table is indexed by the highest of them
+  std::size_t HomeSlot(std::size_t hash) const
+  {
+    return static_cast<std::size_t>(static_cast<uint64_t>(hash) >> shift_);
+  }
+
+  // The slot holding the key, or otherwise the empty slot where it would be inserted
+  std::size_t Probe(TemplateParameter1 const &key, std::size_t hash) const
+  {
+    std::size_t const mask = slots_.size() - 1;
+    for (std::size_t slot = HomeSlot(hash);; slot = (slot + 1) & mask)
+    {
+      uint32_t const index = slots_[slot];
+      if ((index == EMPTY_SLOT) ||
+          ((elements_[index].hash == hash) && hasher_.Equal(elements_[index].key, key)))
+      {
+        return slot;
+      }
+    }
+  }
+
+  void Rehash(std::size_t num_slots)
+  {
+    slots_.assign(num_slots, uint32_t{EMPTY_SLOT});
+
+    shift_ = 64;
+    for (std::size_t n = num_slots; n > 1; n >>= 1u)
+    {
+      --shift_;
+    }
+
+    std::size_t const mask = num_slots - 1;
+    for (uint32_t index = 0; index < elements_.size(); ++index)
+    {
+      std::size_t slot = HomeSlot(elements_[index].hash);
+      while (slots_[slot] != EMPTY_SLOT)
+      {
+        slot = (slot + 1) & mask;
+      }
+
+      slots_[slot] = index;
+    }
+  }
+
+  std::vector<Element>  elements_;
+  std::vector<uint32_t> slots_;
+  uint32_t              shift_{64};
+  MapKeyHasher<Key>     hasher_{};
+};
+
 template <typename Key, typename Value>
 struct Map : public IMap
 {
@@ -86,11 +397,10 @@ struct Map : public IMap
 
   TemplateParameter2 *Find(TemplateParameter1 const &key)
   {
-    auto it = map.find(key);
-    if (it != map.end())
+    TemplateParameter2 *value = map.Find(key);
+    if (value != nullptr)
     {
-      TemplateParameter2 &value = it->second;
-      return &value;
+      return value;
     }
     RuntimeError("map key does not exist");
     return nullptr;
@@ -127,7 +437,7 @@ struct Map : public IMap
   template <typename U>
   IfIsPrimitive<U> Store(TemplateParameter1 const &key, TemplateParameter2 const &value)
   {
-    map[key] = value;
+    map.Set(key, value);
   }
 
   template <typename U>
@@ -135,7 +445,7 @@ struct Map : public IMap
   {
     if (key.object)
     {
-      map[key] = value;
+      map.Set(key, value);
       return;
     }
     RuntimeError("map key is null reference");
@@ -151,23 +461,19 @@ struct Map : public IMap
     auto constructor = buffer.NewMapConstructor();
     auto map_ser     = constructor(map.size());
 
-    for (auto const &v : map)
-    {
-      auto f1 = [&v, this](MsgPackSerializer &serializer) {
-        return SerializeElement<Key>(serializer, v.first);
-      };
+    // elements are always serialised in key order, independent of how they are stored
+    return map.VisitInKeyOrder(
+        [&map_ser, this](TemplateParameter1 const &key, TemplateParameter2 const &value) {
+          auto f1 = [&key, this](MsgPackSerializer &serializer) {
+            return SerializeElement<Key>(serializer, key);
+          };
 
-      auto f2 = [&v, this](MsgPackSerializer &serializer) {
-        return SerializeElement<Value>(serializer, v.second);
-      };
-
-      if (!map_ser.AppendUsingFunction(f1, f2))
-      {
-        return false;
-      }
-    }
+          auto f2 = [&value, this](MsgPackSerializer &serializer) {
+            return SerializeElement<Value>(serializer, value);
+          };
 
-    return true;
+          return map_ser.AppendUsingFunction(f1, f2);
+        });
   }
 
   bool DeserializeFrom(MsgPackSerializer &buffer) override
@@ -195,13 +501,14 @@ struct Map : public IMap
         return false;
       }
 
-      map.insert({key, value});
+      // the first of any duplicated keys is kept
+      map.Insert(key, value);
     }
 
     return true;
   }
 
-  std::map<TemplateParameter1, TemplateParameter2, MapComparator<Key>> map;
+  MapStorage<Key> map;
 
 private:
   template <typename U, typename TemplateParameterType>
@@ -354,6 +661,18 @@ inline Ptr<IMap> IMap::outer(TypeId key_type_id, TypeId value_type_id, VM *vm, T
   {
     return inner<fixed_point::fp64_t, Map>(value_type_id, vm, type_id);
   }
+  case TypeIds::Fixed128:
+  {
+    return inner<Ptr<Fixed128>, Map>(value_type_id, vm, type_id);
+  }
+  case TypeIds::String:
+  {
+    return inner<Ptr<String>, Map>(value_type_id, vm, type_id);
+  }
+  case TypeIds::Address:
+  {
+    return inner<Ptr<Address>, Map>(value_type_id, vm, type_id);
+  }
   default:
   {
     return inner<Ptr<Object>, Map>(value_type_id, vm, type_id);
@@ -470,6 +470,10 @@ public:
   {
     return type_info_array_;
   }
+  const FunctionInfoArray &GetFunctionInfoArray() const
+  {
+    return function_info_array_;
+  }
   const DeserializeConstructorMap &GetDeserializationConstructors() const
   {
     return deserialization_constructors_;
@@ -17,6 +17,7 @@
 //
 //------------------------------------------------------------------------------
 
+#include "vm/arena.hpp"
 #include "vm/common.hpp"
 #include "vm/token.hpp"
 
@@ -117,7 +118,7 @@ using SymbolTablePtr = std::shared_ptr<SymbolTable>;
 
 inline SymbolTablePtr CreateSymbolTable()
 {
-  return std::make_shared<SymbolTable>();
+  return AllocateShared<SymbolTable>();
 }
 
 struct Type : public Symbol
@@ -195,7 +196,7 @@ struct Type : public Symbol
 
 inline TypePtr CreateType(TypeKind type_kind, std::string name)
 {
-  return std::make_shared<Type>(type_kind, std::move(name));
+  return AllocateShared<Type>(type_kind, std::move(name));
 }
 inline TypePtr ConvertToTypePtr(SymbolPtr const &symbol)
 {
@@ -228,8 +229,8 @@ using VariablePtrArray = std::vector<VariablePtr>;
 inline VariablePtr CreateVariable(VariableKind variable_kind, std::string name, TypePtr type,
                                   TypePtr user_defined_type)
 {
-  return std::make_shared<Variable>(variable_kind, std::move(name), std::move(type),
-                                    std::move(user_defined_type));
+  return AllocateShared<Variable>(variable_kind, std::move(name), std::move(type),
+                                  std::move(user_defined_type));
 }
 inline VariablePtr ConvertToVariablePtr(SymbolPtr const &symbol)
 {
@@ -270,9 +271,9 @@ inline FunctionPtr CreateFunction(FunctionKind function_kind, std::string name,
                                   std::string unique_name, TypePtrArray parameter_types,
                                   VariablePtrArray parameter_variables, TypePtr return_type)
 {
-  return std::make_shared<Function>(function_kind, std::move(name), std::move(unique_name),
-                                    std::move(parameter_types), std::move(parameter_variables),
-                                    std::move(return_type));
+  return AllocateShared<Function>(function_kind, std::move(name), std::move(unique_name),
+                                  std::move(parameter_types), std::move(parameter_variables),
+                                  std::move(return_type));
 }
 
 struct FunctionGroup : public Symbol
@@ -297,7 +298,7 @@ using FunctionGroupPtrArray = std::vector<FunctionGroupPtr>;
 
 inline FunctionGroupPtr CreateFunctionGroup(std::string name, TypePtr user_defined_type)
 {
-  return std::make_shared<FunctionGroup>(std::move(name), std::move(user_defined_type));
+  return AllocateShared<FunctionGroup>(std::move(name), std::move(user_defined_type));
 }
 inline FunctionGroupPtr ConvertToFunctionGroupPtr(SymbolPtr const &symbol)
 {
@@ -356,7 +357,7 @@ struct Node
 
 inline NodePtr CreateBasicNode(NodeKind node_kind, std::string text, uint16_t line)
 {
-  return std::make_shared<Node>(NodeCategory::Basic, node_kind, std::move(text), line);
+  return AllocateShared<Node>(NodeCategory::Basic, node_kind, std::move(text), line);
 }
 
 struct BlockNode : public Node
@@ -388,7 +389,7 @@ using BlockNodePtrArray = std::vector<BlockNodePtr>;
 
 inline BlockNodePtr CreateBlockNode(NodeKind node_kind, std::string text, uint16_t line)
 {
-  return std::make_shared<BlockNode>(node_kind, std::move(text), line);
+  return AllocateShared<BlockNode>(node_kind, std::move(text), line);
 }
 
 struct ExpressionNode : public Node
@@ -448,7 +449,7 @@ using ExpressionNodePtrArray = std::vector<ExpressionNodePtr>;
 
 inline ExpressionNodePtr CreateExpressionNode(NodeKind node_kind, std::string text, uint16_t line)
 {
-  return std::make_shared<ExpressionNode>(node_kind, std::move(text), line);
+  return AllocateShared<ExpressionNode>(node_kind, std::move(text), line);
 }
 
 inline BlockNodePtr ConvertToBlockNodePtr(NodePtr const &node)
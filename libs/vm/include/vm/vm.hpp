@@ -381,6 +381,18 @@ public:
     return *io_observer_;
   }
 
+  // Contracts executed for blocks before the UInt256 arithmetic was corrected keep using the
+  // original kernels (see vectorise/uint/legacy.hpp), so that their results do not change
+  void SetLegacyUInt256Arithmetic(bool legacy)
+  {
+    legacy_uint256_arithmetic_ = legacy;
+  }
+
+  bool legacy_uint256_arithmetic() const
+  {
+    return legacy_uint256_arithmetic_;
+  }
+
   std::ostream &GetOutputDevice(std::string const &name)
   {
     if (output_devices_.find(name) == output_devices_.end())
@@ -669,6 +681,7 @@ private:
   ContractInvocationHandler      contract_invocation_handler_{};
   std::ostringstream             output_buffer_;
   IoObserverInterface *          io_observer_{};
+  bool                           legacy_uint256_arithmetic_{false};
   OutputDeviceMap                output_devices_;
   InputDeviceMap                 input_devices_;
   DeserializeConstructorMap      deserialization_constructors_;
@@ -0,0 +1,114 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm/arena.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace fetch {
+namespace vm {
+namespace {
+
+// Requests larger than this get a chunk of their own rather than abandoning the current one
+constexpr std::size_t LARGE_ALLOCATION_SIZE = Arena::MAX_CHUNK_SIZE / 4;
+
+ArenaPtr &CurrentArena()
+{
+  static thread_local ArenaPtr arena;
+  return arena;
+}
+
+}  // namespace
+
+constexpr std::size_t Arena::INITIAL_CHUNK_SIZE;
+constexpr std::size_t Arena::MAX_CHUNK_SIZE;
+
+/**
+ * Create an arena whose memory is released once the last of its owners and of the objects
+ * allocated from it have gone
+ *
+ * @param initial_chunk_size The size of the first chunk, later chunks double in size
+ * @return The new arena
+ */
+ArenaPtr Arena::Create(std::size_t initial_chunk_size)
+{
+  return ArenaPtr{new Arena{initial_chunk_size}, [](Arena *arena) { arena->Release(); }};
+}
+
+Arena::Arena(std::size_t initial_chunk_size)
+  : next_chunk_size_{initial_chunk_size}
+{}
+
+std::size_t Arena::allocated() const
+{
+  return allocated_;
+}
+
+std::size_t Arena::reserved() const
+{
+  return reserved_;
+}
+
+void *Arena::AllocateFromNewChunk(std::size_t size, std::size_t alignment)
+{
+  std::size_t const required = size + alignment - 1;
+
+  if (required > LARGE_ALLOCATION_SIZE)
+  {
+    chunks_.emplace_back(new uint8_t[required]);
+    reserved_ += required;
+    allocated_ += size;
+
+    auto const start = reinterpret_cast<std::uintptr_t>(chunks_.back().get());
+    return reinterpret_cast<void *>((start + alignment - 1) &
+                                    ~(static_cast<std::uintptr_t>(alignment) - 1));
+  }
+
+  std::size_t const chunk_size = std::max(next_chunk_size_, required);
+  next_chunk_size_             = std::min(next_chunk_size_ * 2, MAX_CHUNK_SIZE);
+
+  chunks_.emplace_back(new uint8_t[chunk_size]);
+  reserved_ += chunk_size;
+  head_ = chunks_.back().get();
+  tail_ = head_ + chunk_size;
+
+  return Allocate(size, alignment);
+}
+
+ArenaScope::ArenaScope(ArenaPtr arena)
+  : previous_{std::move(CurrentArena())}
+{
+  CurrentArena() = std::move(arena);
+}
+
+ArenaScope::~ArenaScope()
+{
+  CurrentArena() = std::move(previous_);
+}
+
+ArenaPtr const &ArenaScope::Current()
+{
+  return CurrentArena();
+}
+
+}  // namespace vm
+}  // namespace fetch
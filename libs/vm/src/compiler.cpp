@@ -16,6 +16,7 @@
 //
 //------------------------------------------------------------------------------
 
+#include "vm/arena.hpp"
 #include "vm/compiler.hpp"
 #include "vm/module.hpp"
 
@@ -39,6 +40,10 @@ Compiler::~Compiler()
 bool Compiler::Compile(SourceFiles const &files, std::string const &ir_name, IR &ir,
                        std::vector<std::string> &errors)
 {
+  // The syntax tree, the symbols and types it defines and the resulting IR are all allocated
+  // from one arena, which is released as a whole once the last of them has been destroyed
+  ArenaScope const scope{Arena::Create()};
+
   BlockNodePtr root = parser_.Parse(files, errors);
   if (!root)
   {
@@ -101,7 +101,7 @@ void Parser::Tokenise(std::string const &source)
   do
   {
     value = yylex(&token, scanner);
-    tokens_.push_back(token);
+    tokens_.push_back(std::move(token));
   } while (value != 0);
   if (token.kind != Token::Kind::EndOfInput)
   {
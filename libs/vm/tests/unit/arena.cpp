@@ -0,0 +1,118 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm/arena.hpp"
+#include "vm/node.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace {
+
+using fetch::vm::AllocateShared;
+using fetch::vm::Arena;
+using fetch::vm::ArenaScope;
+using fetch::vm::CreateExpressionNode;
+using fetch::vm::NodeKind;
+
+TEST(ArenaTests, allocations_are_aligned_and_packed_into_chunks)
+{
+  auto arena = Arena::Create(1024);
+
+  for (std::size_t alignment : {1u, 2u, 4u, 8u, 16u})
+  {
+    void *pointer = arena->Allocate(3, alignment);
+    ASSERT_NE(pointer, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pointer) % alignment, 0);
+  }
+
+  EXPECT_EQ(arena->allocated(), 15);
+  EXPECT_EQ(arena->reserved(), 1024);
+
+  // large allocations get a chunk of their own...
+  arena->Allocate(100000, 8);
+  EXPECT_EQ(arena->allocated(), 100015);
+  EXPECT_EQ(arena->reserved(), 1024 + 100007);
+
+  // ...leaving the current chunk in use for smaller ones
+  arena->Allocate(64, 8);
+  EXPECT_EQ(arena->reserved(), 1024 + 100007);
+
+  // subsequent chunks double in size
+  arena->Allocate(1000, 8);
+  EXPECT_EQ(arena->reserved(), 1024 + 100007 + 2048);
+}
+
+TEST(ArenaTests, allocate_shared_only_uses_the_arena_of_the_active_scope)
+{
+  auto arena = Arena::Create();
+
+  CreateExpressionNode(NodeKind::Identifier, "x", 1);
+  EXPECT_EQ(arena->allocated(), 0);
+
+  {
+    ArenaScope const scope{arena};
+    EXPECT_EQ(ArenaScope::Current(), arena);
+
+    auto node = CreateExpressionNode(NodeKind::Identifier, "y", 2);
+    EXPECT_GT(arena->allocated(), sizeof(*node));
+    EXPECT_EQ(node->text, "y");
+
+    {
+      auto                 inner = Arena::Create();
+      ArenaScope const     inner_scope{inner};
+      std::shared_ptr<int> value = AllocateShared<int>(42);
+      EXPECT_EQ(*value, 42);
+      EXPECT_GT(inner->allocated(), 0);
+    }
+
+    EXPECT_EQ(ArenaScope::Current(), arena);
+  }
+
+  EXPECT_EQ(ArenaScope::Current(), nullptr);
+
+  auto const allocated = arena->allocated();
+  CreateExpressionNode(NodeKind::Identifier, "z", 3);
+  EXPECT_EQ(arena->allocated(), allocated);
+}
+
+TEST(ArenaTests, objects_keep_their_arena_alive)
+{
+  std::shared_ptr<std::string> text;
+  std::shared_ptr<std::string> other_text;
+
+  {
+    ArenaScope const scope{Arena::Create()};
+    text       = AllocateShared<std::string>("a string long enough not to be stored in place");
+    other_text = AllocateShared<std::string>("another string which outlives the arena owner");
+  }
+
+  EXPECT_EQ(*text, "a string long enough not to be stored in place");
+
+  // copies made after the last owner has gone still share the same block
+  auto const copy = other_text;
+  other_text.reset();
+  text.reset();
+  EXPECT_EQ(*copy, "another string which outlives the arena owner");
+}
+
+}  // namespace
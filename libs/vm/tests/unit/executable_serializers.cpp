@@ -0,0 +1,114 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2020 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/serializers/main_serializer.hpp"
+#include "vm/compiler.hpp"
+#include "vm/executable_serializers.hpp"
+#include "vm/module.hpp"
+#include "vm/vm.hpp"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using fetch::serializers::MsgPackSerializer;
+using fetch::vm::Compiler;
+using fetch::vm::Executable;
+using fetch::vm::IR;
+using fetch::vm::Module;
+using fetch::vm::Variant;
+using fetch::vm::VM;
+
+const std::string SOURCE = R"(
+function scale(value : Int64) : Int64
+  var factor = 3.5fp128;
+  if (factor > 3.0fp128)
+    return value * 3i64;
+  endif
+  return value;
+endfunction
+
+function main() : Int64
+  var name = "executable";
+  var total = 0i64;
+  for (i in 0:10)
+    total += scale(toInt64(i));
+  endfor
+  return total + toInt64(name.length());
+endfunction
+)";
+
+TEST(ExecutableSerializerTests, RestoredExecutableRunsTheSame)
+{
+  auto     module = std::make_shared<Module>();
+  Compiler compiler{module.get()};
+
+  IR                       ir;
+  std::vector<std::string> errors;
+  ASSERT_TRUE(compiler.Compile({{"default.etch", SOURCE}}, "default_ir", ir, errors));
+
+  VM         vm{module.get()};
+  Executable executable;
+  ASSERT_TRUE(vm.GenerateExecutable(ir, "default_exe", executable, errors));
+
+  MsgPackSerializer serializer;
+  serializer << executable;
+
+  MsgPackSerializer deserializer{serializer.data()};
+  Executable        restored;
+  deserializer >> restored;
+
+  ASSERT_EQ(restored.functions.size(), executable.functions.size());
+  EXPECT_EQ(restored.strings, executable.strings);
+  EXPECT_EQ(restored.large_constants.size(), executable.large_constants.size());
+  EXPECT_EQ(restored.types.size(), executable.types.size());
+
+  for (std::size_t i = 0; i < executable.functions.size(); ++i)
+  {
+    auto const &original = executable.functions[i];
+    auto const &copy     = restored.functions[i];
+
+    EXPECT_EQ(copy.name, original.name);
+    EXPECT_EQ(copy.num_parameters, original.num_parameters);
+    EXPECT_EQ(copy.num_variables, original.num_variables);
+    EXPECT_EQ(copy.pc_to_line_map, original.pc_to_line_map);
+    ASSERT_EQ(copy.instructions.size(), original.instructions.size());
+
+    for (std::size_t pc = 0; pc < original.instructions.size(); ++pc)
+    {
+      EXPECT_EQ(copy.instructions[pc].opcode, original.instructions[pc].opcode);
+      EXPECT_EQ(copy.instructions[pc].type_id, original.instructions[pc].type_id);
+      EXPECT_EQ(copy.instructions[pc].index, original.instructions[pc].index);
+      EXPECT_EQ(copy.instructions[pc].data, original.instructions[pc].data);
+    }
+  }
+
+  std::string error;
+  Variant     expected;
+  Variant     output;
+  ASSERT_TRUE(vm.Execute(executable, "main", error, expected));
+  ASSERT_TRUE(vm.Execute(restored, "main", error, output));
+  EXPECT_EQ(output.Get<int64_t>(), 145);
+  EXPECT_EQ(output.Get<int64_t>(), expected.Get<int64_t>());
+}
+
+}  // namespace